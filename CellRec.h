@@ -12,6 +12,8 @@
 		1) StateEnum will have at least two values, OPEN and OUT_OF_BOUNDS
 		2) The CellRec will have as a parameter a StateEnum called status
 		3) A typdef CellRec** named Board will also be here
+		4) A cell's cost is between DEFAULT_CELL_COST and MAX_CELL_COST, walls have one too but
+		   are never moved into
 */
 
 #include "Constants.h"  // File containing appropriate constants
@@ -20,7 +22,8 @@
 // Struct to be stored in the gameboard
 struct CellRec
 {
-	StateEnum status;	// Gives the current status of the cell
+	StateEnum status;		// Gives the current status of the cell
+	unsigned char cost;		// The cost of moving into the cell, for the cheapest path
 };
 
 
@@ -16,10 +16,11 @@ using namespace std;    // Standard namespace
 enum DirectionEnum { NA, NORTH, EAST, SOUTH, WEST };
 
 // Enum to specify the state a cell is in
-enum StateEnum { OPEN, OUT_OF_BOUNDS, VISITED, WALL };
+// Held in one byte so a cell's status and cost take two bytes
+enum StateEnum : unsigned char { OPEN, OUT_OF_BOUNDS, VISITED, WALL };
 
 
-// Struct to contain an x y z position
+// Struct to contain an x y position, a layered maze uses LocationNDRec (see boardnd.h)
 struct Location2DRec
 {
     int x;     // The row position
@@ -33,9 +34,27 @@ const int DEFAULT_COLS = 5;         // The default maximum amount of columns
 const int ZERO = 0;                 // A lower index bound
 const int OFFSET = 1;               // Amount to offset a number by one
 const int CHAR_AFTER_PERIOD = 3;    // The number of characters after a period for a file name
+const int DEFAULT_CHECKPOINT_SECS = 300;    // The default number of seconds between checkpoints
+const int CLOCK_CHECK_STEPS = 4096;         // The number of search steps between clock checks
+const int DEFAULT_REPLAY_SPEED = 10;        // The default number of trace events replayed a second
+const int DEFAULT_SHARD_MB = 64;            // The default size a shard of the paths is closed at, in megabytes
+const long long BYTES_PER_MB = 1048576LL;   // The number of bytes in a megabyte
+const long long NANOS_PER_SEC = 1000000000LL;   // The number of nanoseconds in a second
+const int DEFAULT_CELL_COST = 1;            // The cost of moving into a cell the input file gives no cost for
+const int MAX_CELL_COST = 15;               // The highest cost a cell may have
+const int WORD_BITS = 64;                   // The number of cells packed into a bitmap word
+const int WORD_SHIFT = 6;                   // Turns a cell into its bitmap word
+const int BIT_MASK = 63;                    // Turns a cell into its bit in the word
+const long long PRINT_CELLS_MAX = 1048576LL;    // The most cells a board printed to the console may have
 
 
 const Location2DRec START_POS = { 0 , 0 };	// The x and y coordinate of the starting position
 
 const string EXIT_DIR = "S";                // The direction taken to exit the gameboard
-const string OUTPUT_FILE = "solution.out";  // The name of the output file
\ No newline at end of file
+const string START_TAG = "START";           // Begins an input file line giving the entrance
+const string EXIT_TAG = "EXIT";             // Begins an input file line giving an exit
+const string COST_TAG = "COST";             // Begins an input file line giving a cell's cost
+const string WALL_TAG = "WALL";             // Begins an edit file line putting up a wall
+const string OPEN_TAG = "OPEN";             // Begins an edit file line taking down a wall
+const string OUTPUT_FILE = "solution.out";  // The name of the output file
+const string CHECKPOINT_FILE = "solution.ckp";  // The default name of the checkpoint file
\ No newline at end of file
@@ -0,0 +1,186 @@
+// Project Maze
+// FileName : boardimage.cpp
+// Author: Christian Siletti
+// Purpose : This file contains the implementation for the functions
+//			 defined in boardimage.h
+
+#include "boardimage.h"		// The header file
+#include <fstream>			// For image file access
+#include <algorithm>		// For copying a colour into a pixel
+#include <cmath>			// For the heatmap's log scale
+#include <new>				// Contains the bad_alloc exception
+
+using namespace std;	// Standard Namespace
+
+
+const int PIXEL_BYTES = 3;			// The red, green and blue bytes of a pixel
+const int MAX_COLOUR = 255;			// The brightest a colour byte can be
+
+const unsigned char OPEN_COLOUR[] = { 255, 255, 255 };	// A blank cell is white
+const unsigned char WALL_COLOUR[] = { 205, 49, 49 };	// A wall is red, like the console's X
+const unsigned char PATH_COLOUR[] = { 13, 188, 121 };	// The path is green, like the console's 0
+const unsigned char HEAD_COLOUR[] = { 0, 100, 0 };		// The head is a darker green
+const unsigned char GRID_COLOUR[] = { 160, 160, 160 };	// The cell borders are grey
+const unsigned char HEAT_WALL_COLOUR[] = { 64, 64, 64 };	// A wall in a heatmap is dark grey
+const unsigned char HEAT_LOW_COLOUR[] = { 255, 255, 160 };	// The lowest count in a heatmap is pale yellow
+const unsigned char HEAT_HIGH_COLOUR[] = { 180, 0, 0 };		// The highest count in a heatmap is deep red
+
+
+
+// O(N^2)
+// Purpose: Write an image of a board with each cell in a colour of its own
+// Pre: The size of the board and PIXEL_BYTES colour bytes for each cell in row major order
+// Post: The image file holds each cell as a square of its colour with a grey border along its
+//		 top and left, and a border closing off the bottom and right. true is returned on success
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+static bool WriteCellImage(/*IN*/const string& fileName,					// The image file
+						   /*IN*/const int& rows,							// Number of rows in the board
+						   /*IN*/const int& cols,							// Number of columns in the board
+						   /*IN*/const vector<unsigned char>& colourArr)		// Each cell's colour, row major
+{
+	ofstream fout;					// The image file writer
+	vector<unsigned char> pixelArr;	// The image's pixels, row major
+	const unsigned char* colour;	// The colour of the pixel being drawn
+	int width = cols * IMAGE_CELL_PIXELS + OFFSET;	// The width of the image in pixels
+	int height = rows * IMAGE_CELL_PIXELS + OFFSET;	// The height of the image in pixels
+
+	try
+	{
+		pixelArr.resize((size_t)width * height * PIXEL_BYTES);
+	}
+	catch (std::bad_alloc)	// The heap space memory has run out
+	{
+		// Throw the exception
+		throw GBOutOfMemoryException();
+	}
+
+	// Colour each pixel by the cell it is in, the first row and column of a cell are its border
+	for (int py = ZERO; py < height; py++)
+		for (int px = ZERO; px < width; px++)
+		{
+			if (py % IMAGE_CELL_PIXELS == ZERO || px % IMAGE_CELL_PIXELS == ZERO)
+				colour = GRID_COLOUR;
+			else
+				colour = &colourArr[((size_t)(py / IMAGE_CELL_PIXELS) * cols + px / IMAGE_CELL_PIXELS) * PIXEL_BYTES];
+
+			copy(colour, colour + PIXEL_BYTES, pixelArr.begin() + ((size_t)py * width + px) * PIXEL_BYTES);
+		}
+
+	// Write the header and the pixels
+	fout.open(fileName, ios::binary | ios::trunc);
+	fout << "P6\n" << width << " " << height << "\n" << MAX_COLOUR << "\n";
+	fout.write(reinterpret_cast<const char*>(pixelArr.data()), pixelArr.size());
+	fout.close();
+
+	return (bool)fout;
+
+}// end WriteCellImage
+
+
+
+// O(N^2)
+// Pre: The board with its walls set and its path VISITED, and the head of the path,
+//		a location off the board for no head
+// Post: The image file holds the board, true is returned on success
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+bool SaveBoardImage(/*IN*/const string& fileName,			// The image file
+					/*IN*/const GameBoard& board,			// The gameboard whose path is being saved
+					/*IN*/const Location2DRec& headLoc)		// The location of the head of the path
+{
+	vector<unsigned char> colourArr;	// Each cell's colour, row major
+	Location2DRec loc;					// The cell being coloured
+	const unsigned char* colour;		// The colour of the cell
+	int rows;							// Number of rows in the gameboard
+	int cols;							// Number of columns in the gameboard
+
+	board.GetSize(rows, cols);
+
+	try
+	{
+		colourArr.resize((size_t)rows * cols * PIXEL_BYTES);
+	}
+	catch (std::bad_alloc)	// The heap space memory has run out
+	{
+		// Throw the exception
+		throw GBOutOfMemoryException();
+	}
+
+	// Colour each cell the way PrintCurrentPath draws it
+	for (loc.x = ZERO; loc.x < rows; loc.x++)
+		for (loc.y = ZERO; loc.y < cols; loc.y++)
+		{
+			if (loc.x == headLoc.x && loc.y == headLoc.y)
+				colour = HEAD_COLOUR;
+			else
+			{
+				switch (board.GetStatus(loc))
+				{
+				case WALL: colour = WALL_COLOUR; break;
+				case VISITED: colour = PATH_COLOUR; break;
+				default: colour = OPEN_COLOUR; break;
+				};
+			}
+
+			copy(colour, colour + PIXEL_BYTES, colourArr.begin() + ((size_t)loc.x * cols + loc.y) * PIXEL_BYTES);
+		}
+
+	return WriteCellImage(fileName, rows, cols, colourArr);
+
+}// end SaveBoardImage
+
+
+
+// O(N^2)
+// Pre: The board with its walls set and a count for each of its cells in row major order
+// Post: The image file holds the heatmap, true is returned on success
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+bool SaveHeatmapImage(/*IN*/const string& fileName,				// The image file
+					  /*IN*/const GameBoard& board,				// The gameboard the counts were kept for
+					  /*IN*/const vector<long long>& countArr)		// Each cell's count, row major
+{
+	vector<unsigned char> colourArr;	// Each cell's colour, row major
+	Location2DRec loc;					// The cell being coloured
+	long long maxCount = ZERO;			// The highest count of any cell
+	double heat;						// How far a cell's count is up the scale, 0 to 1
+	size_t cell;						// A cell's row major index
+	int rows;							// Number of rows in the gameboard
+	int cols;							// Number of columns in the gameboard
+
+	board.GetSize(rows, cols);
+
+	try
+	{
+		colourArr.resize((size_t)rows * cols * PIXEL_BYTES);
+	}
+	catch (std::bad_alloc)	// The heap space memory has run out
+	{
+		// Throw the exception
+		throw GBOutOfMemoryException();
+	}
+
+	// Find the top of the scale
+	for (size_t i = ZERO; i < countArr.size(); i++)
+		maxCount = max(maxCount, countArr[i]);
+
+	// Colour each cell by where its count is on a log scale from 1 to the highest count
+	for (loc.x = ZERO; loc.x < rows; loc.x++)
+		for (loc.y = ZERO; loc.y < cols; loc.y++)
+		{
+			cell = (size_t)loc.x * cols + loc.y;
+
+			if (board.GetStatus(loc) == WALL)
+				copy(HEAT_WALL_COLOUR, HEAT_WALL_COLOUR + PIXEL_BYTES, colourArr.begin() + cell * PIXEL_BYTES);
+			else if (countArr[cell] == ZERO)
+				copy(OPEN_COLOUR, OPEN_COLOUR + PIXEL_BYTES, colourArr.begin() + cell * PIXEL_BYTES);
+			else
+			{
+				heat = (maxCount > OFFSET) ? log((double)countArr[cell]) / log((double)maxCount) : ZERO;
+				for (int i = ZERO; i < PIXEL_BYTES; i++)
+					colourArr[cell * PIXEL_BYTES + i] =
+						(unsigned char)(HEAT_LOW_COLOUR[i] + (HEAT_HIGH_COLOUR[i] - HEAT_LOW_COLOUR[i]) * heat + 0.5);
+			}
+		}
+
+	return WriteCellImage(fileName, rows, cols, colourArr);
+
+}// end SaveHeatmapImage
@@ -0,0 +1,72 @@
+#pragma once
+/*
+	FileName : boardimage.h
+	Author: Christian Siletti
+	Date: 4/28/24
+	Project Maze
+
+	PURPOSE:
+		Contains the specification for saving a gameboard and the path on it as an image,
+		the same picture PrintCurrentPath draws on the console: red walls, a green path and
+		a darker green head. Each cell is a square of IMAGE_CELL_PIXELS pixels with a grey
+		border along its top and left, and the image has a border closing off the bottom and right.
+
+		A board can also be saved as a heatmap of a count kept for each cell, such as the number
+		of paths through it. Cells with a count run from pale yellow for the lowest to deep red for
+		the highest on a log scale, so the few busiest cells do not wash out the rest. Cells with
+		a count of zero are white and walls are dark grey.
+
+		The image is a binary PPM (P6), which needs no library to write and opens in most
+		image viewers and converters.
+
+
+	ASSUMPTIONS:
+		1) Cells on the path are VISITED, the head of the path is given on its own
+
+
+	EXCEPTION HANDLING/ERROR CHECKING:
+		1) SaveBoardImage returns false if the image file could not be written.
+		2) GBOutOfMemoryException thrown when memory from the heap has run out
+
+
+						   SUMMARY OF FUNCTIONS:
+	bool SaveBoardImage(*IN*const string& fileName,			// The image file
+						*IN*const GameBoard& board,			// The gameboard whose path is being saved
+						*IN*const Location2DRec& headLoc)	// The location of the head of the path
+		- Save the board and the path on it to an image file
+	bool SaveHeatmapImage(*IN*const string& fileName,				// The image file
+						  *IN*const GameBoard& board,				// The gameboard the counts were kept for
+						  *IN*const vector<long long>& countArr)	// Each cell's count, row major
+		- Save the board as a heatmap of a count kept for each cell
+*/
+
+#include "gameboard.h"		// Allows access to the gameboard ADT
+#include <vector>			// For the cell counts
+
+using namespace std;    // Standard namespace
+
+
+const int IMAGE_CELL_PIXELS = 16;	// The width and height of a cell in the image
+
+
+
+// O(N^2)
+// Purpose: Save the board and the path on it to an image file
+// Pre: The board with its walls set and its path VISITED, and the head of the path,
+//		a location off the board for no head
+// Post: The image file holds the board, true is returned on success
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+bool SaveBoardImage(/*IN*/const string& fileName,			// The image file
+					/*IN*/const GameBoard& board,			// The gameboard whose path is being saved
+					/*IN*/const Location2DRec& headLoc);	// The location of the head of the path
+
+
+
+// O(N^2)
+// Purpose: Save the board as a heatmap of a count kept for each cell
+// Pre: The board with its walls set and a count for each of its cells in row major order
+// Post: The image file holds the heatmap, true is returned on success
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+bool SaveHeatmapImage(/*IN*/const string& fileName,				// The image file
+					  /*IN*/const GameBoard& board,				// The gameboard the counts were kept for
+					  /*IN*/const vector<long long>& countArr);	// Each cell's count, row major
@@ -0,0 +1,374 @@
+#pragma once
+/*
+	FileName : boardnd.h
+	Author: Christian Siletti
+	Date: 5/4/24
+	Project Maze
+
+	PURPOSE:
+		Contains the specifications for a BoardND Class template, along with the location, layout
+		and direction set it is walked with. A BoardND is a gameboard with DIMS dimensions, so a
+		layered (multi floor) maze is a BoardND<3> whose third coordinate is the floor.
+
+		Each of the DIMS axes is left in two directions, so a board has 2 * DIMS moves. They are
+		searched in the order N, E, S, W, then U and D (up and down a floor), then A and K
+		(ana and kata, along the fourth axis). N, E, S and W move along the rows and columns
+		exactly as they do on a GameBoard, so a board with one floor is searched the same way.
+
+		The cells are held in one flat array with a border of WALL cells around every axis, and
+		each direction is a fixed offset in that array, so the search steps to a neighbour with
+		one add and checks it with one load without any bounds checks. DIMS is known when the
+		program is compiled, so the loop over the directions has a fixed length.
+
+
+	ASSUMPTIONS:
+		1) DIMS is between 2 and ND_DIMS_MAX, every size is at least one
+		2) Only the OPEN, VISITED and WALL statuses are stored, every cell starts OPEN
+		3) The first coordinate is the row, the second the column, the third the floor.
+		   U moves to the floor above (the third coordinate goes up), D to the one below
+
+
+	EXCEPTION HANDLING/ERROR CHECKING:
+		1) If an invalid location is sent into GetStatus a OUT_OF_BOUNDS status will be returned.
+		2) If an invalid location is sent into SetStatus the status of the location will not change,
+		   the program will move on. Setting OUT_OF_BOUNDS is also ignored.
+		3) A board with an unsupported number of dimensions will not compile.
+		4) GBOutOfMemoryException thrown when memory from the heap has run out
+
+
+						   SUMMARY OF METHODS:
+	PUBLIC METHODS
+		BoardND(*IN*const int sizes[DIMS])		// The number of cells along each axis
+					- Instantiate a board of the given size with every cell OPEN
+		StateEnum GetStatus(*IN*const LocationNDRec<DIMS>& loc) const	// The desired cell's coordinate
+					- To return the status of a specified cell
+		void SetStatus(*IN*const LocationNDRec<DIMS>& loc,	// The desired cell's coordinate
+					   *IN*const StateEnum& newStatus)		// The cells new status
+					- To change the status of a desired location
+		void GetSize(*OUT*int sizes[DIMS]) const	// The location to store the size of each axis
+					- To return the size of the board
+		int GetCellCount() const - Return the number of cells in the array, the border included
+		int GetCell(*IN*const LocationNDRec<DIMS>& loc) const	// The cell's coordinate
+					- Return a cell's index in the array
+		int GetStep(*IN*const int& dir) const		// The direction moved in
+					- Return how far a move is in the array
+		StateEnum GetCellStatus(*IN*const int& cell) const		// The cell's index
+					- Return the status of a cell by its index
+		void SetCellStatus(*IN*const int& cell,				// The cell's index
+						   *IN*const StateEnum& newStatus)	// The cells new status
+					- Change the status of a cell by its index
+
+
+	PRIVATE MEMBERS:
+		int sizeArr[DIMS];				// The number of cells along each axis
+		int strideArr[DIMS];			// How far one step along each axis is in the array
+		int stepArr[2 * DIMS];			// How far each direction's move is in the array
+		vector<unsigned char> cellArr;	// Every cell's status, the border included
+
+
+						   SUMMARY OF FUNCTIONS:
+	int DirCountND(*IN*const int& dims)		// The number of dimensions
+		- Return the number of directions a board with some number of dimensions is searched in
+	LocationNDRec<DIMS> MoveND(*IN*const int& dir,						// The direction moved in
+							   *IN*const LocationNDRec<DIMS>& currPos)	// The current location
+		- Move a location one cell in a direction
+	const char* DirTextND(*IN*const int& dir)		// The direction travelled
+		- Get the text printed for a direction in a path, the letter followed by a "-"
+	int DirFromText(*IN*const string& text,		// The direction's letter
+					*IN*const int& dims)		// The number of dimensions
+		- Return the direction a letter stands for
+*/
+
+#include "Constants.h"		// File containing appropriate constants
+#include "gbExceptions.h"	// Holds the out of memory exception
+#include <vector>			// For the cells
+#include <new>				// Contains the bad_alloc exception
+
+using namespace std;    // Standard namespace
+
+
+const int ND_DIMS_MIN = 2;		// The fewest dimensions a BoardND has
+const int ND_DIMS_MAX = 4;		// The most dimensions a BoardND has
+const int ND_BORDER = 1;		// The WALL cells on either end of every axis
+const int NO_DIR = -1;			// The direction of a letter that is not one of the board's
+const int LAYERED_DIMS = 3;		// The dimensions of a layered maze, its rows, columns and floors
+const int ND_AXIS_ARR[2 * ND_DIMS_MAX] = { 0, 1, 0, 1, 2, 2, 3, 3 };		// The axis each direction moves along
+const int ND_SIGN_ARR[2 * ND_DIMS_MAX] = { -1, 1, 1, -1, 1, -1, 1, -1 };	// Which way along its axis it moves
+const char* const ND_DIR_TEXT[2 * ND_DIMS_MAX] = { "N-", "E-", "S-", "W-", "U-", "D-", "A-", "K-" };	// The printed directions
+
+
+// A cell's position on a board of DIMS dimensions
+template <int DIMS>
+struct LocationNDRec
+{
+	int pos[DIMS];		// The row, the column, then the floor and any axes after it
+};
+
+
+// A cell a board of DIMS dimensions can be left from
+template <int DIMS>
+struct ExitNDRec
+{
+	LocationNDRec<DIMS> loc;	// The exit cell
+	string dir;					// The direction taken to leave the board from the exit cell
+};
+
+
+// Where a board of DIMS dimensions is entered and left
+template <int DIMS>
+struct LayoutNDRec
+{
+	LocationNDRec<DIMS> start;			// The cell every path starts on
+	vector<ExitNDRec<DIMS> > exits;		// The cells paths can finish on, in the order they were read in
+};
+
+
+
+// O(1)
+// Purpose: Return the number of directions a board with some number of dimensions is searched in
+// Pre: The number of dimensions
+// Post: Two directions per axis are returned
+constexpr int DirCountND(/*IN*/const int& dims)		// The number of dimensions
+{
+	return dims + dims;
+
+}// end DirCountND
+
+
+
+template <int DIMS>
+class BoardND
+{
+	static_assert(DIMS >= ND_DIMS_MIN && DIMS <= ND_DIMS_MAX, "BoardND dimensions are not supported");
+
+public:
+
+	// O(N) - Non Default Constructor
+	// Purpose: Instantiate a board of the given size with every cell OPEN
+	// Pre: The number of cells along each axis, each at least one
+	// Post: A board of the given size is created, every cell's status is set to OPEN
+	//		 and the border around it to WALL
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	BoardND(/*IN*/const int sizes[DIMS])		// The number of cells along each axis
+	{
+		int stride = OFFSET;	// How far one step along the axis being set up is
+		int cell;				// The index of the cell being set up
+		int rest;				// The cell's position along an axis, the border included
+		bool border;			// Holds if the cell is on the border
+
+		// The columns are next to each other, then the rows, then the floors and any axes after
+		sizeArr[OFFSET] = sizes[OFFSET];
+		strideArr[OFFSET] = stride;
+		stride *= sizes[OFFSET] + ND_BORDER + ND_BORDER;
+		sizeArr[ZERO] = sizes[ZERO];
+		strideArr[ZERO] = stride;
+		stride *= sizes[ZERO] + ND_BORDER + ND_BORDER;
+		for (int a = ND_DIMS_MIN; a < DIMS; a++)
+		{
+			sizeArr[a] = sizes[a];
+			strideArr[a] = stride;
+			stride *= sizes[a] + ND_BORDER + ND_BORDER;
+		}
+
+		// Each direction moves one stride along its axis
+		for (int d = ZERO; d < DirCountND(DIMS); d++)
+			stepArr[d] = ND_SIGN_ARR[d] * strideArr[ND_AXIS_ARR[d]];
+
+		try
+		{
+			cellArr.assign(stride, (unsigned char)OPEN);
+		}
+		catch (std::bad_alloc)	// The heap space memory has run out
+		{
+			// Throw the exception
+			throw GBOutOfMemoryException();
+		}
+
+		// Wall in every cell on the border of any axis
+		for (cell = ZERO; cell < stride; cell++)
+		{
+			border = false;
+			for (int a = ZERO; a < DIMS; a++)
+			{
+				rest = (cell / strideArr[a]) % (sizeArr[a] + ND_BORDER + ND_BORDER);
+				border = border || rest < ND_BORDER || rest >= sizeArr[a] + ND_BORDER;
+			}
+			if (border)
+				cellArr[cell] = (unsigned char)WALL;
+		}
+
+	}// end NDC
+
+
+
+	// O(DIMS) - Observer Accessor
+	// Purpose: To return the status of a specified cell
+	// Pre: The coordinate of the desired cell
+	// Post: The status of the cell will be returned if loc is within the bounds of the board.
+	//       If loc is outside the bounds of the board the status OUT_OF_BOUNDS will be returned
+	StateEnum GetStatus(/*IN*/const LocationNDRec<DIMS>& loc) const	// The desired cell's coordinate
+	{
+		// A negative coordinate wraps around to a large unsigned one, so one compare covers both ends
+		for (int a = ZERO; a < DIMS; a++)
+			if ((unsigned)loc.pos[a] >= (unsigned)sizeArr[a])
+				return OUT_OF_BOUNDS;
+
+		return (StateEnum)cellArr[GetCell(loc)];
+
+	}// end GetStatus
+
+
+
+	// O(DIMS) - Mutator
+	// Purpose: To change the status of a desired location
+	// Pre: The coordinate of the desired cell
+	//      The status the cell is to be updated to
+	// Post: If loc is within the board the status of the desired cell
+	//       will be updated to the new status.
+	//       If loc is outside the board nothing will occur
+	void SetStatus(/*IN*/const LocationNDRec<DIMS>& loc,	// The desired cell's coordinate
+				   /*IN*/const StateEnum& newStatus)		// The cells new status
+	{
+		// Check if the cooridnate is within the bounds of the board
+		if (GetStatus(loc) == OUT_OF_BOUNDS || newStatus == OUT_OF_BOUNDS)
+			return;
+
+		cellArr[GetCell(loc)] = (unsigned char)newStatus;
+
+	}// end SetStatus
+
+
+
+	// O(DIMS) - Observer Accessor
+	// Purpose: To return the size of the board
+	// Pre: N/A
+	// Post: The number of cells along each axis will be stored into the incoming sizes
+	void GetSize(/*OUT*/int sizes[DIMS]) const	// The location to store the size of each axis
+	{
+		for (int a = ZERO; a < DIMS; a++)
+			sizes[a] = sizeArr[a];
+
+	}// end GetSize
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return the number of cells in the array, the border included
+	// Pre: N/A
+	// Post: One more than the largest cell index is returned
+	int GetCellCount() const
+	{
+		return (int)cellArr.size();
+
+	}// end GetCellCount
+
+
+
+	// O(DIMS) - Observer Accessor
+	// Purpose: Return a cell's index in the array
+	// Pre: The cell is on the board
+	// Post: The index the cell's status is held at is returned
+	int GetCell(/*IN*/const LocationNDRec<DIMS>& loc) const	// The cell's coordinate
+	{
+		int cell = ZERO;	// The index being built
+
+		for (int a = ZERO; a < DIMS; a++)
+			cell += (loc.pos[a] + ND_BORDER) * strideArr[a];
+
+		return cell;
+
+	}// end GetCell
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return how far a move is in the array
+	// Pre: 0 <= dir < DirCountND(DIMS)
+	// Post: The index of the cell moved into less the index of the cell moved from is returned
+	int GetStep(/*IN*/const int& dir) const		// The direction moved in
+	{
+		return stepArr[dir];
+
+	}// end GetStep
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return the status of a cell by its index
+	// Pre: 0 <= cell < GetCellCount()
+	// Post: The cell's status is returned, WALL for the border
+	StateEnum GetCellStatus(/*IN*/const int& cell) const		// The cell's index
+	{
+		return (StateEnum)cellArr[cell];
+
+	}// end GetCellStatus
+
+
+
+	// O(1) - Mutator
+	// Purpose: Change the status of a cell by its index
+	// Pre: The index of a cell on the board, not the border
+	// Post: The cell's status is set to the new status
+	void SetCellStatus(/*IN*/const int& cell,				// The cell's index
+					   /*IN*/const StateEnum& newStatus)		// The cells new status
+	{
+		cellArr[cell] = (unsigned char)newStatus;
+
+	}// end SetCellStatus
+
+
+
+private:
+	int sizeArr[DIMS];				// The number of cells along each axis
+	int strideArr[DIMS];			// How far one step along each axis is in the array
+	int stepArr[2 * DIMS];			// How far each direction's move is in the array
+	vector<unsigned char> cellArr;	// Every cell's status, the border included
+
+};
+
+
+
+// O(1)
+// Purpose: Move a location one cell in a direction
+// Pre: 0 <= dir < DirCountND(DIMS) and the current location
+// Post: The location one cell along the direction's axis is returned, it may be off the board
+template <int DIMS>
+inline LocationNDRec<DIMS> MoveND(/*IN*/const int& dir,							// The direction moved in
+								  /*IN*/const LocationNDRec<DIMS>& currPos)		// The current location
+{
+	LocationNDRec<DIMS> newPos = currPos;	// The updated location
+
+	newPos.pos[ND_AXIS_ARR[dir]] += ND_SIGN_ARR[dir];
+
+	return newPos;
+
+}// end MoveND
+
+
+
+// O(1)
+// Purpose: Get the text printed for a direction in a path, the letter followed by a "-"
+// Pre: 0 <= dir < DirCountND(ND_DIMS_MAX)
+// Post: "N-", "E-", "S-", "W-", "U-", "D-", "A-" or "K-" is returned
+inline const char* DirTextND(/*IN*/const int& dir)		// The direction travelled
+{
+	return ND_DIR_TEXT[dir];
+
+}// end DirTextND
+
+
+
+// O(DIMS)
+// Purpose: Return the direction a letter stands for
+// Pre: The direction's letter and the number of dimensions of the board
+// Post: The direction is returned, NO_DIR if the letter is not one of the board's directions
+inline int DirFromText(/*IN*/const string& text,		// The direction's letter
+					   /*IN*/const int& dims)			// The number of dimensions
+{
+	for (int d = ZERO; d < DirCountND(dims); d++)
+		if (text.length() == OFFSET && text[ZERO] == ND_DIR_TEXT[d][ZERO])
+			return d;
+
+	return NO_DIR;
+
+}// end DirFromText
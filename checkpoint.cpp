@@ -0,0 +1,182 @@
+// Project Maze
+// FileName : checkpoint.cpp
+// Author: Christian Siletti
+// Purpose : This file contains the implementation for all of the functions
+//			 defined in checkpoint.h
+
+#include "checkpoint.h"	// The header file
+#include <fstream>		// For checkpoint file access
+#include <filesystem>	// For replacing the old checkpoint file
+#include <algorithm>		// For comparing the file mark
+
+using namespace std;	// Standard Namespace
+
+
+const char CK_MAGIC[] = { 'M', 'Z', 'C', 'K' };	// Marks the start of a checkpoint file
+const int CK_MAGIC_LEN = 4;						// The number of characters in the mark
+const int CK_VERSION = 2;						// The checkpoint file layout version
+const string CK_TEMP_EXT = ".tmp";				// Extension of the file written before the rename
+const unsigned long long FNV_PRIME = 1099511628211ULL;			// FNV-1a multiplier
+
+
+
+// O(1)
+// Pre: The current hash and the value to mix in
+// Post: The updated hash is returned
+unsigned long long HashMix(/*IN*/unsigned long long hash,	// The current hash
+						   /*IN*/long long value)			// The value to mix in
+{
+	// Mix in each byte of the value
+	for (int i = ZERO; i < (int)sizeof(value); i++)
+	{
+		hash ^= (unsigned long long)((value >> (i * BITS_PER_BYTE)) & 0xFF);
+		hash *= FNV_PRIME;
+	}
+
+	return hash;
+
+}// end HashMix
+
+
+
+// O(1)
+// Purpose: Write a single value to a binary file
+// Pre: The open file and the value
+// Post: The raw bytes of the value are written
+template <typename T>
+static void WriteValue(/*IN/OUT*/ofstream& fout,	// The checkpoint file
+					   /*IN*/const T& value)		// The value to write
+{
+	fout.write(reinterpret_cast<const char*>(&value), sizeof(T));
+
+}// end WriteValue
+
+
+
+// O(1)
+// Purpose: Read a single value from a binary file
+// Pre: The open file
+// Post: value holds the raw bytes read, the stream fails if the file ran out
+template <typename T>
+static void ReadValue(/*IN/OUT*/ifstream& fin,		// The checkpoint file
+					  /*OUT*/T& value)				// The value read
+{
+	fin.read(reinterpret_cast<char*>(&value), sizeof(T));
+
+}// end ReadValue
+
+
+
+// O(N^2)
+// Pre: The name of the checkpoint file and the record to write
+// Post: The file holds the record, true is returned on success
+bool SaveCheckpoint(/*IN*/const string& fileName,		// The checkpoint file
+					/*IN*/const CheckpointRec& ck)		// The state to save
+{
+	string tempName = fileName + CK_TEMP_EXT;	// The file written before it replaces the old one
+	ofstream fout;								// The checkpoint file writer
+	long long pathLen = (long long)ck.path.size();	// The number of items in the path
+	error_code err;								// Holds any error from the rename
+
+	// Open the temporary file
+	fout.open(tempName, ios::binary | ios::trunc);
+	if (!fout)
+		return false;
+
+	// Write the header
+	fout.write(CK_MAGIC, CK_MAGIC_LEN);
+	WriteValue(fout, CK_VERSION);
+	WriteValue(fout, ck.rows);
+	WriteValue(fout, ck.cols);
+	WriteValue(fout, ck.wallHash);
+	WriteValue(fout, (int)ck.dir);
+	WriteValue(fout, ck.pathCt);
+	WriteValue(fout, ck.outputPos);
+	WriteValue(fout, ck.minLen);
+	WriteValue(fout, ck.maxLen);
+
+	// Write the path from the bottom up
+	WriteValue(fout, pathLen);
+	for (long long i = ZERO; i < pathLen; i++)
+	{
+		WriteValue(fout, ck.path[i].loc.x);
+		WriteValue(fout, ck.path[i].loc.y);
+		WriteValue(fout, (char)ck.path[i].dir);
+	}
+
+	// Write the visited bitmap
+	fout.write(reinterpret_cast<const char*>(ck.visited.data()), ck.visited.size());
+
+	// Make sure everything made it to the disk
+	fout.close();
+	if (!fout)
+		return false;
+
+	// Replace the old checkpoint
+	filesystem::rename(tempName, fileName, err);
+
+	return !err;
+
+}// end SaveCheckpoint
+
+
+
+// O(N^2)
+// Pre: The name of the checkpoint file
+// Post: ck holds the saved record and true is returned,
+//		 false is returned if the file could not be read
+bool LoadCheckpoint(/*IN*/const string& fileName,		// The checkpoint file
+					/*OUT*/CheckpointRec& ck)			// The state read in
+{
+	ifstream fin;					// The checkpoint file reader
+	char magic[CK_MAGIC_LEN];		// The mark at the start of the file
+	int version = ZERO;				// The file layout version
+	int dir = ZERO;					// The saved direction
+	long long pathLen = ZERO;		// The number of items in the path
+	char itemDir;					// The direction of a path item
+
+	// Open the file
+	fin.open(fileName, ios::binary);
+	if (!fin)
+		return false;
+
+	// Check that it is a checkpoint file
+	fin.read(magic, CK_MAGIC_LEN);
+	ReadValue(fin, version);
+	if (!fin || !equal(magic, magic + CK_MAGIC_LEN, CK_MAGIC) || version != CK_VERSION)
+		return false;
+
+	// Read the header
+	ReadValue(fin, ck.rows);
+	ReadValue(fin, ck.cols);
+	ReadValue(fin, ck.wallHash);
+	ReadValue(fin, dir);
+	ReadValue(fin, ck.pathCt);
+	ReadValue(fin, ck.outputPos);
+	ReadValue(fin, ck.minLen);
+	ReadValue(fin, ck.maxLen);
+	ReadValue(fin, pathLen);
+	ck.dir = (DirectionEnum)dir;
+
+	// Make sure the header makes sense before sizing anything off of it
+	if (!fin || ck.rows <= ZERO || ck.cols <= ZERO || pathLen <= ZERO ||
+		pathLen > (long long)ck.rows * ck.cols)
+		return false;
+
+	// Read the path
+	ck.path.resize((size_t)pathLen);
+	for (long long i = ZERO; i < pathLen; i++)
+	{
+		ReadValue(fin, ck.path[i].loc.x);
+		ReadValue(fin, ck.path[i].loc.y);
+		ReadValue(fin, itemDir);
+		ck.path[i].dir = (DirectionEnum)itemDir;
+	}
+
+	// Read the visited bitmap
+	ck.visited.resize(((long long)ck.rows * ck.cols + BITS_PER_BYTE - OFFSET) / BITS_PER_BYTE);
+	fin.read(reinterpret_cast<char*>(ck.visited.data()), ck.visited.size());
+
+	return (bool)fin;
+
+}// end LoadCheckpoint
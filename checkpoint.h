@@ -0,0 +1,227 @@
+#pragma once
+/*
+	FileName : checkpoint.h
+	Author: Christian Siletti
+	Date: 4/12/24
+	Project Maze
+
+	PURPOSE:
+		Contains the specification for saving and restoring the state of a path search,
+		so a long running search can be stopped and later resumed from where it left off.
+		A resumed search produces the exact same output as one that was never stopped.
+
+
+	ASSUMPTIONS:
+		1) The checkpoint is only taken at the top of the search loop, where the
+		   current location is always the location on top of the path stack
+		2) The output file is flushed before its position is stored in the checkpoint
+		3) The board a checkpoint is restored into has the same size and walls
+		   as the board it was taken from
+
+
+	EXCEPTION HANDLING/ERROR CHECKING:
+		1) SaveCheckpoint writes to a temporary file first and renames it, so a
+		   crash while saving never damages the previous checkpoint.
+		2) LoadCheckpoint returns false if the file is missing, truncated, or not a checkpoint.
+
+
+	FILE LAYOUT (binary):
+		"MZCK", version, rows, cols, wall hash, dir, path count, output position, min and max length,
+		path length, path entries (x, y, dir) from the bottom of the stack to the top,
+		visited bitmap (one bit per cell, row major)
+
+
+						   SUMMARY OF FUNCTIONS:
+	unsigned long long WallHash(*IN*const BoardT& board)	// The board being hashed
+		- Hash the size and wall layout of a board
+	void CaptureCheckpoint(*IN*const StackClass& pathStack,	// The current path
+						   *IN*const BoardT& board,			// The board being searched
+						   *IN*const DirectionEnum& dir,		// The current direction
+						   *IN*const long long& pathCt,		// The number of paths found
+						   *IN*const long long& outputPos,	// The output file's position
+						   *OUT*CheckpointRec& ck)			// The record being filled
+		- Store the state of a search into a checkpoint record
+	void RestoreCheckpoint(*IN*const CheckpointRec& ck,		// The saved state
+						   *OUT*StackClass& pathStack,		// The path being rebuilt
+						   *IN/OUT*BoardT& board)			// The board being marked
+		- Rebuild the path stack and the visited cells from a checkpoint record
+	bool SaveCheckpoint(*IN*const string& fileName,	// The checkpoint file
+						*IN*const CheckpointRec& ck)	// The state to save
+		- Write a checkpoint record to a file
+	bool LoadCheckpoint(*IN*const string& fileName,	// The checkpoint file
+						*OUT*CheckpointRec& ck)		// The state read in
+		- Read a checkpoint record from a file
+	unsigned long long HashMix(*IN*unsigned long long hash,	// The current hash
+							   *IN*long long value)			// The value to mix in
+		- Mix a value into an FNV-1a hash
+
+	The board functions are templates so they work with any board type (GameBoard or
+	FixedBoard) offering GetSize, GetStatus and SetStatus.
+*/
+
+#include "stack.h"		// Allows access to the stack ADT
+#include "gameboard.h"	// Allows access to the gameboard ADT
+#include <vector>		// For the saved path and visited bitmap
+#include <algorithm>	// For flipping the saved path
+
+using namespace std;	// Standard Namespace
+
+
+const int BITS_PER_BYTE = 8;	// The number of cells stored in a bitmap byte
+const unsigned long long FNV_BASIS = 14695981039346656037ULL;	// FNV-1a starting value
+
+
+// The state of a path search at the top of the search loop
+struct CheckpointRec
+{
+	int rows;						// Number of rows in the gameboard
+	int cols;						// Number of columns in the gameboard
+	unsigned long long wallHash;	// Hash of the board's walls
+	DirectionEnum dir;				// The last direction analyzed
+	long long pathCt;				// The number of paths found so far
+	long long outputPos;			// The number of bytes written to the output file
+	int minLen;						// The minimum path length the search ran with
+	int maxLen;						// The maximum path length the search ran with
+	vector<StackRec> path;			// The path stack from bottom to top
+	vector<unsigned char> visited;	// One bit per cell, set if the cell is VISITED
+};
+
+
+
+// O(N^2)
+// Purpose: Write a checkpoint record to a file
+// Pre: The name of the checkpoint file and the record to write
+// Post: The file holds the record, true is returned on success
+bool SaveCheckpoint(/*IN*/const string& fileName,		// The checkpoint file
+					/*IN*/const CheckpointRec& ck);		// The state to save
+
+
+
+// O(N^2)
+// Purpose: Read a checkpoint record from a file
+// Pre: The name of the checkpoint file
+// Post: ck holds the saved record and true is returned,
+//		 false is returned if the file could not be read
+bool LoadCheckpoint(/*IN*/const string& fileName,		// The checkpoint file
+					/*OUT*/CheckpointRec& ck);			// The state read in
+
+
+
+// O(1)
+// Purpose: Mix a value into an FNV-1a hash
+// Pre: The current hash and the value to mix in
+// Post: The updated hash is returned
+unsigned long long HashMix(/*IN*/unsigned long long hash,	// The current hash
+						   /*IN*/long long value);			// The value to mix in
+
+
+
+// ============================ TEMPLATE FUNCTIONS =================================
+
+
+
+// O(N^2)
+// Purpose: Hash the size and wall layout of a board
+// Pre: The board being hashed
+// Post: A 64 bit hash of the rows, columns and wall cells is returned
+template <class BoardT>
+unsigned long long WallHash(/*IN*/const BoardT& board)	// The board being hashed
+{
+	unsigned long long hash = FNV_BASIS;	// The running hash
+	Location2DRec loc;						// The cell being hashed
+	int rows;								// Number of rows in the gameboard
+	int cols;								// Number of columns in the gameboard
+
+	// Hash the size of the board
+	board.GetSize(rows, cols);
+	hash = HashMix(hash, rows);
+	hash = HashMix(hash, cols);
+
+	// Hash the position of every wall
+	for (loc.x = ZERO; loc.x < rows; loc.x++)
+		for (loc.y = ZERO; loc.y < cols; loc.y++)
+			if (board.GetStatus(loc) == WALL)
+				hash = HashMix(hash, (long long)loc.x * cols + loc.y);
+
+	return hash;
+
+}// end WallHash
+
+
+
+// O(N^2)
+// Purpose: Store the state of a search into a checkpoint record
+// Pre: The path stack, board, direction and path count at the top of the search loop,
+//		and the position of the flushed output file
+// Post: ck holds everything needed to continue the search, with no length limits
+template <class BoardT>
+void CaptureCheckpoint(/*IN*/const StackClass& pathStack,	// The current path
+					   /*IN*/const BoardT& board,			// The board being searched
+					   /*IN*/const DirectionEnum& dir,		// The current direction
+					   /*IN*/const long long& pathCt,		// The number of paths found
+					   /*IN*/const long long& outputPos,	// The output file's position
+					   /*OUT*/CheckpointRec& ck)			// The record being filled
+{
+	StackClass path = pathStack;	// Copy of the path that can be emptied
+	Location2DRec loc;				// The cell being checked
+	int cell;						// The cell's row major index
+
+	// Store the size and state of the search
+	board.GetSize(ck.rows, ck.cols);
+	ck.wallHash = WallHash(board);
+	ck.dir = dir;
+	ck.pathCt = pathCt;
+	ck.outputPos = outputPos;
+	ck.minLen = ZERO;
+	ck.maxLen = ZERO;
+
+	// Store the path, the stack gives it back top first so flip it afterwards
+	ck.path.clear();
+	while (!path.IsEmpty())
+	{
+		ck.path.push_back(path.Retrieve());
+		path.Pop();
+	}
+	reverse(ck.path.begin(), ck.path.end());
+
+	// Store the visited cells
+	ck.visited.assign(((long long)ck.rows * ck.cols + BITS_PER_BYTE - OFFSET) / BITS_PER_BYTE, ZERO);
+	for (loc.x = ZERO; loc.x < ck.rows; loc.x++)
+		for (loc.y = ZERO; loc.y < ck.cols; loc.y++)
+			if (board.GetStatus(loc) == VISITED)
+			{
+				cell = loc.x * ck.cols + loc.y;
+				ck.visited[cell / BITS_PER_BYTE] |= (unsigned char)(OFFSET << (cell % BITS_PER_BYTE));
+			}
+
+}// end CaptureCheckpoint
+
+
+
+// O(N^2)
+// Purpose: Rebuild the path stack and the visited cells from a checkpoint record
+// Pre: An empty path stack and a board with only its walls set
+// Post: The path stack and the board are in the state they were when ck was captured
+template <class BoardT>
+void RestoreCheckpoint(/*IN*/const CheckpointRec& ck,		// The saved state
+					   /*OUT*/StackClass& pathStack,		// The path being rebuilt
+					   /*IN/OUT*/BoardT& board)				// The board being marked
+{
+	Location2DRec loc;	// The cell being restored
+	int cell;			// The cell's row major index
+
+	// Rebuild the path from the bottom up
+	pathStack.Clear();
+	for (size_t i = ZERO; i < ck.path.size(); i++)
+		pathStack.Push(ck.path[i]);
+
+	// Mark the visited cells
+	for (loc.x = ZERO; loc.x < ck.rows; loc.x++)
+		for (loc.y = ZERO; loc.y < ck.cols; loc.y++)
+		{
+			cell = loc.x * ck.cols + loc.y;
+			if (ck.visited[cell / BITS_PER_BYTE] & (OFFSET << (cell % BITS_PER_BYTE)))
+				board.SetStatus(loc, VISITED);
+		}
+
+}// end RestoreCheckpoint
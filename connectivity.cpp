@@ -0,0 +1,502 @@
+// Project Maze
+// FileName : connectivity.cpp
+// Author: Christian Siletti
+// Purpose : This file contains the implementation for all of the methods
+//			 defined in connectivity.h
+
+#include "connectivity.h"	// The header file
+#include "memaccount.h"		// For counting the packed cells and the runs
+#include <algorithm>		// For the binary search of a row's runs
+#include <new>				// Contains the bad_alloc exception
+
+const unsigned long long DEBRUIJN_64 = 0x03f79d71b4cb0a89ULL;	// Multiplier that gives each lowest bit a unique top 6 bits
+const int DEBRUIJN_SHIFT = 58;									// Moves the top 6 bits down to an index
+const int WORD_TOP_BIT = WORD_BITS - 1;							// The index of the last cell in a word
+const int TOP_BYTE_SHIFT = 56;									// Moves a word's top byte down to its bottom
+
+// The position of a word's lowest set bit, looked up by the top 6 bits of (lowest bit * DEBRUIJN_64)
+const int DEBRUIJN_INDEX[WORD_BITS] =
+{
+	0, 1, 48, 2, 57, 49, 28, 3, 61, 58, 50, 42, 38, 29, 17, 4,
+	62, 55, 59, 36, 53, 51, 43, 22, 45, 39, 33, 30, 24, 18, 12, 5,
+	63, 47, 56, 27, 60, 41, 37, 16, 54, 35, 52, 21, 44, 32, 23, 11,
+	46, 26, 40, 15, 34, 20, 31, 10, 25, 14, 19, 9, 13, 8, 7, 6
+};
+
+
+
+// O(1)
+// Purpose: Find the position of the lowest set bit of a word
+// Pre: A word with at least one bit set
+// Post: The index of the lowest set bit is returned
+static int LowBit(/*IN*/unsigned long long word)	// The word being scanned
+{
+	return DEBRUIJN_INDEX[((word & (~word + OFFSET)) * DEBRUIJN_64) >> DEBRUIJN_SHIFT];
+
+}// end LowBit
+
+
+
+// O(1)
+// Purpose: Count the set bits of a word
+// Pre: A word
+// Post: The number of set bits is returned
+static int CountBits(/*IN*/unsigned long long word)	// The word being counted
+{
+	// Add the bits up in pairs, then nibbles, then bytes
+	word = word - ((word >> 1) & 0x5555555555555555ULL);
+	word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+	word = (word + (word >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+
+	// Sum the bytes into the top byte
+	return (int)((word * 0x0101010101010101ULL) >> TOP_BYTE_SHIFT);
+
+}// end CountBits
+
+
+
+// O(N)
+// Purpose: Find the next open or closed cell of a packed row
+// Pre: The packed row, its number of words, and the column to start looking from
+// Post: The column of the first cell at or after col with the wanted state is returned,
+//		 or words * WORD_BITS if there is none
+static int NextCell(/*IN*/const unsigned long long* row,	// The packed row
+					/*IN*/int words,						// The number of words in the row
+					/*IN*/int col,							// The column to start looking from
+					/*IN*/bool open)						// true to find an open cell, false a closed one
+{
+	int w = col / WORD_BITS;		// The word being scanned
+	unsigned long long word;			// The cells of the word with the wanted state
+
+	if (w >= words)
+		return words * WORD_BITS;
+
+	// Ignore the cells before the starting column
+	word = (open ? row[w] : ~row[w]) & (~0ULL << (col % WORD_BITS));
+
+	// Skip the words with no cell in the wanted state
+	while (word == ZERO)
+	{
+		if (++w == words)
+			return words * WORD_BITS;
+
+		word = open ? row[w] : ~row[w];
+	}
+
+	return w * WORD_BITS + LowBit(word);
+
+}// end NextCell
+
+
+
+// O(1)
+// Purpose: Find the run a union-find entry was merged into
+// Pre: The union-find parents and an entry
+// Post: The entry's root is returned, the paths looked at are shortened
+static int FindRoot(/*IN/OUT*/vector<int>& parentArr,	// Each run's parent
+					/*IN*/int run)						// The run being looked up
+{
+	// Walk up to the root, pointing each run at its grandparent along the way
+	while (parentArr[run] != run)
+	{
+		parentArr[run] = parentArr[parentArr[run]];
+		run = parentArr[run];
+	}
+
+	return run;
+
+}// end FindRoot
+
+
+
+
+// O(1) - Default Constructor
+// Pre: N/A
+// Post: A map with no cells is created
+ConnectivityMap::ConnectivityMap()
+{
+	maxRows = ZERO;	// Nothing has been built yet
+	maxCols = ZERO;
+	rowWords = ZERO;
+	memBytes = ZERO;
+
+	// Every row count needs the end marker
+	rowRunArr.push_back(ZERO);
+
+}// end DC
+
+
+
+
+// O(1) - Destructor
+// Pre: N/A
+// Post: The class object is destroyed
+ConnectivityMap::~ConnectivityMap()
+{
+	// The arrays free themselves, they are no longer counted
+	MemRelease(MEM_MAPS, memBytes);
+
+}// end Destructor
+
+
+
+
+// O(N^2) - Mutator
+// Pre: The board with its walls set
+// Post: Every open cell belongs to exactly one component, and the component sizes are counted
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+void ConnectivityMap::Build(/*IN*/const GameBoard& board)		// The board being labelled
+{
+	vector<int> parentArr;		// Each run's union-find parent
+	vector<int> rootCompArr;	// Each root run's component number
+	Location2DRec loc;			// The cell being packed
+	int start;					// The first column of a run
+	int end;					// The column after the last column of a run
+	int prev;					// The run of the row above being checked
+	int curr;					// The run of this row being checked
+	long long buildBytes;		// The bytes of the union-find arrays counted in memaccount.h
+
+	// Get the size of the board
+	board.GetSize(maxRows, maxCols);
+	rowWords = (maxCols + WORD_TOP_BIT) / WORD_BITS;
+
+	try
+	{
+		// Pack the open cells, the bits past the last column stay closed
+		openArr.assign((size_t)maxRows * rowWords, ZERO);
+		for (loc.x = ZERO; loc.x < maxRows; loc.x++)
+			for (loc.y = ZERO; loc.y < maxCols; loc.y++)
+				if (board.GetStatus(loc) != WALL)
+					openArr[(size_t)loc.x * rowWords + loc.y / WORD_BITS] |= 1ULL << (loc.y % WORD_BITS);
+
+		// Find every row's runs of open cells
+		rowRunArr.clear();
+		runStartArr.clear();
+		runEndArr.clear();
+		for (int row = ZERO; row < maxRows; row++)
+		{
+			rowRunArr.push_back((int)runStartArr.size());
+
+			start = NextCell(&openArr[(size_t)row * rowWords], rowWords, ZERO, true);
+			while (start < maxCols)
+			{
+				end = min(NextCell(&openArr[(size_t)row * rowWords], rowWords, start, false), maxCols);
+				runStartArr.push_back(start);
+				runEndArr.push_back(end - OFFSET);
+				start = NextCell(&openArr[(size_t)row * rowWords], rowWords, end, true);
+			}
+		}
+		rowRunArr.push_back((int)runStartArr.size());
+
+		// Join every run to the runs it touches in the row above
+		parentArr.resize(runStartArr.size());
+		for (size_t run = ZERO; run < parentArr.size(); run++)
+			parentArr[run] = (int)run;
+
+		for (int row = OFFSET; row < maxRows; row++)
+		{
+			prev = rowRunArr[row - OFFSET];
+			curr = rowRunArr[row];
+
+			// Both rows' runs are in column order, step past whichever run ends first
+			while (prev < rowRunArr[row] && curr < rowRunArr[row + OFFSET])
+			{
+				if (runStartArr[prev] <= runEndArr[curr] && runStartArr[curr] <= runEndArr[prev])
+					parentArr[FindRoot(parentArr, curr)] = FindRoot(parentArr, prev);
+
+				if (runEndArr[prev] < runEndArr[curr])
+					prev++;
+				else
+					curr++;
+			}
+		}
+
+		// Number the components in the order they are first met and count their cells
+		runCompArr.assign(runStartArr.size(), NO_COMPONENT);
+		rootCompArr.assign(runStartArr.size(), NO_COMPONENT);
+		compSizeArr.clear();
+		for (size_t run = ZERO; run < runStartArr.size(); run++)
+		{
+			curr = FindRoot(parentArr, (int)run);
+			if (rootCompArr[curr] == NO_COMPONENT)
+			{
+				rootCompArr[curr] = (int)compSizeArr.size();
+				compSizeArr.push_back(ZERO);
+			}
+
+			runCompArr[run] = rootCompArr[curr];
+			compSizeArr[runCompArr[run]] += runEndArr[run] - runStartArr[run] + OFFSET;
+		}
+	}
+	catch (std::bad_alloc)	// The heap space memory has run out
+	{
+		// Throw the exception
+		throw GBOutOfMemoryException();
+	}
+
+	// Count the map in place of any built before, and the union-find arrays until they are freed on the way out
+	MemRelease(MEM_MAPS, memBytes);
+	memBytes = (long long)openArr.capacity() * sizeof(unsigned long long) +
+			   (long long)(rowRunArr.capacity() + runStartArr.capacity() + runEndArr.capacity() +
+						   runCompArr.capacity() + compSizeArr.capacity()) * sizeof(int);
+	buildBytes = (long long)(parentArr.capacity() + rootCompArr.capacity()) * sizeof(int);
+	MemAdd(MEM_MAPS, memBytes + buildBytes);
+	MemRelease(MEM_MAPS, buildBytes);
+
+}// end Build
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: N/A
+// Post: The number of components is returned
+int ConnectivityMap::GetComponentCount() const
+{
+	return (int)compSizeArr.size();
+
+}// end GetComponentCount
+
+
+
+
+// O(log N) - Observer Accessor
+// Pre: The map has been built
+// Post: The cell's component is returned, or NO_COMPONENT if it is a wall or off the board
+int ConnectivityMap::GetComponent(/*IN*/const Location2DRec& loc) const		// The cell being looked up
+{
+	vector<int>::const_iterator first;	// The row's first run
+	vector<int>::const_iterator last;	// One past the row's last run
+	int run;							// The run the cell could be in
+
+	// Check if the cooridnate is within the bounds of the board
+	if (loc.x < ZERO || loc.x >= maxRows || loc.y < ZERO || loc.y >= maxCols)
+		return NO_COMPONENT;
+
+	// Find the last run of the row that starts at or before the cell
+	first = runStartArr.begin() + rowRunArr[loc.x];
+	last = runStartArr.begin() + rowRunArr[loc.x + OFFSET];
+	run = (int)(upper_bound(first, last, loc.y) - runStartArr.begin()) - OFFSET;
+
+	// The cell is a wall if no run covers it
+	if (run < rowRunArr[loc.x] || runEndArr[run] < loc.y)
+		return NO_COMPONENT;
+
+	return runCompArr[run];
+
+}// end GetComponent
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: 0 <= comp < GetComponentCount()
+// Post: The component's cell count is returned
+int ConnectivityMap::GetComponentSize(/*IN*/int comp) const		// The component being looked up
+{
+	return compSizeArr[comp];
+
+}// end GetComponentSize
+
+
+
+
+// O(log N) - Observer Accessor
+// Pre: The map has been built
+// Post: true is returned if both cells are open and in the same component
+bool ConnectivityMap::IsConnected(/*IN*/const Location2DRec& from,			// One of the cells
+								  /*IN*/const Location2DRec& to) const		// The other cell
+{
+	int comp = GetComponent(from);	// The first cell's component
+
+	return comp != NO_COMPONENT && comp == GetComponent(to);
+
+}// end IsConnected
+
+
+
+
+// O(log N) - Observer Accessor
+// Pre: The map has been built
+// Post: The size of the cell's component is returned, or 0 if the cell is not open
+int ConnectivityMap::CountReachable(/*IN*/const Location2DRec& from) const	// The cell being started from
+{
+	int comp = GetComponent(from);	// The cell's component
+
+	if (comp == NO_COMPONENT)
+		return ZERO;
+
+	return compSizeArr[comp];
+
+}// end CountReachable
+
+
+
+
+// O(N^2) - Observer Accessor
+// Pre: The map has been built
+// Post: reach holds rows * ceil(cols / 64) words, bit (col % 64) of word
+//		 (row * words per row + col / 64) is set for each cell reached.
+//		 The number of cells reached is returned, 0 if the cell is not open
+int ConnectivityMap::FloodFill(/*IN*/const Location2DRec& from,					// The cell being started from
+							   /*OUT*/vector<unsigned long long>& reach) const	// The cells reached
+{
+	vector<unsigned long long> rowArr;	// The row being grown
+	bool changed = true;				// Holds if a sweep reached any new cells
+	int reachCt = ZERO;					// The number of cells reached
+	int row;							// The row being grown
+	int nbrRow;							// The row passing its cells on
+	size_t base;						// The first word of the row being grown
+	size_t nbr;							// The first word of the row passing its cells on
+
+	try
+	{
+		reach.assign((size_t)maxRows * rowWords, ZERO);
+		rowArr.resize(rowWords);
+	}
+	catch (std::bad_alloc)	// The heap space memory has run out
+	{
+		// Throw the exception
+		throw GBOutOfMemoryException();
+	}
+
+	// Nothing can be reached from a wall
+	if (GetComponent(from) == NO_COMPONENT)
+		return ZERO;
+
+	reach[(size_t)from.x * rowWords + from.y / WORD_BITS] = 1ULL << (from.y % WORD_BITS);
+
+	// Sweep down then up until no row grows
+	while (changed)
+	{
+		changed = false;
+
+		for (int pass = ZERO; pass < 2; pass++)
+			for (int i = ZERO; i < maxRows; i++)
+			{
+				// The downward pass takes cells from the row above, the upward pass from the row below
+				row = (pass == ZERO) ? i : maxRows - OFFSET - i;
+				nbrRow = (pass == ZERO) ? row - OFFSET : row + OFFSET;
+
+				base = (size_t)row * rowWords;
+				nbr = (size_t)nbrRow * rowWords;
+
+				// Take the open cells under the neighbouring row's reached cells
+				for (int w = ZERO; w < rowWords; w++)
+				{
+					rowArr[w] = reach[base + w];
+					if (nbrRow >= ZERO && nbrRow < maxRows)
+						rowArr[w] |= reach[nbr + w] & openArr[base + w];
+				}
+
+				// Spread them along the row's runs
+				FillRow(&rowArr[ZERO], &openArr[base]);
+
+				// Keep the row if it grew
+				for (int w = ZERO; w < rowWords; w++)
+					if (rowArr[w] != reach[base + w])
+					{
+						reach[base + w] = rowArr[w];
+						changed = true;
+					}
+			}
+	}
+
+	// Count the cells reached
+	for (size_t w = ZERO; w < reach.size(); w++)
+		reachCt += CountBits(reach[w]);
+
+	return reachCt;
+
+}// end FloodFill
+
+
+
+
+// O(N^2 log N) - Observer Predicate
+// Pre: The map has been built
+// Post: true is returned if the flood fill reaches as many cells as the component has and
+//		 every cell it reaches is labelled with the component, or if the cell is not open
+bool ConnectivityMap::CheckComponent(/*IN*/const Location2DRec& from) const	// The cell being started from
+{
+	vector<unsigned long long> reach;	// The cells the flood fill reached
+	Location2DRec loc;					// The cell being checked
+	int comp = GetComponent(from);		// The component being checked
+
+	// The fill and the union-find must agree on how many cells there are
+	if (FloodFill(from, reach) != CountReachable(from))
+		return false;
+
+	// With as many cells on both sides, every cell reached being in the component makes them the same cells
+	for (loc.x = ZERO; loc.x < maxRows; loc.x++)
+		for (loc.y = ZERO; loc.y < maxCols; loc.y++)
+			if ((reach[(size_t)loc.x * rowWords + (loc.y >> WORD_SHIFT)] >> (loc.y & BIT_MASK) & 1ULL) != ZERO &&
+				GetComponent(loc) != comp)
+				return false;
+
+	return true;
+
+}// end CheckComponent
+
+
+
+
+// O(1)
+// Pre: The number of rows and columns
+// Post: The bytes of the packed cells, and of the run arrays with one run a row, are returned,
+//		 as counted in memaccount.h. Each further run the walls split a row into takes RUN_INTS ints more
+long long ConnectivityMap::MapBytes(/*IN*/const int& rows,		// The number of rows
+									/*IN*/const int& cols)		// The number of columns
+{
+	// The row start markers have one more than the rows
+	return (long long)rows * ((cols + WORD_TOP_BIT) / WORD_BITS) * sizeof(unsigned long long) +
+		   ((long long)rows * (RUN_INTS + OFFSET) + OFFSET) * sizeof(int);
+
+}// end MapBytes
+
+
+
+
+// O(N) - Observer Helper
+// Pre: A row of cells reached that are all open, and the row's open cells
+// Post: Every cell in a run with a cell reached is reached
+void ConnectivityMap::FillRow(/*IN/OUT*/unsigned long long* seed,				// The row's cells reached
+							  /*IN*/const unsigned long long* open) const		// The row's open cells
+{
+	unsigned long long gen;		// The cells reached in the word
+	unsigned long long pro;		// The cells a fill may pass through
+	unsigned long long carry;	// The cell a fill carries in from the neighbouring word
+
+	// Fill towards the higher columns, each step doubles how far a fill can travel
+	carry = ZERO;
+	for (int w = ZERO; w < rowWords; w++)
+	{
+		gen = seed[w] | (carry & open[w]);
+		pro = open[w];
+		for (int shift = OFFSET; shift < WORD_BITS; shift *= 2)
+		{
+			gen |= pro & (gen << shift);
+			pro &= pro << shift;
+		}
+
+		seed[w] = gen;
+		carry = gen >> WORD_TOP_BIT;
+	}
+
+	// Fill towards the lower columns
+	carry = ZERO;
+	for (int w = rowWords - OFFSET; w >= ZERO; w--)
+	{
+		gen = seed[w] | (carry & open[w]);
+		pro = open[w];
+		for (int shift = OFFSET; shift < WORD_BITS; shift *= 2)
+		{
+			gen |= pro & (gen >> shift);
+			pro &= pro >> shift;
+		}
+
+		seed[w] = gen;
+		carry = (gen & 1ULL) << WORD_TOP_BIT;
+	}
+
+}// end FillRow
@@ -0,0 +1,215 @@
+#pragma once
+/*
+	FileName : connectivity.h
+	Author: Christian Siletti
+	Date: 4/25/24
+	Project Maze
+
+	PURPOSE:
+		Contains the specifications for a ConnectivityMap Class. A connectivity map packs the
+		open cells of a gameboard into a bitmap, 64 cells to a word, and splits them into
+		connected components, so "can the exit be reached at all", "which component is this
+		cell in" and "how many cells can be reached from here" are answered without a search.
+
+		The components are labelled a run at a time: each row's horizontal runs of open cells
+		are found with word operations, and every run is joined (union-find) to the runs it
+		touches in the row above. A cell's component is found by a binary search of its row's runs.
+
+		FloodFill grows the cells reachable from one cell a whole word at a time: each row is
+		filled along its runs with shift-and-mask steps that double in length (6 steps for
+		64 cells), and rows pass their cells to the rows above and below in alternating
+		downward and upward sweeps until nothing changes. CheckComponent holds a component's
+		union-find labels up against a flood fill from one of its cells, which a debug build
+		does for the entrance's component after every Build.
+
+
+	ASSUMPTIONS:
+		1) The board passed to Build has its walls set, VISITED cells are treated as open
+		2) Cells connect only through their N, E, S and W neighbours
+
+
+	EXCEPTION HANDLING/ERROR CHECKING:
+		1) GetComponent returns NO_COMPONENT for walls and cells outside the board.
+		2) GBOutOfMemoryException thrown when memory from the heap has run out
+
+
+						   SUMMARY OF METHODS:
+	PUBLIC METHODS
+		ConnectivityMap() - Instantiate an empty connectivity map
+		~ConnectivityMap() - Destroy the class object
+		void Build(*IN*const GameBoard& board)		// The board being labelled
+					- Pack the board's open cells and label their connected components
+		int GetComponentCount() const - Return the number of connected components
+		int GetComponent(*IN*const Location2DRec& loc) const		// The cell being looked up
+					- Return the component a cell is in
+		int GetComponentSize(*IN*int comp) const		// The component being looked up
+					- Return the number of cells in a component
+		bool IsConnected(*IN*const Location2DRec& from,		// One of the cells
+						 *IN*const Location2DRec& to) const	// The other cell
+					- Check if there is a way from one open cell to another
+		int CountReachable(*IN*const Location2DRec& from) const	// The cell being started from
+					- Return the number of open cells that can be reached from a cell, itself included
+		int FloodFill(*IN*const Location2DRec& from,				// The cell being started from
+					  *OUT*vector<unsigned long long>& reach) const	// The cells reached
+					- Mark every cell that can be reached from a cell in a packed bitmap
+		bool CheckComponent(*IN*const Location2DRec& from) const	// The cell being started from
+					- Check a cell's component holds exactly the cells a flood fill from it reaches
+		static long long MapBytes(*IN*const int& rows,		// The number of rows
+								  *IN*const int& cols)		// The number of columns
+					- Return the fewest bytes a map of a board's size takes from the heap while built
+
+
+	PRIVATE MEMBERS:
+		int maxRows;						// The number of rows in the board
+		int maxCols;						// The number of columns in the board
+		int rowWords;						// The number of words in a packed row
+		vector<unsigned long long> openArr;	// The open cells, rowWords words per row
+		vector<int> rowRunArr;				// Where each row's runs start, with one extra end marker
+		vector<int> runStartArr;			// The first column of each run
+		vector<int> runEndArr;				// The last column of each run
+		vector<int> runCompArr;				// The component of each run
+		vector<int> compSizeArr;			// The number of cells in each component
+		long long memBytes;					// The bytes of the map counted in memaccount.h
+
+	PRIVATE METHODS:
+		void FillRow(*IN/OUT*unsigned long long* seed,			// The row's cells reached
+					 *IN*const unsigned long long* open) const	// The row's open cells
+					- Grow the cells reached in a row along the row's runs of open cells
+*/
+
+#include "gameboard.h"		// Allows access to the gameboard ADT
+#include <vector>			// For the packed bitmap and the run arrays
+
+using namespace std;    // Standard namespace
+
+
+const int NO_COMPONENT = -1;	// The component of a cell that is not open
+const int RUN_INTS = 6;			// The ints a run takes while the map is built: its start, end, component,
+								// parent, root's component and the size of the component it may be
+
+
+
+class ConnectivityMap
+{
+public:
+
+	// O(1) - Default Constructor
+	// Purpose: Instantiate an empty connectivity map
+	// Pre: N/A
+	// Post: A map with no cells is created
+	ConnectivityMap();
+
+
+
+	// O(1) - Destructor
+	// Purpose: Destroy the class object
+	// Pre: N/A
+	// Post: The class object is destroyed
+	~ConnectivityMap();
+
+
+
+	// O(N^2) - Mutator
+	// Purpose: Pack the board's open cells and label their connected components
+	// Pre: The board with its walls set
+	// Post: Every open cell belongs to exactly one component, and the component sizes are counted
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	void Build(/*IN*/const GameBoard& board);		// The board being labelled
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return the number of connected components
+	// Pre: N/A
+	// Post: The number of components is returned
+	int GetComponentCount() const;
+
+
+
+	// O(log N) - Observer Accessor
+	// Purpose: Return the component a cell is in
+	// Pre: The map has been built
+	// Post: The cell's component is returned, or NO_COMPONENT if it is a wall or off the board
+	int GetComponent(/*IN*/const Location2DRec& loc) const;		// The cell being looked up
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return the number of cells in a component
+	// Pre: 0 <= comp < GetComponentCount()
+	// Post: The component's cell count is returned
+	int GetComponentSize(/*IN*/int comp) const;		// The component being looked up
+
+
+
+	// O(log N) - Observer Accessor
+	// Purpose: Check if there is a way from one open cell to another
+	// Pre: The map has been built
+	// Post: true is returned if both cells are open and in the same component
+	bool IsConnected(/*IN*/const Location2DRec& from,			// One of the cells
+					 /*IN*/const Location2DRec& to) const;		// The other cell
+
+
+
+	// O(log N) - Observer Accessor
+	// Purpose: Return the number of open cells that can be reached from a cell, itself included
+	// Pre: The map has been built
+	// Post: The size of the cell's component is returned, or 0 if the cell is not open
+	int CountReachable(/*IN*/const Location2DRec& from) const;	// The cell being started from
+
+
+
+	// O(N^2) - Observer Accessor
+	// Purpose: Mark every cell that can be reached from a cell in a packed bitmap
+	// Pre: The map has been built
+	// Post: reach holds rows * ceil(cols / 64) words, bit (col % 64) of word
+	//		 (row * words per row + col / 64) is set for each cell reached.
+	//		 The number of cells reached is returned, 0 if the cell is not open
+	int FloodFill(/*IN*/const Location2DRec& from,					// The cell being started from
+				  /*OUT*/vector<unsigned long long>& reach) const;	// The cells reached
+
+
+
+	// O(N^2 log N) - Observer Predicate
+	// Purpose: Check a cell's component holds exactly the cells a flood fill from it reaches
+	// Pre: The map has been built
+	// Post: true is returned if the flood fill reaches as many cells as the component has and
+	//		 every cell it reaches is labelled with the component, or if the cell is not open
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	bool CheckComponent(/*IN*/const Location2DRec& from) const;	// The cell being started from
+
+
+
+	// O(1)
+	// Purpose: Return the fewest bytes a map of a board's size takes from the heap while built
+	// Pre: The number of rows and columns
+	// Post: The bytes of the packed cells, and of the run arrays with one run a row, are returned,
+	//		 as counted in memaccount.h. Each further run the walls split a row into takes RUN_INTS ints more
+	static long long MapBytes(/*IN*/const int& rows,		// The number of rows
+							  /*IN*/const int& cols);		// The number of columns
+
+
+
+private:
+	int maxRows;						// The number of rows in the board
+	int maxCols;						// The number of columns in the board
+	int rowWords;						// The number of words in a packed row
+
+	vector<unsigned long long> openArr;	// The open cells, rowWords words per row
+	vector<int> rowRunArr;				// Where each row's runs start, with one extra end marker
+	vector<int> runStartArr;			// The first column of each run
+	vector<int> runEndArr;				// The last column of each run
+	vector<int> runCompArr;				// The component of each run
+	vector<int> compSizeArr;			// The number of cells in each component
+	long long memBytes;					// The bytes of the map counted in memaccount.h
+
+
+
+	// O(N) - Observer Helper
+	// Purpose: Grow the cells reached in a row along the row's runs of open cells
+	// Pre: A row of cells reached that are all open, and the row's open cells
+	// Post: Every cell in a run with a cell reached is reached
+	void FillRow(/*IN/OUT*/unsigned long long* seed,				// The row's cells reached
+				 /*IN*/const unsigned long long* open) const;		// The row's open cells
+
+};
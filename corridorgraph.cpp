@@ -0,0 +1,417 @@
+// Project Maze
+// FileName : corridorgraph.cpp
+// Author: Christian Siletti
+// Purpose : This file contains the implementation for all of the methods
+//			 defined in corridorgraph.h
+
+#include "corridorgraph.h"	// The header file
+#include "navigation.h"		// For the printed direction text
+#include "memaccount.h"		// For counting the junction and edge arrays
+#include <new>				// Contains the bad_alloc exception
+
+const int CORRIDOR_DEGREE = 2;	// The number of open neighbours a corridor cell has
+
+
+
+// O(1) - Default Constructor
+// Pre: N/A
+// Post: A graph with no nodes is created
+CorridorGraph::CorridorGraph()
+{
+	maxRows = ZERO;	// Nothing has been built yet
+	maxCols = ZERO;
+	memBytes = ZERO;
+
+	// Every node count needs the end marker
+	edgeStartArr.push_back(ZERO);
+
+}// end DC
+
+
+
+
+// O(1) - Destructor
+// Pre: N/A
+// Post: The class object is destroyed
+CorridorGraph::~CorridorGraph()
+{
+	// The arrays free themselves, they are no longer counted
+	MemRelease(MEM_MAPS, memBytes);
+
+}// end Destructor
+
+
+
+
+// O(N^2) - Mutator
+// Pre: The maze graph built from the board, and the board's layout
+// Post: Every junction is a node, with an edge along each corridor that leads
+//		 to another junction in N, E, S, W order of the corridor's first move
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+void CorridorGraph::Build(/*IN*/const MazeGraph& graph,		// The graph being contracted
+						  /*IN*/const LayoutRec& layout)	// The entrance and exits
+{
+	vector<int> degreeArr;			// Each maze graph node's number of neighbours left
+	vector<unsigned char> trimArr;	// Holds which maze graph nodes were trimmed as dead ends
+	vector<unsigned char> keepArr;	// Holds which maze graph nodes are the entrance or an exit
+	vector<int> leafArr;			// The dead ends waiting to be trimmed
+	vector<int> junctionArr;		// Each maze graph node's junction number, or NO_NODE
+	vector<unsigned char> steps;	// The moves of the corridor being followed
+	Location2DRec loc;				// The cell being recorded
+	int nodeCt = graph.GetNodeCount();	// The number of maze graph nodes
+	int node;						// The node being checked
+	int prev;						// The node the corridor was entered from
+	int curr;						// The node the corridor has reached
+	int next;						// The node the corridor goes on to
+	int junctionCt = ZERO;			// The number of junctions
+	long long edgeMax = ZERO;		// The most edges the junctions can have, one an untrimmed neighbour
+	long long moveMax = ZERO;		// The most moves the edges can make, one each way between untrimmed cells
+	long long buildBytes;			// The bytes of the trimming arrays counted in memaccount.h
+
+	// Get the size of the board
+	graph.GetSize(maxRows, maxCols);
+
+	try
+	{
+		// Start over with no nodes
+		nodeIdArr.assign((size_t)maxRows * maxCols, NO_NODE);
+		openArr.assign((size_t)maxRows * maxCols, false);
+		nodeLocArr.clear();
+		edgeStartArr.clear();
+		edgeTargetArr.clear();
+		edgeLenArr.clear();
+		stepStartArr.clear();
+		stepArr.clear();
+		textArr.clear();
+
+		// Mark the entrance and the open exits, they are never trimmed
+		keepArr.assign(nodeCt, false);
+		node = graph.GetNodeId(layout.start);
+		if (node != NO_NODE)
+			keepArr[node] = true;
+		for (size_t i = ZERO; i < layout.exits.size(); i++)
+		{
+			node = graph.GetNodeId(layout.exits[i].loc);
+			if (node != NO_NODE)
+				keepArr[node] = true;
+		}
+
+		// Count each node's neighbours, a node is only ever a leaf once
+		degreeArr.assign(nodeCt, ZERO);
+		trimArr.assign(nodeCt, false);
+		leafArr.reserve(nodeCt);
+		for (node = ZERO; node < nodeCt; node++)
+		{
+			loc = graph.GetLocation(node);
+			openArr[(size_t)loc.x * maxCols + loc.y] = true;
+			degreeArr[node] = graph.GetEdgeEnd(node) - graph.GetEdgeBegin(node);
+
+			if (degreeArr[node] <= OFFSET && !keepArr[node])
+				leafArr.push_back(node);
+		}
+
+		// Trim the dead ends, a trimmed cell may leave its neighbour a dead end too
+		while (!leafArr.empty())
+		{
+			node = leafArr.back();
+			leafArr.pop_back();
+			trimArr[node] = true;
+
+			for (int edge = graph.GetEdgeBegin(node); edge < graph.GetEdgeEnd(node); edge++)
+			{
+				next = graph.GetEdgeTarget(edge);
+				if (!trimArr[next] && --degreeArr[next] == OFFSET && !keepArr[next])
+					leafArr.push_back(next);
+			}
+		}
+
+		// Number the junctions, every cell left that is not in the middle of a corridor
+		junctionArr.assign(nodeCt, NO_NODE);
+		for (node = ZERO; node < nodeCt; node++)
+			if (!trimArr[node])
+			{
+				moveMax += degreeArr[node];
+				if (keepArr[node] || degreeArr[node] != CORRIDOR_DEGREE)
+				{
+					junctionArr[node] = junctionCt++;
+					edgeMax += degreeArr[node];
+				}
+			}
+
+		// Make room for the most the junctions and corridors can need so no array grows past it
+		nodeLocArr.reserve(junctionCt);
+		edgeStartArr.reserve((size_t)junctionCt + OFFSET);
+		edgeTargetArr.reserve(edgeMax);
+		edgeLenArr.reserve(edgeMax);
+		stepStartArr.reserve(edgeMax);
+		stepArr.reserve(moveMax);
+		textArr.reserve(moveMax * DIR_TEXT_LEN);
+		steps.reserve(nodeCt);
+		for (node = ZERO; node < nodeCt; node++)
+			if (junctionArr[node] != NO_NODE)
+			{
+				loc = graph.GetLocation(node);
+				nodeIdArr[(size_t)loc.x * maxCols + loc.y] = junctionArr[node];
+				nodeLocArr.push_back(loc);
+			}
+
+		// Count the arrays in place of any built before, and the trimming arrays until they are done with
+		MemRelease(MEM_MAPS, memBytes);
+		memBytes = (long long)openArr.capacity() * sizeof(unsigned char) + (long long)nodeIdArr.capacity() * sizeof(int) +
+				   (long long)nodeLocArr.capacity() * sizeof(Location2DRec) + (long long)edgeStartArr.capacity() * sizeof(int) +
+				   (long long)edgeTargetArr.capacity() * sizeof(int) + (long long)edgeLenArr.capacity() * sizeof(int) +
+				   (long long)stepStartArr.capacity() * sizeof(int) + (long long)stepArr.capacity() * sizeof(unsigned char) +
+				   (long long)textArr.capacity() * sizeof(char);
+		buildBytes = (long long)degreeArr.capacity() * sizeof(int) + (long long)trimArr.capacity() * sizeof(unsigned char) +
+					 (long long)keepArr.capacity() * sizeof(unsigned char) + (long long)leafArr.capacity() * sizeof(int) +
+					 (long long)junctionArr.capacity() * sizeof(int) + (long long)steps.capacity() * sizeof(unsigned char);
+		MemAdd(MEM_MAPS, memBytes + buildBytes);
+
+		// Follow each corridor out of each junction to the junction at its other end
+		for (int junction = ZERO; junction < (int)nodeLocArr.size(); junction++)
+		{
+			node = graph.GetNodeId(nodeLocArr[junction]);
+			edgeStartArr.push_back((int)edgeTargetArr.size());
+
+			for (int edge = graph.GetEdgeBegin(node); edge < graph.GetEdgeEnd(node); edge++)
+			{
+				// Corridors into dead ends were trimmed
+				if (trimArr[graph.GetEdgeTarget(edge)])
+					continue;
+
+				prev = node;
+				curr = graph.GetEdgeTarget(edge);
+				steps.assign(OFFSET, (unsigned char)graph.GetEdgeDir(edge));
+
+				// Walk the corridor, a corridor cell has only one way on
+				while (junctionArr[curr] == NO_NODE)
+				{
+					for (int step = graph.GetEdgeBegin(curr); step < graph.GetEdgeEnd(curr); step++)
+					{
+						next = graph.GetEdgeTarget(step);
+						if (next != prev && !trimArr[next])
+						{
+							steps.push_back((unsigned char)graph.GetEdgeDir(step));
+							break;
+						}
+					}
+
+					prev = curr;
+					curr = graph.GetNodeId(Move((DirectionEnum)steps.back(), graph.GetLocation(curr)));
+				}
+
+				// A corridor that loops back to its own junction can never be in a path
+				if (curr == node)
+					continue;
+
+				// Store the corridor as one edge
+				edgeTargetArr.push_back(junctionArr[curr]);
+				edgeLenArr.push_back((int)steps.size());
+				stepStartArr.push_back((int)stepArr.size());
+				for (size_t i = ZERO; i < steps.size(); i++)
+				{
+					stepArr.push_back(steps[i]);
+					textArr += DirText((DirectionEnum)steps[i]);
+				}
+			}
+		}
+
+		// Mark the end of the last junction's edges
+		edgeStartArr.push_back((int)edgeTargetArr.size());
+
+		// The trimming arrays are freed on the way out
+		MemRelease(MEM_MAPS, buildBytes);
+	}
+	catch (std::bad_alloc)	// The heap space memory has run out
+	{
+		// Throw the exception
+		throw GBOutOfMemoryException();
+	}
+
+}// end Build
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: N/A
+// Post: The number of nodes is returned
+int CorridorGraph::GetNodeCount() const
+{
+	return (int)nodeLocArr.size();
+
+}// end GetNodeCount
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: The graph has been built
+// Post: The cell's node number is returned, or NO_NODE if it is not a junction
+int CorridorGraph::GetNodeId(/*IN*/const Location2DRec& loc) const		// The cell being looked up
+{
+	// Check if the cooridnate is within the bounds of the board
+	if (loc.x >= ZERO && loc.x < maxRows && loc.y >= ZERO && loc.y < maxCols)
+		return nodeIdArr[(size_t)loc.x * maxCols + loc.y];
+
+	return NO_NODE;
+
+}// end GetNodeId
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: 0 <= node < GetNodeCount()
+// Post: The node's location is returned
+Location2DRec CorridorGraph::GetLocation(/*IN*/int node) const			// The node being looked up
+{
+	return nodeLocArr[node];
+
+}// end GetLocation
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: 0 <= node < GetNodeCount()
+// Post: The index of the node's first edge is returned
+int CorridorGraph::GetEdgeBegin(/*IN*/int node) const		// The node whose edges are wanted
+{
+	return edgeStartArr[node];
+
+}// end GetEdgeBegin
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: 0 <= node < GetNodeCount()
+// Post: The index one past the node's last edge is returned
+int CorridorGraph::GetEdgeEnd(/*IN*/int node) const		// The node whose edges are wanted
+{
+	return edgeStartArr[node + OFFSET];
+
+}// end GetEdgeEnd
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: The edge is within some node's edge range
+// Post: The edge's target node is returned
+int CorridorGraph::GetEdgeTarget(/*IN*/int edge) const		// The edge being looked up
+{
+	return edgeTargetArr[edge];
+
+}// end GetEdgeTarget
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: The edge is within some node's edge range
+// Post: The compass direction the edge leaves its junction in is returned
+DirectionEnum CorridorGraph::GetEdgeDir(/*IN*/int edge) const		// The edge being looked up
+{
+	return (DirectionEnum)stepArr[stepStartArr[edge]];
+
+}// end GetEdgeDir
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: The edge is within some node's edge range
+// Post: The length of the corridor plus the move into the target junction is returned
+int CorridorGraph::GetEdgeLength(/*IN*/int edge) const		// The edge being looked up
+{
+	return edgeLenArr[edge];
+
+}// end GetEdgeLength
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: The edge is within some node's edge range
+// Post: The edge's direction text is returned, each move is a letter followed by a "-".
+//		 The text is not null terminated, it is GetEdgeLength(edge) * DIR_TEXT_LEN long
+const char* CorridorGraph::GetEdgeText(/*IN*/int edge) const		// The edge being looked up
+{
+	return textArr.data() + (size_t)stepStartArr[edge] * DIR_TEXT_LEN;
+
+}// end GetEdgeText
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: The edge is within some node's edge range and 0 <= step < GetEdgeLength(edge)
+// Post: The direction of the move is returned
+DirectionEnum CorridorGraph::GetEdgeStep(/*IN*/int edge,			// The edge being looked up
+										 /*IN*/int step) const		// The move wanted, 0 is the first
+{
+	return (DirectionEnum)stepArr[stepStartArr[edge] + step];
+
+}// end GetEdgeStep
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: The graph has been built
+// Post: OUT_OF_BOUNDS is returned for cells off the board, WALL for the board's walls,
+//		 and OPEN otherwise, trimmed and corridor cells are still OPEN
+StateEnum CorridorGraph::GetStatus(/*IN*/const Location2DRec& loc) const	// The cell being looked up
+{
+	// Check if the cooridnate is within the bounds of the board
+	if (loc.x < ZERO || loc.x >= maxRows || loc.y < ZERO || loc.y >= maxCols)
+		return OUT_OF_BOUNDS;
+
+	// Check for a wall
+	if (!openArr[(size_t)loc.x * maxCols + loc.y])
+		return WALL;
+
+	return OPEN;
+
+}// end GetStatus
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: N/A
+// Post: The size of the board will be stored into the incoming rows and columns variables
+void CorridorGraph::GetSize(/*OUT*/int& rows,			// The location to store the row size
+							/*OUT*/int& cols) const		// The location to store the column size
+{
+	rows = maxRows;
+	cols = maxCols;
+
+}// end GetSize
+
+
+
+
+// O(1)
+// Pre: The number of rows and columns
+// Post: The bytes of a graph with every cell a junction with four one move edges, and of the
+//		 arrays the dead ends are trimmed with, are returned, as counted in memaccount.h. The
+//		 maze graph it is built from is not included (see MazeGraph::GraphBytes)
+long long CorridorGraph::CorridorBytes(/*IN*/const int& rows,		// The number of rows
+									   /*IN*/const int& cols)		// The number of columns
+{
+	long long cellCt = (long long)rows * cols;	// The number of cells in the board
+	long long graphBytes;						// The bytes kept once the graph is built
+	long long buildBytes;						// The bytes of the trimming arrays
+
+	graphBytes = cellCt * (sizeof(unsigned char) + sizeof(int) + sizeof(Location2DRec) + sizeof(int) +
+						   (long long)NODE_EDGES_MAX * (sizeof(int) + sizeof(int) + sizeof(int)) +
+						   (long long)NODE_EDGES_MAX * (sizeof(unsigned char) + DIR_TEXT_LEN * sizeof(char))) + sizeof(int);
+	buildBytes = cellCt * (sizeof(int) + sizeof(unsigned char) + sizeof(unsigned char) + sizeof(int) + sizeof(int) +
+						   sizeof(unsigned char));
+
+	return graphBytes + buildBytes;
+
+}// end CorridorBytes
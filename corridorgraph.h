@@ -0,0 +1,251 @@
+#pragma once
+/*
+	FileName : corridorgraph.h
+	Author: Christian Siletti
+	Date: 4/24/24
+	Project Maze
+
+	PURPOSE:
+		Contains the specifications for a CorridorGraph Class. A corridor graph is a MazeGraph
+		with its one cell wide corridors contracted, so a search steps from junction to junction
+		instead of pushing and popping every cell of every corridor on every pass.
+
+		First the dead ends are trimmed away: a cell with only one open neighbour, other than
+		the entrance or an exit, can never be in the middle of a path, so it is dropped and its
+		neighbour is checked again. The cells left with exactly two neighbours are corridor cells,
+		every other cell left (and the entrance and exits) is a junction. Each junction keeps one
+		edge per direction that leads along a corridor to another junction. An edge knows how many
+		moves it makes and the direction of each one, and holds its printed direction text so a
+		path is written without walking the corridor again.
+
+		A junction's edges are kept in N, E, S, W order of their first move, which is the order
+		the board search tries them in, so the paths come out in the same order.
+
+
+	ASSUMPTIONS:
+		1) The entrance and exits are those of the layout the graph is built with
+		2) The graph does not change after it is built, edits to the board need a new Build
+
+
+	EXCEPTION HANDLING/ERROR CHECKING:
+		1) GetNodeId returns NO_NODE for walls, trimmed cells, corridor cells and cells outside the board.
+		2) GBOutOfMemoryException thrown when memory from the heap has run out
+
+
+						   SUMMARY OF METHODS:
+	PUBLIC METHODS
+		CorridorGraph() - Instantiate an empty graph
+		virtual ~CorridorGraph() - Destroy the class object
+		void Build(*IN*const MazeGraph& graph,		// The graph being contracted
+				   *IN*const LayoutRec& layout)		// The entrance and exits
+					- Trim the dead ends of a maze graph and contract its corridors
+		int GetNodeCount() const - Return the number of junctions
+		int GetNodeId(*IN*const Location2DRec& loc) const		// The cell being looked up
+					- Return the node number of a junction
+		Location2DRec GetLocation(*IN*int node) const			// The node being looked up
+					- Return the cell a junction stands for
+		int GetEdgeBegin(*IN*int node) const		// The node whose edges are wanted
+		int GetEdgeEnd(*IN*int node) const			// The node whose edges are wanted
+					- Return the range of a junction's edges in the edge array
+		int GetEdgeTarget(*IN*int edge) const		// The edge being looked up
+					- Return the junction an edge leads to
+		DirectionEnum GetEdgeDir(*IN*int edge) const	// The edge being looked up
+					- Return the direction of an edge's first move
+		int GetEdgeLength(*IN*int edge) const		// The edge being looked up
+					- Return the number of moves an edge makes
+		const char* GetEdgeText(*IN*int edge) const	// The edge being looked up
+					- Return the printed directions of an edge's moves
+		DirectionEnum GetEdgeStep(*IN*int edge,			// The edge being looked up
+								  *IN*int step) const	// The move wanted, 0 is the first
+					- Return the direction of one of an edge's moves
+		StateEnum GetStatus(*IN*const Location2DRec& loc) const	// The cell being looked up
+					- Return WALL, OPEN or OUT_OF_BOUNDS for a cell of the board
+		void GetSize(*OUT*int& rows,		// The location to store the row size
+					 *OUT*int& cols) const	// The location to store the column size
+					- Return the size of the board the graph was built from
+		static long long CorridorBytes(*IN*const int& rows,		// The number of rows
+									   *IN*const int& cols)		// The number of columns
+					- Return the most bytes a graph of a board's size takes from the heap while built
+
+
+	PRIVATE MEMBERS:
+		int maxRows;						// The number of rows in the board
+		int maxCols;						// The number of columns in the board
+		vector<unsigned char> openArr;		// Holds which cells of the board are not walls, row major
+		vector<int> nodeIdArr;				// Each cell's junction number in row major order, or NO_NODE
+		vector<Location2DRec> nodeLocArr;	// Each junction's cell
+		vector<int> edgeStartArr;			// Where each junction's edges start, with one extra end marker
+		vector<int> edgeTargetArr;			// The junction each edge leads to
+		vector<int> edgeLenArr;				// The number of moves each edge makes
+		vector<int> stepStartArr;			// Where each edge's moves start in the step array
+		vector<unsigned char> stepArr;		// The direction of every move of every edge
+		string textArr;						// The printed text of every move of every edge
+		long long memBytes;					// The bytes of the arrays counted in memaccount.h
+*/
+
+#include "mazegraph.h"		// Allows access to the maze graph ADT
+#include "layoutrec.h"		// The entrance and exits record
+#include <vector>			// For the node and edge arrays
+
+using namespace std;    // Standard namespace
+
+
+
+class CorridorGraph
+{
+public:
+
+	// O(1) - Default Constructor
+	// Purpose: Instantiate an empty graph
+	// Pre: N/A
+	// Post: A graph with no nodes is created
+	CorridorGraph();
+
+
+
+	// O(1) - Destructor
+	// Purpose: Destroy the class object
+	// Pre: N/A
+	// Post: The class object is destroyed
+	virtual ~CorridorGraph();
+
+
+
+	// O(N^2) - Mutator
+	// Purpose: Trim the dead ends of a maze graph and contract its corridors
+	// Pre: The maze graph built from the board, and the board's layout
+	// Post: Every junction is a node, with an edge along each corridor that leads
+	//		 to another junction in N, E, S, W order of the corridor's first move
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	void Build(/*IN*/const MazeGraph& graph,		// The graph being contracted
+			   /*IN*/const LayoutRec& layout);		// The entrance and exits
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return the number of junctions
+	// Pre: N/A
+	// Post: The number of nodes is returned
+	int GetNodeCount() const;
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return the node number of a junction
+	// Pre: The graph has been built
+	// Post: The cell's node number is returned, or NO_NODE if it is not a junction
+	int GetNodeId(/*IN*/const Location2DRec& loc) const;		// The cell being looked up
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return the cell a junction stands for
+	// Pre: 0 <= node < GetNodeCount()
+	// Post: The node's location is returned
+	Location2DRec GetLocation(/*IN*/int node) const;			// The node being looked up
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return where a junction's edges start in the edge array
+	// Pre: 0 <= node < GetNodeCount()
+	// Post: The index of the node's first edge is returned
+	int GetEdgeBegin(/*IN*/int node) const;		// The node whose edges are wanted
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return where a junction's edges end in the edge array
+	// Pre: 0 <= node < GetNodeCount()
+	// Post: The index one past the node's last edge is returned
+	int GetEdgeEnd(/*IN*/int node) const;		// The node whose edges are wanted
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return the junction an edge leads to
+	// Pre: The edge is within some node's edge range
+	// Post: The edge's target node is returned
+	int GetEdgeTarget(/*IN*/int edge) const;	// The edge being looked up
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return the direction of an edge's first move
+	// Pre: The edge is within some node's edge range
+	// Post: The compass direction the edge leaves its junction in is returned
+	DirectionEnum GetEdgeDir(/*IN*/int edge) const;		// The edge being looked up
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return the number of moves an edge makes
+	// Pre: The edge is within some node's edge range
+	// Post: The length of the corridor plus the move into the target junction is returned
+	int GetEdgeLength(/*IN*/int edge) const;	// The edge being looked up
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return the printed directions of an edge's moves
+	// Pre: The edge is within some node's edge range
+	// Post: The edge's direction text is returned, each move is a letter followed by a "-".
+	//		 The text is not null terminated, it is GetEdgeLength(edge) * DIR_TEXT_LEN long
+	const char* GetEdgeText(/*IN*/int edge) const;		// The edge being looked up
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return the direction of one of an edge's moves
+	// Pre: The edge is within some node's edge range and 0 <= step < GetEdgeLength(edge)
+	// Post: The direction of the move is returned
+	DirectionEnum GetEdgeStep(/*IN*/int edge,			// The edge being looked up
+							  /*IN*/int step) const;	// The move wanted, 0 is the first
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return WALL, OPEN or OUT_OF_BOUNDS for a cell of the board
+	// Pre: The graph has been built
+	// Post: OUT_OF_BOUNDS is returned for cells off the board, WALL for the board's walls,
+	//		 and OPEN otherwise, trimmed and corridor cells are still OPEN
+	StateEnum GetStatus(/*IN*/const Location2DRec& loc) const;	// The cell being looked up
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return the size of the board the graph was built from
+	// Pre: N/A
+	// Post: The size of the board will be stored into the incoming rows and columns variables
+	void GetSize(/*OUT*/int& rows,				// The location to store the row size
+				 /*OUT*/int& cols) const;		// The location to store the column size
+
+
+
+	// O(1)
+	// Purpose: Return the most bytes a graph of a board's size takes from the heap while built
+	// Pre: The number of rows and columns
+	// Post: The bytes of a graph with every cell a junction with four one move edges, and of the
+	//		 arrays the dead ends are trimmed with, are returned, as counted in memaccount.h. The
+	//		 maze graph it is built from is not included (see MazeGraph::GraphBytes)
+	static long long CorridorBytes(/*IN*/const int& rows,		// The number of rows
+								   /*IN*/const int& cols);		// The number of columns
+
+
+
+private:
+	int maxRows;						// The number of rows in the board
+	int maxCols;						// The number of columns in the board
+
+	vector<unsigned char> openArr;		// Holds which cells of the board are not walls, row major
+	vector<int> nodeIdArr;				// Each cell's junction number in row major order, or NO_NODE
+	vector<Location2DRec> nodeLocArr;	// Each junction's cell
+	vector<int> edgeStartArr;			// Where each junction's edges start, with one extra end marker
+	vector<int> edgeTargetArr;			// The junction each edge leads to
+	vector<int> edgeLenArr;				// The number of moves each edge makes
+	vector<int> stepStartArr;			// Where each edge's moves start in the step array
+	vector<unsigned char> stepArr;		// The direction of every move of every edge
+	string textArr;						// The printed text of every move of every edge
+	long long memBytes;					// The bytes of the arrays counted in memaccount.h
+
+};
@@ -0,0 +1,271 @@
+// Project Maze
+// FileName : costmap.cpp
+// Author: Christian Siletti
+// Purpose : This file contains the implementation for all of the methods
+//			 defined in costmap.h
+
+#include "costmap.h"		// The header file
+#include "navigation.h"		// For the search's direction order and printed directions
+#include "memaccount.h"		// For counting the costs
+#include <algorithm>		// For flipping the path around
+#include <new>				// Contains the bad_alloc exception
+
+const int OFF_BOARD = -1;		// The neighbour of a cell on the edge of the board
+
+
+
+// O(1)
+// Purpose: Return the direction that undoes a move
+// Pre: A compass direction
+// Post: The direction pointing the other way is returned
+static DirectionEnum Opposite(/*IN*/const DirectionEnum& dir)		// The direction moved in
+{
+	switch (dir)
+	{
+	case NORTH:
+		return SOUTH;
+	case EAST:
+		return WEST;
+	case SOUTH:
+		return NORTH;
+	case WEST:
+		return EAST;
+	default:
+		return NA;
+	}
+
+}// end Opposite
+
+
+
+// O(1) - Default Constructor
+// Pre: N/A
+// Post: A cost map with no cells is created, every lookup returns NO_COST
+CostMap::CostMap()
+{
+	maxRows = ZERO;	// Nothing has been measured yet
+	maxCols = ZERO;
+	startCell = ZERO;
+	memBytes = ZERO;
+
+}// end DC
+
+
+
+
+// O(1) - Destructor
+// Pre: N/A
+// Post: The class object is destroyed
+CostMap::~CostMap()
+{
+	// The cost arrays free themselves, they are no longer counted
+	MemRelease(MEM_MAPS, memBytes);
+
+}// end Destructor
+
+
+
+
+// O(N^2 + C) for a highest total cost of C
+// Pre: The board with its walls and costs set, of no more than COST_CELLS_MAX cells, and the entrance
+// Post: Every cell the entrance can reach holds the least cost of a path to it
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+void CostMap::Build(/*IN*/const GameBoard& board,			// The board being measured
+					/*IN*/const Location2DRec& start)		// The cell costs are measured from
+{
+	vector<vector<int> > bucketArr;		// The cells waiting to be settled, by their cost in a ring
+	Location2DRec loc;					// The cell being read in
+	int bucketCt;						// The number of buckets in the ring
+	int maxCost = DEFAULT_CELL_COST;	// The highest cost of any cell
+	long long waitCt = ZERO;			// The number of cells waiting in the buckets
+	unsigned int currCost;				// The cost of the bucket being emptied
+	unsigned int newCost;				// The cost of reaching a neighbour through the cell
+	int cell;							// The cell being settled
+	int next;							// Its neighbour
+
+	// Get the size of the board
+	board.GetSize(maxRows, maxCols);
+	startCell = start.x * maxCols + start.y;
+
+	try
+	{
+		// Every cell starts out unreachable, and the walls cost nothing as they are never moved into
+		cellCostArr.assign((size_t)maxRows * maxCols, ZERO);
+		costArr.assign((size_t)maxRows * maxCols, NO_COST);
+
+		for (loc.x = ZERO; loc.x < maxRows; loc.x++)
+			for (loc.y = ZERO; loc.y < maxCols; loc.y++)
+				if (board.GetStatus(loc) != WALL)
+				{
+					cellCostArr[(size_t)loc.x * maxCols + loc.y] = (unsigned char)board.GetCost(loc);
+					maxCost = max(maxCost, board.GetCost(loc));
+				}
+
+		// A cell waiting is never more than the highest cost past the bucket being emptied,
+		// so one more bucket than that lets the ring wrap around without two costs sharing one
+		bucketCt = maxCost + OFFSET;
+		bucketArr.resize(bucketCt);
+	}
+	catch (std::bad_alloc)	// The heap space memory has run out
+	{
+		// Throw the exception
+		throw GBOutOfMemoryException();
+	}
+
+	// Count the costs in place of any measured before
+	MemRelease(MEM_MAPS, memBytes);
+	memBytes = (long long)cellCostArr.size() * sizeof(unsigned char) + (long long)costArr.size() * sizeof(unsigned int);
+	MemAdd(MEM_MAPS, memBytes);
+
+	// A walled in entrance reaches nothing
+	if (cellCostArr[startCell] == ZERO)
+		return;
+
+	costArr[startCell] = ZERO;
+	bucketArr[ZERO].push_back(startCell);
+	waitCt++;
+
+	// Empty the buckets in order of cost until no cell is waiting
+	for (currCost = ZERO; waitCt > ZERO; currCost++)
+	{
+		vector<int>& bucket = bucketArr[currCost % bucketCt];	// The cells waiting at this cost
+
+		// Nothing is added to the bucket while it is emptied, every cost is at least one
+		for (size_t i = ZERO; i < bucket.size(); i++)
+		{
+			cell = bucket[i];
+			waitCt--;
+
+			// A cell put in a bucket again once it was found for less is skipped the first time
+			if (costArr[cell] != currCost)
+				continue;
+
+			// Offer each neighbour the cost of coming through the cell
+			for (DirectionEnum dir = NextDir(NA); dir != NA; dir = NextDir(dir))
+			{
+				next = StepCell(cell, dir);
+				if (next == OFF_BOARD || cellCostArr[next] == ZERO)
+					continue;
+
+				newCost = currCost + cellCostArr[next];
+				if (newCost < costArr[next])
+				{
+					costArr[next] = newCost;
+					try
+					{
+						bucketArr[newCost % bucketCt].push_back(next);
+					}
+					catch (std::bad_alloc)	// The heap space memory has run out
+					{
+						// Throw the exception
+						throw GBOutOfMemoryException();
+					}
+					waitCt++;
+				}
+			}
+		}
+
+		bucket.clear();
+
+	}// end for
+
+}// end Build
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: The map has been built
+// Post: The cell's least cost is returned, or NO_COST if it cannot be reached from the entrance
+unsigned int CostMap::GetCost(/*IN*/const Location2DRec& loc) const	// The cell being looked up
+{
+	// Check if the cooridnate is within the bounds of the map
+	if (loc.x >= ZERO && loc.x < maxRows && loc.y >= ZERO && loc.y < maxCols)
+		return costArr[(size_t)loc.x * maxCols + loc.y];	// Return the least cost of the cell
+
+	// Otherwise the cell cannot be reached
+	return NO_COST;
+
+}// end GetCost
+
+
+
+
+// O(N) for a path of N moves
+// Pre: The map has been built
+// Post: pathText holds the path's moves as "D-" pairs, empty if the cell is the entrance.
+//		 Each move tries N, E, S, W in turn when the path could have come from more than one cell.
+//		 false is returned if the cell cannot be reached
+bool CostMap::GetPath(/*IN*/const Location2DRec& target,		// The cell the path ends on
+					  /*OUT*/string& pathText) const			// The directions travelled
+{
+	vector<DirectionEnum> moveArr;	// The moves of the path, the last first
+	DirectionEnum backDir;			// The direction back to the cell the path came from
+	int cell;						// The cell the path has been walked back to
+	int prev;						// A neighbour the path may have come from
+
+	pathText.clear();
+	if (GetCost(target) == NO_COST)
+		return false;
+
+	// Walk back to the entrance, each step to a neighbour the cell's least cost was reached through
+	cell = target.x * maxCols + target.y;
+	while (cell != startCell)
+	{
+		for (backDir = NextDir(NA); backDir != NA; backDir = NextDir(backDir))
+		{
+			prev = StepCell(cell, backDir);
+			if (prev != OFF_BOARD && costArr[prev] != NO_COST && costArr[prev] + cellCostArr[cell] == costArr[cell])
+				break;
+		}
+
+		// The move into the cell was the other way
+		moveArr.push_back(Opposite(backDir));
+		cell = prev;
+	}
+
+	// Print the moves from the entrance on
+	reverse(moveArr.begin(), moveArr.end());
+	for (size_t i = ZERO; i < moveArr.size(); i++)
+		pathText.append(DirText(moveArr[i]), DIR_TEXT_LEN);
+
+	return true;
+
+}// end GetPath
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: A cell on the board and a compass direction
+// Post: The neighbour's index in row major order is returned, or OFF_BOARD if the move leaves the board
+int CostMap::StepCell(/*IN*/const int& cell,					// The cell moved from
+					  /*IN*/const DirectionEnum& dir) const		// The direction moved in
+{
+	Location2DRec loc;		// The cell's row and column
+	Location2DRec newLoc;	// The neighbour's row and column
+
+	loc.x = cell / maxCols;
+	loc.y = cell % maxCols;
+	newLoc = Move(dir, loc);
+
+	if (newLoc.x < ZERO || newLoc.x >= maxRows || newLoc.y < ZERO || newLoc.y >= maxCols)
+		return OFF_BOARD;
+
+	return newLoc.x * maxCols + newLoc.y;
+
+}// end StepCell
+
+
+
+
+// O(1)
+// Pre: The number of rows and columns
+// Post: The bytes of each cell's cost and least cost are returned, as counted in memaccount.h.
+//		 The cells waiting in the buckets depend on the walls and are not counted
+long long CostMap::MapBytes(/*IN*/const int& rows,		// The number of rows
+							/*IN*/const int& cols)		// The number of columns
+{
+	return (long long)rows * cols * (sizeof(unsigned char) + sizeof(unsigned int));
+
+}// end MapBytes
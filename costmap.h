@@ -0,0 +1,158 @@
+#pragma once
+/*
+	FileName : costmap.h
+	Author: Christian Siletti
+	Date: 5/5/24
+	Project Maze
+
+	PURPOSE:
+		Contains the specifications for a CostMap Class. A cost map holds the least total cost
+		of getting from the entrance of a gameboard to each of its cells, where moving into a
+		cell costs that cell's cost (see CellRec.h), and gives back the cheapest path to any cell.
+
+		It is built with Dijkstra's algorithm over a bucket queue (Dial's algorithm). Every cost
+		is a small whole number no more than MAX_CELL_COST, so the cells waiting to be settled
+		never have costs more than MAX_CELL_COST apart. They are kept in a ring of one bucket per
+		cost, and the buckets are emptied in order of cost, so taking the cheapest cell is O(1)
+		instead of the O(log N) of a binary heap.
+
+		To stay small on very large boards the map keeps one byte per cell for its cost and four
+		for its least cost, and no parent links. A cheapest path is found again by walking back
+		from its end to any neighbour whose least cost plus the cell's own cost is the cell's.
+
+
+	ASSUMPTIONS:
+		1) The board passed to Build has its walls and costs set
+		2) Every cost is between DEFAULT_CELL_COST and MAX_CELL_COST, so a board of no more than
+		   COST_CELLS_MAX cells cannot overflow a least cost, and its cells fit an int.
+		   A bigger board is turned away before the map is built (see mazeclient.cpp)
+		3) The entrance costs nothing, a path's cost is the cost of every cell it moves into
+
+
+	EXCEPTION HANDLING/ERROR CHECKING:
+		1) GetCost returns NO_COST for cells outside the board, walls, and cells that cannot be reached.
+		2) GetPath returns false for a cell that cannot be reached.
+		3) GBOutOfMemoryException thrown when memory from the heap has run out
+
+
+						   SUMMARY OF METHODS:
+	PUBLIC METHODS
+		CostMap() - Instantiate an empty cost map
+		~CostMap() - Destroy the class object
+		void Build(*IN*const GameBoard& board,			// The board being measured
+				   *IN*const Location2DRec& start)		// The cell costs are measured from
+					- Measure the least cost of reaching every cell from the entrance
+		unsigned int GetCost(*IN*const Location2DRec& loc) const	// The cell being looked up
+					- Return the least cost of reaching a cell
+		bool GetPath(*IN*const Location2DRec& target,		// The cell the path ends on
+					 *OUT*string& pathText) const			// The directions travelled
+					- Find a cheapest path from the entrance to a cell
+		static long long MapBytes(*IN*const int& rows,		// The number of rows
+								  *IN*const int& cols)		// The number of columns
+					- Return the bytes a map of a board's size takes from the heap
+
+
+	PRIVATE MEMBERS:
+		int maxRows;						// The number of rows measured
+		int maxCols;						// The number of columns measured
+		int startCell;						// The entrance's cell in row major order
+		vector<unsigned char> cellCostArr;	// Each cell's cost in row major order, zero for walls
+		vector<unsigned int> costArr;		// Each cell's least cost from the entrance, or NO_COST
+		long long memBytes;					// The bytes of the costs counted in memaccount.h
+
+	PRIVATE METHODS:
+		int StepCell(*IN*const int& cell,				// The cell moved from
+					 *IN*const DirectionEnum& dir) const	// The direction moved in
+					- Return the cell one move away in a direction
+*/
+
+#include "gameboard.h"		// Allows access to the gameboard ADT
+#include <vector>			// For the cost arrays
+#include <string>			// For the path's directions
+
+using namespace std;    // Standard namespace
+
+
+const unsigned int NO_COST = 4294967295U;			// The least cost of a cell that cannot be reached
+const long long COST_CELLS_MAX = 4294967295LL / MAX_CELL_COST;	// The most cells a board can have without overflowing a cost
+
+
+
+class CostMap
+{
+public:
+
+	// O(1) - Default Constructor
+	// Purpose: Instantiate an empty cost map
+	// Pre: N/A
+	// Post: A cost map with no cells is created, every lookup returns NO_COST
+	CostMap();
+
+
+
+	// O(1) - Destructor
+	// Purpose: Destroy the class object
+	// Pre: N/A
+	// Post: The class object is destroyed
+	~CostMap();
+
+
+
+	// O(N^2 + C) for a highest total cost of C
+	// Purpose: Measure the least cost of reaching every cell from the entrance
+	// Pre: The board with its walls and costs set, of no more than COST_CELLS_MAX cells, and the entrance
+	// Post: Every cell the entrance can reach holds the least cost of a path to it
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	void Build(/*IN*/const GameBoard& board,			// The board being measured
+			   /*IN*/const Location2DRec& start);		// The cell costs are measured from
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return the least cost of reaching a cell
+	// Pre: The map has been built
+	// Post: The cell's least cost is returned, or NO_COST if it cannot be reached from the entrance
+	unsigned int GetCost(/*IN*/const Location2DRec& loc) const;	// The cell being looked up
+
+
+
+	// O(N) for a path of N moves
+	// Purpose: Find a cheapest path from the entrance to a cell
+	// Pre: The map has been built
+	// Post: pathText holds the path's moves as "D-" pairs, empty if the cell is the entrance.
+	//		 Each move tries N, E, S, W in turn when the path could have come from more than one cell.
+	//		 false is returned if the cell cannot be reached
+	bool GetPath(/*IN*/const Location2DRec& target,		// The cell the path ends on
+				 /*OUT*/string& pathText) const;		// The directions travelled
+
+
+
+	// O(1)
+	// Purpose: Return the bytes a map of a board's size takes from the heap
+	// Pre: The number of rows and columns
+	// Post: The bytes of each cell's cost and least cost are returned, as counted in memaccount.h.
+	//		 The cells waiting in the buckets depend on the walls and are not counted
+	static long long MapBytes(/*IN*/const int& rows,		// The number of rows
+							  /*IN*/const int& cols);		// The number of columns
+
+
+
+private:
+	int maxRows;						// The number of rows measured
+	int maxCols;						// The number of columns measured
+	int startCell;						// The entrance's cell in row major order
+
+	vector<unsigned char> cellCostArr;	// Each cell's cost in row major order, zero for walls
+	vector<unsigned int> costArr;		// Each cell's least cost from the entrance, or NO_COST
+	long long memBytes;					// The bytes of the costs counted in memaccount.h
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return the cell one move away in a direction
+	// Pre: A cell on the board and a compass direction
+	// Post: The neighbour's index in row major order is returned, or OFF_BOARD if the move leaves the board
+	int StepCell(/*IN*/const int& cell,					// The cell moved from
+				 /*IN*/const DirectionEnum& dir) const;	// The direction moved in
+
+};
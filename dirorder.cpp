@@ -0,0 +1,225 @@
+// Project Maze
+// FileName : dirorder.cpp
+// Author: Christian Siletti
+// Purpose : This file contains the implementation for all of the methods
+//			 defined in dirorder.h
+
+#include "dirorder.h"		// The header file
+#include "navigation.h"		// For stepping to a cell's neighbours
+#include "memaccount.h"		// For counting the orders and the scores
+#include <algorithm>		// For the nearest exit
+#include <climits>			// For the score of a neighbour that cannot reach an exit
+#include <cstdlib>			// For the rows and columns between two cells
+#include <new>				// Contains the bad_alloc exception
+
+
+
+// O(1) - Default Constructor
+// Pre: N/A
+// Post: A direction order with no cells is created, Build must be called before it is read
+DirOrder::DirOrder()
+{
+	// Nothing has been ordered yet
+	memBytes = ZERO;
+
+}// end DC
+
+
+
+
+// O(1) - Destructor
+// Pre: N/A
+// Post: The class object is destroyed
+DirOrder::~DirOrder()
+{
+	// The arrays free themselves, they are no longer counted
+	MemRelease(MEM_MAPS, memBytes);
+
+}// end Destructor
+
+
+
+
+// O(N^2 * E) for E exits with DIR_ORDER_MANHATTAN, O(N^2) otherwise - Mutator
+// Pre: The size of the board, its layout, the distance map if the policy reads it, and the policy
+// Post: Every cell holds the order its neighbours are tried in under the policy
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+void DirOrder::Build(/*IN*/const int& rows,					// Number of rows in the board
+					 /*IN*/const int& cols,					// Number of columns in the board
+					 /*IN*/const LayoutRec& layout,			// The entrance and exits
+					 /*IN*/const DistanceMap& distMap,		// Each cell's distance from the nearest exit
+					 /*IN*/const DirOrderEnum& policy)		// How the neighbours are ordered
+{
+	vector<int> scoreArr;			// Each cell's closeness to the nearest exit, lower is closer
+	Location2DRec loc;				// The cell being ordered
+	Location2DRec newLoc;			// The neighbour being scored
+	DirectionEnum order[ORDER_DIRS];	// The cell's directions, in the order they are tried
+	int score[ORDER_DIRS];			// The score of the neighbour in each direction of the order
+	DirectionEnum dir;				// The direction being placed in the order
+	int dirScore;					// The score of the neighbour in that direction
+	int pos;						// The number of directions placed in the order so far
+	int slot;						// Where the direction goes in the order
+	size_t cell;					// The cell's index in row major order
+	int code;						// The order's directions packed two bits each
+	int codeArr[ORDER_CODES];		// The index of each packed order added so far, or NO_ORDER
+	long long scoreBytes;			// The bytes of the scores counted in memaccount.h
+	long long tableBytes;			// The bytes of the orders' tables
+
+	try
+	{
+		// Start over with no orders
+		permArr.assign((size_t)rows * cols, ZERO);
+		nextArr.clear();
+		lastArr.clear();
+
+		// Every cell starts out as close as every other, as with the fixed order
+		scoreArr.assign((size_t)rows * cols, ZERO);
+	}
+	catch (std::bad_alloc)	// The heap space memory has run out
+	{
+		// Throw the exception
+		throw GBOutOfMemoryException();
+	}
+
+	// Count the cells' orders in place of any built before, and the scores until they are done with
+	MemRelease(MEM_MAPS, memBytes);
+	memBytes = (long long)permArr.size() * sizeof(unsigned char);
+	scoreBytes = (long long)scoreArr.size() * sizeof(int);
+	MemAdd(MEM_MAPS, memBytes + scoreBytes);
+
+	// Score each cell by how close it is to the nearest exit under the policy
+	for (loc.x = ZERO; loc.x < rows; loc.x++)
+		for (loc.y = ZERO; loc.y < cols; loc.y++)
+		{
+			cell = (size_t)loc.x * cols + loc.y;
+
+			// The rows plus columns to the nearest exit
+			if (policy == DIR_ORDER_MANHATTAN)
+			{
+				scoreArr[cell] = INT_MAX;
+				for (size_t i = ZERO; i < layout.exits.size(); i++)
+					scoreArr[cell] = min(scoreArr[cell], abs(loc.x - layout.exits[i].loc.x) +
+														 abs(loc.y - layout.exits[i].loc.y));
+			}
+
+			// The moves to the nearest exit, a cell that cannot reach one is tried last
+			else if (policy == DIR_ORDER_DISTANCE)
+			{
+				scoreArr[cell] = distMap.GetDistance(loc);
+				if (scoreArr[cell] == NO_DISTANCE)
+					scoreArr[cell] = INT_MAX;
+			}
+		}
+
+	// No order has been added yet
+	for (int i = ZERO; i < ORDER_CODES; i++)
+		codeArr[i] = NO_ORDER;
+
+	// Order each cell's neighbours by their scores, an insertion sort keeps the N, E, S, W
+	// order between neighbours with the same score
+	for (loc.x = ZERO; loc.x < rows; loc.x++)
+		for (loc.y = ZERO; loc.y < cols; loc.y++)
+		{
+			pos = ZERO;
+			for (dir = NextDir(NA); dir != NA; dir = NextDir(dir))
+			{
+				// A neighbour off the board is tried after every one on it
+				newLoc = Move(dir, loc);
+				if (newLoc.x >= ZERO && newLoc.x < rows && newLoc.y >= ZERO && newLoc.y < cols)
+					dirScore = scoreArr[(size_t)newLoc.x * cols + newLoc.y];
+				else
+					dirScore = INT_MAX;
+
+				// Slide the directions with higher scores up to make room
+				slot = pos;
+				while (slot > ZERO && score[slot - OFFSET] > dirScore)
+				{
+					order[slot] = order[slot - OFFSET];
+					score[slot] = score[slot - OFFSET];
+					slot--;
+				}
+				order[slot] = dir;
+				score[slot] = dirScore;
+				pos++;
+			}
+
+			// Look the order up by its packed directions, adding it the first time it is seen
+			code = ZERO;
+			for (int i = ZERO; i < ORDER_DIRS; i++)
+				code = (code << ORDER_CODE_BITS) | (order[i] - NORTH);
+			if (codeArr[code] == NO_ORDER)
+				codeArr[code] = AddOrder(order);
+
+			permArr[(size_t)loc.x * cols + loc.y] = (unsigned char)codeArr[code];
+		}
+
+	// Count the orders' tables, the scores are freed on the way out
+	tableBytes = (long long)(nextArr.capacity() + lastArr.capacity()) * sizeof(DirectionEnum);
+	memBytes += tableBytes;
+	MemAdd(MEM_MAPS, tableBytes);
+	MemRelease(MEM_MAPS, scoreBytes);
+
+}// end Build
+
+
+
+
+// O(1)
+// Pre: The four directions in the order they are tried, an order not added yet
+// Post: The order's table is added and its index is returned
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+int DirOrder::AddOrder(/*IN*/const DirectionEnum order[])		// The four directions in the order tried
+{
+	int orderCt = (int)lastArr.size();		// The number of orders so far
+
+	try
+	{
+		// Add the order's table, NA leads to its first direction and its last leads back to NA
+		nextArr.resize((size_t)(orderCt + OFFSET) * ORDER_STEPS, NA);
+		nextArr[(size_t)orderCt * ORDER_STEPS + NA] = order[ZERO];
+		for (int i = OFFSET; i < ORDER_DIRS; i++)
+			nextArr[(size_t)orderCt * ORDER_STEPS + order[i - OFFSET]] = order[i];
+		lastArr.push_back(order[ORDER_DIRS - OFFSET]);
+	}
+	catch (std::bad_alloc)	// The heap space memory has run out
+	{
+		// Throw the exception
+		throw GBOutOfMemoryException();
+	}
+
+	return orderCt;
+
+}// end AddOrder
+
+
+
+
+// O(1)
+// Pre: The number of rows and columns
+// Post: The bytes of each cell's order, of each cell's score used while building, and of a table
+//		 for every order the four directions can be in, are returned, as counted in memaccount.h
+long long DirOrder::OrderBytes(/*IN*/const int& rows,		// The number of rows
+							   /*IN*/const int& cols)		// The number of columns
+{
+	return (long long)rows * cols * (sizeof(unsigned char) + sizeof(int)) +
+		   (long long)ORDER_MAX * (ORDER_STEPS + OFFSET) * sizeof(DirectionEnum);
+
+}// end OrderBytes
+
+
+
+
+// O(1)
+// Pre: The ordering policy
+// Post: "fixed", "manhattan" or "distance" is returned
+const char* OrderText(/*IN*/const DirOrderEnum& policy)		// The ordering policy
+{
+	// Return the appropriate name
+	switch (policy)
+	{
+	case DIR_ORDER_MANHATTAN: return "manhattan";
+	case DIR_ORDER_DISTANCE: return "distance";
+	default: return "fixed";
+	};
+
+}// end OrderText
@@ -0,0 +1,189 @@
+#pragma once
+/*
+	FileName : dirorder.h
+	Author: Christian Siletti
+	Date: 5/14/24
+	Project Maze
+
+	PURPOSE:
+		Contains the specifications for a DirOrder Class. A direction order holds, for each cell
+		of a board, the order the search tries the cell's four neighbours in. NextDir always tries
+		N, E, S, W, so on a board whose exit is to the south west the search walks the whole
+		north east of the board before its first path. Every path is still found in any order,
+		only the order the paths are found in changes, so a search stopped at its first path
+		(--first) finds it sooner when the neighbours nearer an exit are tried first.
+
+		The orders are picked by a policy:
+			DIR_ORDER_FIXED		- N, E, S, W on every cell, as NextDir does
+			DIR_ORDER_MANHATTAN	- The neighbours closest to the nearest exit as the crow flies, rows
+								  plus columns, first. It needs nothing but the exits' cells
+			DIR_ORDER_DISTANCE	- The neighbours with the fewest moves left to the nearest exit
+								  around the walls first, read from a DistanceMap. The neighbours
+								  that cannot reach an exit are tried last
+
+		Neighbours that are as close as each other are tried in the N, E, S, W order. There are only
+		24 orders of four directions, so each cell holds a byte picking one, and each order is a small
+		table of the direction tried after each one, which keeps the lookup in the search's innermost
+		loop a couple of array reads.
+
+
+	ASSUMPTIONS:
+		1) Directions are searched from NA, and the last direction of a cell's order is followed by NA
+		2) Neighbours off the board are tried last, after every neighbour on it
+		3) The DistanceMap is only read with DIR_ORDER_DISTANCE, and was built to the layout's open exits
+
+
+	EXCEPTION HANDLING/ERROR CHECKING:
+		1) GBOutOfMemoryException thrown when memory from the heap has run out
+
+
+						   SUMMARY OF METHODS:
+	PUBLIC METHODS
+		DirOrder() - Instantiate a direction order with no cells
+		~DirOrder() - Destroy the class object
+		void Build(*IN*const int& rows,					// Number of rows in the board
+				   *IN*const int& cols,					// Number of columns in the board
+				   *IN*const LayoutRec& layout,			// The entrance and exits
+				   *IN*const DistanceMap& distMap,		// Each cell's distance from the nearest exit
+				   *IN*const DirOrderEnum& policy)		// How the neighbours are ordered
+					- Pick the order every cell's neighbours are tried in
+		DirectionEnum Next(*IN*const size_t& cell,			// The cell's index in row major order
+						   *IN*const DirectionEnum& dir) const	// The last direction tried
+					- Get the direction tried after another on a cell
+		bool IsLast(*IN*const size_t& cell,				// The cell's index in row major order
+					*IN*const DirectionEnum& dir) const	// The last direction tried
+					- Check if a direction is the last tried on a cell
+		static long long OrderBytes(*IN*const int& rows,		// The number of rows
+									*IN*const int& cols)		// The number of columns
+					- Return the most bytes an order of a board's size takes from the heap while built
+
+
+	PRIVATE MEMBERS:
+		vector<unsigned char> permArr;		// Each cell's order in row major order
+		vector<DirectionEnum> nextArr;		// Each order's direction after each direction, ORDER_STEPS an order
+		vector<DirectionEnum> lastArr;		// Each order's last direction
+		long long memBytes;					// The bytes of the orders counted in memaccount.h
+
+
+	PRIVATE METHODS:
+		int AddOrder(*IN*const DirectionEnum order[])		// The four directions in the order tried
+					- Add an order's table
+
+
+						   SUMMARY OF FUNCTIONS:
+	const char* OrderText(*IN*const DirOrderEnum& policy)		// The ordering policy
+		- Get the name of an ordering policy as given on the command line
+*/
+
+#include "Constants.h"		// File containing appropriate constants
+#include "optionsrec.h"		// For the ordering policies
+#include "layoutrec.h"		// The entrance and exits record
+#include "distancemap.h"	// For the distances around the walls
+#include <vector>			// For the order arrays
+#include <cstddef>			// For the cells' indexes
+
+using namespace std;    // Standard namespace
+
+
+const int ORDER_DIRS = 4;					// The number of directions in an order
+const int ORDER_STEPS = ORDER_DIRS + 1;		// The directions an order's table is indexed by, NA included
+const int ORDER_CODE_BITS = 2;				// The bits each direction takes in a packed order
+const int ORDER_CODES = 1 << (ORDER_DIRS * ORDER_CODE_BITS);	// The number of packed orders
+const int NO_ORDER = -1;					// A packed order that has not been added
+const int ORDER_MAX = 24;					// The number of orders the four directions can be in
+
+
+
+class DirOrder
+{
+public:
+
+	// O(1) - Default Constructor
+	// Purpose: Instantiate a direction order with no cells
+	// Pre: N/A
+	// Post: A direction order with no cells is created, Build must be called before it is read
+	DirOrder();
+
+
+
+	// O(1) - Destructor
+	// Purpose: Destroy the class object
+	// Pre: N/A
+	// Post: The class object is destroyed
+	~DirOrder();
+
+
+
+	// O(N^2 * E) for E exits with DIR_ORDER_MANHATTAN, O(N^2) otherwise - Mutator
+	// Purpose: Pick the order every cell's neighbours are tried in
+	// Pre: The size of the board, its layout, the distance map if the policy reads it, and the policy
+	// Post: Every cell holds the order its neighbours are tried in under the policy
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	void Build(/*IN*/const int& rows,					// Number of rows in the board
+			   /*IN*/const int& cols,					// Number of columns in the board
+			   /*IN*/const LayoutRec& layout,			// The entrance and exits
+			   /*IN*/const DistanceMap& distMap,		// Each cell's distance from the nearest exit
+			   /*IN*/const DirOrderEnum& policy);		// How the neighbours are ordered
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Get the direction tried after another on a cell
+	// Pre: The order has been built and the cell is on the board
+	// Post: The cell's first direction is returned for NA, and NA after its last direction
+	DirectionEnum Next(/*IN*/const size_t& cell,				// The cell's index in row major order
+					   /*IN*/const DirectionEnum& dir) const	// The last direction tried
+	{
+		return nextArr[(size_t)permArr[cell] * ORDER_STEPS + dir];
+
+	}// end Next
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Check if a direction is the last tried on a cell
+	// Pre: The order has been built and the cell is on the board
+	// Post: True is returned if every direction of the cell has been tried once dir has
+	bool IsLast(/*IN*/const size_t& cell,				// The cell's index in row major order
+				/*IN*/const DirectionEnum& dir) const	// The last direction tried
+	{
+		return lastArr[permArr[cell]] == dir;
+
+	}// end IsLast
+
+
+
+	// O(1)
+	// Purpose: Return the most bytes an order of a board's size takes from the heap while built
+	// Pre: The number of rows and columns
+	// Post: The bytes of each cell's order, of each cell's score used while building, and of a table
+	//		 for every order the four directions can be in, are returned, as counted in memaccount.h
+	static long long OrderBytes(/*IN*/const int& rows,		// The number of rows
+								/*IN*/const int& cols);		// The number of columns
+
+
+
+private:
+	vector<unsigned char> permArr;		// Each cell's order in row major order
+	vector<DirectionEnum> nextArr;		// Each order's direction after each direction, ORDER_STEPS an order
+	vector<DirectionEnum> lastArr;		// Each order's last direction
+	long long memBytes;					// The bytes of the orders counted in memaccount.h
+
+
+
+	// O(1)
+	// Purpose: Add an order's table
+	// Pre: The four directions in the order they are tried, an order not added yet
+	// Post: The order's table is added and its index is returned
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	int AddOrder(/*IN*/const DirectionEnum order[]);		// The four directions in the order tried
+
+};
+
+
+
+// O(1)
+// Purpose: Get the name of an ordering policy as given on the command line
+// Pre: The ordering policy
+// Post: "fixed", "manhattan" or "distance" is returned
+const char* OrderText(/*IN*/const DirOrderEnum& policy);		// The ordering policy
@@ -0,0 +1,196 @@
+// Project Maze
+// FileName : distancemap.cpp
+// Author: Christian Siletti
+// Purpose : This file contains the implementation for all of the methods
+//			 defined in distancemap.h
+
+#include "distancemap.h"	// The header file
+#include "navigation.h"		// For stepping to a cell's neighbours
+#include "memaccount.h"		// For counting the distances and the queue
+#include <new>				// Contains the bad_alloc exception
+
+
+
+// O(1) - Default Constructor
+// Pre: N/A
+// Post: A distance map with no cells is created, every lookup returns NO_DISTANCE
+DistanceMap::DistanceMap()
+{
+	maxRows = ZERO;	// Nothing has been measured yet
+	maxCols = ZERO;
+	memBytes = ZERO;
+
+}// end DC
+
+
+
+
+// O(1) - Destructor
+// Pre: N/A
+// Post: The class object is destroyed
+DistanceMap::~DistanceMap()
+{
+	// The distance array frees itself, it is no longer counted
+	MemRelease(MEM_MAPS, memBytes);
+
+}// end Destructor
+
+
+
+
+// O(N^2) - Mutator
+// Pre: The board with its walls set and the target cell
+// Post: Every cell holds the fewest moves it takes to reach the target
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+void DistanceMap::Build(/*IN*/const GameBoard& board,			// The board being measured
+						/*IN*/const Location2DRec& target)		// The cell distances are measured to
+{
+	// Measure from the one target
+	Build(board, vector<Location2DRec>(OFFSET, target));
+
+}// end Build
+
+
+
+
+// O(N^2) - Mutator
+// Pre: The board with its walls set and the target cells
+// Post: Every cell holds the fewest moves it takes to reach any of the targets,
+//		 walled targets are left out
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+void DistanceMap::Build(/*IN*/const GameBoard& board,						// The board being measured
+						/*IN*/const vector<Location2DRec>& targets)		// The cells distances are measured to
+{
+	vector<Location2DRec> queue;	// The cells waiting to have their neighbours measured
+	size_t front = ZERO;			// The position of the next cell in the queue
+	Location2DRec currLoc;			// The cell being expanded
+	Location2DRec newLoc;			// The neighbour being measured
+	int currDist;					// The distance of the cell being expanded
+	long long queueBytes;			// The bytes of the queue counted in memaccount.h
+
+	// Get the size of the board
+	board.GetSize(maxRows, maxCols);
+
+	try
+	{
+		// Every cell starts out unreachable
+		distArr.assign((size_t)maxRows * maxCols, NO_DISTANCE);
+		queue.reserve((size_t)maxRows * maxCols);
+	}
+	catch (std::bad_alloc)	// The heap space memory has run out
+	{
+		// Throw the exception
+		throw GBOutOfMemoryException();
+	}
+
+	// Count the distances in place of any measured before, and the queue until it is done with
+	MemRelease(MEM_MAPS, memBytes);
+	memBytes = (long long)distArr.size() * sizeof(int);
+	queueBytes = (long long)queue.capacity() * sizeof(Location2DRec);
+	MemAdd(MEM_MAPS, memBytes + queueBytes);
+
+	// Start the search at every target, a walled off target cannot be reached from anywhere
+	for (size_t i = ZERO; i < targets.size(); i++)
+		if (board.GetStatus(targets[i]) != WALL && board.GetStatus(targets[i]) != OUT_OF_BOUNDS &&
+			distArr[(size_t)targets[i].x * maxCols + targets[i].y] == NO_DISTANCE)
+		{
+			distArr[(size_t)targets[i].x * maxCols + targets[i].y] = ZERO;
+			queue.push_back(targets[i]);
+		}
+
+	// Repeat until every reachable cell has been measured, the targets all start at zero
+	// so each cell is reached first from its nearest target
+	while (front < queue.size())
+	{
+		// Take the next cell off the queue
+		currLoc = queue[front++];
+		currDist = distArr[(size_t)currLoc.x * maxCols + currLoc.y];
+
+		// Measure each neighbour that has not been reached yet
+		for (DirectionEnum dir = NextDir(NA); dir != NA; dir = NextDir(dir))
+		{
+			newLoc = Move(dir, currLoc);
+
+			if (board.GetStatus(newLoc) != WALL && board.GetStatus(newLoc) != OUT_OF_BOUNDS &&
+				distArr[(size_t)newLoc.x * maxCols + newLoc.y] == NO_DISTANCE)
+			{
+				distArr[(size_t)newLoc.x * maxCols + newLoc.y] = currDist + OFFSET;
+				queue.push_back(newLoc);
+			}
+		}
+
+	}// end while
+
+	// The queue is freed on the way out
+	MemRelease(MEM_MAPS, queueBytes);
+
+}// end Build
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: The map has been built
+// Post: The cell's distance is returned, or NO_DISTANCE if the target cannot be reached from it
+int DistanceMap::GetDistance(/*IN*/const Location2DRec& loc) const	// The cell being looked up
+{
+	// Check if the cooridnate is within the bounds of the map
+	if (loc.x >= ZERO && loc.x < maxRows && loc.y >= ZERO && loc.y < maxCols)
+		return distArr[(size_t)loc.x * maxCols + loc.y];	// Return the distance of the cell
+
+	// Otherwise the cell cannot reach anything
+	return NO_DISTANCE;
+
+}// end GetDistance
+
+
+
+
+// O(N) for a path of N moves - Observer Accessor
+// Pre: The map has been built
+// Post: pathText holds the path's directions, "D-" for each move, trying each cell's
+//		 neighbours in N, E, S, W order, and end holds the target it finishes on.
+//		 false is returned, with pathText empty, if no target can be reached from the cell
+bool DistanceMap::GetShortestPath(/*IN*/const Location2DRec& from,		// The cell the path starts on
+								  /*OUT*/string& pathText,				// The directions travelled
+								  /*OUT*/Location2DRec& end) const		// The target the path finishes on
+{
+	DirectionEnum dir;		// The direction being tried
+	Location2DRec next;		// The neighbour being tried
+
+	pathText.clear();
+	end = from;
+	if (GetDistance(from) == NO_DISTANCE)
+		return false;
+
+	// Step to a neighbour one move closer until a target is reached
+	while (GetDistance(end) != ZERO)
+	{
+		for (dir = NextDir(NA); dir != NA; dir = NextDir(dir))
+		{
+			next = Move(dir, end);
+			if (GetDistance(next) == GetDistance(end) - OFFSET)
+				break;
+		}
+
+		pathText.append(DirText(dir), DIR_TEXT_LEN);
+		end = next;
+	}
+
+	return true;
+
+}// end GetShortestPath
+
+
+
+
+// O(1)
+// Pre: The number of rows and columns
+// Post: The bytes of the distances and of the queue of cells waiting to be measured, which
+//		 can hold every cell, are returned, as counted in memaccount.h
+long long DistanceMap::MapBytes(/*IN*/const int& rows,		// The number of rows
+								/*IN*/const int& cols)		// The number of columns
+{
+	return (long long)rows * cols * (sizeof(int) + sizeof(Location2DRec));
+
+}// end MapBytes
@@ -0,0 +1,151 @@
+#pragma once
+/*
+	FileName : distancemap.h
+	Author: Christian Siletti
+	Date: 4/15/24
+	Project Maze
+
+	PURPOSE:
+		Contains the specifications for a DistanceMap Class. A distance map holds the
+		fewest number of moves needed to get from each cell of a gameboard to a target cell
+		(or the nearest of several), walking only through cells that are not walls. It is built
+		once with a breadth first search, after which any cell's distance can be looked up in O(1).
+
+		Since the distances ignore VISITED cells, they never overestimate how many moves a
+		partial path still needs, so a search can safely drop any path whose length so far
+		plus its distance left is over a limit.
+
+		GetDistance is virtual so a map that keeps its distances some other way, such as the
+		DynamicMap repaired after each edit (see dynamicmap.h), can be handed to anything that
+		reads a DistanceMap without being measured again.
+
+
+	ASSUMPTIONS:
+		1) The board passed to Build has its walls set
+		2) Only WALL and OUT_OF_BOUNDS cells block a move
+
+
+	EXCEPTION HANDLING/ERROR CHECKING:
+		1) GetDistance returns NO_DISTANCE for cells outside the board, walls,
+		   and cells that cannot reach the target.
+		2) GBOutOfMemoryException thrown when memory from the heap has run out
+
+
+						   SUMMARY OF METHODS:
+	PUBLIC METHODS
+		DistanceMap() - Instantiate an empty distance map
+		virtual ~DistanceMap() - Destroy the class object
+		void Build(*IN*const GameBoard& board,			// The board being measured
+				   *IN*const Location2DRec& target)		// The cell distances are measured to
+					- Measure every cell's distance to the target
+		void Build(*IN*const GameBoard& board,						// The board being measured
+				   *IN*const vector<Location2DRec>& targets)		// The cells distances are measured to
+					- Measure every cell's distance to the nearest of several targets
+		virtual int GetDistance(*IN*const Location2DRec& loc) const	// The cell being looked up
+					- Return the number of moves from a cell to the target
+		bool GetShortestPath(*IN*const Location2DRec& from,		// The cell the path starts on
+							 *OUT*string& pathText,				// The directions travelled
+							 *OUT*Location2DRec& end) const		// The target the path finishes on
+					- Walk a shortest path from a cell to the nearest target
+		static long long MapBytes(*IN*const int& rows,		// The number of rows
+								  *IN*const int& cols)		// The number of columns
+					- Return the most bytes a map of a board's size takes from the heap while built
+
+
+	PRIVATE MEMBERS:
+		int maxRows;			// The number of rows measured
+		int maxCols;			// The number of columns measured
+		vector<int> distArr;	// Each cell's distance in row major order
+		long long memBytes;		// The bytes of the distances counted in memaccount.h
+*/
+
+#include "gameboard.h"		// Allows access to the gameboard ADT
+#include <vector>			// For the distance array
+#include <string>			// For the directions of a shortest path
+
+using namespace std;    // Standard namespace
+
+
+const int NO_DISTANCE = -1;		// The distance of a cell that cannot reach the target
+
+
+
+class DistanceMap
+{
+public:
+
+	// O(1) - Default Constructor
+	// Purpose: Instantiate an empty distance map
+	// Pre: N/A
+	// Post: A distance map with no cells is created, every lookup returns NO_DISTANCE
+	DistanceMap();
+
+
+
+	// O(1) - Destructor
+	// Purpose: Destroy the class object
+	// Pre: N/A
+	// Post: The class object is destroyed
+	virtual ~DistanceMap();
+
+
+
+	// O(N^2) - Mutator
+	// Purpose: Measure every cell's distance to the target
+	// Pre: The board with its walls set and the target cell
+	// Post: Every cell holds the fewest moves it takes to reach the target
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	void Build(/*IN*/const GameBoard& board,			// The board being measured
+			   /*IN*/const Location2DRec& target);		// The cell distances are measured to
+
+
+
+	// O(N^2) - Mutator
+	// Purpose: Measure every cell's distance to the nearest of several targets
+	// Pre: The board with its walls set and the target cells
+	// Post: Every cell holds the fewest moves it takes to reach any of the targets,
+	//		 walled targets are left out
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	void Build(/*IN*/const GameBoard& board,						// The board being measured
+			   /*IN*/const vector<Location2DRec>& targets);		// The cells distances are measured to
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return the number of moves from a cell to the target
+	// Pre: The map has been built
+	// Post: The cell's distance is returned, or NO_DISTANCE if the target cannot be reached from it
+	virtual int GetDistance(/*IN*/const Location2DRec& loc) const;	// The cell being looked up
+
+
+
+	// O(N) for a path of N moves - Observer Accessor
+	// Purpose: Walk a shortest path from a cell to the nearest target
+	// Pre: The map has been built
+	// Post: pathText holds the path's directions, "D-" for each move, trying each cell's
+	//		 neighbours in N, E, S, W order, and end holds the target it finishes on.
+	//		 false is returned, with pathText empty, if no target can be reached from the cell
+	bool GetShortestPath(/*IN*/const Location2DRec& from,		// The cell the path starts on
+						 /*OUT*/string& pathText,				// The directions travelled
+						 /*OUT*/Location2DRec& end) const;		// The target the path finishes on
+
+
+
+	// O(1)
+	// Purpose: Return the most bytes a map of a board's size takes from the heap while built
+	// Pre: The number of rows and columns
+	// Post: The bytes of the distances and of the queue of cells waiting to be measured, which
+	//		 can hold every cell, are returned, as counted in memaccount.h
+	static long long MapBytes(/*IN*/const int& rows,		// The number of rows
+							  /*IN*/const int& cols);		// The number of columns
+
+
+
+private:
+	int maxRows;			// The number of rows measured
+	int maxCols;			// The number of columns measured
+
+	vector<int> distArr;	// Each cell's distance in row major order
+	long long memBytes;		// The bytes of the distances counted in memaccount.h
+
+};
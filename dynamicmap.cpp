@@ -0,0 +1,846 @@
+// Project Maze
+// FileName : dynamicmap.cpp
+// Author: Christian Siletti
+// Purpose : This file contains the implementation for all of the methods
+//			 defined in dynamicmap.h
+
+#include "dynamicmap.h"		// The header file
+#include "navigation.h"		// For stepping to a cell's neighbours and printed directions
+#include "memaccount.h"		// For counting the cell arrays and the queues
+#include <new>				// Contains the bad_alloc exception
+
+const int OFF_BOARD = -1;				// The neighbour of a cell on the edge of the board
+const int UNREACHED = 2147483647;		// The distance of a cell that cannot reach an exit
+const signed char NO_OWNER = -1;		// A cell no search has reached while splitting a component
+const int MAX_NEIGHBOURS = 4;			// The most open neighbours a cell can have
+
+
+
+// O(1) - Default Constructor
+// Pre: N/A
+// Post: A map with no cells is created, every lookup returns NO_DISTANCE or NO_COMPONENT
+DynamicMap::DynamicMap()
+{
+	maxRows = ZERO;	// Nothing has been measured yet
+	maxCols = ZERO;
+	deadEndCt = ZERO;
+	workCt = ZERO;
+	memBytes = ZERO;
+
+}// end DC
+
+
+
+
+// O(1) - Destructor
+// Pre: N/A
+// Post: The class object is destroyed
+DynamicMap::~DynamicMap()
+{
+	// The cell arrays free themselves, they are no longer counted
+	MemRelease(MEM_MAPS, memBytes);
+
+}// end Destructor
+
+
+
+
+// O(N^2) - Mutator
+// Pre: The board with its walls set and its layout
+// Post: Every open cell holds its distance to the nearest open exit and its component,
+//		 and the dead ends are trimmed
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+void DynamicMap::Build(/*IN*/const GameBoard& board,		// The board being measured
+					   /*IN*/const LayoutRec& layout)		// The entrance and exits
+{
+	vector<int> queue;		// The cells waiting to be measured or labelled
+	vector<int> leafArr;	// The cells that may be dead ends
+	Location2DRec loc;		// The cell being read in
+	size_t front;			// The position of the next cell in the queue
+	size_t cellCt;			// The number of cells on the board
+	int cell;				// The cell being measured from
+	int next;				// Its neighbour
+	int comp;				// The component being labelled
+	long long queueBytes;	// The bytes of the queue and the dead ends counted in memaccount.h
+
+	// Get the size of the board
+	board.GetSize(maxRows, maxCols);
+	cellCt = (size_t)maxRows * maxCols;
+
+	try
+	{
+		// Start over with every cell unreachable and in no component
+		openArr.assign(cellCt, false);
+		keepArr.assign(cellCt, false);
+		exitArr.assign(cellCt, false);
+		gArr.assign(cellCt, UNREACHED);
+		rhsArr.assign(cellCt, UNREACHED);
+		compArr.assign(cellCt, NO_COMPONENT);
+		ownerArr.assign(cellCt, NO_OWNER);
+		trimArr.assign(cellCt, false);
+		degreeArr.assign(cellCt, ZERO);
+		compSizeArr.clear();
+		freeCompArr.clear();
+		exitCellArr.clear();
+		distQueue = DistQueue();
+
+		// No more than every other cell can be a component of its own, and every open cell is
+		// queued and may be a dead end once, so none of these grow while built
+		compSizeArr.reserve((cellCt + OFFSET) / 2);
+		queue.reserve(cellCt);
+		leafArr.reserve(cellCt);
+
+		for (loc.x = ZERO; loc.x < maxRows; loc.x++)
+			for (loc.y = ZERO; loc.y < maxCols; loc.y++)
+				openArr[(size_t)loc.x * maxCols + loc.y] = board.GetStatus(loc) != WALL;
+
+		// The entrance and exits are never trimmed
+		keepArr[(size_t)layout.start.x * maxCols + layout.start.y] = true;
+		for (size_t i = ZERO; i < layout.exits.size(); i++)
+		{
+			cell = layout.exits[i].loc.x * maxCols + layout.exits[i].loc.y;
+			exitCellArr.push_back(cell);
+			keepArr[cell] = true;
+			exitArr[cell] = true;
+		}
+	}
+	catch (std::bad_alloc)	// The heap space memory has run out
+	{
+		// Throw the exception
+		throw GBOutOfMemoryException();
+	}
+
+	// Count the cell arrays in place of any built before, and the queue and dead ends until they are done with
+	MemRelease(MEM_MAPS, memBytes);
+	memBytes = (long long)(openArr.capacity() + keepArr.capacity() + exitArr.capacity() + trimArr.capacity() +
+						   degreeArr.capacity()) * sizeof(unsigned char) + (long long)ownerArr.capacity() * sizeof(signed char) +
+			   (long long)(gArr.capacity() + rhsArr.capacity() + compArr.capacity() + compSizeArr.capacity() +
+						   exitCellArr.capacity()) * sizeof(int);
+	queueBytes = (long long)(queue.capacity() + leafArr.capacity()) * sizeof(int);
+	MemAdd(MEM_MAPS, memBytes + queueBytes);
+
+	// Measure the distances breadth first from every open exit, they all start out agreeing
+	for (size_t i = ZERO; i < exitCellArr.size(); i++)
+		if (openArr[exitCellArr[i]] && gArr[exitCellArr[i]] == UNREACHED)
+		{
+			gArr[exitCellArr[i]] = ZERO;
+			rhsArr[exitCellArr[i]] = ZERO;
+			queue.push_back(exitCellArr[i]);
+		}
+
+	for (front = ZERO; front < queue.size(); front++)
+		for (DirectionEnum dir = NextDir(NA); dir != NA; dir = NextDir(dir))
+		{
+			next = StepCell(queue[front], dir);
+			if (next != OFF_BOARD && openArr[next] && gArr[next] == UNREACHED)
+			{
+				gArr[next] = gArr[queue[front]] + OFFSET;
+				rhsArr[next] = gArr[next];
+				queue.push_back(next);
+			}
+		}
+
+	// Label the components a flood at a time
+	for (cell = ZERO; cell < (int)cellCt; cell++)
+		if (openArr[cell] && compArr[cell] == NO_COMPONENT)
+		{
+			comp = NewComponent();
+			compArr[cell] = comp;
+			queue.assign(OFFSET, cell);
+
+			for (front = ZERO; front < queue.size(); front++)
+				for (DirectionEnum dir = NextDir(NA); dir != NA; dir = NextDir(dir))
+				{
+					next = StepCell(queue[front], dir);
+					if (next != OFF_BOARD && openArr[next] && compArr[next] == NO_COMPONENT)
+					{
+						compArr[next] = comp;
+						queue.push_back(next);
+					}
+				}
+
+			compSizeArr[comp] = (int)queue.size();
+		}
+
+	// Count each open cell's neighbours, and trim the dead ends
+	deadEndCt = ZERO;
+	for (cell = ZERO; cell < (int)cellCt; cell++)
+		if (openArr[cell])
+		{
+			for (DirectionEnum dir = NextDir(NA); dir != NA; dir = NextDir(dir))
+			{
+				next = StepCell(cell, dir);
+				if (next != OFF_BOARD && openArr[next])
+					degreeArr[cell]++;
+			}
+			leafArr.push_back(cell);
+		}
+	TrimDeadEnds(leafArr);
+
+	workCt = ZERO;
+
+	// The queue and the dead ends are freed on the way out
+	MemRelease(MEM_MAPS, queueBytes);
+
+}// end Build
+
+
+
+
+// O(M log M) for the M cells whose distance, component or trimming is changed
+// Pre: The board the map was built from
+// Post: The cell is set on the board, and the map is the same as one built from scratch
+//		 on the board as it now is. false is returned if the cell is off the board or the
+//		 status is not WALL or OPEN
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+bool DynamicMap::SetStatus(/*IN/OUT*/GameBoard& board,				// The board the map was built from
+						   /*IN*/const Location2DRec& loc,			// The cell being changed
+						   /*IN*/const StateEnum& newStatus)		// WALL or OPEN
+{
+	vector<int> leafArr;	// The cells the new wall may have left dead ends
+	int cell;				// The cell being changed
+	int next;				// Its neighbour
+	bool opening = newStatus == OPEN;	// Holds if a wall is being taken down
+
+	// Only walls can be put up or taken down, and only on the board
+	if (loc.x < ZERO || loc.x >= maxRows || loc.y < ZERO || loc.y >= maxCols ||
+		(newStatus != WALL && newStatus != OPEN))
+		return false;
+
+	board.SetStatus(loc, newStatus);
+	workCt = ZERO;
+
+	// Nothing to repair if the cell already was what it was set to
+	cell = loc.x * maxCols + loc.y;
+	if ((bool)openArr[cell] == opening)
+		return true;
+	openArr[cell] = opening;
+
+	try
+	{
+		if (opening)
+		{
+			// Join the components around it and untrim the dead ends it may have joined up
+			JoinComponents(cell);
+			UntrimAround(cell);
+		}
+		else
+		{
+			SplitComponent(cell);
+
+			// A wall has no neighbours of its own, and its neighbours lose it
+			if (trimArr[cell])
+				deadEndCt--;
+			else
+				for (DirectionEnum dir = NextDir(NA); dir != NA; dir = NextDir(dir))
+				{
+					next = StepCell(cell, dir);
+					if (next != OFF_BOARD && openArr[next])
+					{
+						degreeArr[next]--;
+						leafArr.push_back(next);
+					}
+				}
+			trimArr[cell] = false;
+			degreeArr[cell] = ZERO;
+			TrimDeadEnds(leafArr);
+		}
+
+		// Only the cell's own rhs changed, the repair passes the change on from there
+		UpdateCell(cell);
+		RepairDistances();
+	}
+	catch (std::bad_alloc)	// The heap space memory has run out
+	{
+		// Throw the exception
+		throw GBOutOfMemoryException();
+	}
+
+	return true;
+
+}// end SetStatus
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: The map has been built
+// Post: The cell's distance is returned, or NO_DISTANCE if no exit can be reached from it
+int DynamicMap::GetDistance(/*IN*/const Location2DRec& loc) const	// The cell being looked up
+{
+	// Check if the cooridnate is within the bounds of the map and can reach an exit
+	if (loc.x >= ZERO && loc.x < maxRows && loc.y >= ZERO && loc.y < maxCols &&
+		gArr[(size_t)loc.x * maxCols + loc.y] != UNREACHED)
+		return gArr[(size_t)loc.x * maxCols + loc.y];	// Return the distance of the cell
+
+	// Otherwise the cell cannot reach anything
+	return NO_DISTANCE;
+
+}// end GetDistance
+
+
+
+
+// O(N) for a path of N moves
+// Pre: The map has been built
+// Post: pathText holds the path's moves as "D-" pairs, without the exit move, and exit holds
+//		 the layout index of the exit it finishes on. Each move tries N, E, S, W in turn.
+//		 false is returned if no exit can be reached from the cell
+bool DynamicMap::GetPath(/*IN*/const Location2DRec& from,		// The cell the path starts on
+						 /*OUT*/string& pathText,				// The directions travelled
+						 /*OUT*/int& exit) const				// The exit the path finishes on
+{
+	DirectionEnum dir;	// The direction being tried
+	int cell;			// The cell the path has reached
+	int next;			// The neighbour being tried
+
+	pathText.clear();
+	exit = NO_EXIT;
+	if (GetDistance(from) == NO_DISTANCE)
+		return false;
+
+	// Step to a neighbour one move closer until an exit is reached
+	cell = from.x * maxCols + from.y;
+	while (gArr[cell] != ZERO)
+	{
+		for (dir = NextDir(NA); dir != NA; dir = NextDir(dir))
+		{
+			next = StepCell(cell, dir);
+			if (next != OFF_BOARD && openArr[next] && gArr[next] == gArr[cell] - OFFSET)
+				break;
+		}
+
+		pathText.append(DirText(dir), DIR_TEXT_LEN);
+		cell = next;
+	}
+
+	// Find which exit it is, the first exit given on the cell
+	for (int i = ZERO; i < (int)exitCellArr.size() && exit == NO_EXIT; i++)
+		if (exitCellArr[i] == cell)
+			exit = i;
+
+	return true;
+
+}// end GetPath
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: The map has been built
+// Post: The cell's component is returned, or NO_COMPONENT if it is a wall or off the board
+int DynamicMap::GetComponent(/*IN*/const Location2DRec& loc) const	// The cell being looked up
+{
+	// Check if the cooridnate is within the bounds of the map
+	if (loc.x >= ZERO && loc.x < maxRows && loc.y >= ZERO && loc.y < maxCols)
+		return compArr[(size_t)loc.x * maxCols + loc.y];
+
+	return NO_COMPONENT;
+
+}// end GetComponent
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: The map has been built
+// Post: true is returned if both cells are open and in the same component
+bool DynamicMap::IsConnected(/*IN*/const Location2DRec& from,			// One of the cells
+							 /*IN*/const Location2DRec& to) const		// The other cell
+{
+	return GetComponent(from) != NO_COMPONENT && GetComponent(from) == GetComponent(to);
+
+}// end IsConnected
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: The map has been built
+// Post: The size of the cell's component is returned, or 0 if the cell is not open
+int DynamicMap::CountReachable(/*IN*/const Location2DRec& from) const	// The cell being started from
+{
+	if (GetComponent(from) == NO_COMPONENT)
+		return ZERO;
+
+	return compSizeArr[GetComponent(from)];
+
+}// end CountReachable
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: The map has been built
+// Post: true is returned if the cell is open and can never be in the middle of a path
+bool DynamicMap::IsDeadEnd(/*IN*/const Location2DRec& loc) const	// The cell being looked up
+{
+	return loc.x >= ZERO && loc.x < maxRows && loc.y >= ZERO && loc.y < maxCols &&
+		   trimArr[(size_t)loc.x * maxCols + loc.y];
+
+}// end IsDeadEnd
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: The map has been built
+// Post: The number of dead end cells is returned
+int DynamicMap::GetDeadEndCount() const
+{
+	return deadEndCt;
+
+}// end GetDeadEndCount
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: N/A
+// Post: The number of cells queued, searched or trimmed by the last SetStatus is returned
+long long DynamicMap::GetEditWork() const
+{
+	return workCt;
+
+}// end GetEditWork
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: A cell on the board and a compass direction
+// Post: The neighbour's index in row major order is returned, or OFF_BOARD if the move leaves the board
+int DynamicMap::StepCell(/*IN*/const int& cell,					// The cell moved from
+						 /*IN*/const DirectionEnum& dir) const	// The direction moved in
+{
+	Location2DRec loc;		// The cell's row and column
+	Location2DRec newLoc;	// The neighbour's row and column
+
+	loc.x = cell / maxCols;
+	loc.y = cell % maxCols;
+	newLoc = Move(dir, loc);
+
+	if (newLoc.x < ZERO || newLoc.x >= maxRows || newLoc.y < ZERO || newLoc.y >= maxCols)
+		return OFF_BOARD;
+
+	return newLoc.x * maxCols + newLoc.y;
+
+}// end StepCell
+
+
+
+
+// O(log N) - Mutator
+// Pre: A cell on the board
+// Post: The cell's rhs is zero on an open exit, unreachable on a wall, and otherwise one more
+//		 than its nearest open neighbour's distance. The cell is queued if its distance is not its rhs
+void DynamicMap::UpdateCell(/*IN*/const int& cell)			// The cell being measured again
+{
+	int next;	// A neighbour of the cell
+
+	workCt++;
+
+	// Work out what the cell's neighbours say its distance should be
+	if (!openArr[cell])
+		rhsArr[cell] = UNREACHED;
+	else if (exitArr[cell])
+		rhsArr[cell] = ZERO;
+	else
+	{
+		rhsArr[cell] = UNREACHED;
+		for (DirectionEnum dir = NextDir(NA); dir != NA; dir = NextDir(dir))
+		{
+			next = StepCell(cell, dir);
+			if (next != OFF_BOARD && openArr[next] && gArr[next] != UNREACHED)
+				rhsArr[cell] = min(rhsArr[cell], gArr[next] + OFFSET);
+		}
+	}
+
+	// Queue it to be settled if it disagrees, by the lower of the two
+	if (gArr[cell] != rhsArr[cell])
+		distQueue.push(make_pair(min(gArr[cell], rhsArr[cell]), cell));
+
+}// end UpdateCell
+
+
+
+
+// O(M log M) for the M cells settled
+// Pre: The cells an edit changed the rhs of have been updated
+// Post: Every cell's distance is its rhs, and the queue is empty
+void DynamicMap::RepairDistances()
+{
+	int key;	// The key the cell was queued with
+	int cell;	// The cell being settled
+	int next;	// Its neighbour
+
+	while (!distQueue.empty())
+	{
+		key = distQueue.top().first;
+		cell = distQueue.top().second;
+		distQueue.pop();
+
+		// A cell may be queued again before it is settled, only its latest entry counts
+		if (gArr[cell] == rhsArr[cell] || key != min(gArr[cell], rhsArr[cell]))
+			continue;
+
+		// A cell that was found closer takes its new distance, and a cell that lost the way
+		// it was measured through is unreachable until it is measured again
+		if (gArr[cell] > rhsArr[cell])
+			gArr[cell] = rhsArr[cell];
+		else
+		{
+			gArr[cell] = UNREACHED;
+			UpdateCell(cell);
+		}
+
+		// Its neighbours were measured through it
+		for (DirectionEnum dir = NextDir(NA); dir != NA; dir = NextDir(dir))
+		{
+			next = StepCell(cell, dir);
+			if (next != OFF_BOARD && openArr[next])
+				UpdateCell(next);
+		}
+
+	}// end while
+
+}// end RepairDistances
+
+
+
+
+// O(1) - Mutator
+// Pre: N/A
+// Post: A component with no cells is returned
+int DynamicMap::NewComponent()
+{
+	int comp;	// The component handed out
+
+	// Hand out a freed component before making a new one
+	if (!freeCompArr.empty())
+	{
+		comp = freeCompArr.back();
+		freeCompArr.pop_back();
+	}
+	else
+	{
+		comp = (int)compSizeArr.size();
+		compSizeArr.push_back(ZERO);
+	}
+
+	compSizeArr[comp] = ZERO;
+	return comp;
+
+}// end NewComponent
+
+
+
+
+// O(M) for a component of M cells
+// Pre: An open cell and the component its component is joining
+// Post: Every cell of the cell's old component is in comp, and the old component is freed
+void DynamicMap::Relabel(/*IN*/const int& from,			// A cell of the component being relabelled
+						 /*IN*/const int& comp)			// The component it is joining
+{
+	vector<int> stack;				// The cells waiting to be relabelled
+	int oldComp = compArr[from];	// The component being relabelled
+	int cell;						// The cell being relabelled
+	int next;						// Its neighbour
+
+	compArr[from] = comp;
+	stack.push_back(from);
+	while (!stack.empty())
+	{
+		cell = stack.back();
+		stack.pop_back();
+		workCt++;
+
+		for (DirectionEnum dir = NextDir(NA); dir != NA; dir = NextDir(dir))
+		{
+			next = StepCell(cell, dir);
+			if (next != OFF_BOARD && compArr[next] == oldComp)
+			{
+				compArr[next] = comp;
+				stack.push_back(next);
+			}
+		}
+	}
+
+	compSizeArr[comp] += compSizeArr[oldComp];
+	compSizeArr[oldComp] = ZERO;
+	freeCompArr.push_back(oldComp);
+
+}// end Relabel
+
+
+
+
+// O(M) for the M cells of the smaller components joined
+// Pre: A cell that was just opened
+// Post: The cell and every component next to it are one component
+void DynamicMap::JoinComponents(/*IN*/const int& cell)		// The cell just opened
+{
+	int largest = NO_COMPONENT;		// The largest component next to the cell, the others join it
+	int next;						// A neighbour of the cell
+
+	// Find the largest component around the cell
+	for (DirectionEnum dir = NextDir(NA); dir != NA; dir = NextDir(dir))
+	{
+		next = StepCell(cell, dir);
+		if (next != OFF_BOARD && compArr[next] != NO_COMPONENT &&
+			(largest == NO_COMPONENT || compSizeArr[compArr[next]] > compSizeArr[largest]))
+			largest = compArr[next];
+	}
+
+	// A cell with no open neighbours is a component of its own
+	if (largest == NO_COMPONENT)
+		largest = NewComponent();
+
+	compArr[cell] = largest;
+	compSizeArr[largest]++;
+
+	// Relabel the smaller components into it
+	for (DirectionEnum dir = NextDir(NA); dir != NA; dir = NextDir(dir))
+	{
+		next = StepCell(cell, dir);
+		if (next != OFF_BOARD && compArr[next] != NO_COMPONENT && compArr[next] != largest)
+			Relabel(next, largest);
+	}
+
+}// end JoinComponents
+
+
+
+
+// O(M) for the M cells of the components split off, times the cell's open neighbours
+// Pre: A cell that was just walled
+// Post: Each piece its component was cut into is a component of its own
+void DynamicMap::SplitComponent(/*IN*/const int& cell)		// The cell just walled
+{
+	vector<int> queueArr[MAX_NEIGHBOURS];	// The cells each search has reached, in the order reached
+	size_t frontArr[MAX_NEIGHBOURS];		// The position of each search's next cell
+	int groupArr[MAX_NEIGHBOURS];			// The search each search has met up with, itself if none
+	bool doneArr[MAX_NEIGHBOURS];			// Holds if a search's group was found to be a whole component
+	int searchCt = ZERO;					// The number of searches, one per open neighbour
+	int groupCt;							// The number of groups still searching
+	int oldComp = compArr[cell];			// The component being split
+	int newComp;							// A component split off
+	int next;								// A neighbour of the cell being searched from
+	int owner;								// The group of the search that reached the neighbour
+	bool exhausted;							// Holds if every search of a group has run out of cells
+
+	compArr[cell] = NO_COMPONENT;
+	compSizeArr[oldComp]--;
+
+	// Start a search from each open neighbour
+	for (DirectionEnum dir = NextDir(NA); dir != NA; dir = NextDir(dir))
+	{
+		next = StepCell(cell, dir);
+		if (next != OFF_BOARD && openArr[next])
+		{
+			ownerArr[next] = (signed char)searchCt;
+			queueArr[searchCt].push_back(next);
+			frontArr[searchCt] = ZERO;
+			groupArr[searchCt] = searchCt;
+			doneArr[searchCt] = false;
+			searchCt++;
+		}
+	}
+
+	// A cell with no open neighbours was its component
+	if (searchCt == ZERO)
+	{
+		freeCompArr.push_back(oldComp);
+		return;
+	}
+
+	// Search a cell at a time from each group until at most one is left searching
+	groupCt = searchCt;
+	while (groupCt > OFFSET)
+	{
+		for (int i = ZERO; i < searchCt; i++)
+		{
+			if (doneArr[groupArr[i]] || frontArr[i] == queueArr[i].size())
+				continue;
+
+			int curr = queueArr[i][frontArr[i]++];	// The cell being searched from
+			for (DirectionEnum dir = NextDir(NA); dir != NA; dir = NextDir(dir))
+			{
+				next = StepCell(curr, dir);
+				if (next == OFF_BOARD || !openArr[next])
+					continue;
+
+				// Claim a cell no search has reached, or meet up with the search that reached it
+				if (ownerArr[next] == NO_OWNER)
+				{
+					ownerArr[next] = (signed char)i;
+					queueArr[i].push_back(next);
+				}
+				else if (groupArr[ownerArr[next]] != groupArr[i])
+				{
+					owner = groupArr[ownerArr[next]];
+					for (int j = ZERO; j < searchCt; j++)
+						if (groupArr[j] == owner)
+							groupArr[j] = groupArr[i];
+					groupCt--;
+				}
+			}
+		}
+
+		// A group that has run out of cells without meeting the others is a component of its own,
+		// unless it is the last one searching, which keeps the old component
+		for (int g = ZERO; g < searchCt && groupCt > OFFSET; g++)
+		{
+			if (groupArr[g] != g || doneArr[g])
+				continue;
+
+			exhausted = true;
+			for (int j = ZERO; j < searchCt; j++)
+				if (groupArr[j] == g && frontArr[j] != queueArr[j].size())
+					exhausted = false;
+			if (!exhausted)
+				continue;
+
+			newComp = NewComponent();
+			for (int j = ZERO; j < searchCt; j++)
+				if (groupArr[j] == g)
+				{
+					for (size_t k = ZERO; k < queueArr[j].size(); k++)
+						compArr[queueArr[j][k]] = newComp;
+					compSizeArr[newComp] += (int)queueArr[j].size();
+				}
+			compSizeArr[oldComp] -= compSizeArr[newComp];
+			doneArr[g] = true;
+			groupCt--;
+		}
+
+	}// end while
+
+	// Clear the marks the searches left
+	for (int i = ZERO; i < searchCt; i++)
+	{
+		workCt += queueArr[i].size();
+		for (size_t k = ZERO; k < queueArr[i].size(); k++)
+			ownerArr[queueArr[i][k]] = NO_OWNER;
+	}
+
+}// end SplitComponent
+
+
+
+
+// O(M) for the M cells trimmed
+// Pre: Cells whose number of neighbours may have dropped to one or less
+// Post: No open cell other than the entrance and exits has fewer than two neighbours not trimmed
+void DynamicMap::TrimDeadEnds(/*IN/OUT*/vector<int>& leafArr)	// The cells that may be dead ends
+{
+	int cell;	// The cell being checked
+	int next;	// Its neighbour
+
+	// Trim the dead ends, a trimmed cell may leave its neighbour a dead end too
+	while (!leafArr.empty())
+	{
+		cell = leafArr.back();
+		leafArr.pop_back();
+		workCt++;
+
+		if (!openArr[cell] || trimArr[cell] || keepArr[cell] || degreeArr[cell] > OFFSET)
+			continue;
+
+		trimArr[cell] = true;
+		deadEndCt++;
+		for (DirectionEnum dir = NextDir(NA); dir != NA; dir = NextDir(dir))
+		{
+			next = StepCell(cell, dir);
+			if (next != OFF_BOARD && openArr[next])
+			{
+				degreeArr[next]--;
+				if (!trimArr[next])
+					leafArr.push_back(next);
+			}
+		}
+
+	}// end while
+
+}// end TrimDeadEnds
+
+
+
+
+// O(M) for the M dead ends connected to the cell
+// Pre: A cell that was just opened
+// Post: The dead ends are those of the board as it now is
+void DynamicMap::UntrimAround(/*IN*/const int& cell)		// The cell just opened
+{
+	vector<int> regionArr;	// The cell and the dead ends connected to it, which may no longer be dead ends
+	int curr;				// The cell being untrimmed
+	int next;				// Its neighbour
+
+	// Only the dead ends connected to the cell through other dead ends can join a path through it,
+	// so untrim them all and trim again whichever still are dead ends. The region is marked with
+	// the split's search marks, which are all clear between edits
+	regionArr.push_back(cell);
+	ownerArr[cell] = ZERO;
+	for (size_t i = ZERO; i < regionArr.size(); i++)
+		for (DirectionEnum dir = NextDir(NA); dir != NA; dir = NextDir(dir))
+		{
+			next = StepCell(regionArr[i], dir);
+			if (next != OFF_BOARD && openArr[next] && trimArr[next])
+			{
+				trimArr[next] = false;
+				deadEndCt--;
+				ownerArr[next] = ZERO;
+				regionArr.push_back(next);
+			}
+		}
+
+	// The region cells count their neighbours again, and every open cell next to the region,
+	// none of which are dead ends, gains the region cells beside it
+	for (size_t i = ZERO; i < regionArr.size(); i++)
+	{
+		curr = regionArr[i];
+		degreeArr[curr] = ZERO;
+		for (DirectionEnum dir = NextDir(NA); dir != NA; dir = NextDir(dir))
+		{
+			next = StepCell(curr, dir);
+			if (next != OFF_BOARD && openArr[next])
+			{
+				degreeArr[curr]++;
+				if (ownerArr[next] == NO_OWNER)
+					degreeArr[next]++;
+			}
+		}
+	}
+
+	for (size_t i = ZERO; i < regionArr.size(); i++)
+		ownerArr[regionArr[i]] = NO_OWNER;
+
+	workCt += regionArr.size();
+	TrimDeadEnds(regionArr);
+
+}// end UntrimAround
+
+
+
+
+// O(1)
+// Pre: The number of rows and columns
+// Post: The bytes of the cell arrays, of a component for every other cell, and of the queue
+//		 and dead ends waiting to be measured, which can hold every cell, are returned, as
+//		 counted in memaccount.h. The cells an edit queues are not counted, they are only the
+//		 cells the edit changes
+long long DynamicMap::MapBytes(/*IN*/const int& rows,		// The number of rows
+							   /*IN*/const int& cols)		// The number of columns
+{
+	long long cellCt = (long long)rows * cols;	// The number of cells in the board
+	long long flagBytes;						// The bytes of a cell's open, keep, exit, trim, degree and owner
+	long long valueBytes;						// The bytes of a cell's distance, rhs and component
+	long long queueBytes;						// The bytes of a cell's place in the queue and the dead ends
+
+	flagBytes = sizeof(unsigned char) * 5 + sizeof(signed char);
+	valueBytes = sizeof(int) * 3;
+	queueBytes = sizeof(int) * 2;
+
+	return cellCt * (flagBytes + valueBytes + queueBytes) + (cellCt + OFFSET) / 2 * sizeof(int);
+
+}// end MapBytes
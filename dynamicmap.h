@@ -0,0 +1,374 @@
+#pragma once
+/*
+	FileName : dynamicmap.h
+	Author: Christian Siletti
+	Date: 5/6/24
+	Project Maze
+
+	PURPOSE:
+		Contains the specifications for a DynamicMap Class. A dynamic map holds what the solver
+		works out about a gameboard before it searches: each cell's fewest moves to the nearest exit
+		(see distancemap.h), the connected components (see connectivity.h) and the dead ends
+		(see corridorgraph.h). Unlike those it is kept up to date as walls are put up and taken
+		down, so an edit only costs as much as the part of the board it changes. It is a
+		DistanceMap whose GetDistance reads the repaired distances, so the search and the path
+		ranker can be handed it instead of a DistanceMap measured again for every query.
+
+		The distances are repaired the way Lifelong Planning A* repairs them. Each cell keeps its
+		distance g, and rhs, the distance its neighbours say it should have (zero on an open exit,
+		one more than its nearest neighbour otherwise). An edit changes the rhs of the cell edited,
+		and only cells whose g and rhs disagree are queued, cheapest first. A cell whose g is over
+		its rhs takes the rhs and passes it on to its neighbours. A cell whose g is under its rhs
+		has lost the way it was measured through, so its g is dropped to unreachable and it and its
+		neighbours are measured again. Every distance is repaired, not only the entrance's, so the
+		whole map stays the same as a fresh DistanceMap.
+
+		A wall taken down joins the components around it, and the smaller ones are relabelled into
+		the largest. A wall put up may split its component, so the open cells around it are
+		searched from all at once a cell at a time each. A search that runs out of cells before
+		meeting the others has found a component of its own and is relabelled, and once only one
+		search is left the rest of the component is not looked at.
+
+		A dead end is a cell with only one open neighbour that is not, other than the entrance
+		or an exit, trimmed over and over until none are left. A wall put up trims from its
+		neighbours. A wall taken down untrims the dead ends connected to it, which are the only
+		cells that can stop being dead ends, and trims them again.
+
+
+	ASSUMPTIONS:
+		1) The board passed to Build has its walls set, VISITED cells are treated as open
+		2) The entrance and exits are those of the layout the map was built with, and are on the board
+		3) Once built, the board's walls are only changed through SetStatus
+
+
+	EXCEPTION HANDLING/ERROR CHECKING:
+		1) SetStatus returns false for a cell off the board or a status other than WALL or OPEN,
+		   and changes nothing.
+		2) GetDistance returns NO_DISTANCE for cells outside the board, walls,
+		   and cells that cannot reach an exit.
+		3) GetComponent returns NO_COMPONENT for walls and cells outside the board.
+		4) GBOutOfMemoryException thrown when memory from the heap has run out
+
+
+						   SUMMARY OF METHODS:
+	PUBLIC METHODS
+		DynamicMap() - Instantiate an empty dynamic map
+		virtual ~DynamicMap() - Destroy the class object
+		void Build(*IN*const GameBoard& board,		// The board being measured
+				   *IN*const LayoutRec& layout)		// The entrance and exits
+					- Measure the distances, components and dead ends of a board from scratch
+		bool SetStatus(*IN/OUT*GameBoard& board,			// The board the map was built from
+					   *IN*const Location2DRec& loc,		// The cell being changed
+					   *IN*const StateEnum& newStatus)		// WALL or OPEN
+					- Put up or take down a wall and repair the map around it
+		virtual int GetDistance(*IN*const Location2DRec& loc) const	// The cell being looked up
+					- Return the number of moves from a cell to the nearest exit
+		bool GetPath(*IN*const Location2DRec& from,		// The cell the path starts on
+					 *OUT*string& pathText,				// The directions travelled
+					 *OUT*int& exit) const				// The exit the path finishes on
+					- Find a shortest path from a cell to the nearest exit
+		int GetComponent(*IN*const Location2DRec& loc) const	// The cell being looked up
+					- Return the component a cell is in
+		bool IsConnected(*IN*const Location2DRec& from,		// One of the cells
+						 *IN*const Location2DRec& to) const	// The other cell
+					- Check if there is a way from one open cell to another
+		int CountReachable(*IN*const Location2DRec& from) const	// The cell being started from
+					- Return the number of open cells that can be reached from a cell, itself included
+		bool IsDeadEnd(*IN*const Location2DRec& loc) const	// The cell being looked up
+					- Check if a cell was trimmed as a dead end
+		int GetDeadEndCount() const - Return the number of cells trimmed as dead ends
+		long long GetEditWork() const - Return the number of cells the last edit looked at
+		static long long MapBytes(*IN*const int& rows,		// The number of rows
+								  *IN*const int& cols)		// The number of columns
+					- Return the most bytes a map of a board's size takes from the heap while built
+
+
+	PRIVATE MEMBERS:
+		int maxRows;						// The number of rows in the board
+		int maxCols;						// The number of columns in the board
+		vector<int> exitCellArr;			// The cell of each exit, in the layout's order
+		vector<unsigned char> openArr;		// Holds which cells are open
+		vector<unsigned char> keepArr;		// Holds which cells are the entrance or an exit, never trimmed
+		vector<unsigned char> exitArr;		// Holds which cells are exits
+		vector<int> gArr;					// Each cell's distance to the nearest exit
+		vector<int> rhsArr;					// The distance each cell's neighbours say it should have
+		DistQueue distQueue;				// The cells whose distances disagree, cheapest first
+		vector<int> compArr;				// Each cell's component, or NO_COMPONENT
+		vector<int> compSizeArr;			// The number of cells in each component
+		vector<int> freeCompArr;			// The components no longer used, to be handed out again
+		vector<signed char> ownerArr;		// The search that reached each cell when splitting a component, also
+										// marks the dead ends being untrimmed
+		vector<unsigned char> trimArr;		// Holds which cells were trimmed as dead ends
+		vector<unsigned char> degreeArr;	// Each open cell's number of open neighbours not trimmed
+		int deadEndCt;						// The number of cells trimmed as dead ends
+		long long workCt;					// The number of cells the last edit looked at
+		long long memBytes;					// The bytes of the cell arrays counted in memaccount.h
+
+	PRIVATE METHODS:
+		int StepCell(*IN*const int& cell,				// The cell moved from
+					 *IN*const DirectionEnum& dir) const	// The direction moved in
+					- Return the cell one move away in a direction
+		void UpdateCell(*IN*const int& cell)			// The cell being measured again
+					- Work out a cell's rhs again and queue it if it disagrees with its distance
+		void RepairDistances()
+					- Settle every queued cell until every distance agrees with its neighbours
+		int NewComponent()
+					- Hand out an unused component
+		void Relabel(*IN*const int& from,		// A cell of the component being relabelled
+					 *IN*const int& comp)		// The component it is joining
+					- Move every cell of a component into another
+		void JoinComponents(*IN*const int& cell)	// The cell just opened
+					- Join the components around a cell that was opened
+		void SplitComponent(*IN*const int& cell)	// The cell just walled
+					- Split a cell's component if walling it cut the component in pieces
+		void TrimDeadEnds(*IN/OUT*vector<int>& leafArr)		// The cells that may be dead ends
+					- Trim the dead ends given and every cell they leave a dead end
+		void UntrimAround(*IN*const int& cell)		// The cell just opened
+					- Untrim the dead ends connected to a cell that was opened and trim them again
+*/
+
+#include "gameboard.h"		// Allows access to the gameboard ADT
+#include "layoutrec.h"		// The entrance and exits record
+#include "distancemap.h"	// For NO_DISTANCE
+#include "connectivity.h"	// For NO_COMPONENT
+#include <vector>			// For the cell arrays
+#include <queue>			// For the cells waiting to be repaired
+#include <string>			// For the path's directions
+#include <utility>			// For the queue's key and cell pairs
+#include <functional>		// For taking the cheapest key first
+
+using namespace std;    // Standard namespace
+
+
+// The cells whose distances disagree with their neighbours, as key and cell pairs with the lowest key on top
+typedef priority_queue<pair<int, int>, vector<pair<int, int> >, greater<pair<int, int> > > DistQueue;
+
+
+
+class DynamicMap : public DistanceMap
+{
+public:
+
+	// O(1) - Default Constructor
+	// Purpose: Instantiate an empty dynamic map
+	// Pre: N/A
+	// Post: A map with no cells is created, every lookup returns NO_DISTANCE or NO_COMPONENT
+	DynamicMap();
+
+
+
+	// O(1) - Destructor
+	// Purpose: Destroy the class object
+	// Pre: N/A
+	// Post: The class object is destroyed
+	virtual ~DynamicMap();
+
+
+
+	// O(N^2) - Mutator
+	// Purpose: Measure the distances, components and dead ends of a board from scratch
+	// Pre: The board with its walls set and its layout
+	// Post: Every open cell holds its distance to the nearest open exit and its component,
+	//		 and the dead ends are trimmed
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	void Build(/*IN*/const GameBoard& board,		// The board being measured
+			   /*IN*/const LayoutRec& layout);		// The entrance and exits
+
+
+
+	// O(M log M) for the M cells whose distance, component or trimming is changed
+	// Purpose: Put up or take down a wall and repair the map around it
+	// Pre: The board the map was built from
+	// Post: The cell is set on the board, and the map is the same as one built from scratch
+	//		 on the board as it now is. false is returned if the cell is off the board or the
+	//		 status is not WALL or OPEN
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	bool SetStatus(/*IN/OUT*/GameBoard& board,				// The board the map was built from
+				   /*IN*/const Location2DRec& loc,			// The cell being changed
+				   /*IN*/const StateEnum& newStatus);		// WALL or OPEN
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return the number of moves from a cell to the nearest exit
+	// Pre: The map has been built
+	// Post: The cell's distance is returned, or NO_DISTANCE if no exit can be reached from it
+	virtual int GetDistance(/*IN*/const Location2DRec& loc) const;	// The cell being looked up
+
+
+
+	// O(N) for a path of N moves
+	// Purpose: Find a shortest path from a cell to the nearest exit
+	// Pre: The map has been built
+	// Post: pathText holds the path's moves as "D-" pairs, without the exit move, and exit holds
+	//		 the layout index of the exit it finishes on. Each move tries N, E, S, W in turn.
+	//		 false is returned if no exit can be reached from the cell
+	bool GetPath(/*IN*/const Location2DRec& from,		// The cell the path starts on
+				 /*OUT*/string& pathText,				// The directions travelled
+				 /*OUT*/int& exit) const;				// The exit the path finishes on
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return the component a cell is in
+	// Pre: The map has been built
+	// Post: The cell's component is returned, or NO_COMPONENT if it is a wall or off the board
+	int GetComponent(/*IN*/const Location2DRec& loc) const;		// The cell being looked up
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Check if there is a way from one open cell to another
+	// Pre: The map has been built
+	// Post: true is returned if both cells are open and in the same component
+	bool IsConnected(/*IN*/const Location2DRec& from,			// One of the cells
+					 /*IN*/const Location2DRec& to) const;		// The other cell
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return the number of open cells that can be reached from a cell, itself included
+	// Pre: The map has been built
+	// Post: The size of the cell's component is returned, or 0 if the cell is not open
+	int CountReachable(/*IN*/const Location2DRec& from) const;	// The cell being started from
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Check if a cell was trimmed as a dead end
+	// Pre: The map has been built
+	// Post: true is returned if the cell is open and can never be in the middle of a path
+	bool IsDeadEnd(/*IN*/const Location2DRec& loc) const;	// The cell being looked up
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return the number of cells trimmed as dead ends
+	// Pre: The map has been built
+	// Post: The number of dead end cells is returned
+	int GetDeadEndCount() const;
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return the number of cells the last edit looked at
+	// Pre: N/A
+	// Post: The number of cells queued, searched or trimmed by the last SetStatus is returned
+	long long GetEditWork() const;
+
+
+
+	// O(1)
+	// Purpose: Return the most bytes a map of a board's size takes from the heap while built
+	// Pre: The number of rows and columns
+	// Post: The bytes of the cell arrays, of a component for every other cell, and of the queue
+	//		 and dead ends waiting to be measured, which can hold every cell, are returned, as
+	//		 counted in memaccount.h. The cells an edit queues are not counted, they are only the
+	//		 cells the edit changes
+	static long long MapBytes(/*IN*/const int& rows,		// The number of rows
+							  /*IN*/const int& cols);		// The number of columns
+
+
+
+private:
+	int maxRows;						// The number of rows in the board
+	int maxCols;						// The number of columns in the board
+	vector<int> exitCellArr;			// The cell of each exit, in the layout's order
+
+	vector<unsigned char> openArr;		// Holds which cells are open
+	vector<unsigned char> keepArr;		// Holds which cells are the entrance or an exit, never trimmed
+	vector<unsigned char> exitArr;		// Holds which cells are exits
+
+	vector<int> gArr;					// Each cell's distance to the nearest exit
+	vector<int> rhsArr;					// The distance each cell's neighbours say it should have
+	DistQueue distQueue;				// The cells whose distances disagree, cheapest first
+
+	vector<int> compArr;				// Each cell's component, or NO_COMPONENT
+	vector<int> compSizeArr;			// The number of cells in each component
+	vector<int> freeCompArr;			// The components no longer used, to be handed out again
+	vector<signed char> ownerArr;		// The search that reached each cell when splitting a component, also
+										// marks the dead ends being untrimmed
+
+	vector<unsigned char> trimArr;		// Holds which cells were trimmed as dead ends
+	vector<unsigned char> degreeArr;	// Each open cell's number of open neighbours not trimmed
+	int deadEndCt;						// The number of cells trimmed as dead ends
+
+	long long workCt;					// The number of cells the last edit looked at
+	long long memBytes;					// The bytes of the cell arrays counted in memaccount.h
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return the cell one move away in a direction
+	// Pre: A cell on the board and a compass direction
+	// Post: The neighbour's index in row major order is returned, or OFF_BOARD if the move leaves the board
+	int StepCell(/*IN*/const int& cell,					// The cell moved from
+				 /*IN*/const DirectionEnum& dir) const;	// The direction moved in
+
+
+
+	// O(log N) - Mutator
+	// Purpose: Work out a cell's rhs again and queue it if it disagrees with its distance
+	// Pre: A cell on the board
+	// Post: The cell's rhs is zero on an open exit, unreachable on a wall, and otherwise one more
+	//		 than its nearest open neighbour's distance. The cell is queued if its distance is not its rhs
+	void UpdateCell(/*IN*/const int& cell);			// The cell being measured again
+
+
+
+	// O(M log M) for the M cells settled
+	// Purpose: Settle every queued cell until every distance agrees with its neighbours
+	// Pre: The cells an edit changed the rhs of have been updated
+	// Post: Every cell's distance is its rhs, and the queue is empty
+	void RepairDistances();
+
+
+
+	// O(1) - Mutator
+	// Purpose: Hand out an unused component
+	// Pre: N/A
+	// Post: A component with no cells is returned
+	int NewComponent();
+
+
+
+	// O(M) for a component of M cells
+	// Purpose: Move every cell of a component into another
+	// Pre: An open cell and the component its component is joining
+	// Post: Every cell of the cell's old component is in comp, and the old component is freed
+	void Relabel(/*IN*/const int& from,			// A cell of the component being relabelled
+				 /*IN*/const int& comp);		// The component it is joining
+
+
+
+	// O(M) for the M cells of the smaller components joined
+	// Purpose: Join the components around a cell that was opened
+	// Pre: A cell that was just opened
+	// Post: The cell and every component next to it are one component
+	void JoinComponents(/*IN*/const int& cell);		// The cell just opened
+
+
+
+	// O(M) for the M cells of the components split off, times the cell's open neighbours
+	// Purpose: Split a cell's component if walling it cut the component in pieces
+	// Pre: A cell that was just walled
+	// Post: Each piece its component was cut into is a component of its own
+	void SplitComponent(/*IN*/const int& cell);		// The cell just walled
+
+
+
+	// O(M) for the M cells trimmed
+	// Purpose: Trim the dead ends given and every cell they leave a dead end
+	// Pre: Cells whose number of neighbours may have dropped to one or less
+	// Post: No open cell other than the entrance and exits has fewer than two neighbours not trimmed
+	void TrimDeadEnds(/*IN/OUT*/vector<int>& leafArr);	// The cells that may be dead ends
+
+
+
+	// O(M) for the M dead ends connected to the cell
+	// Purpose: Untrim the dead ends connected to a cell that was opened and trim them again
+	// Pre: A cell that was just opened
+	// Post: The dead ends are those of the board as it now is
+	void UntrimAround(/*IN*/const int& cell);		// The cell just opened
+
+};
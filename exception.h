@@ -1,3 +1,4 @@
+#pragma once
 //Filename:exception.h
 //Author: Luke Musto
 //Date: 3.26.2024
@@ -0,0 +1,161 @@
+#pragma once
+/*
+	FileName : fixedboard.h
+	Author: Christian Siletti
+	Date: 4/19/24
+	Project Maze
+
+	PURPOSE:
+		Contains the specifications for a FixedBoard Class template. A FixedBoard is a gameboard
+		whose size is fixed when the program is compiled. Each row is held in one 64 bit word
+		for its walls and one for its visited cells, and none of its methods are virtual, so the
+		compiler can inline every GetStatus/SetStatus in the search loop down to a few bit tests.
+		It offers the same GetStatus, SetStatus and GetSize methods as GameBoard, so the same
+		search code can run on either.
+
+
+	ASSUMPTIONS:
+		1) ROWS is at least one, COLS is between one and 64
+		2) Only the OPEN, VISITED and WALL statuses are stored, every cell starts OPEN
+
+
+	EXCEPTION HANDLING/ERROR CHECKING:
+		1) If an invalid location is sent into GetStatus a OUT_OF_BOUNDS status will be returned.
+		2) If an invalid location is sent into SetStatus the status of the location will not change,
+		   the program will move on. Setting OUT_OF_BOUNDS is also ignored.
+		3) A board with an unsupported size will not compile.
+
+
+						   SUMMARY OF METHODS:
+	PUBLIC METHODS
+		FixedBoard() - Instantiate a fixed size board with every cell OPEN
+		StateEnum GetStatus(*IN*const Location2DRec& loc) const	// The desired cell's coordinate
+					- To return the status of a specified cell
+		void SetStatus(*IN*const Location2DRec& loc,		// The desired cell's coordinate
+					   *IN*const StateEnum& newStatus)		// The cells new status
+					- To change the status of a desired location
+		void GetSize(*OUT*int& rows,			// The location to store the row size
+					 *OUT*int& cols) const		// The location to store the column size
+					- To return the size of the board
+
+
+	PRIVATE MEMBERS:
+		unsigned long long wallRows[ROWS];		// Bit y of row x is set if cell (x, y) is a WALL
+		unsigned long long visitedRows[ROWS];	// Bit y of row x is set if cell (x, y) is VISITED
+*/
+
+#include "Constants.h"  // File containing appropriate constants
+
+using namespace std;    // Standard namespace
+
+
+
+template <int ROWS, int COLS>
+class FixedBoard
+{
+	static_assert(ROWS > ZERO && COLS > ZERO && COLS <= WORD_BITS, "FixedBoard size is not supported");
+
+public:
+
+	// O(N) - Default Constructor
+	// Purpose: Instantiate a fixed size board
+	// Pre: N/A
+	// Post: A board of ROWS by COLS cells is created, every cell's status is set to OPEN.
+	FixedBoard()
+	{
+		// Clear every row
+		for (int i = ZERO; i < ROWS; i++)
+		{
+			wallRows[i] = ZERO;
+			visitedRows[i] = ZERO;
+		}
+
+	}// end DC
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: To return the status of a specified cell
+	// Pre: The coordinate of the desired cell
+	// Post: The status of the cell will be returned if loc is within the bounds of the board.
+	//       If loc is outside the bounds of the board the status OUT_OF_BOUNDS will be returned
+	StateEnum GetStatus(/*IN*/const Location2DRec& loc) const	// The desired cell's coordinate
+	{
+		unsigned long long bit;		// The cell's bit within its row
+
+		// A negative coordinate wraps around to a large unsigned one, so one compare covers both ends
+		if ((unsigned)loc.x >= (unsigned)ROWS || (unsigned)loc.y >= (unsigned)COLS)
+			return OUT_OF_BOUNDS;
+
+		// Check the cell's bits
+		bit = 1ULL << loc.y;
+		if (wallRows[loc.x] & bit)
+			return WALL;
+		if (visitedRows[loc.x] & bit)
+			return VISITED;
+
+		return OPEN;
+
+	}// end GetStatus
+
+
+
+	// O(1) - Mutator
+	// Purpose: To change the status of a desired location
+	// Pre: The coordinate of the desired cell
+	//      The status the cell is to be updated to
+	// Post: If loc is within the board the status of the desired cell
+	//       will be updated to the new status.
+	//       If loc is outside the board nothing will occur
+	void SetStatus(/*IN*/const Location2DRec& loc,		// The desired cell's coordinate
+				   /*IN*/const StateEnum& newStatus)		// The cells new status
+	{
+		unsigned long long bit;		// The cell's bit within its row
+
+		// Check if the cooridnate is within the bounds of the board
+		if ((unsigned)loc.x >= (unsigned)ROWS || (unsigned)loc.y >= (unsigned)COLS)
+			return;
+
+		// Clear the cell, then set the bit for its new status
+		bit = 1ULL << loc.y;
+		switch (newStatus)
+		{
+		case OPEN:
+			wallRows[loc.x] &= ~bit;
+			visitedRows[loc.x] &= ~bit;
+			break;
+		case VISITED:
+			wallRows[loc.x] &= ~bit;
+			visitedRows[loc.x] |= bit;
+			break;
+		case WALL:
+			wallRows[loc.x] |= bit;
+			visitedRows[loc.x] &= ~bit;
+			break;
+		default:
+			break;	// OUT_OF_BOUNDS cannot be stored
+		};
+
+	}// end SetStatus
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: To return the size of the board
+	// Pre: N/A
+	// Post: The size of the board will be stored into the incoming rows and columns variables
+	void GetSize(/*OUT*/int& rows,				// The location to store the row size
+				 /*OUT*/int& cols) const		// The location to store the column size
+	{
+		rows = ROWS;
+		cols = COLS;
+
+	}// end GetSize
+
+
+
+private:
+	unsigned long long wallRows[ROWS];		// Bit y of row x is set if cell (x, y) is a WALL
+	unsigned long long visitedRows[ROWS];	// Bit y of row x is set if cell (x, y) is VISITED
+
+};
@@ -5,6 +5,7 @@
 //			 defined in gameboard.h
 
 #include "gameboard.h"	// The header file
+#include "memaccount.h"	// For counting the cells' memory
 #include <new>			// Contains the bad_alloc exception
 
 
@@ -49,6 +50,11 @@ GameBoard::GameBoard(/*IN*/int rows,       // The desired number of rows
 // Post: A deep copy of a desired gameboard object is made
 GameBoard::GameBoard(/*IN*/const GameBoard& orig)     // The gameboard to be copied
 {
+	// Start with no cells so there is nothing for the copy to free
+	maxRows = ZERO;
+	maxCols = ZERO;
+	boardPtrArr = nullptr;
+
 	// Copy the board
 	operator=(orig);
 }// end CC
@@ -56,6 +62,47 @@ GameBoard::GameBoard(/*IN*/const GameBoard& orig)     // The gameboard to be cop
 
 
 
+// O(1) - Move Constructor
+// Pre: The gameboard object to be moved exists
+// Post: This board holds orig's size and cells, and orig is left with no cells
+GameBoard::GameBoard(/*IN/OUT*/GameBoard&& orig) noexcept    // The gameboard being moved
+{
+	// Take the cells
+	maxRows = orig.maxRows;
+	maxCols = orig.maxCols;
+	boardPtrArr = orig.boardPtrArr;
+
+	// Leave nothing behind to be freed twice
+	orig.maxRows = ZERO;
+	orig.maxCols = ZERO;
+	orig.boardPtrArr = nullptr;
+
+}// end MC
+
+
+
+
+// O(N^2) - Protected Constructor
+// Pre: The number of rows and columns, and if the cells are allocated
+// Post: A gameboard of the size is created, with every cell OPEN if they are allocated.
+//       Without them a derived board must answer every accessor itself
+GameBoard::GameBoard(/*IN*/int rows,           // The number of rows
+                     /*IN*/int cols,           // The number of columns
+                     /*IN*/bool allocate)      // Holds if the cells are allocated
+{
+	maxRows = rows;	// Set max rows to the desired amount
+	maxCols = cols;	// Set max columns to the desired amount
+	boardPtrArr = nullptr;
+
+	// Create the game board if it is wanted
+	if (allocate)
+		AllocateBoard();
+
+}// end PC
+
+
+
+
 // O(N) - Destructor
 // Pre: N/A
 // Post: The class object is destroyed, and boardPtrArr points to null
@@ -119,32 +166,144 @@ void GameBoard::GetSize(/*OUT*/int& rows,				// The location to store the row si
 
 
 
+// O(1) - Observer Accessor
+// Pre: The coordinate of the desired cell
+// Post: The cost of the cell will be returned if loc is within the bounds of the gameboard,
+//       DEFAULT_CELL_COST unless it was changed. Zero is returned if loc is outside the gameboard
+int GameBoard::GetCost(/*IN*/const Location2DRec& loc) const  // The desired cell's coordinate
+{
+	// Check if the cooridnate is within the bounds of the board
+	if (loc.x >= ZERO && loc.x < maxRows && loc.y >= ZERO && loc.y < maxCols)
+		return boardPtrArr[loc.x][loc.y].cost;	// Return the cost of the cell
+
+	// Otherwise there is no cell to move into
+	return ZERO;
+
+}// end GetCost
+
+
+
+
+// O(1) - Mutator
+// Pre: The coordinate of the desired cell
+//      The cost the cell is to be updated to
+// Post: If loc is within the gameboard and the cost is between DEFAULT_CELL_COST and
+//       MAX_CELL_COST the cost of the desired cell will be updated to the new cost.
+//       Otherwise nothing will occur
+void GameBoard::SetCost(/*IN*/const Location2DRec& loc,      // The desired cell's coordinate
+						/*IN*/const int& newCost)          // The cells new cost
+{
+	// Check if the cooridnate is within the bounds of the board and the cost can be held
+	if (loc.x >= ZERO && loc.x < maxRows && loc.y >= ZERO && loc.y < maxCols &&
+		newCost >= DEFAULT_CELL_COST && newCost <= MAX_CELL_COST)
+		boardPtrArr[loc.x][loc.y].cost = (unsigned char)newCost;	// Update the cost of the cell
+
+}// end SetCost
+
+
+
+
 
 // O(N^2) - Overloaded Operator
 // Pre: The gameboard to be copied
 // Post: A deep copy of the gameboard will be created and returned
 void GameBoard::operator =(/*IN*/ const GameBoard& orig) // The gameboard to be copied
 {
+	Location2DRec loc;	// The cell being copied from a board that keeps its cells its own way
+
+	// A board copied onto itself is already a copy
+	if (this == &orig)
+		return;
 
 	// Delete the current board
 	DeAllocateBoard();
 
 	// Copy the size of the new game board
-	maxRows = orig.maxRows;
-	maxCols = orig.maxCols;
+	orig.GetSize(maxRows, maxCols);
 
 	// Create the board
 	AllocateBoard();
 
-	// Copy each cells status
-	for (int i = ZERO; i < maxRows; i++)
-		for (int j = ZERO; j < maxCols; j++)
-			boardPtrArr[i][j].status = orig.boardPtrArr[i][j].status;
+	// Copy each cells status and cost, through the accessors if the board keeps its cells its own way
+	if (orig.boardPtrArr != nullptr)
+	{
+		for (int i = ZERO; i < maxRows; i++)
+			for (int j = ZERO; j < maxCols; j++)
+				boardPtrArr[i][j] = orig.boardPtrArr[i][j];
+	}
+	else
+	{
+		for (loc.x = ZERO; loc.x < maxRows; loc.x++)
+			for (loc.y = ZERO; loc.y < maxCols; loc.y++)
+			{
+				boardPtrArr[loc.x][loc.y].status = orig.GetStatus(loc);
+				boardPtrArr[loc.x][loc.y].cost = (unsigned char)orig.GetCost(loc);
+			}
+	}
+
+}// end operator =
+
+
+
+
+// O(N) - Overloaded Operator
+// Pre: The gameboard to be moved
+// Post: This board's cells are freed, it holds orig's size and cells, and orig is left with no cells.
+//       A board that keeps its cells its own way is copied instead
+void GameBoard::operator =(/*IN/OUT*/GameBoard&& orig)  // The gameboard being moved
+{
+	// A board moved onto itself keeps its cells
+	if (this == &orig)
+		return;
+
+	// There are no cells to take from a board that keeps them its own way
+	if (orig.boardPtrArr == nullptr)
+	{
+		operator=((const GameBoard&)orig);
+		return;
+	}
+
+	// Delete the current board and take orig's
+	DeAllocateBoard();
+	maxRows = orig.maxRows;
+	maxCols = orig.maxCols;
+	boardPtrArr = orig.boardPtrArr;
+
+	// Leave nothing behind to be freed twice
+	orig.maxRows = ZERO;
+	orig.maxCols = ZERO;
+	orig.boardPtrArr = nullptr;
 
 }// end operator =
 
 
 
+
+// O(1) - Mutator
+// Pre: N/A
+// Post: Nothing changes, every cell of a gameboard is needed.
+//       A board that keeps its cells in tiles gives back the tiles all one status (see tiledboard.h)
+void GameBoard::Compact()
+{
+	// Every cell is in use
+
+}// end Compact
+
+
+
+
+// O(1)
+// Pre: The number of rows and columns
+// Post: The bytes of the row pointers and the cells are returned, as counted in memaccount.h
+long long GameBoard::BoardBytes(/*IN*/const int& rows,     // The number of rows
+                                /*IN*/const int& cols)     // The number of columns
+{
+	return (long long)rows * sizeof(CellRec*) + (long long)rows * cols * sizeof(CellRec);
+
+}// end BoardBytes
+
+
+
 // ============================ PROTECTED METHODS =================================
 
 
@@ -167,9 +326,12 @@ void GameBoard::AllocateBoard()
 			// Create the columns for the row
 			boardPtrArr[i] = new CellRec[maxCols];
 
-			// Set each cell in that row to OPEN
+			// Set each cell in that row to OPEN with the default cost
 			for (int j = ZERO; j < maxCols; j++)
+			{
 				boardPtrArr[i][j].status = OPEN;
+				boardPtrArr[i][j].cost = (unsigned char)DEFAULT_CELL_COST;
+			}
 		}
 	}
 	catch (std::bad_alloc)	// The heap space memory has run out
@@ -177,16 +339,25 @@ void GameBoard::AllocateBoard()
 		// Throw the exception
 		throw GBOutOfMemoryException();
 	}
+
+	// Count the memory taken
+	MemAdd(MEM_BOARD, BoardBytes(maxRows, maxCols));
+
 }// end AllocateBoard
 
 
 
 
 // O(N)
-// Pre: The board must be allocated first
-// Post: The memory the gameboard is using will be returned to the heap
+// Pre: N/A
+// Post: The memory the gameboard is using will be returned to the heap,
+//		 nothing happens if the board has no cells
 void GameBoard::DeAllocateBoard()
 {
+	// A board moved from, or that keeps its cells its own way, has nothing to free
+	if (boardPtrArr == nullptr)
+		return;
+
 	// Free up any memory that was allocated
 	for (int i = ZERO; i < maxRows; i++)
 	{
@@ -195,6 +366,9 @@ void GameBoard::DeAllocateBoard()
 	// Free the array of pointers
 	delete[] boardPtrArr;
 
+	// Count the memory given back
+	MemRelease(MEM_BOARD, BoardBytes(maxRows, maxCols));
+
 	// Set the pointer to null, because why not
 	boardPtrArr = nullptr;
 
@@ -19,6 +19,9 @@
         4) A typdef CellRec** named Board will be defined in CellRec.h as well
         5) If there is not enough space to allocate a board the board will 
            be deleted thus deallocate itself
+        6) A board moved from is left with no cells, a size of zero by zero
+        7) A derived board that keeps its cells its own way (see overlayboard.h) is made with
+           the protected constructor, which allocates no cells, and overrides every virtual accessor
 
 
     EXCEPTION HANDLING/ERROR CHECKING:
@@ -26,6 +29,8 @@
         2) If an invalid location is sent into SetStatus the status of the location will not change,
            the program will move on.
         3) GBOutOfMemoryException thrown when memory from the heap has run out
+        4) GetCost returns zero for a location outside the gameboard, and SetCost ignores a cost
+           outside DEFAULT_CELL_COST to MAX_CELL_COST
 
 
                            SUMMARY OF METHODS:
@@ -36,7 +41,9 @@
                     - Instantiate a gameboard object with non default values
         GameBoard(*IN*const GameBoard& orig)  // The gameboard to be copied
                     - Performs a deep copy of another gameboard object
-        ~GameBoard() - Destroy the class object
+        GameBoard(*IN/OUT*GameBoard&& orig) // The gameboard being moved
+                    - Take over another gameboard's cells without copying them
+        virtual ~GameBoard() - Destroy the class object
         virtual StateEnum GetStatus(*IN*const Location2DRec& loc) const // The desired cell's coordinate
                     - To return the status of a specified cell
         virtual void SetStatus(*IN*const Location2DRec& loc,      // The desired cell's coordinate
@@ -45,10 +52,25 @@
         virtual void GetSize(*OUT*int& rows,              // The location to store the row size
                              *OUT*int& cols) const;       // The location to store the column size
                     - To return the size of the board
+        virtual int GetCost(*IN*const Location2DRec& loc) const // The desired cell's coordinate
+                    - To return the cost of moving into a specified cell
+        virtual void SetCost(*IN*const Location2DRec& loc,        // The desired cell's coordinate
+                             *IN*const int& newCost);             // The cells new cost
+                    - To change the cost of moving into a desired location
         virtual void operator =(*IN* const GameBoard& orig); // The gameboard to be copied
                     - To create a deep copy of another gameboard
+        virtual void operator =(*IN/OUT*GameBoard&& orig); // The gameboard being moved
+                    - To take over another gameboard's cells without copying them
+        virtual void Compact() - To give back any cells the board holds that it does not need
+        static long long BoardBytes(*IN*const int& rows,    // The number of rows
+                                    *IN*const int& cols)    // The number of columns
+                    - To return the bytes a board of a size takes from the heap
 
     PROTECTED METHODS
+        GameBoard(*IN*int rows,         // The number of rows
+                  *IN*int cols,         // The number of columns
+                  *IN*bool allocate)    // Holds if the cells are allocated
+                    - Instantiate a gameboard object of a size, with or without its cells
         virtual void AllocateBoard() - To allocate dynamic memory for a game board object
         virtual void DeAllocateBoard() - To deallocate memory of a game board object
 
@@ -101,11 +123,19 @@ public:
 
 
 
+    // O(1) - Move Constructor
+    // Purpose: Take over another gameboard's cells without copying them
+    // Pre: The gameboard object to be moved exists
+    // Post: This board holds orig's size and cells, and orig is left with no cells
+    GameBoard(/*IN/OUT*/GameBoard&& orig) noexcept;    // The gameboard being moved
+
+
+
     // O(N) - Destructor
     // Purpose: Destroy the class object
     // Pre: N/A
     // Post: The class object is destroyed, and boardPtrArr points to null
-    ~GameBoard();
+    virtual ~GameBoard();
 
 
 
@@ -139,6 +169,27 @@ public:
 
 
 
+    // O(1) - Observer Accessor
+    // Purpose: To return the cost of moving into a specified cell
+    // Pre: The coordinate of the desired cell
+    // Post: The cost of the cell will be returned if loc is within the bounds of the gameboard,
+    //       DEFAULT_CELL_COST unless it was changed. Zero is returned if loc is outside the gameboard
+    virtual int GetCost(/*IN*/const Location2DRec& loc) const;  // The desired cell's coordinate
+
+
+
+    // O(1) - Mutator
+    // Purpose: To change the cost of moving into a desired location
+    // Pre: The coordinate of the desired cell
+    //      The cost the cell is to be updated to
+    // Post: If loc is within the gameboard and the cost is between DEFAULT_CELL_COST and
+    //       MAX_CELL_COST the cost of the desired cell will be updated to the new cost.
+    //       Otherwise nothing will occur
+    virtual void SetCost(/*IN*/const Location2DRec& loc,      // The desired cell's coordinate
+                         /*IN*/const int& newCost);         // The cells new cost
+
+
+
     // O(N^2) - Overloaded Operator
     // Purpose: To create a deep copy of another gameboard
     // Pre: The gameboard to be copied
@@ -146,8 +197,46 @@ public:
     virtual void operator =(/*IN*/ const GameBoard& orig); // The gameboard to be copied
 
 
+
+    // O(N) - Overloaded Operator
+    // Purpose: To take over another gameboard's cells without copying them
+    // Pre: The gameboard to be moved
+    // Post: This board's cells are freed, it holds orig's size and cells, and orig is left with no cells.
+    //       A board that keeps its cells its own way is copied instead
+    virtual void operator =(/*IN/OUT*/GameBoard&& orig);  // The gameboard being moved
+
+
+
+    // O(1) - Mutator
+    // Purpose: To give back any cells the board holds that it does not need
+    // Pre: N/A
+    // Post: Nothing changes, every cell of a gameboard is needed.
+    //       A board that keeps its cells in tiles gives back the tiles all one status (see tiledboard.h)
+    virtual void Compact();
+
+
+
+    // O(1)
+    // Purpose: To return the bytes a board of a size takes from the heap
+    // Pre: The number of rows and columns
+    // Post: The bytes of the row pointers and the cells are returned, as counted in memaccount.h
+    static long long BoardBytes(/*IN*/const int& rows,     // The number of rows
+                                /*IN*/const int& cols);    // The number of columns
+
+
 protected:
 
+    // O(N^2) - Protected Constructor
+    // Purpose: Instantiate a gameboard object of a size, with or without its cells
+    // Pre: The number of rows and columns, and if the cells are allocated
+    // Post: A gameboard of the size is created, with every cell OPEN if they are allocated.
+    //       Without them a derived board must answer every accessor itself
+    GameBoard(/*IN*/int rows,           // The number of rows
+              /*IN*/int cols,           // The number of columns
+              /*IN*/bool allocate);     // Holds if the cells are allocated
+
+
+
     // O(N^2)
     // Purpose: To allocate dynamic memory for a game board object
     // Pre: N/A
@@ -160,8 +249,9 @@ protected:
 
     // O(N)
     // Purpose: To deallocate memory of a game board object
-    // Pre: The board must be allocated first
-    // Post: The memory the gameboard is using will be returned to the heap
+    // Pre: N/A
+    // Post: The memory the gameboard is using will be returned to the heap,
+    //       nothing happens if the board has no cells
     virtual void DeAllocateBoard();
 
 
@@ -0,0 +1,37 @@
+#pragma once
+/*
+	FileName : layoutrec.h
+	Author: Christian Siletti
+	Date: 4/26/24
+	Project Maze
+
+	Purpose: This file contains the specification for the records holding where a
+			 board is entered and where it can be left, read in from the input file.
+
+	ASSUMPTIONS:
+		1) Every cell in the layout is on the board and no two exits share a cell
+		2) A board with no exits given has the one exit in the bottom right corner,
+		   left with an EXIT_DIR movement
+*/
+
+#include "Constants.h"  // File containing appropriate constants
+#include <vector>		// For the list of exits
+
+
+const int NO_EXIT = -1;		// The exit index of a cell that is not an exit
+
+
+// A cell the board can be left from
+struct ExitRec
+{
+	Location2DRec loc;	// The exit cell
+	string dir;			// The direction taken to leave the board from the exit cell
+};
+
+
+// Where a board is entered and left
+struct LayoutRec
+{
+	Location2DRec start;	// The cell every path starts on
+	vector<ExitRec> exits;	// The cells paths can finish on, in the order they were read in
+};
@@ -11,14 +11,125 @@
 		output file.
 
 	INPUT:
-		The name of the input file will be read in from the user. The first line of the input file 
+		The name of the input file will be read in from the user. The first line of the input file
 		will contain the size of the gameboard, all proceeding lines will contain coordinates of the
-		walls within the gameboard.
+		walls within the gameboard. A line may instead give the entrance or an exit:
+			START x y			  Paths start on (x, y) instead of START_POS
+			EXIT x y DIR		  Paths may finish on (x, y), leaving the board with a DIR
+								  (N, E, S or W) movement. Any number of exits may be given,
+								  without one the exit is the bottom right corner with EXIT_DIR
+			COST x y c			  Moving into (x, y) costs c (DEFAULT_CELL_COST to MAX_CELL_COST)
+								  instead of DEFAULT_CELL_COST, only read with --cheapest
+		A layered maze gives three sizes on its first line, rows, columns and floors, and every
+		coordinate after it as "x y z" with z the floor. Its exits may also be left with a U or D
+		movement, and its paths move between floors with U (up a floor) and D (down a floor).
+		The name of the input file may instead be given on the command line, along with these options:
+			--checkpoint FILE		  Periodically save the search state to FILE
+			--checkpoint-every SECS  Seconds between checkpoints (default DEFAULT_CHECKPOINT_SECS)
+			--resume FILE			  Continue the search saved in FILE
+			--time-budget SECS		  Stop and save the search after SECS seconds
+			--max-len L			  Only find paths of at most L moves
+			--min-len L			  Only print paths of at least L moves
+			--engine board|graph|corridor|meet
+									  Search the board itself (default), the board compiled
+									  into a graph of its open cells (see mazegraph.h), or that
+									  graph with its corridors contracted (see corridorgraph.h).
+									  With --no-paths, meet counts the paths from halves walked on
+									  each side of the board and met in the middle (see meetcount.h)
+			--view FPS				  Draw the path being searched FPS times a second (see searchview.h)
+			--trace FILE			  Record every step of the search to FILE (see searchtrace.h)
+			--stats BASE			  Count the paths of each length and the paths through each cell,
+									  saved to BASE_lengths.csv, BASE_cells.csv and BASE_heatmap.ppm
+									  (see pathstats.h)
+			--no-paths				  Count the paths without printing them
+			--sync-write			  Print the paths on the search's thread instead of a writer
+									  thread of its own (see pathwriter.h)
+			--shard BASE			  Print the paths to BASE_0000.out, BASE_0001.out, ... with an
+									  index BASE.idx instead of OUTPUT_FILE (see pathshards.h)
+			--shard-mb MB			  Close a shard once it holds MB megabytes (default DEFAULT_SHARD_MB)
+			--path N				  Start the search at path N without finding the paths before it,
+									  counting them instead (see pathrank.h)
+			--to M					  Stop the search once path M is found
+			--estimate PROBES		  Estimate the number of paths and how long the search would take
+									  from PROBES random probes instead of searching (see pathestimate.h)
+			--threads T			  Make the probes, answer the served queries, or walk and compare the
+									  meet engine's halves on T threads (default the number of cores)
+			--estimate-by uniform|reach
+									  Probe each move equally often (default), or the moves with more
+									  cells reachable past them more often
+			--seed S				  Start the probes' random numbers with S (default DEFAULT_ESTIMATE_SEED)
+			--cheapest				  Find the cheapest path to each exit instead of every path
+									  (see costmap.h)
+			--shortest				  Find a shortest path to the nearest exit instead of every path,
+									  on a flat board or a layered maze (see distancemap.h and searchnd.h)
+			--edits FILE			  Make the edits in FILE to the board one at a time, and find a shortest
+									  path after each instead of every path (see dynamicmap.h). Each line
+									  of FILE is WALL x y to put up a wall or OPEN x y to take one down
+			--cache DIR			  Read the results back from DIR if this board was solved with the same
+									  options before, or save them there once it is (see resultcache.h)
+			--cache-mb MB			  Remove the results used least recently once DIR holds more than MB
+									  megabytes (default DEFAULT_CACHE_MB)
+			--mem-mb MB			  Check the board, the path stack at its deepest and the maps built around
+									  the search fit in MB megabytes before making them (see memaccount.h)
+			--cell-order rows|zorder  Lay the board's cells out a row at a time (default), or in 8 by 8
+									  tiles with each tile's cells in z-order, so the cells next to one
+									  another are more often in the same cache line (see zorderboard.h)
+			--huge-pages			  Put the z-order board's cells on huge pages, where the system has them
+			--order fixed|manhattan|distance
+									  Try each cell's neighbours N, E, S, W (default), nearest an exit
+									  by rows plus columns first, or fewest moves from an exit first
+									  (see dirorder.h)
+			--first				  Stop at the first path found and show how long it took to find
+		A trace is replayed instead of searching with:
+			--replay FILE			  Replay the search traced to FILE on the console
+			--speed EPS			  Replay EPS steps a second (default DEFAULT_REPLAY_SPEED),
+									  0 jumps straight to the end or to the path sought
+			--seek N				  Skip ahead to the Nth path found without drawing the steps before it
+			--image FILE			  Save the last frame replayed to FILE as a PPM image (see boardimage.h)
+		Queries about any number of mazes are answered a line at a time from the console instead of
+		searching with (see mazeserver.h for the queries):
+			--serve				  Answer queries until the input runs out or a quit query
+			--threads T			  Answer the queries that only read a maze on T threads
+			--max-len L, --min-len L, --engine board|graph|corridor
+									  The length limits and engine the counts and paths are found with
+		Sharded paths are read back instead of searching with:
+			--lookup BASE			  Print paths from the shards indexed by BASE.idx to the console
+			--path N				  The first path printed
+			--to M					  The last path printed (default N)
+		A path's length is its number of moves, including the final EXIT_DIR move.
 
 	PROCESSING:
 		The file name will be validated, and its existence will be checked.
 		Valid gameboard size will be checked as well. The walls of the gameboard will be created,
 		and then every possible path within the gameboard will be found.
+		Boards of a common square size are searched on a FixedBoard (see pathsearch.h).
+		Boards whose exits cannot be reached from the entrance are found from their connected
+		components (see connectivity.h) and are not searched.
+		The paths to every exit are found in the same search (see pathsearch.h).
+		A layered maze is searched on a BoardND (see boardnd.h and searchnd.h).
+		Boards of TILED_BOARD_CELLS or more are kept in tiles given cells only once written, and
+		tiles left all open or all wall are shared (see tiledboard.h).
+		(WITH --cell-order zorder) The board is made as a ZOrderBoard, it must be under TILED_BOARD_CELLS.
+		(WITH --order) The same paths are found, numbered in the order they are found in.
+					   With --order distance the distances to the exits are measured before the search.
+		(WITH --first) The search stops at its first path, as with --to 1. The time from before the
+					   distances and orders are made until the path is found is shown below the board.
+		(WITH --cache) A board found in the cache is not solved again.
+		(WITH --mem-mb) Before the board is made, the bytes it, the path stack (with rows * columns items,
+					   the deepest it can be), the maps built around the search (connectivity, distance,
+					   neighbour order and cost maps) and the path writer's ring would take are added up.
+					   The connectivity map's runs of open cells are counted as one a row until the walls
+					   are read, and the budget is checked again with their real size once they are. If
+					   they do not fit the paths are printed on the search's thread, which needs no ring,
+					   and if they still do not fit the program aborts. The graph engines keep their path
+					   in arrays of their own, and --estimate, --cheapest and --edits push nothing, so for
+					   them only the board and the maps are checked. The graph engines' graphs (every
+					   cell open with four edges), the meet engine's cell arrays and walks, the map the
+					   edits keep and the statistics are checked with them. The meet engine's halves are
+					   not checked, as their number is only known once they are walked, but like every
+					   map they are counted in the memory report as they are made.
+		(WITH --engine meet) The count is printed as with --no-paths, and how the paths were split
+					   is shown below the board.
 
 	OUTPUT:
 		If the input file name is invalid the user will be asked to retype the name.
@@ -26,36 +137,166 @@
 		message will appear and the program will abort.
 		If the file is found and the size is valid, every possible path will be printed to OUTPUT_FILE.
 		The printout will number the paths found and contain the directions travelled within the paths.
+		With more than one exit each path's number is followed by the exit it finishes on, (Exit k)
+		for the k-th exit in the input file, and paths to all exits share the one numbering.
 		If no paths are found an appropriate output is sent to OUTPUT_FILE.
+		With a maximum length, partial paths that cannot reach the exit in time are dropped early
+		using each cell's breadth first distance to the nearest exit. Only the paths kept are numbered.
+		(WITH --no-paths) Only the number of paths found is printed to OUTPUT_FILE.
+		(WITH --shard) The paths are printed to the shard files, OUTPUT_FILE only holds how many there are.
+		(WITH --path/--to) Only the paths numbered N to M are printed, numbered as in a full search.
+					   If there are fewer than N paths OUTPUT_FILE says how many there are.
+		(WITH --estimate) No paths are printed, OUTPUT_FILE and the console below the board hold the
+					   estimated paths, partial paths searched and search time, each with its 95%
+					   confidence interval. A board searched within ESTIMATE_CALIBRATE_MS is counted exactly.
+		(WITH --cheapest) OUTPUT_FILE holds one cheapest path to each exit that can be reached,
+					   labelled with its exit and followed by its total cost.
+		(WITH --shortest) OUTPUT_FILE holds one shortest path from the entrance to the nearest exit,
+					   labelled with its exit and followed by its length, the exit move counted.
+		(WITH --edits) OUTPUT_FILE holds a shortest path from the entrance to the nearest exit before
+					   the edits and after each one, with its length, the cells the entrance can reach,
+					   the dead end cells and the cells the edit had to look at.
+					   The board printed to the console is the board after the last edit.
+		(WITH --stats) The length histogram and the paths through each cell are saved as CSV files,
+					   and the cell counts as a heatmap image of the board.
+		(WITH --cache) OUTPUT_FILE and the statistics files are the same whether they were read back
+					   from the cache or not. The console says below the board which it was.
+		The paths are printed by a writer thread the search hands them to. Below the board the
+		console shows how often the search waited on the writer, and the writer on the search.
+		Below the board the console shows the memory the board, the path stack and the writer's ring
+		took, in use at the end and at the peak (see memaccount.h).
 		The gameboard will be printed to the console screen indicating its walls with X's.
-		(IF ENABLED) The maze and the path being searched will be updated to the console screen 
-					 in real time.
+		A layered maze is printed a floor at a time, floor 0 first. A board of more than
+		PRINT_CELLS_MAX cells is not printed, the console only says how big it is.
+		(WITH --view) The maze and the path being searched will be updated to the console screen
+					  in real time, on a thread of its own so the search does not wait on it.
+		If the time budget runs out the search state is saved to a checkpoint file, and a later
+		run resumed from it will finish OUTPUT_FILE exactly as an uninterrupted run would have.
+		(WITH --replay) OUTPUT_FILE is not touched, the traced search is drawn on the console a step
+					  at a time with PrintCurrentPath, along with the number of paths found so far.
+		(WITH --lookup) OUTPUT_FILE is not touched, the paths asked for are printed to the console
+					  as they are in the shards.
+		(WITH --serve) OUTPUT_FILE is not touched, each query's response is printed to the console,
+					  every line starting with the query's number, and the latency percentiles of
+					  each kind of query are printed once the queries run out.
 
 
 
 	ASSUMPTIONS:  ******  IMPORTANT!!!! READ THESE   ******
 		1) The size and coordinates within the input file will be integers only,
-		   in the format of "x y" per line
-		2) A EXIT_DIR movement is made on the exit tile to exit the board
-		3) The exit of the board is located in the bottom right corner
-		4) The entrance to the board is located at START_POS
+		   in the format of "x y" per line, or after START_TAG, EXIT_TAG or COST_TAG
+		2) An exit's own direction movement is made on its tile to exit the board
+		3) Without EXIT_TAG lines the exit of the board is located in the bottom right corner
+		   and left with an EXIT_DIR movement
+		4) Without a START_TAG line the entrance to the board is located at START_POS
 
 	EXCEPTION HANDLING/ERROR CHECKING:
 		1) If an invalid file name is given the user must retype the name.
 		2) The file will be checked for existance.
 		3) The size of the gameboard will be validated as well.
 		   (size > 0)
+		4) Unknown command line options, or a minimum length over the maximum length,
+		   print the usage and abort the program. Above the usage the console says which
+		   option was turned down and why, for any of the options turned down below as well.
+		5) A checkpoint that is unreadable, or was taken on a different board, entrance or exits,
+		   or with different length limits, aborts the program without touching OUTPUT_FILE.
+		6) An entrance or exit off the board, an exit direction that is not N, E, S or W
+		   (or U or D on a layered maze), or two exits on the same cell abort the program.
+		7) A trace file that cannot be created, or a replayed file that is not a trace,
+		   aborts the program. An image or statistics that cannot be saved display a warning.
+		8) Shards that cannot be created, or a looked up index that is not an index, abort the program.
+		   Sharded paths cannot be checkpointed, so --shard with --checkpoint, --resume or
+		   --time-budget prints the usage and aborts the program.
+		9) A resumed search goes on from its checkpoint, so --path with --resume, or --to before
+		   --path, prints the usage and aborts the program.
+		10) An estimate searches for no paths, so --estimate with --checkpoint, --resume, --time-budget,
+		   --path, --to, --shard or --stats, or with no threads, prints the usage and aborts the program.
+		11) A layered maze is only searched with the length limits, --no-paths, --sync-write, --shard,
+		   --to and --shortest. Any other search option, or --cache, --mem-mb, --cell-order, --huge-pages
+		   or --first, which a layered maze is never run with, aborts the program.
+		12) The cheapest paths are not a search for every path, so --cheapest with --checkpoint, --resume,
+		   --time-budget, --max-len, --min-len, --path, --to, --shard, --stats or --estimate prints the
+		   usage and aborts the program. A cost off the board or out of range is ignored. A board of
+		   more than COST_CELLS_MAX cells, whose costs could overflow, aborts the program.
+		13) The edits are not a search for every path, so --edits with any search option other than
+		   --sync-write, or with --cheapest or --estimate, prints the usage and aborts the program.
+		   An edit file that cannot be read, or an edit that is not WALL or OPEN on the board,
+		   aborts the program.
+		14) A server reads its mazes from its queries, so --serve with an input file or any option other
+		   than --threads, the length limits and --engine prints the usage and aborts the program.
+		   A query that cannot be answered is answered with ERROR and the server goes on.
+		15) Only finished results are cached, so --cache with --checkpoint, --resume, --time-budget,
+		   --trace, --shard, --estimate, --edits or --serve, or a cache size under one megabyte, prints
+		   the usage and aborts the program. The time to the first path is not a result and is never
+		   the same twice, so --cache with --first prints the usage and aborts the program. A cache
+		   that cannot be opened or saved to displays a warning.
+		16) A board, path stack and maps that do not fit the memory budget abort the program before they
+		   are made, with how many bytes they would need, as do connectivity runs that take it over the
+		   budget once the walls are read. A budget under zero prints the usage and aborts the program.
+		17) Huge pages are only asked for the z-order layout, so --huge-pages without --cell-order zorder,
+		   or either with --serve, prints the usage and aborts the program. A board of TILED_BOARD_CELLS
+		   or more is tiled, and its tiles keep their cells a row at a time, so --cell-order zorder on
+		   one aborts the program before the board is made.
+		18) Only the board engine tries the neighbours in an order other than N, E, S, W, and a search
+		   saved or started part way in is in that order, so --order manhattan or distance with
+		   --checkpoint, --resume, --time-budget, --path, --engine graph or corridor, --estimate,
+		   --cheapest, --edits or --serve, or on a layered maze, prints the usage and aborts the program.
+		   --first with --path or with --to other than 1 prints the usage and aborts the program.
+		19) The meet engine only counts paths, so --engine meet without --no-paths, or with --checkpoint,
+		   --resume, --time-budget, --max-len, --min-len, --view, --trace, --stats, --shard, --path, --to,
+		   --first, --order, --estimate, --cheapest, --edits or --serve, prints the usage and aborts
+		   the program.
+		20) A shortest path is not a search for every path, so --shortest with any search option other
+		   than --sync-write, or with --estimate, --cheapest, --edits or --serve, prints the usage and
+		   aborts the program.
 
 
 
 
 						   SUMMARY OF FUNCTIONS:
+	bool ParseOptions(*IN*int argc,				// The number of command line arguments
+					  *IN*char* argv[],			// The command line arguments
+					  *OUT*OptionsRec& opts)	// The options read in
+		- Read the run options from the command line
+	bool IsGiven(*IN*const OptionsRec& opts,			// The options read in
+				 *IN*const OptionEnum& option)			// The option being looked for
+		- Check if an option was given
+	bool RefuseOption(*IN*const string& why)		// Why the options were turned down
+		- Print why the options were turned down
+	bool RefuseOptions(*IN*const OptionsRec& opts,				// The options read in
+					   *IN*const string& mode,					// The mode the options were given with
+					   *IN*const vector<OptionEnum>& refused)	// The options the mode cannot be run with
+		- Turn the options down if any the mode cannot be run with was given
+	bool CheckValues(*IN*const OptionsRec& opts)		// The options read in
+		- Check each option's value is in range
+	bool CheckCheckpointOptions(*IN*const OptionsRec& opts)		// The options read in
+		- Check the options fit a search that is saved or started part way in
+	bool CheckPathOptions(*IN*const OptionsRec& opts)		// The options read in
+		- Check the paths asked for by number make sense
+	bool CheckEstimateOptions(*IN*const OptionsRec& opts)		// The options read in
+		- Check the options fit an estimate
+	bool CheckCheapestOptions(*IN*const OptionsRec& opts)		// The options read in
+		- Check the options fit a search for the cheapest paths
+	bool CheckShortestOptions(*IN*const OptionsRec& opts)		// The options read in
+		- Check the options fit a search for a shortest path
+	bool CheckEditsOptions(*IN*const OptionsRec& opts)		// The options read in
+		- Check the options fit a run of edits
+	bool CheckServeOptions(*IN*const OptionsRec& opts)		// The options read in
+		- Check the options fit a server
+	bool CheckCacheOptions(*IN*const OptionsRec& opts)		// The options read in
+		- Check the options fit a cached run
+	bool CheckOrderOptions(*IN*const OptionsRec& opts)		// The options read in
+		- Check the options fit a neighbour order other than N, E, S, W
+	bool CheckMeetOptions(*IN*const OptionsRec& opts)		// The options read in
+		- Check the options fit the meet engine
 	bool ValidateFileName(*IN*string fileName) // The file name being validated
 		- Validate a file name
 		  (makes sure it contains only letters and a period and 3 letters after the period)
-	void ReadWalls(*IN/OUT*GameBoard& board,			// The gameboard whose walls are being set up
-				   *IN/OUT*ifstream& fin)				// The input file containing the walls coordinates
-		- Read in wall coordinates from an input file and set them up in a gameboard object
+	bool ReadWalls(*IN/OUT*GameBoard& board,			// The gameboard whose walls are being set up
+				   *IN/OUT*ifstream& fin,				// The input file containing the walls coordinates
+				   *OUT*LayoutRec& layout)				// The entrance and exits read in
+		- Read in wall coordinates, the entrance, the exits and the cell costs from an input file
+		  and set the walls up in a gameboard object
 	void PrintCurrentPath(*IN*const GameBoard& board,		// The gameboard whose path is being printed
 						  *IN*const int& rowSize,			// The boards number of rows
 						  *IN*const int& colSize)			// The boards number of columns
@@ -65,29 +306,152 @@
 						  *IN*const int& rowSize,			// The boards number of rows
 						  *IN*const int& colSize)			// The boards number of columns
 		- Print the current path mapped out on the game board
-	DirectionEnum NextDir(*IN*const DirectionEnum& dir)		// The current direction
-		- Get the next direction based off a direction sent in (Order: NA -> N -> E -> S -> W -> NA)
-	Location2DRec Move(*IN*const DirectionEnum& dir,		// The desired direction to move in
-					   *IN*const Location2DRec& currPos)	// The current location
-		- Increment a Location2DRec in a single direction
-	string PathDirections(*IN* StackClass path)		// The stack containing the path
-		- To obtain the directions travelled in a path from start to finish 
+	void ReplayTrace(*IN*const OptionsRec& opts)	// The options naming the trace and how to replay it
+		- Replay a traced search on the console
+	void LookupPaths(*IN*const OptionsRec& opts)	// The options naming the shards and the paths wanted
+		- Print paths from sharded output to the console
+	void SearchLayered(*IN*const OptionsRec& opts,		// The options the search runs with
+					   *IN*const int sizes[],			// The rows, columns and floors of the maze
+					   *IN/OUT*ifstream& fin,			// The input file, past its size line
+					   *IN/OUT*ofstream& fout)			// The output file writer
+		- Read in, search and print a layered maze
+	bool ReadLayers(*IN/OUT*BoardND<LAYERED_DIMS>& board,		// The board whose walls are being set up
+					*IN/OUT*ifstream& fin,						// The input file containing the walls coordinates
+					*OUT*LayoutNDRec<LAYERED_DIMS>& layout)		// The entrance and exits read in
+		- Read in wall coordinates, the entrance and the exits of a layered maze
+	void PrintLayers(*IN*const BoardND<LAYERED_DIMS>& board)	// The board being printed
+		- Print each floor of a layered maze
+	void ApplyEdits(*IN*const OptionsRec& opts,			// The options naming the edit file
+					*IN/OUT*GameBoard& board,			// The board being edited
+					*IN*const LayoutRec& layout,		// The entrance and exits
+					*IN/OUT*ofstream& fout)				// The output file writer
+		- Edit the board a wall at a time and print a shortest path after each edit
+	void PrintEditState(*IN/OUT*ofstream& fout,			// The output file writer
+						*IN*const string& label,		// What the line is labelled with
+						*IN*const DynamicMap& dynMap,	// The map of the board as it now is
+						*IN*const LayoutRec& layout)	// The entrance and exits
+		- Print a shortest path and what is known about the board as it now is
+	bool LoadBoard(*IN*const string& fileName,		// The maze file
+				   *OUT*GameBoard*& board,			// The board read in, made with new
+				   *OUT*LayoutRec& layout)			// The entrance and exits read in
+		- Read in a maze file for the server
+	void RestoreResults(*IN*const OptionsRec& opts,						// The options naming the statistics files
+						*IN*const vector<CachePartRec>& partArr,		// The files read back from the cache
+						*IN/OUT*ofstream& fout)							// The output file writer
+		- Print the results read back from the cache
+	bool SaveResults(*IN*const OptionsRec& opts,		// The options naming the statistics files
+					 *IN/OUT*ResultCache& cache,		// The cache the results are saved to
+					 *IN*const string& cacheKey)		// What the run was asked
+		- Save the files a run printed to the cache
+	bool FitMemoryBudget(*IN/OUT*OptionsRec& opts,		// The options the search runs with
+						 *IN*const int& rows,			// The number of rows
+						 *IN*const int& cols,			// The number of columns
+						 *OUT*long long& needBytes,		// The bytes the search would take
+						 *OUT*bool& leaner)				// Holds if the ring was given up to fit
+		- Check the board and the search fit the memory budget
 */
 
 #include "stack.h"		// Allows access to the stack ADT
 #include "gameboard.h"	// Allows access to the gameboard AD
+#include "optionsrec.h"	// The command line options record
+#include "distancemap.h"	// For cutting off paths that are too long
+#include "connectivity.h"	// For finding boards whose exit cannot be reached
+#include "pathsearch.h"	// The path search itself
+#include "layoutrec.h"	// The entrance and exits record
+#include "searchview.h"	// The live view of the search
+#include "searchtrace.h"	// For tracing the search and replaying it
+#include "boardimage.h"	// For saving a replayed frame as an image
+#include "pathstats.h"		// For the path length and cell statistics
+#include "pathwriter.h"		// For printing the paths off the search's thread
+#include "pathestimate.h"	// For estimating the paths of boards too big to search
+#include "searchnd.h"		// For searching layered mazes
+#include "costmap.h"		// For the cheapest paths of weighted boards
+#include "dynamicmap.h"		// For repairing the board's distances after each edit
+#include "mazeserver.h"		// For answering queries about many mazes
+#include "resultcache.h"		// For reading back the results of boards solved before
+#include "memaccount.h"		// For the memory the board, path stack and writer take
+#include "tiledboard.h"		// For boards too big to allocate every cell of up front
+#include "zorderboard.h"		// For boards laid out in z-order
+#include "dirorder.h"		// For the names of the neighbour orders
+#include "meetcount.h"		// For counting the paths from both ends
 #include <iostream>		// For console input and output
 #include <fstream>		// For input and output file access
 #include <thread>		// For the time delay
+#include <chrono>		// For the replay speed and the time to the first path
+#include <sstream>		// For reading a wall coordinate from a token
+#include <cassert>		// For checking the connectivity map in a debug build
 
 using namespace std;	// Standard Namespace
 
 
+// The name each option is given on the command line, in the order of OptionEnum
+const string OPTION_NAMES[OPTION_CT] = { "an input file", "--checkpoint", "--resume", "--time-budget", "--max-len",
+										 "--min-len", "--engine", "--view", "--trace", "--stats", "--no-paths",
+										 "--shard", "--path", "--to", "--first", "--order", "--estimate",
+										 "--cheapest", "--shortest", "--edits", "--serve", "--cache", "--mem-mb",
+										 "--cell-order", "--huge-pages" };
+
+// The options each mode cannot be run with, as the error checking above lists them
+const vector<OptionEnum> SHARD_REFUSED = { OPTION_CHECKPOINT, OPTION_RESUME, OPTION_TIME_BUDGET };
+const vector<OptionEnum> ESTIMATE_REFUSED = { OPTION_CHECKPOINT, OPTION_RESUME, OPTION_TIME_BUDGET, OPTION_PATH,
+											  OPTION_TO, OPTION_FIRST, OPTION_SHARD, OPTION_STATS };
+const vector<OptionEnum> CHEAPEST_REFUSED = { OPTION_CHECKPOINT, OPTION_RESUME, OPTION_TIME_BUDGET, OPTION_MAX_LEN,
+											  OPTION_MIN_LEN, OPTION_PATH, OPTION_TO, OPTION_FIRST, OPTION_SHARD,
+											  OPTION_STATS, OPTION_ESTIMATE };
+const vector<OptionEnum> SHORTEST_REFUSED = { OPTION_CHECKPOINT, OPTION_RESUME, OPTION_TIME_BUDGET, OPTION_MAX_LEN,
+											  OPTION_MIN_LEN, OPTION_ENGINE, OPTION_VIEW, OPTION_TRACE, OPTION_STATS,
+											  OPTION_NO_PATHS, OPTION_SHARD, OPTION_PATH, OPTION_TO, OPTION_FIRST,
+											  OPTION_ORDER, OPTION_ESTIMATE, OPTION_CHEAPEST, OPTION_EDITS,
+											  OPTION_SERVE };
+const vector<OptionEnum> EDITS_REFUSED = { OPTION_CHECKPOINT, OPTION_RESUME, OPTION_TIME_BUDGET, OPTION_MAX_LEN,
+										   OPTION_MIN_LEN, OPTION_ENGINE, OPTION_VIEW, OPTION_TRACE, OPTION_STATS,
+										   OPTION_NO_PATHS, OPTION_SHARD, OPTION_PATH, OPTION_TO, OPTION_FIRST,
+										   OPTION_ESTIMATE, OPTION_CHEAPEST };
+const vector<OptionEnum> SERVE_REFUSED = { OPTION_INPUT_FILE, OPTION_CHECKPOINT, OPTION_RESUME, OPTION_TIME_BUDGET,
+										   OPTION_VIEW, OPTION_TRACE, OPTION_STATS, OPTION_NO_PATHS, OPTION_SHARD,
+										   OPTION_PATH, OPTION_TO, OPTION_FIRST, OPTION_ESTIMATE, OPTION_CHEAPEST,
+										   OPTION_EDITS, OPTION_CELL_ORDER, OPTION_HUGE_PAGES };
+const vector<OptionEnum> CACHE_REFUSED = { OPTION_CHECKPOINT, OPTION_RESUME, OPTION_TIME_BUDGET, OPTION_TRACE,
+										   OPTION_SHARD, OPTION_FIRST, OPTION_ESTIMATE, OPTION_EDITS, OPTION_SERVE };
+const vector<OptionEnum> ORDER_REFUSED = { OPTION_CHECKPOINT, OPTION_RESUME, OPTION_TIME_BUDGET, OPTION_PATH,
+										   OPTION_ENGINE, OPTION_ESTIMATE, OPTION_CHEAPEST, OPTION_EDITS,
+										   OPTION_SERVE };
+const vector<OptionEnum> MEET_REFUSED = { OPTION_CHECKPOINT, OPTION_RESUME, OPTION_TIME_BUDGET, OPTION_MAX_LEN,
+										  OPTION_MIN_LEN, OPTION_VIEW, OPTION_TRACE, OPTION_STATS, OPTION_SHARD,
+										  OPTION_PATH, OPTION_TO, OPTION_FIRST, OPTION_ORDER, OPTION_ESTIMATE,
+										  OPTION_CHEAPEST, OPTION_EDITS, OPTION_SERVE };
+const vector<OptionEnum> LAYERED_REFUSED = { OPTION_CHECKPOINT, OPTION_RESUME, OPTION_TIME_BUDGET, OPTION_ENGINE,
+											 OPTION_VIEW, OPTION_TRACE, OPTION_STATS, OPTION_PATH, OPTION_FIRST,
+											 OPTION_ORDER, OPTION_ESTIMATE, OPTION_CHEAPEST, OPTION_EDITS,
+											 OPTION_CACHE, OPTION_MEM_MB, OPTION_CELL_ORDER, OPTION_HUGE_PAGES };
+
+
 
 // Prototypes
+bool ParseOptions(/*IN*/int,					// The number of command line arguments
+				  /*IN*/char*[],				// The command line arguments
+				  /*OUT*/OptionsRec&);			// The options read in
+bool IsGiven(/*IN*/const OptionsRec&,			// The options read in
+			 /*IN*/const OptionEnum&);			// The option being looked for
+bool RefuseOption(/*IN*/const string&);		// Why the options were turned down
+bool RefuseOptions(/*IN*/const OptionsRec&,				// The options read in
+				   /*IN*/const string&,					// The mode the options were given with
+				   /*IN*/const vector<OptionEnum>&);	// The options the mode cannot be run with
+bool CheckValues(/*IN*/const OptionsRec&);				// The options read in
+bool CheckCheckpointOptions(/*IN*/const OptionsRec&);	// The options read in
+bool CheckPathOptions(/*IN*/const OptionsRec&);			// The options read in
+bool CheckEstimateOptions(/*IN*/const OptionsRec&);		// The options read in
+bool CheckCheapestOptions(/*IN*/const OptionsRec&);		// The options read in
+bool CheckShortestOptions(/*IN*/const OptionsRec&);		// The options read in
+bool CheckEditsOptions(/*IN*/const OptionsRec&);		// The options read in
+bool CheckServeOptions(/*IN*/const OptionsRec&);		// The options read in
+bool CheckCacheOptions(/*IN*/const OptionsRec&);		// The options read in
+bool CheckOrderOptions(/*IN*/const OptionsRec&);		// The options read in
+bool CheckMeetOptions(/*IN*/const OptionsRec&);			// The options read in
 bool ValidateFileName(/*IN*/const string&);	// The file name being validated
-void ReadWalls(/*IN/OUT*/GameBoard&,		// The gameboard whose walls are being set up
-			   /*IN/OUT*/ifstream&);		// The input file containing the walls coordinates
+bool ReadWalls(/*IN/OUT*/GameBoard&,		// The gameboard whose walls are being set up
+			   /*IN/OUT*/ifstream&,			// The input file containing the walls coordinates
+			   /*OUT*/LayoutRec&);			// The entrance and exits read in
 void PrintCurrentPath(/*IN*/const GameBoard&,			// The gameboard whose path is being printed
 					  /*IN*/const int&,					// The boards number of rows
 					  /*IN*/const int&);				// The boards number of columns
@@ -95,32 +459,138 @@ void PrintCurrentPath(/*IN*/const GameBoard&,			// The gameboard whose path is b
 					  /*IN*/const Location2DRec&,		// The location of the head of the path
 					  /*IN*/const int&,					// The boards number of rows
 					  /*IN*/const int&);				// The boards number of columns
-
-DirectionEnum NextDir(/*IN*/const DirectionEnum&);		// The current direction
-Location2DRec Move(/*IN*/const DirectionEnum&,			// The desired direction to move in
-				   /*IN*/const Location2DRec&);			// The current location
-string PathDirections(/*IN*/ StackClass);				// The stack containing the path
-
-
-
-void main()
+void ReplayTrace(/*IN*/const OptionsRec&);		// The options naming the trace and how to replay it
+void LookupPaths(/*IN*/const OptionsRec&);		// The options naming the shards and the paths wanted
+void SearchLayered(/*IN*/const OptionsRec&,		// The options the search runs with
+				   /*IN*/const int[],				// The rows, columns and floors of the maze
+				   /*IN/OUT*/ifstream&,				// The input file, past its size line
+				   /*IN/OUT*/ofstream&);			// The output file writer
+bool ReadLayers(/*IN/OUT*/BoardND<LAYERED_DIMS>&,		// The board whose walls are being set up
+				/*IN/OUT*/ifstream&,					// The input file containing the walls coordinates
+				/*OUT*/LayoutNDRec<LAYERED_DIMS>&);		// The entrance and exits read in
+void PrintLayers(/*IN*/const BoardND<LAYERED_DIMS>&);	// The board being printed
+void ApplyEdits(/*IN*/const OptionsRec&,			// The options naming the edit file
+				/*IN/OUT*/GameBoard&,				// The board being edited
+				/*IN*/const LayoutRec&,				// The entrance and exits
+				/*IN/OUT*/ofstream&);				// The output file writer
+void PrintEditState(/*IN/OUT*/ofstream&,			// The output file writer
+					/*IN*/const string&,			// What the line is labelled with
+					/*IN*/const DynamicMap&,		// The map of the board as it now is
+					/*IN*/const LayoutRec&);		// The entrance and exits
+bool LoadBoard(/*IN*/const string&,			// The maze file
+			   /*OUT*/GameBoard*&,			// The board read in, made with new
+			   /*OUT*/LayoutRec&);			// The entrance and exits read in
+void RestoreResults(/*IN*/const OptionsRec&,				// The options naming the statistics files
+					/*IN*/const vector<CachePartRec>&,		// The files read back from the cache
+					/*IN/OUT*/ofstream&);					// The output file writer
+bool SaveResults(/*IN*/const OptionsRec&,		// The options naming the statistics files
+				 /*IN/OUT*/ResultCache&,		// The cache the results are saved to
+				 /*IN*/const string&);			// What the run was asked
+bool FitMemoryBudget(/*IN/OUT*/OptionsRec&,		// The options the search runs with
+					 /*IN*/const int&,			// The number of rows
+					 /*IN*/const int&,			// The number of columns
+					 /*OUT*/long long&,			// The bytes the search would take
+					 /*OUT*/bool&);				// Holds if the ring was given up to fit
+
+
+
+void main(int argc, char* argv[])
 {
-	StackClass pathStack;		// The current maze path
-	Location2DRec currLoc;		// The current position on the gameboard
-	StackRec currItem;			// The item to store within the pathStack
-	Location2DRec newLoc;		// The location being analyzed
-	DirectionEnum dir = NA;		// The current direction being analyzed
 	string inputFile;			// The name of the input file
 	ifstream fin;				// The input file reader
 	ofstream fout;				// The output file writer
 	bool isValid = false;		// Holds if an input file is valid or not
-	int pathCt = ZERO;			// The number of valid paths found
+	long long pathCt = ZERO;	// The number of valid paths found
 	int rows;					// Number of rows in the gameboard
 	int cols;					// Number of columns in the gameboard
+	OptionsRec opts;			// The options given on the command line
+	bool outOfTime = false;		// Holds if the time budget ran out before the search finished
+	DistanceMap distMap;		// Each cell's distance from the nearest exit, for the path length limit
+	ConnectivityMap conn;		// The board's connected components, to skip boards with no way out
+	LayoutRec layout;			// The entrance and exits of the gameboard
+	vector<Location2DRec> openExits;	// The exits that are not walls
+	bool exitReachable = false;	// Holds if any exit can be reached from the entrance
+	SearchView view;			// The live view of the search, only started with --view
+	TraceWriter trace;			// The trace of the search, only opened with --trace
+	PathStats stats;			// The path statistics, only kept with --stats
+	PathWriter writer;			// Prints the paths the search finds
+	SearchResultEnum result;	// How the search ended
+	PathEstimator estimator;	// Estimates the paths instead of searching, only run with --estimate
+	bool estimated = false;		// Holds if the paths were estimated instead of searched for
+	MeetCounter meet;			// Counts the paths from both ends, only run with --engine meet
+	long long meetCt = ZERO;	// The number of paths the meet engine counted
+	bool met = false;			// Holds if the paths were counted by the meet engine
+	string sizeLine;			// The first line of the input file
+	int sizes[LAYERED_DIMS];	// The rows, columns and floors of a layered maze
+	CostMap costMap;			// The cheapest cost of reaching each cell, only built with --cheapest
+	string pathText;			// The directions of a cheapest or shortest path
+	MazeServer server;			// Answers queries instead of searching, only run with --serve
+	bool cheapFound = false;	// Holds if a cheapest path to any exit was found
+	Location2DRec shortEnd;		// The exit cell a shortest path finishes on, only walked with --shortest
+	size_t shortExit = ZERO;	// The exit a shortest path leaves by
+	ResultCache cache;			// The results of boards solved before, only opened with --cache
+	string cacheKey;			// What this run is asked, the results are cached under it
+	vector<CachePartRec> cacheArr;	// The files read back from the cache
+	bool cacheHit = false;		// Holds if the results were read back from the cache
+	bool cacheSaved = false;	// Holds if the results were saved to the cache
+	long long needBytes = ZERO;	// The bytes the board and the search would take, only added up with --mem-mb
+	bool leanWrite = false;		// Holds if the paths are printed on the search's thread to fit the budget
+	chrono::steady_clock::time_point searchStart;	// When the search began, for the time to the first path
+	double firstMs = ZERO;		// The milliseconds taken to find the first path, only timed with --first
+	bool timedFirst = false;	// Holds if the time to the first path was measured
+
+
+	// Read in the command line options, abort if they do not make sense
+	if (!ParseOptions(argc, argv, opts))
+	{
+		// Display the usage and a terminating error message
+		cout << "Usage: TheMaze [inputFile] [--checkpoint FILE] [--checkpoint-every SECS]\n"
+			 << "               [--resume FILE] [--time-budget SECS] [--max-len L] [--min-len L]\n"
+			 << "               [--engine board|graph|corridor] [--view FPS] [--trace FILE]\n"
+			 << "               [--stats BASE] [--no-paths] [--sync-write] [--shard BASE] [--shard-mb MB]\n"
+			 << "               [--path N] [--to M] [--order fixed|manhattan|distance] [--first]\n"
+			 << "       TheMaze [inputFile] --estimate PROBES [--threads T] [--estimate-by uniform|reach]\n"
+			 << "               [--seed S] [--max-len L] [--min-len L]\n"
+			 << "               [--cache DIR] [--cache-mb MB] [--mem-mb MB]\n"
+			 << "               [--cell-order rows|zorder] [--huge-pages]\n"
+			 << "       TheMaze [inputFile] --cheapest|--shortest [--cache DIR] [--cache-mb MB]\n"
+			 << "       TheMaze [inputFile] --engine meet --no-paths [--threads T] [--cache DIR] [--cache-mb MB]\n"
+			 << "       TheMaze [inputFile] --edits FILE [--sync-write]\n"
+			 << "       TheMaze --replay FILE [--speed EPS] [--seek N] [--image FILE]\n"
+			 << "       TheMaze --lookup BASE --path N [--to M]\n"
+			 << "       TheMaze --serve [--threads T] [--max-len L] [--min-len L] [--engine board|graph|corridor]\n"
+			 << "Error - Invalid Command Line Options!!!" << endl;
+
+		abort();	// Abort the program
+	}
+
+	// Replay a traced search instead of searching if asked to
+	if (!opts.replayFile.empty())
+	{
+		ReplayTrace(opts);
+		return;
+	}
+
+	// Read back sharded paths instead of searching if asked to
+	if (!opts.lookupBase.empty())
+	{
+		LookupPaths(opts);
+		return;
+	}
+
+	// Answer queries instead of searching if asked to
+	if (opts.serve)
+	{
+		server.Run(cin, cout, opts, LoadBoard);
+		return;
+	}
+
+	// Use the input file name from the command line if one was given
+	inputFile = opts.inputFile;
+	isValid = !inputFile.empty() && ValidateFileName(inputFile);
 
-	
 	// Repeats until a valid file name is given
-	do
+	while (!isValid)
 	{
 		// Prompt the user for the input file name
 		cout << "Please enter the name of the input file: ";
@@ -145,14 +615,17 @@ void main()
 		// Clear the screen
 		system("cls");
 
-	} while (!isValid);
+	}// end while
 
 
 	// Open the input file
 	fin.open(inputFile);
 
 	// Open the output file
-	fout.open(OUTPUT_FILE);		// Open it here so if an error occurs it closes and overwrites itself
+	if (opts.resumeFile.empty())
+		fout.open(OUTPUT_FILE);		// Open it here so if an error occurs it closes and overwrites itself
+	else
+		fout.open(OUTPUT_FILE, ios::in | ios::out);	// Keep the paths written before the checkpoint
 
 
 	// Checks to see if the file exists
@@ -169,8 +642,19 @@ void main()
 
 
 	// Read in the size of the game board
-	fin >> rows;
-	fin >> cols;
+	getline(fin, sizeLine);
+	istringstream sizeIn(sizeLine);
+	sizeIn >> rows;
+	sizeIn >> cols;
+
+	// A third size is the number of floors of a layered maze, which is searched on its own
+	if (sizeIn >> sizes[LAYERED_DIMS - OFFSET])
+	{
+		sizes[ZERO] = rows;
+		sizes[OFFSET] = cols;
+		SearchLayered(opts, sizes, fin, fout);
+		return;
+	}
 
 
 	// Check if the rows amount and the column amount are valid, abort if not
@@ -185,166 +669,369 @@ void main()
 		abort();	// Abort the program
 	}
 
-	// Instantiate a gameboard of custom size
-	GameBoard gb(rows, cols);
+	// Check a cheapest path's cost cannot overflow on the board before it is read in, abort if it can
+	if (opts.cheapest && (long long)rows * cols > COST_CELLS_MAX)
+	{
+		cout << "Error - A board of " << (long long)rows * cols << " cells is too big to find the cheapest paths on, "
+			 << "the most is " << COST_CELLS_MAX << "!!!" << endl;	// Displays a terminating error message
 
-	// Read in and store the walls in the gameboard
-	ReadWalls(gb, fin);
+		// Close the input and output files
+		fin.close();
+		fout.close();
 
-	// Close the input file
-	fin.close();
+		abort();	// Abort the program
+	}
 
+	// Check a board to be laid out in z-order is not one that is tiled, abort if it is
+	if (opts.cellOrder == ORDER_ZORDER && UsesTiles(rows, cols))
+	{
+		cout << "Error - A board of " << (long long)rows * cols << " cells is tiled and cannot be laid out in z-order, "
+			 << "the most is " << TILED_BOARD_CELLS - OFFSET << "!!!" << endl;	// Displays a terminating error message
 
-	// Set currLoc temporarily to the exit location
-	currLoc.x = rows - OFFSET;
-	currLoc.y = cols - OFFSET;
+		// Close the input and output files
+		fin.close();
+		fout.close();
 
-	// Check if the starting position is blocked by a wall
-	if (gb.GetStatus(START_POS) == WALL || gb.GetStatus(currLoc) == WALL)
-		fout << "No possible paths found!" << endl;
+		abort();	// Abort the program
+	}
 
-	// If the board is a 1x1 or the start and exit are on the same spot print the only path
-	else if (START_POS.x == currLoc.x && START_POS.y == currLoc.y)
-		fout << "Path #1: " << EXIT_DIR;	// Print the only path
+	// Check the board and the search fit the memory budget before any of it is made, abort if not
+	if (opts.memMb > ZERO && !FitMemoryBudget(opts, rows, cols, needBytes, leanWrite))
+	{
+		// Displays a terminating error message
+		cout << "Error - The board and its search would need " << needBytes << " bytes, over the budget of "
+			 << opts.memMb << " MB!!!" << endl;
 
+		// Close the input and output files
+		fin.close();
+		fout.close();
 
-	// Find every possible path
-	else
+		abort();	// Abort the program
+	}
+
+	// Instantiate a gameboard of custom size, tiled if it is too big to allocate every cell of
+	GameBoard* gbPtr = NewBoard(rows, cols, opts.cellOrder, opts.hugePages);	// The gameboard, made with new
+	GameBoard& gb = *gbPtr;														// The gameboard
+
+	// Read in and store the walls in the gameboard, abort if the entrance or an exit is not valid
+	if (!ReadWalls(gb, fin, layout))
+	{
+		cout << "Error - Invalid Entrance Or Exit!!!" << endl;	// Displays a terminating error message
+
+		// Close the input and output files
+		fin.close();
+		fout.close();
+
+		abort();	// Abort the program
+	}
+
+	// Close the input file
+	fin.close();
+
+	// A tiled board gives back the tiles its walls filled solid
+	gb.Compact();
+
+	// Look the board up in the cache if asked to
+	if (!opts.cacheDir.empty() && cache.Open(opts.cacheDir, opts.cacheMb * BYTES_PER_MB))
 	{
-		// Start at the entrance
-		currLoc = START_POS;
+		cacheKey = CacheKey(gb, layout, opts);
+		cacheHit = cache.Fetch(cacheKey, cacheArr);
+	}
+
+	// Print the results read back instead of solving the board again
+	if (cacheHit)
+	{
+		RestoreResults(opts, cacheArr, fout);
+		fout.close();
 
-		// Store the initial location and direction
-		currItem.loc = currLoc;
-		currItem.dir = dir;
+		// Clear the screen and print the empty board
+		system("cls");
+		PrintCurrentPath(gb, rows, cols);
+		cout << "\nResults read back from the cache '" << opts.cacheDir << "'." << endl;
+		delete gbPtr;
+		return;
+	}
 
-		// Push the first item onto the stack
-		pathStack.Push(currItem);
+	// Label the board's connected components
+	conn.Build(gb);
 
-		// Repeat until the stack is empty
-		while (!pathStack.IsEmpty())
+	// The components' runs are only known now the walls are read, so check the budget again with them
+	if (opts.memMb > ZERO)
+	{
+		needBytes += MemPeak(MEM_MAPS) - ConnectivityMap::MapBytes(rows, cols);
+		if (needBytes > opts.memMb * BYTES_PER_MB)
 		{
-			// Get the next direction to search
-			dir = NextDir(dir);
+			// Displays a terminating error message
+			cout << "Error - The board and its search would need " << needBytes << " bytes, over the budget of "
+				 << opts.memMb << " MB!!!" << endl;
 
-			// Get the next coordinate being analyzed
-			newLoc = Move(dir, currLoc);
+			// Close the output file
+			fout.close();
 
-			// See if the space is available to travel into
-			if (gb.GetStatus(newLoc) == OPEN)
-			{
-				// Store the new items information
-				currItem.loc = newLoc;
-				currItem.dir = dir;
+			abort();	// Abort the program
+		}
+	}
 
-				// Add the new item to the stack
-				pathStack.Push(currItem);
+	// Keep statistics on the paths if asked to, once the maps counted so far are only the components
+	if (!opts.statsBase.empty())
+		stats.Start(rows, cols);
 
-				// Set the cell that was just entered to visited
-				gb.SetStatus(currLoc, VISITED);
+	// Gather the exits that are not walls, and see if any of them can be reached from the entrance
+	for (size_t i = ZERO; i < layout.exits.size(); i++)
+		if (gb.GetStatus(layout.exits[i].loc) != WALL)
+		{
+			openExits.push_back(layout.exits[i].loc);
+			exitReachable = exitReachable || conn.IsConnected(layout.start, layout.exits[i].loc);
+		}
 
-				// Reset the direction to N/A
-				dir = NA;
+	// A debug build checks the entrance's component against a flood fill from the entrance
+	assert(conn.CheckComponent(layout.start));
 
-				////	================= CODE TO PRINT THE CURRENT PATH TO OUTPUT =============
-				////							(DISABLE IF TOO SLOW) 
+	// Edit the board instead of searching it if asked to, the edits may open up a way out
+	if (!opts.editsFile.empty())
+		ApplyEdits(opts, gb, layout, fout);
 
+	// Check if the starting position or every exit is blocked by a wall
+	else if (gb.GetStatus(layout.start) == WALL || openExits.empty())
+		fout << "No possible paths found!" << endl;
 
-				//// Clear the screen
-				//system("cls");
+	// If the board is a 1x1 or the start and its only exit are on the same spot print the only path
+	else if (layout.exits.size() == OFFSET &&
+			 layout.start.x == layout.exits[ZERO].loc.x && layout.start.y == layout.exits[ZERO].loc.y)
+	{
+		// The only path is the single exit move, make sure it is within the length limits
+		if (WithinLenLimits(OFFSET, opts))
+			fout << "Path #1: " << layout.exits[ZERO].dir;	// Print the only path
+		else
+			fout << "No possible paths!" << endl;
+	}
 
-				//// Print the path
-				//PrintCurrentPath(gb, newLoc, rows, cols);
+	// Check if an exit can be reached from the entrance at all, there is nothing to search if not
+	else if (!exitReachable)
+		fout << "No possible paths!" << endl;
 
-				//// Add a time delay
-				//std::this_thread::sleep_for(50ms);	// I'd make a constant but im not sure what 
-				//									// variable that is
+	// Estimate the paths instead of finding them if asked to
+	else if (opts.estimateProbes > ZERO)
+	{
+		// The probes cut paths that are too long short the way the search does
+		if (opts.maxLen > ZERO)
+			distMap.Build(gb, openExits);
+
+		estimator.Build(gb, layout, opts, distMap);
+		estimator.Run(opts.estimateProbes, opts.threads, opts.estimateSample,
+					  (unsigned long long)opts.estimateSeed);
+		estimator.Report(fout);
+		estimated = true;
+	}
 
-				//// =========================================================================
+	// Count the paths from both ends instead of finding them if asked to
+	else if (opts.engine == ENGINE_MEET)
+	{
+		meetCt = meet.Count(gb, layout, opts.threads);
+		met = true;
+
+		// The count is printed as the search prints it without the paths
+		if (meetCt == ZERO)
+			fout << "No possible paths!" << endl;
+		else
+			fout << "Paths found: " << meetCt << endl;
+	}
 
-				// Check if the cell is the exit cell
-				if (newLoc.x == rows - OFFSET && newLoc.y == cols - OFFSET)
-				{
+	// Find the cheapest path to each exit instead of every path if asked to
+	else if (opts.cheapest)
+	{
+		costMap.Build(gb, layout.start);
 
-					// Label the path
-					fout << "Path #" << ++pathCt << ":\t";
+		// Print each exit's cheapest path, its exit move costs nothing
+		for (size_t i = ZERO; i < layout.exits.size(); i++)
+			if (costMap.GetPath(layout.exits[i].loc, pathText))
+			{
+				fout << "Cheapest path" << ExitLabel(layout, (int)i) << ":\t" << pathText << layout.exits[i].dir
+					 << "\tCost: " << costMap.GetCost(layout.exits[i].loc) << "\n\n";
+				cheapFound = true;
+			}
 
-					// Print the path - Exit direction is tacked on as it is the final movement
-					fout << PathDirections(pathStack) << "-" << EXIT_DIR << "\n\n";
+		// Check if no exit could be reached
+		if (!cheapFound)
+			fout << "No possible paths!" << endl;
+	}
 
-					// Get the direction of the most recent added item
-					dir = pathStack.Retrieve().dir;		// The search will continue from this direction
+	// Find a shortest path to the nearest exit instead of every path if asked to
+	else if (opts.shortest)
+	{
+		distMap.Build(gb, openExits);
+		distMap.GetShortestPath(layout.start, pathText, shortEnd);
+
+		// The path leaves by the first open exit on the cell it finishes on, its exit move is counted
+		while (layout.exits[shortExit].loc.x != shortEnd.x || layout.exits[shortExit].loc.y != shortEnd.y ||
+			   gb.GetStatus(layout.exits[shortExit].loc) == WALL)
+			shortExit++;
+		fout << "Shortest path" << ExitLabel(layout, (int)shortExit) << ":\t" << pathText
+			 << layout.exits[shortExit].dir << "\tLength: " << distMap.GetDistance(layout.start) + OFFSET << "\n\n";
+	}
 
-					// Get rid of the item
-					pathStack.Pop();
 
-					// Set the status of the removed cell to open, its no longer appart of the path
-					gb.SetStatus(currLoc, OPEN);
-				}
+	// Find every possible path
+	else
+	{
+		// The time to the first path includes the distances and orders it needs
+		searchStart = chrono::steady_clock::now();
 
-				else
-					currLoc = newLoc;	// Go to the next location
+		// Measure how far each cell is from its nearest exit so paths that are too long can be cut short,
+		// or so the neighbours with the fewest moves left are tried first
+		if (opts.maxLen > ZERO || opts.dirOrder == DIR_ORDER_DISTANCE)
+			distMap.Build(gb, openExits);
 
-			}// end if space is open
+		// Trace the search if asked to, abort if the trace file cannot be created
+		if (!opts.traceFile.empty() && !trace.Open(opts.traceFile, gb, layout.start))
+		{
+			cout << "Error - Could Not Create The Trace File!!!" << endl;	// Displays a terminating error message
 
-			// West indicates that a cells direction search has been exhausted so the path must back track
-			// until a new direction can be explored
-			while (dir == WEST)
-			{
-				// Get the direction of the most recent added item
-				dir = pathStack.Retrieve().dir;		// The search will continue from this direction
+			// Close the output file
+			fout.close();
 
-				// Get rid of the item, back track the path
-				pathStack.Pop();
+			abort();	// Abort the program
+		}
 
-				// Check to see if the search is over
-				if (!pathStack.IsEmpty())
-				{
-					// Go to the prior location
-					currLoc = pathStack.Retrieve().loc;
+		// Watch the search if asked to
+		if (opts.viewFps > ZERO)
+			view.Start(gb, opts.viewFps);
+
+		// Print the paths to shards if asked to, abort if they cannot be created
+		if (!opts.shardBase.empty() && !writer.ShardTo(opts.shardBase, opts.shardMb * BYTES_PER_MB))
+		{
+			cout << "Error - Could Not Create The Shard Files!!!" << endl;	// Displays a terminating error message
 
-					// Treat the current location as open until a forward progressing movement is made
-					gb.SetStatus(currLoc, OPEN);
-				}
+			// Close the output file
+			fout.close();
 
+			abort();	// Abort the program
+		}
 
-				////	================= CODE TO PRINT THE CURRENT PATH TO OUTPUT =============
-				////							(DISABLE IF TOO SLOW) 
+		// Print the paths on a thread of their own unless they are not printed at all
+		writer.Start(fout, layout, !opts.syncWrite && !opts.noPaths);
 
-				//// Clear the screen
-				//system("cls");
+		// Search the board
+		result = SearchBoard(gb, layout, opts, distMap, view, trace, stats, writer, pathCt);
+		if (opts.first)
+		{
+			firstMs = chrono::duration<double, milli>(chrono::steady_clock::now() - searchStart).count();
+			timedFirst = true;
+		}
+		writer.Stop();
+		trace.Close();
 
-				//// Print the path
-				//PrintCurrentPath(gb, currLoc, rows, cols);
+		// Show the final count on an empty path and stop watching
+		if (opts.viewFps > ZERO)
+		{
+			view.Publish(vector<StackRec>(), pathCt);
+			view.Stop();
+		}
 
-				//// Add a time delay
-				//std::this_thread::sleep_for(50ms);	// I'd make a constant but im not sure what
-				//									// variable that is
+		// Abort if the checkpoint does not belong to this board
+		if (result == SEARCH_BAD_CHECKPOINT)
+		{
+			cout << "Error - Invalid Checkpoint File!!!" << endl;	// Displays a terminating error message
 
-				//// =========================================================================
+			// Close the output file
+			fout.close();
 
+			abort();	// Abort the program
+		}
 
-			}// end while
+		// The search finished
+		outOfTime = (result == SEARCH_OUT_OF_TIME);
+		if (!outOfTime)
+		{
+			// Check if no paths were found
+			if (pathCt == ZERO)
+				fout << "No possible paths!" << endl;	// Output to the file that no paths were found
 
-		}// end while
+			// There are fewer paths than the first one wanted
+			else if (pathCt < opts.firstPath)
+				fout << "Only " << pathCt << " paths found, there is no path #" << opts.firstPath << "!" << endl;
 
+			// Only the count goes here if the paths were not printed or went to the shards
+			else if (opts.noPaths || !opts.shardBase.empty())
+				fout << "Paths found: " << pathCt << endl;
 
-		// Check if no paths were found
-		if (pathCt == ZERO)
-			fout << "No possible paths!" << endl;	// Output to the file that no paths were found
+			// The checkpoint is no longer needed
+			if (!opts.checkpointFile.empty())
+				remove(opts.checkpointFile.c_str());
+		}
 
 	}// end else
 
 
+	// Save the statistics if they were kept, from the moment the search stopped
+	if (stats.IsStarted())
+	{
+		stats.Finish();
+		if (!stats.Save(opts.statsBase, gb))
+			cout << "Warning - Could not save the statistics to '" << opts.statsBase << "'" << endl;
+	}
+
 	// Close the output file
 	fout.close();
 
+	// Save the results to the cache so the next run asked the same thing reads them back,
+	// a search that ran out of time has not finished them
+	if (cache.IsOpen() && !outOfTime)
+		cacheSaved = SaveResults(opts, cache, cacheKey);
+
 	// Clear the screen
 	system("cls");
 
 	// Print the emptry board
 	PrintCurrentPath(gb, rows, cols);
 
+	// Let the user know how to finish the search
+	if (outOfTime)
+		cout << "\nTime budget reached after " << pathCt << " paths, the search was saved to '"
+			 << BudgetFile(opts) << "'.\nRun again with --resume " << BudgetFile(opts) << " to continue." << endl;
+
+	// Show the estimate below the board
+	if (estimated)
+	{
+		cout << endl;
+		estimator.Report(cout);
+	}
+
+	// Show how the meet engine split the paths
+	if (met)
+	{
+		cout << endl;
+		meet.Report(cout);
+	}
+
+	// Show how well the search and the writer kept up with each other
+	if (writer.IsThreaded())
+		cout << "\nPath writer stalls: the search waited " << writer.GetSearchStalls()
+			 << " times, the writer waited " << writer.GetWriterStalls() << " times." << endl;
+
+	// Show how long the first path took to find, and in which order
+	if (timedFirst && pathCt > ZERO)
+		cout << "\nFirst path found in " << firstMs << " ms trying the neighbours in the "
+			 << OrderText(opts.dirOrder) << " order." << endl;
+	else if (timedFirst)
+		cout << "\nNo path found, the search took " << firstMs << " ms trying the neighbours in the "
+			 << OrderText(opts.dirOrder) << " order." << endl;
+
+	// Show the memory taken, and if the budget changed how the paths were printed
+	cout << endl;
+	PrintMemory(cout);
+	if (leanWrite)
+		cout << "The paths were printed on the search's thread so its " << needBytes << " bytes fit the budget of "
+			 << opts.memMb << " MB." << endl;
+
+	// Let the user know if the results will be read back next time
+	if (cacheSaved)
+		cout << "\nResults saved to the cache '" << opts.cacheDir << "', " << cache.GetEvictCt()
+			 << " older results were removed to make room." << endl;
+	else if (!opts.cacheDir.empty() && !outOfTime)
+		cout << "\nWarning - Could not save the results to the cache '" << opts.cacheDir << "'" << endl;
+
+	delete gbPtr;
 
 }// end main
 
@@ -356,68 +1043,259 @@ void main()
 
 
 // O(N)
-// Purpose: Validate a file name
-//			(make sure it contains onl letters and a period and 3 letters after the period)
-// Pre: The file name
-// Post: Returns true if the file name is valid,
-//		 otherwise false
-bool ValidateFileName(/*IN*/const string& fileName)	// The file name being validated
+// Purpose: Read the run options from the command line
+// Pre: The command line arguments
+// Post: opts holds the options given, with defaults for the rest.
+//		 false is returned, after printing why, if an option is unknown, missing its value,
+//		 out of range, or given with a mode it cannot be run with
+bool ParseOptions(/*IN*/int argc,				// The number of command line arguments
+				  /*IN*/char* argv[],			// The command line arguments
+				  /*OUT*/OptionsRec& opts)		// The options read in
 {
-	bool periodFound = false;	// Keeps track of if a period is found or not
-	int pos = ZERO;				// Keeps track of the position in the string
-	int extenAmt = ZERO;		// Keeps track of the number of extension characters
+	string arg;		// The current argument
+
+	// Set the defaults
+	opts.inputFile = "";
+	opts.checkpointFile = "";
+	opts.resumeFile = "";
+	opts.checkpointSecs = DEFAULT_CHECKPOINT_SECS;
+	opts.timeBudgetSecs = ZERO;
+	opts.maxLen = ZERO;
+	opts.minLen = ZERO;
+	opts.engine = ENGINE_BOARD;
+	opts.viewFps = ZERO;
+	opts.traceFile = "";
+	opts.replayFile = "";
+	opts.replaySpeed = DEFAULT_REPLAY_SPEED;
+	opts.seekPath = ZERO;
+	opts.imageFile = "";
+	opts.statsBase = "";
+	opts.noPaths = false;
+	opts.syncWrite = false;
+	opts.shardBase = "";
+	opts.shardMb = DEFAULT_SHARD_MB;
+	opts.lookupBase = "";
+	opts.firstPath = ZERO;
+	opts.lastPath = ZERO;
+	opts.estimateProbes = ZERO;
+	opts.threads = max((int)thread::hardware_concurrency(), OFFSET);
+	opts.estimateSample = SAMPLE_UNIFORM;
+	opts.estimateSeed = DEFAULT_ESTIMATE_SEED;
+	opts.cheapest = false;
+	opts.shortest = false;
+	opts.editsFile = "";
+	opts.serve = false;
+	opts.cacheDir = "";
+	opts.cacheMb = DEFAULT_CACHE_MB;
+	opts.memMb = ZERO;
+	opts.cellOrder = ORDER_ROWS;
+	opts.hugePages = false;
+	opts.dirOrder = DIR_ORDER_FIXED;
+	opts.first = false;
+
+	// Go through every argument after the program name
+	for (int i = OFFSET; i < argc; i++)
+	{
+		arg = argv[i];
+
+		// Options that take a value must have one after them
+		if (arg == "--checkpoint" && i + OFFSET < argc)
+			opts.checkpointFile = argv[++i];
+		else if (arg == "--checkpoint-every" && i + OFFSET < argc)
+			opts.checkpointSecs = atoi(argv[++i]);
+		else if (arg == "--resume" && i + OFFSET < argc)
+			opts.resumeFile = argv[++i];
+		else if (arg == "--time-budget" && i + OFFSET < argc)
+			opts.timeBudgetSecs = atoi(argv[++i]);
+		else if (arg == "--max-len" && i + OFFSET < argc)
+			opts.maxLen = atoi(argv[++i]);
+		else if (arg == "--min-len" && i + OFFSET < argc)
+			opts.minLen = atoi(argv[++i]);
+		else if (arg == "--view" && i + OFFSET < argc)
+			opts.viewFps = atoi(argv[++i]);
+		else if (arg == "--trace" && i + OFFSET < argc)
+			opts.traceFile = argv[++i];
+		else if (arg == "--replay" && i + OFFSET < argc)
+			opts.replayFile = argv[++i];
+		else if (arg == "--speed" && i + OFFSET < argc)
+			opts.replaySpeed = atoi(argv[++i]);
+		else if (arg == "--seek" && i + OFFSET < argc)
+			opts.seekPath = atoi(argv[++i]);
+		else if (arg == "--image" && i + OFFSET < argc)
+			opts.imageFile = argv[++i];
+		else if (arg == "--stats" && i + OFFSET < argc)
+			opts.statsBase = argv[++i];
+		else if (arg == "--no-paths")
+			opts.noPaths = true;
+		else if (arg == "--sync-write")
+			opts.syncWrite = true;
+		else if (arg == "--cheapest")
+			opts.cheapest = true;
+		else if (arg == "--shortest")
+			opts.shortest = true;
+		else if (arg == "--edits" && i + OFFSET < argc)
+			opts.editsFile = argv[++i];
+		else if (arg == "--serve")
+			opts.serve = true;
+		else if (arg == "--huge-pages")
+			opts.hugePages = true;
+		else if (arg == "--first")
+			opts.first = true;
+		else if (arg == "--cache" && i + OFFSET < argc)
+			opts.cacheDir = argv[++i];
+		else if (arg == "--cache-mb" && i + OFFSET < argc)
+			opts.cacheMb = atoi(argv[++i]);
+		else if (arg == "--mem-mb" && i + OFFSET < argc)
+			opts.memMb = atoll(argv[++i]);
+		else if (arg == "--shard" && i + OFFSET < argc)
+			opts.shardBase = argv[++i];
+		else if (arg == "--shard-mb" && i + OFFSET < argc)
+			opts.shardMb = atoi(argv[++i]);
+		else if (arg == "--lookup" && i + OFFSET < argc)
+			opts.lookupBase = argv[++i];
+		else if (arg == "--path" && i + OFFSET < argc)
+			opts.firstPath = atoll(argv[++i]);
+		else if (arg == "--to" && i + OFFSET < argc)
+			opts.lastPath = atoll(argv[++i]);
+		else if (arg == "--estimate" && i + OFFSET < argc)
+			opts.estimateProbes = atoll(argv[++i]);
+		else if (arg == "--threads" && i + OFFSET < argc)
+			opts.threads = atoi(argv[++i]);
+		else if (arg == "--seed" && i + OFFSET < argc)
+			opts.estimateSeed = atoll(argv[++i]);
+		else if (arg == "--estimate-by" && i + OFFSET < argc)
+		{
+			// Only the known ways of probing are accepted
+			arg = argv[++i];
+			if (arg == "uniform")
+				opts.estimateSample = SAMPLE_UNIFORM;
+			else if (arg == "reach")
+				opts.estimateSample = SAMPLE_REACH;
+			else
+				return RefuseOption("'" + arg + "' is not a way of probing");
+		}
+		else if (arg == "--engine" && i + OFFSET < argc)
+		{
+			// Only the known engines are accepted
+			arg = argv[++i];
+			if (arg == "board")
+				opts.engine = ENGINE_BOARD;
+			else if (arg == "graph")
+				opts.engine = ENGINE_GRAPH;
+			else if (arg == "corridor")
+				opts.engine = ENGINE_CORRIDOR;
+			else if (arg == "meet")
+				opts.engine = ENGINE_MEET;
+			else
+				return RefuseOption("'" + arg + "' is not an engine");
+		}
+		else if (arg == "--cell-order" && i + OFFSET < argc)
+		{
+			// Only the known layouts are accepted
+			arg = argv[++i];
+			if (arg == "rows")
+				opts.cellOrder = ORDER_ROWS;
+			else if (arg == "zorder")
+				opts.cellOrder = ORDER_ZORDER;
+			else
+				return RefuseOption("'" + arg + "' is not a cell order");
+		}
+		else if (arg == "--order" && i + OFFSET < argc)
+		{
+			// Only the known neighbour orders are accepted
+			arg = argv[++i];
+			if (arg == "fixed")
+				opts.dirOrder = DIR_ORDER_FIXED;
+			else if (arg == "manhattan")
+				opts.dirOrder = DIR_ORDER_MANHATTAN;
+			else if (arg == "distance")
+				opts.dirOrder = DIR_ORDER_DISTANCE;
+			else
+				return RefuseOption("'" + arg + "' is not a neighbour order");
+		}
 
+		// The only argument without a dash is the input file
+		else if (!arg.empty() && arg[ZERO] != '-' && opts.inputFile.empty())
+			opts.inputFile = arg;
 
-	// Check if the first character is a period
-	if (fileName[pos] == '.')
-		return false;	// Return false because a letter is needed before the period
+		else
+			return RefuseOption("'" + arg + "' is not an option, or is missing its value");
+	}
 
+	// The first path mode is a search stopped at its first path
+	if (opts.first && opts.lastPath == ZERO)
+		opts.lastPath = OFFSET;
 
-	// Repeat until the end of the string or until a period is found
-	while(pos < fileName.length() && !periodFound)
-	{
-		// See if the character is the period
-		if (fileName[pos] == '.')
-			periodFound = true;
+	// Each mode turns down the options it cannot be run with
+	return CheckValues(opts) && CheckCheckpointOptions(opts) && CheckPathOptions(opts) &&
+		   CheckEstimateOptions(opts) && CheckCheapestOptions(opts) && CheckShortestOptions(opts) &&
+		   CheckEditsOptions(opts) && CheckServeOptions(opts) && CheckCacheOptions(opts) && CheckOrderOptions(opts) &&
+		   CheckMeetOptions(opts);
 
+}// end ParseOptions
 
-		// Check if the character is not a letter
-		else if (fileName[pos] < 'A' || fileName[pos] > 'z')
-			return false;	// Return false if not a letter
 
+// ===================================================================================================
 
-		// Increment position
-		pos++;
-	}
 
-	// If the period is found check for the last three characters
-	if (periodFound)
+
+// O(1)
+// Purpose: Check if an option was given
+// Pre: The options read in, with --first already stopping the search at its first path
+// Post: true is returned if the option is not at its default. --to is only given if it was
+//		 not set by --first
+bool IsGiven(/*IN*/const OptionsRec& opts,			// The options read in
+			 /*IN*/const OptionEnum& option)		// The option being looked for
+{
+	switch (option)
 	{
-		// Check to see if there are only three letter characters remaining
-		while (extenAmt < CHAR_AFTER_PERIOD && pos < fileName.length())
-		{
-			// Check if the character is not a letter
-			if (fileName[pos] < 'A' || fileName[pos] > 'z')
-				return false;	// Return false if not a letter
+	case OPTION_INPUT_FILE: return !opts.inputFile.empty();
+	case OPTION_CHECKPOINT: return !opts.checkpointFile.empty();
+	case OPTION_RESUME: return !opts.resumeFile.empty();
+	case OPTION_TIME_BUDGET: return opts.timeBudgetSecs != ZERO;
+	case OPTION_MAX_LEN: return opts.maxLen != ZERO;
+	case OPTION_MIN_LEN: return opts.minLen != ZERO;
+	case OPTION_ENGINE: return opts.engine != ENGINE_BOARD;
+	case OPTION_VIEW: return opts.viewFps != ZERO;
+	case OPTION_TRACE: return !opts.traceFile.empty();
+	case OPTION_STATS: return !opts.statsBase.empty();
+	case OPTION_NO_PATHS: return opts.noPaths;
+	case OPTION_SHARD: return !opts.shardBase.empty();
+	case OPTION_PATH: return opts.firstPath != ZERO;
+	case OPTION_TO: return opts.lastPath != ZERO && !opts.first;
+	case OPTION_FIRST: return opts.first;
+	case OPTION_ORDER: return opts.dirOrder != DIR_ORDER_FIXED;
+	case OPTION_ESTIMATE: return opts.estimateProbes != ZERO;
+	case OPTION_CHEAPEST: return opts.cheapest;
+	case OPTION_SHORTEST: return opts.shortest;
+	case OPTION_EDITS: return !opts.editsFile.empty();
+	case OPTION_SERVE: return opts.serve;
+	case OPTION_CACHE: return !opts.cacheDir.empty();
+	case OPTION_MEM_MB: return opts.memMb != ZERO;
+	case OPTION_CELL_ORDER: return opts.cellOrder != ORDER_ROWS;
+	case OPTION_HUGE_PAGES: return opts.hugePages;
+	default: return false;
+	};
 
-			// Increment pos
-			pos++;
+}// end IsGiven
 
-			// Increment extenAmt
-			extenAmt++;
-		}
 
-		// Check if pos is equal to the length of the fileName
-		// and that there were only three characters after the period
-		if (pos == fileName.length() && extenAmt == CHAR_AFTER_PERIOD)
-			return true;	// It is a valid file name
 
-	}
+// ===================================================================================================
 
-	return false;	// Somewhere along the way the fileName was not valid
 
 
-}// end ValidateFileName
+// O(1)
+// Purpose: Print why the options were turned down
+// Pre: What was wrong with them
+// Post: The reason is printed to the console and false is returned
+bool RefuseOption(/*IN*/const string& why)		// Why the options were turned down
+{
+	cout << why << "." << endl;
+
+	return false;
+
+}// end RefuseOption
 
 
 
@@ -426,34 +1304,63 @@ bool ValidateFileName(/*IN*/const string& fileName)	// The file name being valid
 
 
 // O(N)
-// Purpose: Read in wall coordinates from an input file and set them up in a gameboard object
-// Pre: The board the walls are being set up in, and the input file with the walls coordinates
-// Post: The walls are placed in the appropriate gameboard coordinates,
-//		 any invalid or out of range coordinates will be ignored
-void ReadWalls(/*IN/OUT*/GameBoard& board,			// The gameboard whose walls are being set up
-			   /*IN/OUT*/ifstream& fin)				// The input file containing the walls coordinates
+// Purpose: Turn the options down if any the mode cannot be run with was given
+// Pre: The options read in, the mode they were given with and the options it cannot be run with
+// Post: false is returned, after printing the first of them given, if any of them was given
+bool RefuseOptions(/*IN*/const OptionsRec& opts,				// The options read in
+				   /*IN*/const string& mode,					// The mode the options were given with
+				   /*IN*/const vector<OptionEnum>& refused)		// The options the mode cannot be run with
 {
-	Location2DRec wallCoord;	// Temporary storage for the wall coordinate
+	for (size_t i = ZERO; i < refused.size(); i++)
+		if (IsGiven(opts, refused[i]))
+			return RefuseOption(mode + " cannot be used with " + OPTION_NAMES[refused[i]]);
 
+	return true;
 
-	// Grab and store the wall coordinate - priming read
-	fin >> wallCoord.x;
-	fin >> wallCoord.y;
+}// end RefuseOptions
 
 
-	// While coordinates are still within the file
-	while (fin)
-	{
-		// Put the wall in the game board
-		board.SetStatus(wallCoord, WALL);
 
-		// Grab and store the wall coordinate
-		fin >> wallCoord.x;
-		fin >> wallCoord.y;
+// ===================================================================================================
 
-	}// end while
 
-}// end ReadWalls
+
+// O(1)
+// Purpose: Check each option's value is in range
+// Pre: The options read in
+// Post: false is returned, after printing why, if a value is out of range
+bool CheckValues(/*IN*/const OptionsRec& opts)		// The options read in
+{
+	if (opts.checkpointSecs <= ZERO)
+		return RefuseOption("--checkpoint-every must be above zero");
+	if (opts.timeBudgetSecs < ZERO)
+		return RefuseOption("--time-budget cannot be under zero");
+	if (opts.maxLen < ZERO || opts.minLen < ZERO)
+		return RefuseOption("--max-len and --min-len cannot be under zero");
+	if (opts.maxLen != ZERO && opts.minLen > opts.maxLen)
+		return RefuseOption("--min-len cannot be over --max-len");
+	if (opts.viewFps < ZERO)
+		return RefuseOption("--view cannot be under zero");
+	if (opts.replaySpeed < ZERO || opts.seekPath < ZERO)
+		return RefuseOption("--speed and --seek cannot be under zero");
+	if (opts.shardMb <= ZERO)
+		return RefuseOption("--shard-mb must be above zero");
+	if (opts.firstPath < ZERO || opts.lastPath < ZERO)
+		return RefuseOption("--path and --to cannot be under zero");
+	if (opts.estimateProbes < ZERO)
+		return RefuseOption("--estimate cannot be under zero");
+	if (opts.threads <= ZERO)
+		return RefuseOption("--threads must be above zero");
+	if (opts.cacheMb <= ZERO)
+		return RefuseOption("--cache-mb must be above zero");
+	if (opts.memMb < ZERO)
+		return RefuseOption("--mem-mb cannot be under zero");
+	if (opts.hugePages && opts.cellOrder != ORDER_ZORDER)
+		return RefuseOption("--huge-pages needs --cell-order zorder");
+
+	return true;
+
+}// end CheckValues
 
 
 
@@ -461,72 +1368,434 @@ void ReadWalls(/*IN/OUT*/GameBoard& board,			// The gameboard whose walls are be
 
 
 
-// O(N^2)
-// Purpose: Print the current path mapped out on the game board
-//			Specifying the head position.
-// Pre: The game board, the paths head, and its row and column size are needed
-// Post: The gameboard will be printed to the console in a table format with green
-//		 0's indicating the path, red X's indicating the walls, and a 
-//		 green O indicating the head
-void PrintCurrentPath(/*IN*/const GameBoard& board,			// The gameboard whose path is being printed
-					  /*IN*/const Location2DRec& headLoc,	// The location of the head of the path
-					  /*IN*/const int& rowSize,				// The boards number of rows
-					  /*IN*/const int& colSize)				// The boards number of columns
+// O(1)
+// Purpose: Check the options fit a search that is saved or started part way in
+// Pre: The options read in
+// Post: false is returned, after printing why, if sharded paths are checkpointed, or a resumed
+//		 search is started at a path number
+bool CheckCheckpointOptions(/*IN*/const OptionsRec& opts)		// The options read in
 {
-	StateEnum cellState;	// The current cell's status
-	Location2DRec currLoc;	// The current cell's location
+	// Sharded paths cannot be cut back to a checkpoint
+	if (IsGiven(opts, OPTION_SHARD) && !RefuseOptions(opts, "--shard", SHARD_REFUSED))
+		return false;
 
+	// A resumed search goes on from its checkpoint
+	if (IsGiven(opts, OPTION_PATH) && IsGiven(opts, OPTION_RESUME))
+		return RefuseOption("--path cannot be used with --resume");
 
-	// Prints the board 
-	for (int i = ZERO; i < rowSize; i++)
-	{
-		// Get the current row
-		currLoc.x = i;
+	return true;
 
-		// Print the table border
-		for (int j = ZERO; j < colSize; j++)
-		{
-			cout << "+---";	// This will print the appropriate amount of cells
-		}
-		cout << "+\n";		// Tac on the last corner and go to the next line
+}// end CheckCheckpointOptions
 
-		// Print the contents of the cells
-		for (int j = ZERO; j < colSize; j++)
-		{
-			// Get the current column
-			currLoc.y = j;
 
-			// Get the status of the cell
-			cellState = board.GetStatus(currLoc);
 
-			// Check if the location is the head
-			if(currLoc.x == headLoc.x && currLoc.y == headLoc.y)
-				cout << "| " << "\033[1;32mO\033[0m" << " ";	// Prints a green O
+// ===================================================================================================
 
-			else
-			{
-				// Determine and output the appropriate output
-				switch (cellState)
-				{
-				case WALL: cout << "| " << "\033[1;31mX\033[0m" << " "; break;	// Prints a red X
-				case OPEN: cout << "|   "; break;	// Prints a blank cell
-				case VISITED: cout << "| " << "\033[1;32m0\033[0m" << " "; break;	// Prints a green 0
-				default: break;	// Do nothing
-				};
-			}
 
-		}
 
-		cout << "|\n";		// Tac on the last border and go to the next line
+// O(1)
+// Purpose: Check the paths asked for by number make sense
+// Pre: The options read in, with --first already stopping the search at its first path
+// Post: false is returned, after printing why, if the last path is before the first, paths are
+//		 looked up without a number, or --first is asked for other than the first path
+bool CheckPathOptions(/*IN*/const OptionsRec& opts)		// The options read in
+{
+	if (opts.lastPath != ZERO && opts.lastPath < opts.firstPath)
+		return RefuseOption("--to cannot be before --path");
+	if (!opts.lookupBase.empty() && opts.firstPath == ZERO)
+		return RefuseOption("--lookup needs --path");
+	if (opts.first && (opts.firstPath != ZERO || opts.lastPath != OFFSET))
+		return RefuseOption("--first cannot be used with --path, or with --to other than 1");
 
+	return true;
 
-	}// end row for loop
+}// end CheckPathOptions
 
-	// Print the bottom table border
-	for (int j = ZERO; j < colSize; j++)
-	{
-		cout << "+---";	// This will print the appropriate amount of cells
-	}
+
+
+// ===================================================================================================
+
+
+
+// O(1)
+// Purpose: Check the options fit an estimate
+// Pre: The options read in
+// Post: false is returned, after printing why, if an estimate is given an option it cannot be run with
+bool CheckEstimateOptions(/*IN*/const OptionsRec& opts)		// The options read in
+{
+	return !IsGiven(opts, OPTION_ESTIMATE) || RefuseOptions(opts, "--estimate", ESTIMATE_REFUSED);
+
+}// end CheckEstimateOptions
+
+
+
+// ===================================================================================================
+
+
+
+// O(1)
+// Purpose: Check the options fit a search for the cheapest paths
+// Pre: The options read in
+// Post: false is returned, after printing why, if --cheapest is given an option it cannot be run with
+bool CheckCheapestOptions(/*IN*/const OptionsRec& opts)		// The options read in
+{
+	return !opts.cheapest || RefuseOptions(opts, "--cheapest", CHEAPEST_REFUSED);
+
+}// end CheckCheapestOptions
+
+
+
+// ===================================================================================================
+
+
+
+// O(1)
+// Purpose: Check the options fit a search for a shortest path
+// Pre: The options read in
+// Post: false is returned, after printing why, if --shortest is given an option it cannot be run with
+bool CheckShortestOptions(/*IN*/const OptionsRec& opts)		// The options read in
+{
+	return !opts.shortest || RefuseOptions(opts, "--shortest", SHORTEST_REFUSED);
+
+}// end CheckShortestOptions
+
+
+
+// ===================================================================================================
+
+
+
+// O(1)
+// Purpose: Check the options fit a run of edits
+// Pre: The options read in
+// Post: false is returned, after printing why, if --edits is given an option it cannot be run with
+bool CheckEditsOptions(/*IN*/const OptionsRec& opts)		// The options read in
+{
+	return !IsGiven(opts, OPTION_EDITS) || RefuseOptions(opts, "--edits", EDITS_REFUSED);
+
+}// end CheckEditsOptions
+
+
+
+// ===================================================================================================
+
+
+
+// O(1)
+// Purpose: Check the options fit a server
+// Pre: The options read in
+// Post: false is returned, after printing why, if --serve is given an input file or an option
+//		 it cannot be run with
+bool CheckServeOptions(/*IN*/const OptionsRec& opts)		// The options read in
+{
+	return !opts.serve || RefuseOptions(opts, "--serve", SERVE_REFUSED);
+
+}// end CheckServeOptions
+
+
+
+// ===================================================================================================
+
+
+
+// O(1)
+// Purpose: Check the options fit a cached run
+// Pre: The options read in
+// Post: false is returned, after printing why, if --cache is given an option it cannot be run with
+bool CheckCacheOptions(/*IN*/const OptionsRec& opts)		// The options read in
+{
+	return opts.cacheDir.empty() || RefuseOptions(opts, "--cache", CACHE_REFUSED);
+
+}// end CheckCacheOptions
+
+
+
+// ===================================================================================================
+
+
+
+// O(1)
+// Purpose: Check the options fit a neighbour order other than N, E, S, W
+// Pre: The options read in
+// Post: false is returned, after printing why, if --order manhattan or distance is given an
+//		 option it cannot be run with
+bool CheckOrderOptions(/*IN*/const OptionsRec& opts)		// The options read in
+{
+	return !IsGiven(opts, OPTION_ORDER) || RefuseOptions(opts, "--order", ORDER_REFUSED);
+
+}// end CheckOrderOptions
+
+
+
+// ===================================================================================================
+
+
+
+// O(1)
+// Purpose: Check the options fit the meet engine
+// Pre: The options read in
+// Post: false is returned, after printing why, if --engine meet is given without --no-paths,
+//		 or with an option it cannot be run with
+bool CheckMeetOptions(/*IN*/const OptionsRec& opts)		// The options read in
+{
+	if (opts.engine != ENGINE_MEET)
+		return true;
+
+	// The meet engine only counts the paths
+	if (!opts.noPaths)
+		return RefuseOption("--engine meet needs --no-paths");
+
+	return RefuseOptions(opts, "--engine meet", MEET_REFUSED);
+
+}// end CheckMeetOptions
+
+
+
+
+// ===================================================================================================
+
+
+
+// O(N)
+// Purpose: Validate a file name
+//			(make sure it contains onl letters and a period and 3 letters after the period)
+// Pre: The file name
+// Post: Returns true if the file name is valid,
+//		 otherwise false
+bool ValidateFileName(/*IN*/const string& fileName)	// The file name being validated
+{
+	bool periodFound = false;	// Keeps track of if a period is found or not
+	int pos = ZERO;				// Keeps track of the position in the string
+	int extenAmt = ZERO;		// Keeps track of the number of extension characters
+
+
+	// Check if the first character is a period
+	if (fileName[pos] == '.')
+		return false;	// Return false because a letter is needed before the period
+
+
+	// Repeat until the end of the string or until a period is found
+	while(pos < fileName.length() && !periodFound)
+	{
+		// See if the character is the period
+		if (fileName[pos] == '.')
+			periodFound = true;
+
+
+		// Check if the character is not a letter
+		else if (fileName[pos] < 'A' || fileName[pos] > 'z')
+			return false;	// Return false if not a letter
+
+
+		// Increment position
+		pos++;
+	}
+
+	// If the period is found check for the last three characters
+	if (periodFound)
+	{
+		// Check to see if there are only three letter characters remaining
+		while (extenAmt < CHAR_AFTER_PERIOD && pos < fileName.length())
+		{
+			// Check if the character is not a letter
+			if (fileName[pos] < 'A' || fileName[pos] > 'z')
+				return false;	// Return false if not a letter
+
+			// Increment pos
+			pos++;
+
+			// Increment extenAmt
+			extenAmt++;
+		}
+
+		// Check if pos is equal to the length of the fileName
+		// and that there were only three characters after the period
+		if (pos == fileName.length() && extenAmt == CHAR_AFTER_PERIOD)
+			return true;	// It is a valid file name
+
+	}
+
+	return false;	// Somewhere along the way the fileName was not valid
+
+
+}// end ValidateFileName
+
+
+
+// ===================================================================================================
+
+
+
+// O(N)
+// Purpose: Read in wall coordinates, the entrance, the exits and the cell costs from an input file
+//			and set the walls up in a gameboard object
+// Pre: The board the walls are being set up in, and the input file with the walls coordinates
+// Post: The walls and costs are placed in the appropriate gameboard coordinates,
+//		 any invalid or out of range coordinates or costs will be ignored.
+//		 layout holds the entrance and exits given, START_POS and the bottom right corner
+//		 with EXIT_DIR if none were. false is returned if the entrance or an exit is off the board,
+//		 an exit direction is not N, E, S or W, or two exits are on the same cell
+bool ReadWalls(/*IN/OUT*/GameBoard& board,			// The gameboard whose walls are being set up
+			   /*IN/OUT*/ifstream& fin,				// The input file containing the walls coordinates
+			   /*OUT*/LayoutRec& layout)			// The entrance and exits read in
+{
+	Location2DRec wallCoord;	// Temporary storage for the wall coordinate
+	ExitRec exitItem;			// Temporary storage for an exit
+	Location2DRec costCoord;	// Temporary storage for a cell whose cost is given
+	int cost;					// Temporary storage for the cell's cost
+	string token;				// The first word of an entry
+	bool isValid = true;		// Holds if the entrance and exits read in so far are valid
+	int rows;					// Number of rows in the gameboard
+	int cols;					// Number of columns in the gameboard
+
+	// Start with the default entrance and no exits
+	board.GetSize(rows, cols);
+	layout.start = START_POS;
+	layout.exits.clear();
+
+
+	// While entries are still within the file
+	while (fin >> token)
+	{
+		// The entrance, it must be on the board
+		if (token == START_TAG)
+		{
+			fin >> layout.start.x;
+			fin >> layout.start.y;
+			isValid = isValid && fin && board.GetStatus(layout.start) != OUT_OF_BOUNDS;
+		}
+
+		// An exit, it must be on the board, leave it in a compass direction and not share a cell
+		else if (token == EXIT_TAG)
+		{
+			fin >> exitItem.loc.x;
+			fin >> exitItem.loc.y;
+			fin >> exitItem.dir;
+			isValid = isValid && fin && board.GetStatus(exitItem.loc) != OUT_OF_BOUNDS &&
+					  (exitItem.dir == "N" || exitItem.dir == "E" || exitItem.dir == "S" || exitItem.dir == "W");
+
+			for (size_t i = ZERO; i < layout.exits.size(); i++)
+				if (layout.exits[i].loc.x == exitItem.loc.x && layout.exits[i].loc.y == exitItem.loc.y)
+					isValid = false;
+
+			layout.exits.push_back(exitItem);
+		}
+
+		// A cell's cost, the board ignores a cell that is off it or a cost that is out of range
+		else if (token == COST_TAG)
+		{
+			if (!(fin >> costCoord.x >> costCoord.y >> cost))
+				break;
+
+			board.SetCost(costCoord, cost);
+		}
+
+		// Otherwise it is a wall coordinate, stop at anything that is not a number
+		else
+		{
+			if (!(istringstream(token) >> wallCoord.x) || !(fin >> wallCoord.y))
+				break;
+
+			// Put the wall in the game board
+			board.SetStatus(wallCoord, WALL);
+		}
+
+	}// end while
+
+	// Without any exits given the exit is the bottom right corner
+	if (layout.exits.empty())
+	{
+		exitItem.loc.x = rows - OFFSET;
+		exitItem.loc.y = cols - OFFSET;
+		exitItem.dir = EXIT_DIR;
+		layout.exits.push_back(exitItem);
+	}
+
+	return isValid;
+
+}// end ReadWalls
+
+
+
+// ===================================================================================================
+
+
+
+// O(N^2)
+// Purpose: Print the current path mapped out on the game board
+//			Specifying the head position.
+// Pre: The game board, the paths head, and its row and column size are needed
+// Post: The gameboard will be printed to the console in a table format with green
+//		 0's indicating the path, red X's indicating the walls, and a 
+//		 green O indicating the head. A board of more than PRINT_CELLS_MAX cells
+//		 is only named by its size
+void PrintCurrentPath(/*IN*/const GameBoard& board,			// The gameboard whose path is being printed
+					  /*IN*/const Location2DRec& headLoc,	// The location of the head of the path
+					  /*IN*/const int& rowSize,				// The boards number of rows
+					  /*IN*/const int& colSize)				// The boards number of columns
+{
+	StateEnum cellState;	// The current cell's status
+	Location2DRec currLoc;	// The current cell's location
+
+	// A board too big to read on the console is not printed
+	if ((long long)rowSize * colSize > PRINT_CELLS_MAX)
+	{
+		cout << "The " << rowSize << " by " << colSize << " board is too big to print, it has over "
+			 << PRINT_CELLS_MAX << " cells.\n";
+		return;
+	}
+
+
+	// Prints the board 
+	for (int i = ZERO; i < rowSize; i++)
+	{
+		// Get the current row
+		currLoc.x = i;
+
+		// Print the table border
+		for (int j = ZERO; j < colSize; j++)
+		{
+			cout << "+---";	// This will print the appropriate amount of cells
+		}
+		cout << "+\n";		// Tac on the last corner and go to the next line
+
+		// Print the contents of the cells
+		for (int j = ZERO; j < colSize; j++)
+		{
+			// Get the current column
+			currLoc.y = j;
+
+			// Get the status of the cell
+			cellState = board.GetStatus(currLoc);
+
+			// Check if the location is the head
+			if(currLoc.x == headLoc.x && currLoc.y == headLoc.y)
+				cout << "| " << "\033[1;32mO\033[0m" << " ";	// Prints a green O
+
+			else
+			{
+				// Determine and output the appropriate output
+				switch (cellState)
+				{
+				case WALL: cout << "| " << "\033[1;31mX\033[0m" << " "; break;	// Prints a red X
+				case OPEN: cout << "|   "; break;	// Prints a blank cell
+				case VISITED: cout << "| " << "\033[1;32m0\033[0m" << " "; break;	// Prints a green 0
+				default: break;	// Do nothing
+				};
+			}
+
+		}
+
+		cout << "|\n";		// Tac on the last border and go to the next line
+
+
+	}// end row for loop
+
+	// Print the bottom table border
+	for (int j = ZERO; j < colSize; j++)
+	{
+		cout << "+---";	// This will print the appropriate amount of cells
+	}
 	cout << "+\n";		// Tac on the last corner and go to the next line
 
 }// end PrintCurrentPath
@@ -563,45 +1832,378 @@ void PrintCurrentPath(/*IN*/const GameBoard& board,			// The gameboard whose pat
 
 
 
-// O(N)
-// Purpose: To obtain the directions travelled in a path from start to finish 
-//			and store them in a string
-// Pre: The stack containing the path
-// Post: The directions travelled in the path will be returned in a string 
-//		 in the form of direction-direction (S - E - N - E - S)
-string PathDirections(/*IN*/ StackClass path)		// The stack containing the path
+// O(N^2 * E) for a trace of E events
+// Purpose: Replay a traced search on the console
+// Pre: The options naming the trace file, the replay speed, the path to skip ahead to and the image file
+// Post: The traced search is drawn a step at a time with PrintCurrentPath, from the path sought
+//		 if one was given, until the trace ends. With a speed of zero only the path sought, or the
+//		 end of the trace, is drawn. The last frame is saved as an image if an image file was given.
+//		 The program is aborted if the file is not a trace
+void ReplayTrace(/*IN*/const OptionsRec& opts)	// The options naming the trace and how to replay it
 {
-	string strPath = "";	// The series of directions to travel to exit the board
+	TraceReader reader;				// The trace file reader
+	TraceEventEnum event;			// The event being replayed
+	DirectionEnum dir = NA;			// The direction of a push
+	vector<Location2DRec> pathArr;	// The cells of the path, the head last
+	Location2DRec loc;				// The cell being read
+	int rows;						// Number of rows in the gameboard
+	int cols;						// Number of columns in the gameboard
+	long long pathCt;				// The number of paths found so far
+	bool seeking;					// Holds if the replay is still skipping ahead
+	bool stopped = false;			// Holds if the replay stopped on the path sought
+	chrono::steady_clock::time_point nextFrame = chrono::steady_clock::now();	// When the next step is drawn
+
+	// Open the trace, abort if it is not one
+	if (!reader.Open(opts.replayFile))
+	{
+		cout << "Error - Invalid Trace File!!!" << endl;	// Displays a terminating error message
 
-	// Repeat until the path is empty
-	while (!path.IsEmpty())
+		abort();	// Abort the program
+	}
+
+	// Rebuild the traced board
+	reader.GetSize(rows, cols);
+	GameBoard gb(rows, cols);
+	for (loc.x = ZERO; loc.x < rows; loc.x++)
+		for (loc.y = ZERO; loc.y < cols; loc.y++)
+			if (reader.IsWall(loc))
+				gb.SetStatus(loc, WALL);
+
+	// The path starts at the entrance, skip ahead only to a path the trace has not already passed
+	pathArr.push_back(reader.GetStart());
+	pathCt = reader.GetFirstPathCt();
+	seeking = opts.seekPath > pathCt;
+
+	// Replay the events until the trace ends or the replay stops on the path sought
+	event = reader.Next(dir);
+	while (event != TRACE_END && !stopped)
 	{
-		// Add the direction travelled to the string path
-		switch (path.Retrieve().dir)
+		switch (event)
 		{
-		case NORTH: strPath = "N-" + strPath;	break;
-		case SOUTH: strPath = "S-" + strPath;	break;
-		case EAST: strPath = "E-" + strPath;	break;
-		case WEST: strPath = "W-" + strPath;	break;
+		case TRACE_PUSH:	// Move out of the head into the next cell
+			gb.SetStatus(pathArr.back(), VISITED);
+			pathArr.push_back(Move(dir, pathArr.back()));
+			break;
+		case TRACE_POP:		// Move back, the head is open again until it is moved out of
+			if (pathArr.size() > OFFSET)
+			{
+				pathArr.pop_back();
+				gb.SetStatus(pathArr.back(), OPEN);
+			}
+			break;
+		case TRACE_FOUND:	// The path to the head was numbered
+			pathCt++;
+			if (seeking && pathCt == opts.seekPath)
+			{
+				seeking = false;
+				stopped = (opts.replaySpeed == ZERO);
+			}
+			break;
 		default: break;
 		};
 
-		// Get rid of the current item
-		path.Pop();
+		// Draw the step at the replay speed once the path sought is reached
+		if (!seeking && opts.replaySpeed > ZERO)
+		{
+			this_thread::sleep_until(nextFrame);
+			nextFrame += chrono::nanoseconds(NANOS_PER_SEC / opts.replaySpeed);
+
+			system("cls");
+			PrintCurrentPath(gb, pathArr.back(), rows, cols);
+			cout << "\nPaths found: " << pathCt << endl;
+		}
+
+		event = reader.Next(dir);
+	}
+
+	// Draw where the replay finished
+	system("cls");
+	PrintCurrentPath(gb, pathArr.back(), rows, cols);
+	cout << "\nPaths found: " << pathCt << endl;
+	if (seeking)
+		cout << "The trace ends before path #" << opts.seekPath << "." << endl;
+
+	// Save it as an image if asked to
+	if (!opts.imageFile.empty() && !SaveBoardImage(opts.imageFile, gb, pathArr.back()))
+		cout << "Warning - Could not save the image to '" << opts.imageFile << "'" << endl;
+
+}// end ReplayTrace
+
+
+
+// O(log N + M) for an index of N entries and M paths printed
+// Purpose: Print paths from sharded output to the console
+// Pre: The options naming the shards and the first and last paths wanted
+// Post: The paths wanted are printed as they are in the shards, with a note if any were not found.
+//		 The program is aborted if the index is not one
+void LookupPaths(/*IN*/const OptionsRec& opts)	// The options naming the shards and the paths wanted
+{
+	ShardReader reader;			// The shard index reader
+	long long last;				// The number of the last path wanted
+	long long foundCt;			// The number of paths printed
+
+	// Load the index, abort if it is not one
+	if (!reader.Open(opts.lookupBase))
+	{
+		cout << "Error - Invalid Shard Index!!!" << endl;	// Displays a terminating error message
+
+		abort();	// Abort the program
+	}
+
+	// Print the paths wanted, a lone path if no last one was given
+	last = (opts.lastPath == ZERO) ? opts.firstPath : opts.lastPath;
+	foundCt = reader.ReadPaths(opts.firstPath, last, cout);
+
+	// Let the user know if the shards end before the paths asked for
+	if (foundCt < last - opts.firstPath + OFFSET)
+		cout << "Only " << foundCt << " of the " << last - opts.firstPath + OFFSET
+			 << " paths asked for were found." << endl;
+
+}// end LookupPaths
+
+
+
+// ===================================================================================================
+
+
+
+// O(2^N)
+// Purpose: Read in, search and print a layered maze
+// Pre: The options, the maze's size, the open input file past its size line and the open output file
+// Post: Every path, or with --shortest a shortest path, is printed to OUTPUT_FILE as for a flat board,
+//		 both files are closed and each floor of the maze is printed to the console. The program is
+//		 aborted if the size, the entrance or an exit is not valid, or an option the layered search
+//		 does not have was given
+void SearchLayered(/*IN*/const OptionsRec& opts,		// The options the search runs with
+				   /*IN*/const int sizes[],				// The rows, columns and floors of the maze
+				   /*IN/OUT*/ifstream& fin,				// The input file, past its size line
+				   /*IN/OUT*/ofstream& fout)			// The output file writer
+{
+	LayoutNDRec<LAYERED_DIMS> layout;	// The entrance and exits of the maze
+	LayoutRec flatLayout;		// The exits' directions, for the path writer
+	vector<int> distArr;		// Each cell's distance from the nearest exit
+	PathWriter writer;			// Prints the paths the search finds
+	string pathText;			// The directions of a shortest path, only walked with --shortest
+	int endCell;				// The exit cell a shortest path finishes on
+	size_t shortExit = ZERO;	// The exit a shortest path leaves by
+	long long pathCt = ZERO;	// The number of valid paths found
+	int startCell;				// The entrance's cell
+	bool openExit = false;		// Holds if any exit is not a wall
+	bool sameCell = true;		// Holds if the entrance is on the only exit
+
+	// Check if every size is valid, and that only the options the layered search has were given
+	for (int a = ZERO; a < LAYERED_DIMS; a++)
+		if (sizes[a] <= ZERO)
+		{
+			cout << "Error - Invalid Game Board Size!!!" << endl;	// Displays a terminating error message
+
+			// Close the input and output files
+			fin.close();
+			fout.close();
+
+			abort();	// Abort the program
+		}
+
+	if (!RefuseOptions(opts, "A layered maze", LAYERED_REFUSED))
+	{
+		cout << "Error - Option Not Supported On A Layered Maze!!!" << endl;	// Displays a terminating error message
+
+		// Close the input and output files
+		fin.close();
+		fout.close();
+
+		abort();	// Abort the program
+	}
+
+	// Instantiate a board of custom size
+	BoardND<LAYERED_DIMS> board(sizes);
+
+	// Read in and store the walls in the board, abort if the entrance or an exit is not valid
+	if (!ReadLayers(board, fin, layout))
+	{
+		cout << "Error - Invalid Entrance Or Exit!!!" << endl;	// Displays a terminating error message
+
+		// Close the input and output files
+		fin.close();
+		fout.close();
+
+		abort();	// Abort the program
+	}
+
+	// Close the input file
+	fin.close();
+
+	// Measure how far each cell is from its nearest exit, a cell that cannot reach one is never searched
+	MeasureDistancesND(board, layout, distArr);
+	startCell = board.GetCell(layout.start);
+	for (size_t i = ZERO; i < layout.exits.size(); i++)
+		openExit = openExit || board.GetStatus(layout.exits[i].loc) != WALL;
+	for (int a = ZERO; a < LAYERED_DIMS; a++)
+		sameCell = sameCell && layout.start.pos[a] == layout.exits[ZERO].loc.pos[a];
+
+	// Check if the starting position or every exit is blocked by a wall
+	if (board.GetCellStatus(startCell) == WALL || !openExit)
+		fout << "No possible paths found!" << endl;
+
+	// If the start and its only exit are on the same spot print the only path
+	else if (layout.exits.size() == OFFSET && sameCell)
+	{
+		// The only path is the single exit move, make sure it is within the length limits
+		if (WithinLenLimits(OFFSET, opts))
+			fout << "Path #1: " << layout.exits[ZERO].dir;	// Print the only path
+		else
+			fout << "No possible paths!" << endl;
+	}
+
+	// Check if an exit can be reached from the entrance at all, there is nothing to search if not
+	else if (distArr[startCell] == NO_DISTANCE)
+		fout << "No possible paths!" << endl;
+
+	// Find a shortest path to the nearest exit instead of every path if asked to
+	else if (opts.shortest)
+	{
+		GetShortestPathND(board, distArr, startCell, pathText, endCell);
+
+		// The path leaves by the first open exit on the cell it finishes on, its exit move is counted
+		FlattenLayout(layout, flatLayout);
+		while (board.GetCell(layout.exits[shortExit].loc) != endCell ||
+			   board.GetStatus(layout.exits[shortExit].loc) == WALL)
+			shortExit++;
+		fout << "Shortest path" << ExitLabel(flatLayout, (int)shortExit) << ":\t" << pathText
+			 << flatLayout.exits[shortExit].dir << "\tLength: " << distArr[startCell] + OFFSET << "\n\n";
+	}
+
+	// Find every possible path
+	else
+	{
+		// Print the paths to shards if asked to, abort if they cannot be created
+		if (!opts.shardBase.empty() && !writer.ShardTo(opts.shardBase, opts.shardMb * BYTES_PER_MB))
+		{
+			cout << "Error - Could Not Create The Shard Files!!!" << endl;	// Displays a terminating error message
+
+			// Close the output file
+			fout.close();
+
+			abort();	// Abort the program
+		}
+
+		// Search the maze, printing the paths on a thread of their own unless they are not printed at all
+		FlattenLayout(layout, flatLayout);
+		writer.Start(fout, flatLayout, !opts.syncWrite && !opts.noPaths);
+		FindPathsND(board, layout, opts, distArr, writer, pathCt);
+		writer.Stop();
+
+		// Check if no paths were found
+		if (pathCt == ZERO)
+			fout << "No possible paths!" << endl;	// Output to the file that no paths were found
+
+		// Only the count goes here if the paths were not printed or went to the shards
+		else if (opts.noPaths || !opts.shardBase.empty())
+			fout << "Paths found: " << pathCt << endl;
+	}
+
+	// Close the output file
+	fout.close();
+
+	// Clear the screen
+	system("cls");
+
+	// Print the empty maze
+	PrintLayers(board);
+
+	// Show how well the search and the writer kept up with each other
+	if (writer.IsThreaded())
+		cout << "\nPath writer stalls: the search waited " << writer.GetSearchStalls()
+			 << " times, the writer waited " << writer.GetWriterStalls() << " times." << endl;
+
+}// end SearchLayered
+
+
+
+// ===================================================================================================
+
+
+
+// O(N)
+// Purpose: Read in wall coordinates, the entrance and the exits of a layered maze
+// Pre: The board, the open input file past its size line, and the layout being filled
+// Post: The walls are set in the board and the layout holds the entrance and exits.
+//		 false is returned if the entrance or an exit is off the board, an exit's direction
+//		 is not one of the board's, or two exits share a cell
+bool ReadLayers(/*IN/OUT*/BoardND<LAYERED_DIMS>& board,			// The board whose walls are being set up
+				/*IN/OUT*/ifstream& fin,						// The input file containing the walls coordinates
+				/*OUT*/LayoutNDRec<LAYERED_DIMS>& layout)		// The entrance and exits read in
+{
+	LocationNDRec<LAYERED_DIMS> wallCoord;	// Temporary storage for the wall coordinate
+	ExitNDRec<LAYERED_DIMS> exitItem;		// Temporary storage for an exit
+	string token;					// The first word of an entry
+	bool isValid = true;			// Holds if the entrance and exits read in so far are valid
+	bool sameCell;					// Holds if two exits are on the same cell
+	int sizes[LAYERED_DIMS];		// The rows, columns and floors of the maze
+
+	// Start with the default entrance and no exits
+	board.GetSize(sizes);
+	for (int a = ZERO; a < LAYERED_DIMS; a++)
+		layout.start.pos[a] = ZERO;
+	layout.exits.clear();
+
+
+	// While entries are still within the file
+	while (fin >> token)
+	{
+		// The entrance, it must be on the board
+		if (token == START_TAG)
+		{
+			for (int a = ZERO; a < LAYERED_DIMS; a++)
+				fin >> layout.start.pos[a];
+			isValid = isValid && fin && board.GetStatus(layout.start) != OUT_OF_BOUNDS;
+		}
+
+		// An exit, it must be on the board, leave it in one of the board's directions and not share a cell
+		else if (token == EXIT_TAG)
+		{
+			for (int a = ZERO; a < LAYERED_DIMS; a++)
+				fin >> exitItem.loc.pos[a];
+			fin >> exitItem.dir;
+			isValid = isValid && fin && board.GetStatus(exitItem.loc) != OUT_OF_BOUNDS &&
+					  DirFromText(exitItem.dir, LAYERED_DIMS) != NO_DIR;
+
+			for (size_t i = ZERO; i < layout.exits.size(); i++)
+			{
+				sameCell = true;
+				for (int a = ZERO; a < LAYERED_DIMS; a++)
+					sameCell = sameCell && layout.exits[i].loc.pos[a] == exitItem.loc.pos[a];
+				isValid = isValid && !sameCell;
+			}
+
+			layout.exits.push_back(exitItem);
+		}
+
+		// Otherwise it is a wall coordinate, stop at anything that is not a number
+		else
+		{
+			if (!(istringstream(token) >> wallCoord.pos[ZERO]) || !(fin >> wallCoord.pos[OFFSET]) ||
+				!(fin >> wallCoord.pos[LAYERED_DIMS - OFFSET]))
+				break;
 
+			// Put the wall in the board
+			board.SetStatus(wallCoord, WALL);
+		}
 
 	}// end while
 
-	// Erase the extra "- " in the back
-	strPath.erase(strPath.length() - OFFSET);
-	
-	// Erase the extra " " at the front
-	//strPath.erase(ZERO,OFFSET);
+	// Without any exits given the exit is the bottom right corner of the top floor
+	if (layout.exits.empty())
+	{
+		for (int a = ZERO; a < LAYERED_DIMS; a++)
+			exitItem.loc.pos[a] = sizes[a] - OFFSET;
+		exitItem.dir = EXIT_DIR;
+		layout.exits.push_back(exitItem);
+	}
 
-	// Return the string path
-	return strPath;
+	return isValid;
 
-}// end PrintPathDirections
+}// end ReadLayers
 
 
 
@@ -609,24 +2211,289 @@ string PathDirections(/*IN*/ StackClass path)		// The stack containing the path
 
 
 
-// O(1)
-// Purpose: Get the next direction based off a direction sent in (Order: NA -> N -> E -> S -> W -> NA)
-// Pre: The current direction
-// Post: The next direction will be returned
-DirectionEnum NextDir(/*IN*/const DirectionEnum& dir)		// The current direction
+// O(N)
+// Purpose: Print each floor of a layered maze
+// Pre: The board with its walls set
+// Post: Each floor, floor 0 first, is printed to the console under its number in a table format
+//		 with red X's indicating the walls. A maze of more than PRINT_CELLS_MAX cells is only named
+//		 by its size
+void PrintLayers(/*IN*/const BoardND<LAYERED_DIMS>& board)		// The board being printed
 {
-	// Return the appropriate direction
-	switch (dir)
-	{
-	case NA: return NORTH;
-	case NORTH: return EAST;
-	case EAST: return SOUTH;
-	case SOUTH: return WEST;
-	case WEST: return NA;
-	default: return NA;
-	};
+	LocationNDRec<LAYERED_DIMS> currLoc;	// The current cell's location
+	int sizes[LAYERED_DIMS];				// The rows, columns and floors of the maze
+
+	board.GetSize(sizes);
+
+	// A maze too big to read on the console is not printed
+	if (board.GetCellCount() > PRINT_CELLS_MAX)
+	{
+		cout << "The " << sizes[ZERO] << " by " << sizes[OFFSET] << " by " << sizes[LAYERED_DIMS - OFFSET]
+			 << " maze is too big to print, it has over " << PRINT_CELLS_MAX << " cells.\n";
+		return;
+	}
+
+	// Print each floor as its own board
+	for (currLoc.pos[LAYERED_DIMS - OFFSET] = ZERO; currLoc.pos[LAYERED_DIMS - OFFSET] < sizes[LAYERED_DIMS - OFFSET];
+		 currLoc.pos[LAYERED_DIMS - OFFSET]++)
+	{
+		cout << "Floor " << currLoc.pos[LAYERED_DIMS - OFFSET] << ":\n";
+
+		for (currLoc.pos[ZERO] = ZERO; currLoc.pos[ZERO] < sizes[ZERO]; currLoc.pos[ZERO]++)
+		{
+			// Print the table border
+			for (int j = ZERO; j < sizes[OFFSET]; j++)
+				cout << "+---";
+			cout << "+\n";
+
+			// Print the contents of the cells
+			for (currLoc.pos[OFFSET] = ZERO; currLoc.pos[OFFSET] < sizes[OFFSET]; currLoc.pos[OFFSET]++)
+			{
+				if (board.GetStatus(currLoc) == WALL)
+					cout << "| " << "\033[1;31mX\033[0m" << " ";	// Prints a red X
+				else
+					cout << "|   ";	// Prints a blank cell
+			}
+			cout << "|\n";
+		}
+
+		// Print the bottom table border
+		for (int j = ZERO; j < sizes[OFFSET]; j++)
+			cout << "+---";
+		cout << "+\n\n";
+	}
+
+}// end PrintLayers
+
+
+
+// ===================================================================================================
+
+
+
+// O(E * M log M) for E edits that each change M cells
+// Purpose: Edit the board a wall at a time and print a shortest path after each edit
+// Pre: The board with its walls set and its layout, and the options naming the edit file
+// Post: A shortest path before the edits and after each one is printed to the output file,
+//		 and the board is left with every edit made. The program aborts if the edit file
+//		 cannot be read or an edit is not valid
+void ApplyEdits(/*IN*/const OptionsRec& opts,			// The options naming the edit file
+				/*IN/OUT*/GameBoard& board,				// The board being edited
+				/*IN*/const LayoutRec& layout,			// The entrance and exits
+				/*IN/OUT*/ofstream& fout)				// The output file writer
+{
+	ifstream editIn;		// The edit file reader
+	DynamicMap dynMap;		// The distances, components and dead ends, kept up to date through each edit
+	Location2DRec loc;		// The cell being edited
+	string token;			// The first word of an edit
+	StateEnum newStatus;	// What the cell is being changed to
+	int editCt = ZERO;		// The number of edits made
+
+	// Open the edit file, abort if it cannot be read
+	editIn.open(opts.editsFile);
+	if (!editIn)
+	{
+		cout << "Error - Could Not Read The Edit File!!!" << endl;	// Displays a terminating error message
+
+		// Close the output file
+		fout.close();
+
+		abort();	// Abort the program
+	}
+
+	// Measure the board once before any edits
+	dynMap.Build(board, layout);
+	PrintEditState(fout, "Before edits", dynMap, layout);
+
+	// Make each edit and repair only what it changed
+	while (editIn >> token)
+	{
+		newStatus = (token == WALL_TAG) ? WALL : OPEN;
+		if ((token != WALL_TAG && token != OPEN_TAG) || !(editIn >> loc.x >> loc.y) ||
+			!dynMap.SetStatus(board, loc, newStatus))
+		{
+			cout << "Error - Invalid Edit!!!" << endl;	// Displays a terminating error message
+
+			// Close the edit and output files
+			editIn.close();
+			fout.close();
+
+			abort();	// Abort the program
+		}
+
+		editCt++;
+		PrintEditState(fout, "Edit #" + to_string(editCt) + " (" + token + " " + to_string(loc.x) + " " +
+							 to_string(loc.y) + ")", dynMap, layout);
+	}
+
+	// Close the edit file
+	editIn.close();
+
+}// end ApplyEdits
+
+
+
+// ===================================================================================================
+
+
+
+// O(N) for a path of N moves
+// Purpose: Print a shortest path and what is known about the board as it now is
+// Pre: The map of the board after the edits so far, and its layout
+// Post: A line labelled with the label is printed to the output file holding a shortest path
+//		 from the entrance and its length, or that there is none, along with the cells the entrance
+//		 can reach, the dead end cells, and the cells the last edit looked at
+void PrintEditState(/*IN/OUT*/ofstream& fout,			// The output file writer
+					/*IN*/const string& label,			// What the line is labelled with
+					/*IN*/const DynamicMap& dynMap,		// The map of the board as it now is
+					/*IN*/const LayoutRec& layout)		// The entrance and exits
+{
+	string pathText;	// The directions of the shortest path
+	int exit;			// The exit it finishes on
+
+	fout << label << ":\t";
+
+	// The path's length counts its exit move
+	if (dynMap.GetPath(layout.start, pathText, exit))
+		fout << pathText << layout.exits[exit].dir << "\tLength: " << dynMap.GetDistance(layout.start) + OFFSET;
+	else
+		fout << "No possible paths!";
+
+	fout << "\tReachable cells: " << dynMap.CountReachable(layout.start)
+		 << "\tDead end cells: " << dynMap.GetDeadEndCount()
+		 << "\tCells updated: " << dynMap.GetEditWork() << "\n\n";
+
+}// end PrintEditState
+
+
+
+// ===================================================================================================
+
+
+
+// O(N^2)
+// Purpose: Read in a maze file for the server
+// Pre: The name of the maze file
+// Post: board points to a new gameboard with the file's walls set, and layout holds its entrance
+//		 and exits. false is returned, with nothing made, if the file cannot be opened, its size is
+//		 not valid, it is a layered maze, or its entrance or an exit is not valid
+bool LoadBoard(/*IN*/const string& fileName,		// The maze file
+			   /*OUT*/GameBoard*& board,			// The board read in, made with new
+			   /*OUT*/LayoutRec& layout)			// The entrance and exits read in
+{
+	ifstream fin;			// The maze file reader
+	string sizeLine;		// The first line of the maze file
+	int rows = ZERO;		// Number of rows in the gameboard
+	int cols = ZERO;		// Number of columns in the gameboard
+	int floors;				// The number of floors, only given by a layered maze
+
+	board = NULL;
+
+	// Open the file and read in the size of the board, a layered maze is not served
+	fin.open(fileName);
+	if (!fin)
+		return false;
+
+	getline(fin, sizeLine);
+	istringstream sizeIn(sizeLine);
+	sizeIn >> rows;
+	sizeIn >> cols;
+	if (rows <= ZERO || cols <= ZERO || (sizeIn >> floors))
+		return false;
+
+	// Read in the walls, the entrance and the exits
+	board = NewBoard(rows, cols, ORDER_ROWS, false);
+	if (!ReadWalls(*board, fin, layout))
+	{
+		delete board;
+		board = NULL;
+		return false;
+	}
+
+	// A tiled board gives back the tiles its walls filled solid
+	board->Compact();
+
+	return true;
+
+}// end LoadBoard
+
+
+
+// ===================================================================================================
+
+
+
+// O(B) for B bytes read back
+// Purpose: Print the results read back from the cache
+// Pre: The parts of a cache entry, and the output file open
+// Post: OUTPUT_FILE holds the entry's output, and the statistics files its statistics if they were
+//		 asked for, byte for byte as they were saved. A statistics file that cannot be written
+//		 displays a warning
+void RestoreResults(/*IN*/const OptionsRec& opts,					// The options naming the statistics files
+					/*IN*/const vector<CachePartRec>& partArr,		// The files read back from the cache
+					/*IN/OUT*/ofstream& fout)						// The output file writer
+{
+	ofstream statsOut;		// A statistics file writer
+
+	// The output was saved as bytes, so it is printed back as bytes
+	fout.close();
+	fout.open(OUTPUT_FILE, ios::binary | ios::trunc);
+
+	for (size_t i = ZERO; i < partArr.size(); i++)
+	{
+		if (partArr[i].name == OUTPUT_FILE)
+			fout.write(partArr[i].content.data(), partArr[i].content.size());
+		else if (!opts.statsBase.empty())
+		{
+			statsOut.open(opts.statsBase + partArr[i].name, ios::binary | ios::trunc);
+			statsOut.write(partArr[i].content.data(), partArr[i].content.size());
+			statsOut.close();
+			if (!statsOut)
+				cout << "Warning - Could not save the statistics to '" << opts.statsBase << "'" << endl;
+			statsOut.clear();
+		}
+	}
+
+}// end RestoreResults
+
 
-}// end NextDir
+
+// ===================================================================================================
+
+
+
+// O(B) for B bytes saved
+// Purpose: Save the files a run printed to the cache
+// Pre: The cache is open, and OUTPUT_FILE and the statistics files, if they were asked for, are closed
+// Post: The files are saved under the key and true is returned, false is returned if a file
+//		 cannot be read or the cache cannot be saved to
+bool SaveResults(/*IN*/const OptionsRec& opts,		// The options naming the statistics files
+				 /*IN/OUT*/ResultCache& cache,		// The cache the results are saved to
+				 /*IN*/const string& cacheKey)		// What the run was asked
+{
+	const string statsExts[] = { STATS_LENGTHS_EXT, STATS_CELLS_EXT, STATS_HEATMAP_EXT };	// The statistics files' endings
+	const int STATS_FILE_CT = 3;	// The number of statistics files
+	vector<CachePartRec> partArr;	// The files being saved
+	CachePartRec part;				// The file being read
+
+	// The output file is saved under its own name
+	part.name = OUTPUT_FILE;
+	if (!ReadWholeFile(OUTPUT_FILE, part.content))
+		return false;
+	partArr.push_back(part);
+
+	// The statistics files are saved under their endings, so they can be read back under any name
+	if (!opts.statsBase.empty())
+		for (int i = ZERO; i < STATS_FILE_CT; i++)
+		{
+			part.name = statsExts[i];
+			if (!ReadWholeFile(opts.statsBase + statsExts[i], part.content))
+				return false;
+			partArr.push_back(part);
+		}
+
+	return cache.Store(cacheKey, partArr);
+
+}// end SaveResults
 
 
 
@@ -635,40 +2502,93 @@ DirectionEnum NextDir(/*IN*/const DirectionEnum& dir)		// The current direction
 
 
 // O(1)
-// Purpose: Increment a Location2DRec in a single direction
-// Pre: The desired direction and the Location2DRec being changed
-// Post: A Location2DRec will be returned with the new coordinate
-//		 If NA or another non compass direction is sent in, the new location will
-//		 be the same as the old location
-Location2DRec Move(/*IN*/const DirectionEnum& dir,		// The desired direction to move in
-				   /*IN*/const Location2DRec& currPos)	// The current location
+// Purpose: Check the board and the search fit the memory budget
+// Pre: The options with a budget above zero, and the size of the board
+// Post: needBytes holds the bytes the board (only its tile table if it is tiled, as its tiles are
+//		 not known until its walls are read), the path stack at its deepest (an item for every cell),
+//		 the maps the run builds (the connectivity map with one run a row), the graph engines' graphs
+//		 and the meet engine's cell arrays and walks (every cell open), the statistics and the
+//		 writer's ring would take, with the ring left out if the paths are printed on the search's
+//		 thread. If they only fit without the ring, the paths are printed on the search's thread and
+//		 leaner is true. true is returned if they fit
+bool FitMemoryBudget(/*IN/OUT*/OptionsRec& opts,		// The options the search runs with
+					 /*IN*/const int& rows,			// The number of rows
+					 /*IN*/const int& cols,			// The number of columns
+					 /*OUT*/long long& needBytes,		// The bytes the search would take
+					 /*OUT*/bool& leaner)				// Holds if the ring was given up to fit
 {
-	Location2DRec newPos = currPos;		// The updated location
-
-	// Increment newPos according to the specified direction
-	switch (dir)
-	{
-	case NORTH:
-		newPos.x--;
-		break;
-	case SOUTH:
-		newPos.x++;
-		break;
-	case EAST:
-		newPos.y++;
-		break;
-	case WEST:
-		newPos.y--;
-		break;
-	default:
-		break;
-	};
+	long long budgetBytes = opts.memMb * BYTES_PER_MB;		// The most the search may take
+	bool searched = opts.estimateProbes == ZERO && !opts.cheapest && !opts.shortest && opts.editsFile.empty();	// Holds if paths are searched for
+
+	leaner = false;
+
+	// Every board is made, tiled or in the layout asked for
+	if (UsesTiles(rows, cols))
+		needBytes = TiledBoard::TableBytes(rows, cols);
+	else if (opts.cellOrder == ORDER_ZORDER)
+		needBytes = ZOrderBoard::BoardBytes(rows, cols, opts.hugePages);
+	else
+		needBytes = GameBoard::BoardBytes(rows, cols);
+
+	// Only the board engine pushes its path onto the stack
+	if (searched && opts.engine == ENGINE_BOARD)
+		needBytes += (long long)rows * cols * StackClass::ItemBytes();
+
+	// Every board's components are labelled
+	needBytes += ConnectivityMap::MapBytes(rows, cols);
 
-	// Return the updated position
-	return newPos;
+	// The distances are measured for a maximum length, to try the closest neighbours first, or to walk
+	// a shortest path
+	if (((searched || opts.estimateProbes > ZERO) && (opts.maxLen > ZERO || opts.dirOrder == DIR_ORDER_DISTANCE)) ||
+		opts.shortest)
+		needBytes += DistanceMap::MapBytes(rows, cols);
 
-}// end Move
+	// Only the board engine's search orders the neighbours
+	if (searched && opts.dirOrder != DIR_ORDER_FIXED)
+		needBytes += DirOrder::OrderBytes(rows, cols);
 
+	// The cheapest paths are found on the cells' costs
+	if (opts.cheapest)
+		needBytes += CostMap::MapBytes(rows, cols);
+
+	// The edits are made to a map kept up to date through each of them
+	if (!opts.editsFile.empty())
+		needBytes += DynamicMap::MapBytes(rows, cols);
+
+	// The graph engines compile the board, and the corridor engine contracts the graph it compiled
+	if (searched && (opts.engine == ENGINE_GRAPH || opts.engine == ENGINE_CORRIDOR))
+		needBytes += MazeGraph::GraphBytes(rows, cols);
+	if (searched && opts.engine == ENGINE_CORRIDOR)
+		needBytes += CorridorGraph::CorridorBytes(rows, cols);
+
+	// The meet engine links the cells and walks the halves on every thread
+	if (searched && opts.engine == ENGINE_MEET)
+		needBytes += MeetCounter::CountBytes(rows, cols, opts.threads);
+
+	// The statistics count the paths through every cell and of every length
+	if (!opts.statsBase.empty())
+		needBytes += PathStats::StatsBytes(rows, cols);
+
+	// The ring is the one thing the search can do without, so give it up if it is what does not fit
+	if (searched && !opts.syncWrite && !opts.noPaths)
+	{
+		if (needBytes + PathWriter::RingBytes() <= budgetBytes)
+		{
+			needBytes += PathWriter::RingBytes();
+			return true;
+		}
+
+		opts.syncWrite = true;
+		leaner = needBytes <= budgetBytes;
+	}
+
+	return needBytes <= budgetBytes;
+
+}// end FitMemoryBudget
+
+
+
+// ===================================================================================================
 
 
 
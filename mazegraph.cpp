@@ -0,0 +1,315 @@
+// Project Maze
+// FileName : mazegraph.cpp
+// Author: Christian Siletti
+// Purpose : This file contains the implementation for all of the methods
+//			 defined in mazegraph.h
+
+#include "mazegraph.h"		// The header file
+#include "navigation.h"		// For stepping to a cell's neighbours
+#include "memaccount.h"		// For counting the node and edge arrays
+#include <new>				// Contains the bad_alloc exception
+
+
+
+// O(1) - Default Constructor
+// Pre: N/A
+// Post: A graph with no nodes is created
+MazeGraph::MazeGraph()
+{
+	maxRows = ZERO;	// Nothing has been built yet
+	maxCols = ZERO;
+	memBytes = ZERO;
+
+	// Every node count needs the end marker
+	edgeStartArr.push_back(ZERO);
+
+}// end DC
+
+
+
+
+// O(1) - Destructor
+// Pre: N/A
+// Post: The class object is destroyed
+MazeGraph::~MazeGraph()
+{
+	// The arrays free themselves, they are no longer counted
+	MemRelease(MEM_MAPS, memBytes);
+
+}// end Destructor
+
+
+
+
+// O(N^2) - Mutator
+// Pre: The board with its walls set
+// Post: Every cell that is not a WALL is a node, with an edge to each of its
+//		 open neighbours in N, E, S, W order
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+void MazeGraph::Build(/*IN*/const GameBoard& board)		// The board being compiled
+{
+	Location2DRec loc;		// The cell being numbered
+	Location2DRec newLoc;	// The neighbour being linked
+	int node;				// The node being linked
+	int target;				// The neighbour's node number
+	int nodeCt = ZERO;		// The number of open cells
+	int edgeCt = ZERO;		// The number of edges
+
+	// Get the size of the board
+	board.GetSize(maxRows, maxCols);
+
+	try
+	{
+		// Start over with no nodes
+		nodeIdArr.assign((size_t)maxRows * maxCols, NO_NODE);
+		nodeLocArr.clear();
+		edgeStartArr.clear();
+		edgeTargetArr.clear();
+		edgeDirArr.clear();
+		maskArr.clear();
+
+		// Number every open cell in row major order, counted first so the arrays are only the size they need
+		for (loc.x = ZERO; loc.x < maxRows; loc.x++)
+			for (loc.y = ZERO; loc.y < maxCols; loc.y++)
+				if (board.GetStatus(loc) != WALL)
+					nodeIdArr[(size_t)loc.x * maxCols + loc.y] = nodeCt++;
+		nodeLocArr.reserve(nodeCt);
+		edgeStartArr.reserve((size_t)nodeCt + OFFSET);
+		for (loc.x = ZERO; loc.x < maxRows; loc.x++)
+			for (loc.y = ZERO; loc.y < maxCols; loc.y++)
+				if (GetNodeId(loc) != NO_NODE)
+					nodeLocArr.push_back(loc);
+
+		// Find each node's open neighbours, and with them the number of edges
+		maskArr.assign(nodeCt, ZERO);
+		for (node = ZERO; node < nodeCt; node++)
+			for (DirectionEnum dir = NextDir(NA); dir != NA; dir = NextDir(dir))
+				if (GetNodeId(Move(dir, nodeLocArr[node])) != NO_NODE)
+				{
+					maskArr[node] |= (unsigned char)(OFFSET << (dir - OFFSET));
+					edgeCt++;
+				}
+
+		// Link each node to its open neighbours, in the order the search tries them
+		edgeTargetArr.reserve(edgeCt);
+		edgeDirArr.reserve(edgeCt);
+		for (node = ZERO; node < nodeCt; node++)
+		{
+			edgeStartArr.push_back((int)edgeTargetArr.size());
+
+			for (DirectionEnum dir = NextDir(NA); dir != NA; dir = NextDir(dir))
+				if (maskArr[node] & (OFFSET << (dir - OFFSET)))
+				{
+					newLoc = Move(dir, nodeLocArr[node]);
+					target = GetNodeId(newLoc);
+					edgeTargetArr.push_back(target);
+					edgeDirArr.push_back((unsigned char)dir);
+				}
+		}
+
+		// Mark the end of the last node's edges
+		edgeStartArr.push_back((int)edgeTargetArr.size());
+	}
+	catch (std::bad_alloc)	// The heap space memory has run out
+	{
+		// Throw the exception
+		throw GBOutOfMemoryException();
+	}
+
+	// Count the arrays in place of any built before
+	MemRelease(MEM_MAPS, memBytes);
+	memBytes = (long long)nodeIdArr.capacity() * sizeof(int) + (long long)nodeLocArr.capacity() * sizeof(Location2DRec) +
+			   (long long)edgeStartArr.capacity() * sizeof(int) + (long long)edgeTargetArr.capacity() * sizeof(int) +
+			   (long long)edgeDirArr.capacity() * sizeof(unsigned char) + (long long)maskArr.capacity() * sizeof(unsigned char);
+	MemAdd(MEM_MAPS, memBytes);
+
+}// end Build
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: N/A
+// Post: The number of nodes is returned
+int MazeGraph::GetNodeCount() const
+{
+	return (int)nodeLocArr.size();
+
+}// end GetNodeCount
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: The graph has been built
+// Post: The cell's node number is returned, or NO_NODE if it is a wall or off the board
+int MazeGraph::GetNodeId(/*IN*/const Location2DRec& loc) const		// The cell being looked up
+{
+	// Check if the cooridnate is within the bounds of the board
+	if (loc.x >= ZERO && loc.x < maxRows && loc.y >= ZERO && loc.y < maxCols)
+		return nodeIdArr[(size_t)loc.x * maxCols + loc.y];
+
+	return NO_NODE;
+
+}// end GetNodeId
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: 0 <= node < GetNodeCount()
+// Post: The node's location is returned
+Location2DRec MazeGraph::GetLocation(/*IN*/int node) const			// The node being looked up
+{
+	return nodeLocArr[node];
+
+}// end GetLocation
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: 0 <= node < GetNodeCount()
+// Post: The index of the node's first edge is returned
+int MazeGraph::GetEdgeBegin(/*IN*/int node) const		// The node whose edges are wanted
+{
+	return edgeStartArr[node];
+
+}// end GetEdgeBegin
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: 0 <= node < GetNodeCount()
+// Post: The index one past the node's last edge is returned
+int MazeGraph::GetEdgeEnd(/*IN*/int node) const		// The node whose edges are wanted
+{
+	return edgeStartArr[node + OFFSET];
+
+}// end GetEdgeEnd
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: The edge is within some node's edge range
+// Post: The edge's target node is returned
+int MazeGraph::GetEdgeTarget(/*IN*/int edge) const		// The edge being looked up
+{
+	return edgeTargetArr[edge];
+
+}// end GetEdgeTarget
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: The edge is within some node's edge range
+// Post: The edge's compass direction is returned
+DirectionEnum MazeGraph::GetEdgeDir(/*IN*/int edge) const		// The edge being looked up
+{
+	return (DirectionEnum)edgeDirArr[edge];
+
+}// end GetEdgeDir
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: The edge is within some node's edge range
+// Post: 1 is returned, every edge of a maze graph is a single move
+int MazeGraph::GetEdgeLength(/*IN*/int /*edge*/) const		// The edge being looked up
+{
+	return OFFSET;
+
+}// end GetEdgeLength
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: The edge is within some node's edge range
+// Post: The edge's direction text is returned, each move is a letter followed by a "-"
+const char* MazeGraph::GetEdgeText(/*IN*/int edge) const		// The edge being looked up
+{
+	return DirText(GetEdgeDir(edge));
+
+}// end GetEdgeText
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: The edge is within some node's edge range and 0 <= step < GetEdgeLength(edge)
+// Post: The direction of the move is returned
+DirectionEnum MazeGraph::GetEdgeStep(/*IN*/int edge,			// The edge being looked up
+									 /*IN*/int /*step*/) const		// The move wanted, 0 is the first
+{
+	return GetEdgeDir(edge);
+
+}// end GetEdgeStep
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: 0 <= node < GetNodeCount()
+// Post: A mask with bit (dir - 1) set for each open direction is returned
+int MazeGraph::GetNeighbourMask(/*IN*/int node) const		// The node being looked up
+{
+	return maskArr[node];
+
+}// end GetNeighbourMask
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: The graph has been built
+// Post: OUT_OF_BOUNDS is returned for cells off the board, WALL for cells with no node,
+//		 and OPEN otherwise
+StateEnum MazeGraph::GetStatus(/*IN*/const Location2DRec& loc) const	// The cell being looked up
+{
+	// Check if the cooridnate is within the bounds of the board
+	if (loc.x < ZERO || loc.x >= maxRows || loc.y < ZERO || loc.y >= maxCols)
+		return OUT_OF_BOUNDS;
+
+	// Cells without a node are walls
+	if (GetNodeId(loc) == NO_NODE)
+		return WALL;
+
+	return OPEN;
+
+}// end GetStatus
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: N/A
+// Post: The size of the board will be stored into the incoming rows and columns variables
+void MazeGraph::GetSize(/*OUT*/int& rows,				// The location to store the row size
+						/*OUT*/int& cols) const			// The location to store the column size
+{
+	rows = maxRows;
+	cols = maxCols;
+
+}// end GetSize
+
+
+
+
+// O(1)
+// Pre: The number of rows and columns
+// Post: The bytes of a graph with every cell open and four edges to every node are returned,
+//		 as counted in memaccount.h
+long long MazeGraph::GraphBytes(/*IN*/const int& rows,		// The number of rows
+								/*IN*/const int& cols)		// The number of columns
+{
+	long long cellCt = (long long)rows * cols;	// The number of cells in the board
+
+	return cellCt * (sizeof(int) + sizeof(Location2DRec) + sizeof(int) + sizeof(unsigned char) +
+					 (long long)NODE_EDGES_MAX * (sizeof(int) + sizeof(unsigned char))) + sizeof(int);
+
+}// end GraphBytes
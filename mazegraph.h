@@ -0,0 +1,254 @@
+#pragma once
+/*
+	FileName : mazegraph.h
+	Author: Christian Siletti
+	Date: 4/23/24
+	Project Maze
+
+	PURPOSE:
+		Contains the specifications for a MazeGraph Class. A maze graph is the open cells of a
+		gameboard compiled into a compact graph, so a search no longer has to find a cell's
+		neighbours with NextDir, Move and a bounds checked GetStatus on every step.
+
+		Every cell that is not a WALL is numbered in row major order. Each numbered cell (node)
+		keeps its open neighbours in one shared edge array (compressed sparse row layout), in
+		the same N, E, S, W order NextDir searches them in, along with a 4 bit mask of which
+		directions are open. The node numbers map back to their Location2DRec.
+
+		Every edge is a single move. The edge length, text and step accessors are shared with
+		CorridorGraph, whose edges can be many moves long, so one search runs on either graph.
+
+		A maze graph also offers GetSize and GetStatus, reporting WALL for cells with no node,
+		so it can be hashed and printed like a board.
+
+
+	ASSUMPTIONS:
+		1) The board passed to Build has its walls set, VISITED cells are treated as open
+		2) The graph does not change after it is built, edits to the board need a new Build
+
+
+	EXCEPTION HANDLING/ERROR CHECKING:
+		1) GetNodeId returns NO_NODE for walls and cells outside the board.
+		2) GBOutOfMemoryException thrown when memory from the heap has run out
+
+
+						   SUMMARY OF METHODS:
+	PUBLIC METHODS
+		MazeGraph() - Instantiate an empty graph
+		virtual ~MazeGraph() - Destroy the class object
+		void Build(*IN*const GameBoard& board)		// The board being compiled
+					- Number the open cells of a board and link each to its open neighbours
+		int GetNodeCount() const - Return the number of open cells
+		int GetNodeId(*IN*const Location2DRec& loc) const		// The cell being looked up
+					- Return the node number of a cell
+		Location2DRec GetLocation(*IN*int node) const			// The node being looked up
+					- Return the cell a node stands for
+		int GetEdgeBegin(*IN*int node) const		// The node whose edges are wanted
+		int GetEdgeEnd(*IN*int node) const			// The node whose edges are wanted
+					- Return the range of a node's edges in the edge array
+		int GetEdgeTarget(*IN*int edge) const		// The edge being looked up
+					- Return the node an edge leads to
+		DirectionEnum GetEdgeDir(*IN*int edge) const	// The edge being looked up
+					- Return the direction an edge is travelled in
+		int GetEdgeLength(*IN*int edge) const		// The edge being looked up
+					- Return the number of moves an edge makes, always 1
+		const char* GetEdgeText(*IN*int edge) const	// The edge being looked up
+					- Return the printed directions of an edge's moves
+		DirectionEnum GetEdgeStep(*IN*int edge,			// The edge being looked up
+								  *IN*int step) const	// The move wanted, 0 is the first
+					- Return the direction of one of an edge's moves
+		int GetNeighbourMask(*IN*int node) const		// The node being looked up
+					- Return which of a node's four directions are open
+		StateEnum GetStatus(*IN*const Location2DRec& loc) const	// The cell being looked up
+					- Return WALL, OPEN or OUT_OF_BOUNDS for a cell
+		void GetSize(*OUT*int& rows,		// The location to store the row size
+					 *OUT*int& cols) const	// The location to store the column size
+					- Return the size of the board the graph was built from
+		static long long GraphBytes(*IN*const int& rows,		// The number of rows
+									*IN*const int& cols)		// The number of columns
+					- Return the most bytes a graph of a board's size takes from the heap
+
+
+	PRIVATE MEMBERS:
+		int maxRows;						// The number of rows in the board
+		int maxCols;						// The number of columns in the board
+		vector<int> nodeIdArr;				// Each cell's node number in row major order, or NO_NODE
+		vector<Location2DRec> nodeLocArr;	// Each node's cell
+		vector<int> edgeStartArr;			// Where each node's edges start, with one extra end marker
+		vector<int> edgeTargetArr;			// The node each edge leads to
+		vector<unsigned char> edgeDirArr;	// The direction each edge is travelled in
+		vector<unsigned char> maskArr;		// Each node's open directions, bit (dir - 1) per direction
+		long long memBytes;					// The bytes of the arrays counted in memaccount.h
+*/
+
+#include "gameboard.h"		// Allows access to the gameboard ADT
+#include <vector>			// For the node and edge arrays
+
+using namespace std;    // Standard namespace
+
+
+const int NO_NODE = -1;		// The node number of a cell that is not open
+const int NODE_EDGES_MAX = 4;	// The most edges a node can have, one a direction
+
+
+
+class MazeGraph
+{
+public:
+
+	// O(1) - Default Constructor
+	// Purpose: Instantiate an empty graph
+	// Pre: N/A
+	// Post: A graph with no nodes is created
+	MazeGraph();
+
+
+
+	// O(1) - Destructor
+	// Purpose: Destroy the class object
+	// Pre: N/A
+	// Post: The class object is destroyed
+	virtual ~MazeGraph();
+
+
+
+	// O(N^2) - Mutator
+	// Purpose: Number the open cells of a board and link each to its open neighbours
+	// Pre: The board with its walls set
+	// Post: Every cell that is not a WALL is a node, with an edge to each of its
+	//		 open neighbours in N, E, S, W order
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	void Build(/*IN*/const GameBoard& board);		// The board being compiled
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return the number of open cells
+	// Pre: N/A
+	// Post: The number of nodes is returned
+	int GetNodeCount() const;
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return the node number of a cell
+	// Pre: The graph has been built
+	// Post: The cell's node number is returned, or NO_NODE if it is a wall or off the board
+	int GetNodeId(/*IN*/const Location2DRec& loc) const;		// The cell being looked up
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return the cell a node stands for
+	// Pre: 0 <= node < GetNodeCount()
+	// Post: The node's location is returned
+	Location2DRec GetLocation(/*IN*/int node) const;			// The node being looked up
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return where a node's edges start in the edge array
+	// Pre: 0 <= node < GetNodeCount()
+	// Post: The index of the node's first edge is returned
+	int GetEdgeBegin(/*IN*/int node) const;		// The node whose edges are wanted
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return where a node's edges end in the edge array
+	// Pre: 0 <= node < GetNodeCount()
+	// Post: The index one past the node's last edge is returned
+	int GetEdgeEnd(/*IN*/int node) const;		// The node whose edges are wanted
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return the node an edge leads to
+	// Pre: The edge is within some node's edge range
+	// Post: The edge's target node is returned
+	int GetEdgeTarget(/*IN*/int edge) const;	// The edge being looked up
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return the direction an edge is travelled in
+	// Pre: The edge is within some node's edge range
+	// Post: The edge's compass direction is returned
+	DirectionEnum GetEdgeDir(/*IN*/int edge) const;		// The edge being looked up
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return the number of moves an edge makes
+	// Pre: The edge is within some node's edge range
+	// Post: 1 is returned, every edge of a maze graph is a single move
+	int GetEdgeLength(/*IN*/int edge) const;	// The edge being looked up
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return the printed directions of an edge's moves
+	// Pre: The edge is within some node's edge range
+	// Post: The edge's direction text is returned, each move is a letter followed by a "-"
+	const char* GetEdgeText(/*IN*/int edge) const;		// The edge being looked up
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return the direction of one of an edge's moves
+	// Pre: The edge is within some node's edge range and 0 <= step < GetEdgeLength(edge)
+	// Post: The direction of the move is returned
+	DirectionEnum GetEdgeStep(/*IN*/int edge,			// The edge being looked up
+							  /*IN*/int step) const;	// The move wanted, 0 is the first
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return which of a node's four directions are open
+	// Pre: 0 <= node < GetNodeCount()
+	// Post: A mask with bit (dir - 1) set for each open direction is returned
+	int GetNeighbourMask(/*IN*/int node) const;		// The node being looked up
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return WALL, OPEN or OUT_OF_BOUNDS for a cell
+	// Pre: The graph has been built
+	// Post: OUT_OF_BOUNDS is returned for cells off the board, WALL for cells with no node,
+	//		 and OPEN otherwise
+	StateEnum GetStatus(/*IN*/const Location2DRec& loc) const;	// The cell being looked up
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return the size of the board the graph was built from
+	// Pre: N/A
+	// Post: The size of the board will be stored into the incoming rows and columns variables
+	void GetSize(/*OUT*/int& rows,				// The location to store the row size
+				 /*OUT*/int& cols) const;		// The location to store the column size
+
+
+
+	// O(1)
+	// Purpose: Return the most bytes a graph of a board's size takes from the heap
+	// Pre: The number of rows and columns
+	// Post: The bytes of a graph with every cell open and four edges to every node are returned,
+	//		 as counted in memaccount.h
+	static long long GraphBytes(/*IN*/const int& rows,		// The number of rows
+								/*IN*/const int& cols);		// The number of columns
+
+
+
+private:
+	int maxRows;						// The number of rows in the board
+	int maxCols;						// The number of columns in the board
+
+	vector<int> nodeIdArr;				// Each cell's node number in row major order, or NO_NODE
+	vector<Location2DRec> nodeLocArr;	// Each node's cell
+	vector<int> edgeStartArr;			// Where each node's edges start, with one extra end marker
+	vector<int> edgeTargetArr;			// The node each edge leads to
+	vector<unsigned char> edgeDirArr;	// The direction each edge is travelled in
+	vector<unsigned char> maskArr;		// Each node's open directions, bit (dir - 1) per direction
+	long long memBytes;					// The bytes of the arrays counted in memaccount.h
+
+};
@@ -0,0 +1,500 @@
+// Project Maze
+// FileName : mazeserver.cpp
+// Author: Christian Siletti
+// Purpose : This file contains the implementation for all of the methods
+//			 defined in mazeserver.h
+
+#include "mazeserver.h"		// The header file
+#include "pathsearch.h"		// For finding the paths and checking their lengths
+#include "pathrank.h"		// For counting the paths without finding them
+#include <sstream>			// For reading the queries and building the responses
+#include <algorithm>		// For sorting the latencies
+#include <iomanip>			// For printing the latencies
+#include <new>				// Contains the bad_alloc exception
+
+const double NANOS_PER_MS = 1000000.0;		// The number of nanoseconds in a millisecond
+const int LATENCY_DIGITS = 3;				// The number of decimal places a latency is printed with
+const double PERCENTILE_ARR[] = { 0.50, 0.90, 0.99 };	// The latency percentiles printed
+const int PERCENTILE_CT = 3;				// The number of latency percentiles printed
+
+
+
+// O(1)
+// Purpose: Return the latency a fraction of the queries were answered within
+// Pre: The latencies, sorted from shortest to longest, and at least one of them
+// Post: The smallest latency at least the fraction of the latencies are no longer than is returned
+static double Percentile(/*IN*/const vector<double>& sortedArr,	// The latencies
+						 /*IN*/const double& fraction)			// The fraction wanted
+{
+	size_t rank = (size_t)(fraction * sortedArr.size() + 0.5);	// The latency's position counting from one
+
+	if (rank < OFFSET)
+		rank = OFFSET;
+	if (rank > sortedArr.size())
+		rank = sortedArr.size();
+
+	return sortedArr[rank - OFFSET];
+
+}// end Percentile
+
+
+
+
+// O(1) - Default Constructor
+// Pre: N/A
+// Post: A server with no mazes and no workers is created
+MazeServer::MazeServer()
+{
+	loader = NULL;	// Nothing is being served yet
+	outPtr = NULL;
+	busyCt = ZERO;
+	closing = false;
+
+}// end DC
+
+
+
+
+// O(N) - Destructor
+// Pre: N/A
+// Post: Every board served is deleted
+MazeServer::~MazeServer()
+{
+	for (map<string, ServedMazeRec*>::iterator it = mazeMap.begin(); it != mazeMap.end(); it++)
+	{
+		delete it->second->board;
+		delete it->second;
+	}
+
+}// end Destructor
+
+
+
+
+// O(Q) for Q queries, each as long as its answer takes
+// Pre: The queries, where the responses go, the options and the maze file reader
+// Post: Every query read is answered, the workers are stopped, and the latencies are printed
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+void MazeServer::Run(/*IN/OUT*/istream& in,					// The queries
+					 /*IN/OUT*/ostream& out,				// Where the responses are printed
+					 /*IN*/const OptionsRec& opts,			// The options the searches run with and the number of threads
+					 /*IN*/BoardLoader loader)				// Reads a maze file into a board and layout
+{
+	QueryRec query;			// The query being read
+	string kind;			// The query's first word
+	long long queryCt = ZERO;	// The number of queries read
+
+	this->opts = opts;
+	this->loader = loader;
+	outPtr = &out;
+	closing = false;
+
+	// Start the workers
+	for (int i = ZERO; i < opts.threads; i++)
+		workerArr.push_back(thread(&MazeServer::WorkLoop, this));
+
+	// Read queries until there are no more
+	while (getline(in, query.line))
+	{
+		kind.clear();
+		istringstream(query.line) >> kind;
+		if (kind.empty())
+			continue;
+		if (kind == QUIT_QUERY)
+			break;
+
+		query.id = ++queryCt;
+		query.readAt = chrono::steady_clock::now();
+
+		// Queries that only read a maze go to the workers
+		if (kind == SHORTEST_QUERY || kind == COUNT_QUERY || kind == ENUMERATE_QUERY)
+		{
+			{
+				lock_guard<mutex> guard(queueLock);
+				queryQueue.push_back(query);
+				busyCt++;
+			}
+			queueReady.notify_one();
+		}
+
+		// Any other query waits for the queries before it to finish and is answered here
+		else
+		{
+			{
+				unique_lock<mutex> guard(queueLock);
+				while (busyCt > ZERO)
+					queueIdle.wait(guard);
+			}
+			Answer(query);
+		}
+
+	}// end while
+
+	// Let the workers finish the queue and stop
+	{
+		lock_guard<mutex> guard(queueLock);
+		closing = true;
+	}
+	queueReady.notify_all();
+	for (size_t i = ZERO; i < workerArr.size(); i++)
+		workerArr[i].join();
+	workerArr.clear();
+
+	// Print how long the queries took
+	out << Latencies();
+	out.flush();
+
+}// end Run
+
+
+
+
+// O(Q) for Q queries
+// Pre: Run on a worker thread
+// Post: The queue is empty and the server is closing
+void MazeServer::WorkLoop()
+{
+	QueryRec query;		// The query being answered
+
+	while (true)
+	{
+		// Wait for a query, or stop once the server is closing and there are none left
+		{
+			unique_lock<mutex> guard(queueLock);
+			while (queryQueue.empty() && !closing)
+				queueReady.wait(guard);
+			if (queryQueue.empty())
+				return;
+
+			query = queryQueue.front();
+			queryQueue.pop_front();
+		}
+
+		Answer(query);
+
+		// Let the reader know if it is waiting for every query to finish
+		{
+			lock_guard<mutex> guard(queueLock);
+			busyCt--;
+		}
+		queueIdle.notify_all();
+	}
+
+}// end WorkLoop
+
+
+
+
+// O(1) plus the query's own time
+// Pre: A query read by Run. Queries that change what is served are answered with no other query running
+// Post: Every line of the response is printed together, each starting with the query's number
+void MazeServer::Answer(/*IN*/const QueryRec& query)		// The query being answered
+{
+	istringstream queryIn(query.line);	// Reads the query's words
+	string kind;						// The kind of query
+	string name;						// The maze the query is about
+	string value;						// The query's file name
+	string response;					// The response, a line at a time
+	string line;						// A line of the response
+	long long pathCt;					// The number of paths wanted
+	Location2DRec loc;					// The cell being changed
+	map<string, ServedMazeRec*>::iterator maze;		// The maze the query is about
+	double latency;						// How long the query took, in ms
+
+	// Unknown queries are timed together so a client cannot grow the latencies without bound
+	queryIn >> kind;
+	if (kind != LOAD_QUERY && kind != SHORTEST_QUERY && kind != COUNT_QUERY && kind != ENUMERATE_QUERY &&
+		kind != WALL_QUERY && kind != OPEN_QUERY && kind != STATS_QUERY)
+	{
+		kind = UNKNOWN_QUERY;
+		response = "ERROR Unknown query";
+	}
+	else if (kind != STATS_QUERY && !(queryIn >> name))
+		response = "ERROR Missing maze name";
+	else
+	{
+		maze = mazeMap.find(name);
+
+		try
+		{
+			// Read in a maze
+			if (kind == LOAD_QUERY)
+				response = (queryIn >> value) ? Load(name, value) : "ERROR Missing maze file";
+
+			// Report the latencies so far
+			else if (kind == STATS_QUERY)
+				response = "OK\n" + Latencies();
+
+			// Every other query is about a maze being served
+			else if (maze == mazeMap.end())
+				response = "ERROR Unknown maze";
+			else if (kind == SHORTEST_QUERY)
+				response = Shortest(*maze->second);
+			else if (kind == COUNT_QUERY)
+				response = Count(*maze->second);
+			else if (kind == ENUMERATE_QUERY)
+				response = (queryIn >> pathCt && pathCt > ZERO) ? Enumerate(*maze->second, pathCt)
+																: "ERROR Missing number of paths";
+			else
+				response = (queryIn >> loc.x >> loc.y) ?
+						   Edit(*maze->second, loc, kind == WALL_QUERY ? WALL : OPEN) : "ERROR Missing cell";
+		}
+		catch (GBOutOfMemoryException)		// The heap space memory has run out
+		{
+			response = "ERROR Out of memory";
+		}
+	}
+
+	// Print every line of the response together, numbered
+	{
+		lock_guard<mutex> guard(outLock);
+		istringstream responseIn(response);
+		while (getline(responseIn, line))
+			*outPtr << "#" << query.id << " " << line << "\n";
+		outPtr->flush();
+	}
+
+	// Record how long it took from the moment it was read
+	latency = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - query.readAt).count() /
+			  NANOS_PER_MS;
+	{
+		lock_guard<mutex> guard(latencyLock);
+		latencyMap[kind].push_back(latency);
+	}
+
+}// end Answer
+
+
+
+
+// O(N^2)
+// Pre: No other query is running
+// Post: The maze is served under the name, replacing any maze it had, or the name is left as it was
+//		 if the file cannot be read. The response is returned
+string MazeServer::Load(/*IN*/const string& name,			// The name the maze is served under
+						/*IN*/const string& fileName)		// The maze file
+{
+	GameBoard* board = NULL;	// The board read in
+	ServedMazeRec* maze;		// The maze being served
+	int rows;					// Number of rows in the gameboard
+	int cols;					// Number of columns in the gameboard
+
+	// Read the file in, the name keeps its maze if it cannot be
+	maze = new (nothrow) ServedMazeRec;
+	if (maze == NULL)
+		throw GBOutOfMemoryException();
+	if (!loader(fileName, board, maze->layout))
+	{
+		delete maze;
+		return "ERROR Could not load '" + fileName + "'";
+	}
+	maze->board = board;
+
+	// Work out what the queries read, freeing the maze if it does not fit
+	try
+	{
+		maze->dynMap.Build(*board, maze->layout);
+		maze->walls = make_shared<WallLayer>();
+		maze->walls->Build(*board);
+	}
+	catch (std::bad_alloc)	// The heap space memory has run out
+	{
+		delete board;
+		delete maze;
+
+		// Throw the exception
+		throw GBOutOfMemoryException();
+	}
+	catch (GBOutOfMemoryException)	// The maps ran out of memory
+	{
+		delete board;
+		delete maze;
+		throw;
+	}
+
+	// Replace the maze it had
+	if (mazeMap.count(name) > ZERO)
+	{
+		delete mazeMap[name]->board;
+		delete mazeMap[name];
+	}
+	mazeMap[name] = maze;
+
+	board->GetSize(rows, cols);
+	return "OK " + to_string(rows) + "x" + to_string(cols) + " board with " +
+		   to_string(maze->layout.exits.size()) + " exits";
+
+}// end Load
+
+
+
+
+// O(N) for a path of N moves
+// Pre: A maze being served
+// Post: The response holding the path and its length, or that there is none, is returned
+string MazeServer::Shortest(/*IN*/const ServedMazeRec& maze) const		// The maze being asked about
+{
+	string pathText;	// The directions of the path
+	int exit;			// The exit it finishes on
+
+	// The path's length counts its exit move
+	if (!maze.dynMap.GetPath(maze.layout.start, pathText, exit))
+		return "OK No possible paths!";
+
+	return "OK " + pathText + maze.layout.exits[exit].dir + " Length: " +
+		   to_string(maze.dynMap.GetDistance(maze.layout.start) + OFFSET);
+
+}// end Shortest
+
+
+
+
+// O(S) for the S partial path states the count memoizes
+// Pre: A maze being served
+// Post: The response holding the number of paths within the length limits is returned
+string MazeServer::Count(/*IN*/const ServedMazeRec& maze) const		// The maze being asked about
+{
+	PathRanker ranker;					// Counts the paths
+	long long pathCt;					// The number of paths if easily answered
+	string pathText;					// The only path, if there is one
+
+	if (HasEasyAnswer(maze, pathCt, pathText))
+		return "OK " + to_string(pathCt) + " paths";
+
+	// The count cuts paths that are too long short the way the search does, with the distances
+	// the maze keeps up to date
+	ranker.Build(*maze.board, maze.layout, opts, maze.dynMap);
+	return "OK " + to_string(ranker.CountPaths()) + " paths";
+
+}// end Count
+
+
+
+
+// O(2^N)
+// Pre: A maze being served and how many paths are wanted
+// Post: The response holding how many paths were found, then each path, is returned.
+//		 The maze is searched on a copy of its board so other queries can read it meanwhile
+string MazeServer::Enumerate(/*IN*/const ServedMazeRec& maze,			// The maze being asked about
+							 /*IN*/const long long& pathCt) const		// The number of paths wanted
+{
+	OptionsRec searchOpts = opts;		// The options, stopping at the last path wanted
+	SearchView view;					// Never started
+	TraceWriter trace;					// Never opened
+	PathStats stats;					// Never started
+	PathWriter writer;					// Prints the paths found to the response
+	ostringstream pathsOut;				// The paths found
+	string response;					// The response, a line at a time
+	string line;						// A line of the paths found
+	long long easyCt;					// The number of paths if easily answered
+	string pathText;					// The only path, if there is one
+	long long foundCt = ZERO;			// The number of paths found
+
+	if (HasEasyAnswer(maze, easyCt, pathText))
+		return "OK " + to_string(easyCt) + " paths" + (easyCt > ZERO ? "\nPath #1:\t" + pathText : "");
+
+	// Search an overlay of the shared walls, the search marks the cells it visits in its own bits
+	OverlayBoard board(maze.walls);
+
+	// Find the paths wanted, printed on the worker's own thread. The search cuts paths that are
+	// too long short with the distances the maze keeps up to date
+	searchOpts.firstPath = ZERO;
+	searchOpts.lastPath = pathCt;
+	searchOpts.noPaths = false;
+	writer.Start(pathsOut, maze.layout, false);
+	SearchBoard(board, maze.layout, searchOpts, maze.dynMap, view, trace, stats, writer, foundCt);
+	writer.Stop();
+
+	// One line per path, without the blank lines between them
+	response = "OK " + to_string(foundCt) + " paths";
+	istringstream pathsIn(pathsOut.str());
+	while (getline(pathsIn, line))
+		if (!line.empty())
+			response += "\n" + line;
+
+	return response;
+
+}// end Enumerate
+
+
+
+
+// O(M log M) for the M cells the edit changes
+// Pre: A maze being served, and no other query is running
+// Post: The cell is changed and the maze's distances repaired around it. The response
+//		 holding how many cells were looked at, or that the cell is off the board, is returned
+string MazeServer::Edit(/*IN/OUT*/ServedMazeRec& maze,			// The maze being changed
+						/*IN*/const Location2DRec& loc,			// The cell being changed
+						/*IN*/const StateEnum& newStatus)		// WALL or OPEN
+{
+	if (!maze.dynMap.SetStatus(*maze.board, loc, newStatus))
+		return "ERROR Cell off the board";
+	maze.walls->SetWall(loc, newStatus == WALL);
+
+	return "OK Cells updated: " + to_string(maze.dynMap.GetEditWork());
+
+}// end Edit
+
+
+
+
+// O(Q log Q) for Q queries answered
+// Pre: N/A
+// Post: One line per kind of query answered so far is returned, with how many there were
+//		 and their 50th, 90th and 99th percentile and longest latencies
+string MazeServer::Latencies()
+{
+	ostringstream statsOut;		// The lines being built
+	vector<double> sortedArr;	// One kind's latencies, shortest first
+
+	lock_guard<mutex> guard(latencyLock);
+	statsOut << fixed << setprecision(LATENCY_DIGITS);
+	for (map<string, vector<double> >::iterator it = latencyMap.begin(); it != latencyMap.end(); it++)
+	{
+		sortedArr = it->second;
+		sort(sortedArr.begin(), sortedArr.end());
+
+		statsOut << "Latency " << it->first << ": " << sortedArr.size() << " queries";
+		for (int p = ZERO; p < PERCENTILE_CT; p++)
+			statsOut << ", p" << (int)(PERCENTILE_ARR[p] * 100 + 0.5) << " "
+					 << Percentile(sortedArr, PERCENTILE_ARR[p]) << " ms";
+		statsOut << ", max " << sortedArr.back() << " ms\n";
+	}
+
+	return statsOut.str();
+
+}// end Latencies
+
+
+
+
+// O(1)
+// Pre: A maze being served
+// Post: true is returned if the entrance is a wall, cannot reach an exit, or is on the only exit,
+//		 with pathCt holding the number of paths and pathText the printed path if there is one
+bool MazeServer::HasEasyAnswer(/*IN*/const ServedMazeRec& maze,		// The maze being asked about
+							   /*OUT*/long long& pathCt,			// The number of paths if easily answered
+							   /*OUT*/string& pathText) const		// The only path, if there is one
+{
+	pathCt = ZERO;
+	pathText.clear();
+
+	// No exit can be reached, which covers a walled entrance and walled exits
+	if (maze.dynMap.GetDistance(maze.layout.start) == NO_DISTANCE)
+		return true;
+
+	// The only path is the single exit move, if it is within the length limits
+	if (maze.layout.exits.size() == OFFSET && maze.layout.start.x == maze.layout.exits[ZERO].loc.x &&
+		maze.layout.start.y == maze.layout.exits[ZERO].loc.y)
+	{
+		if (WithinLenLimits(OFFSET, opts))
+		{
+			pathCt = OFFSET;
+			pathText = maze.layout.exits[ZERO].dir;
+		}
+		return true;
+	}
+
+	return false;
+
+}// end HasEasyAnswer
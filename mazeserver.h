@@ -0,0 +1,294 @@
+#pragma once
+/*
+	FileName : mazeserver.h
+	Author: Christian Siletti
+	Date: 5/7/24
+	Project Maze
+
+	PURPOSE:
+		Contains the specifications for a MazeServer Class. A maze server answers queries about
+		any number of mazes for as long as it runs, so a maze is read in, and its distances,
+		components and dead ends measured (see dynamicmap.h), once instead of once per query.
+
+		Queries come in a line at a time and are numbered in the order they arrive, and every line
+		of a query's response starts with "#" and its number, so a client can match them up:
+			load NAME FILE		  Read in the maze in FILE (as the input file is read) as NAME
+			shortest NAME		  A shortest path from the entrance to the nearest exit
+			count NAME			  How many paths there are, counted without finding them (see pathrank.h)
+			enumerate NAME N	  The first N paths, as the search numbers and prints them
+			wall NAME x y		  Put up a wall on (x, y) and repair the maze's distances around it
+			open NAME x y		  Take down the wall on (x, y) and repair the maze's distances around it
+			stats				  The latency percentiles of each kind of query so far
+			quit				  Stop reading queries, finish the ones read, and print the latencies
+		The first line of a response is "OK" or "ERROR" followed by the answer or what was wrong.
+
+		The shortest, count and enumerate queries only read a maze, so they are handed to a pool
+		of worker threads and run side by side, answering in the order they finish. The queries
+		that change what is served, and stats, wait for every query before them to finish and
+		are run by the reader on their own, so a query always sees every change sent before it.
+
+		A maze's walls are kept once more, packed a bit to a cell, in a wall layer (see overlayboard.h)
+		that every enumerate query shares. Each search runs on an overlay holding only the bits of
+		the cells it visits, so starting one costs a bit per cell instead of a copy of the board.
+
+		A query's latency is measured from the moment it was read to the moment its response
+		was printed, so it includes the time spent waiting for a worker.
+
+
+	ASSUMPTIONS:
+		1) Maze names are single words, and a maze loaded under a name in use replaces it
+		2) The options the server runs with are used for every search, only their length limits
+		   and engine are looked at
+		3) Layered mazes are not served
+
+
+	EXCEPTION HANDLING/ERROR CHECKING:
+		1) A query that is unknown, is missing a value, or names a maze not loaded is answered with ERROR.
+		2) A maze file that cannot be read or is not valid is answered with ERROR, and the name
+		   keeps the maze it had.
+		3) A wall or open query off the board is answered with ERROR.
+		4) GBOutOfMemoryException thrown when memory from the heap has run out
+
+
+						   SUMMARY OF METHODS:
+	PUBLIC METHODS
+		MazeServer() - Instantiate a server with no mazes
+		~MazeServer() - Free every maze served
+		void Run(*IN/OUT*istream& in,				// The queries
+				 *IN/OUT*ostream& out,				// Where the responses are printed
+				 *IN*const OptionsRec& opts,		// The options the searches run with and the number of threads
+				 *IN*BoardLoader loader)			// Reads a maze file into a board and layout
+					- Answer queries until the input runs out or a quit query
+
+
+	PRIVATE MEMBERS:
+		map<string, ServedMazeRec*> mazeMap;			// The mazes served, by name
+		OptionsRec opts;								// The options the searches run with
+		BoardLoader loader;								// Reads a maze file into a board and layout
+		ostream* outPtr;								// Where the responses are printed
+		deque<QueryRec> queryQueue;						// The queries waiting for a worker
+		mutex queueLock;								// Guards the queue and the busy count
+		condition_variable queueReady;					// Signalled when a query is queued or the server closes
+		condition_variable queueIdle;					// Signalled when a worker finishes a query
+		int busyCt;										// The number of queries queued or being answered
+		bool closing;									// Holds if the workers should stop once the queue is empty
+		vector<thread> workerArr;						// The worker threads
+		mutex outLock;									// Keeps each response's lines together
+		mutex latencyLock;								// Guards the latencies
+		map<string, vector<double> > latencyMap;		// The latency of each query answered, in ms, by kind
+
+	PRIVATE METHODS:
+		void WorkLoop() - Answer queued queries until the server closes
+		void Answer(*IN*const QueryRec& query)		// The query being answered
+					- Answer a query, print its response and record its latency
+		string Load(*IN*const string& name,			// The name the maze is served under
+					*IN*const string& fileName)		// The maze file
+					- Read in a maze and measure it
+		string Shortest(*IN*const ServedMazeRec& maze) const	// The maze being asked about
+					- Find a shortest path from the entrance to the nearest exit
+		string Count(*IN*const ServedMazeRec& maze) const		// The maze being asked about
+					- Count the maze's paths without finding them
+		string Enumerate(*IN*const ServedMazeRec& maze,			// The maze being asked about
+						 *IN*const long long& pathCt) const		// The number of paths wanted
+					- Find and print the maze's first paths
+		string Edit(*IN/OUT*ServedMazeRec& maze,		// The maze being changed
+					*IN*const Location2DRec& loc,		// The cell being changed
+					*IN*const StateEnum& newStatus)		// WALL or OPEN
+					- Put up or take down a wall
+		string Latencies()
+					- Print the latency percentiles of each kind of query
+		bool HasEasyAnswer(*IN*const ServedMazeRec& maze,		// The maze being asked about
+						   *OUT*long long& pathCt,				// The number of paths if easily answered
+						   *OUT*string& pathText) const			// The only path, if there is one
+					- Check if the maze's paths are known without searching
+*/
+
+#include "gameboard.h"		// Allows access to the gameboard ADT
+#include "layoutrec.h"		// The entrance and exits record
+#include "optionsrec.h"		// The command line options record
+#include "dynamicmap.h"		// The distances, components and dead ends kept for each maze
+#include "overlayboard.h"	// The walls the searches share and the overlays they run on
+#include <iostream>			// For the queries and responses
+#include <string>			// For the query lines
+#include <map>				// For the mazes by name and the latencies by kind
+#include <deque>			// For the queries waiting for a worker
+#include <vector>			// For the worker threads
+#include <thread>			// For the worker threads
+#include <mutex>			// For guarding the queue, the responses and the latencies
+#include <condition_variable>	// For waking the workers and the reader
+#include <chrono>			// For the latencies
+
+using namespace std;    // Standard namespace
+
+
+// Reads a maze file into a new board and its layout, false if the file cannot be read or is not valid
+typedef bool (*BoardLoader)(/*IN*/const string&,		// The maze file
+							/*OUT*/GameBoard*&,			// The board read in, made with new
+							/*OUT*/LayoutRec&);			// The entrance and exits read in
+
+
+const string LOAD_QUERY = "load";				// Reads in a maze
+const string SHORTEST_QUERY = "shortest";		// Asks for a shortest path
+const string COUNT_QUERY = "count";				// Asks how many paths there are
+const string ENUMERATE_QUERY = "enumerate";		// Asks for the first paths
+const string WALL_QUERY = "wall";				// Puts up a wall
+const string OPEN_QUERY = "open";				// Takes down a wall
+const string STATS_QUERY = "stats";				// Asks for the latencies
+const string QUIT_QUERY = "quit";				// Stops the server
+const string UNKNOWN_QUERY = "unknown";			// What the latencies of queries not known are kept under
+
+
+// A maze being served
+struct ServedMazeRec
+{
+	GameBoard* board;				// The maze's board, its walls only
+	shared_ptr<WallLayer> walls;	// The maze's walls, shared by the overlays its searches run on
+	LayoutRec layout;				// The entrance and exits
+	DynamicMap dynMap;				// The distances, components and dead ends, kept up to date through each edit
+};
+
+
+// A query waiting to be answered
+struct QueryRec
+{
+	long long id;								// The query's number, in the order read
+	string line;								// The query as read
+	chrono::steady_clock::time_point readAt;	// When it was read
+};
+
+
+
+class MazeServer
+{
+public:
+
+	// O(1) - Default Constructor
+	// Purpose: Instantiate a server with no mazes
+	// Pre: N/A
+	// Post: A server with no mazes and no workers is created
+	MazeServer();
+
+
+
+	// O(N) - Destructor
+	// Purpose: Free every maze served
+	// Pre: N/A
+	// Post: Every board served is deleted
+	~MazeServer();
+
+
+
+	// O(Q) for Q queries, each as long as its answer takes
+	// Purpose: Answer queries until the input runs out or a quit query
+	// Pre: The queries, where the responses go, the options and the maze file reader
+	// Post: Every query read is answered, the workers are stopped, and the latencies are printed
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	void Run(/*IN/OUT*/istream& in,					// The queries
+			 /*IN/OUT*/ostream& out,				// Where the responses are printed
+			 /*IN*/const OptionsRec& opts,			// The options the searches run with and the number of threads
+			 /*IN*/BoardLoader loader);				// Reads a maze file into a board and layout
+
+
+
+private:
+	map<string, ServedMazeRec*> mazeMap;		// The mazes served, by name
+	OptionsRec opts;							// The options the searches run with
+	BoardLoader loader;							// Reads a maze file into a board and layout
+	ostream* outPtr;							// Where the responses are printed
+
+	deque<QueryRec> queryQueue;					// The queries waiting for a worker
+	mutex queueLock;							// Guards the queue and the busy count
+	condition_variable queueReady;				// Signalled when a query is queued or the server closes
+	condition_variable queueIdle;				// Signalled when a worker finishes a query
+	int busyCt;									// The number of queries queued or being answered
+	bool closing;								// Holds if the workers should stop once the queue is empty
+	vector<thread> workerArr;					// The worker threads
+
+	mutex outLock;								// Keeps each response's lines together
+	mutex latencyLock;							// Guards the latencies
+	map<string, vector<double> > latencyMap;	// The latency of each query answered, in ms, by kind
+
+
+
+	// O(Q) for Q queries
+	// Purpose: Answer queued queries until the server closes
+	// Pre: Run on a worker thread
+	// Post: The queue is empty and the server is closing
+	void WorkLoop();
+
+
+
+	// O(1) plus the query's own time
+	// Purpose: Answer a query, print its response and record its latency
+	// Pre: A query read by Run. Queries that change what is served are answered with no other query running
+	// Post: Every line of the response is printed together, each starting with the query's number
+	void Answer(/*IN*/const QueryRec& query);		// The query being answered
+
+
+
+	// O(N^2)
+	// Purpose: Read in a maze and measure it
+	// Pre: No other query is running
+	// Post: The maze is served under the name, replacing any maze it had, or the name is left as it was
+	//		 if the file cannot be read. The response is returned
+	string Load(/*IN*/const string& name,			// The name the maze is served under
+				/*IN*/const string& fileName);		// The maze file
+
+
+
+	// O(N) for a path of N moves
+	// Purpose: Find a shortest path from the entrance to the nearest exit
+	// Pre: A maze being served
+	// Post: The response holding the path and its length, or that there is none, is returned
+	string Shortest(/*IN*/const ServedMazeRec& maze) const;		// The maze being asked about
+
+
+
+	// O(S) for the S partial path states the count memoizes
+	// Purpose: Count the maze's paths without finding them
+	// Pre: A maze being served
+	// Post: The response holding the number of paths within the length limits is returned
+	string Count(/*IN*/const ServedMazeRec& maze) const;		// The maze being asked about
+
+
+
+	// O(2^N)
+	// Purpose: Find and print the maze's first paths
+	// Pre: A maze being served and how many paths are wanted
+	// Post: The response holding how many paths were found, then each path, is returned.
+	//		 The maze is searched on an overlay of its walls so other queries can read them meanwhile
+	string Enumerate(/*IN*/const ServedMazeRec& maze,			// The maze being asked about
+					 /*IN*/const long long& pathCt) const;		// The number of paths wanted
+
+
+
+	// O(M log M) for the M cells the edit changes
+	// Purpose: Put up or take down a wall
+	// Pre: A maze being served, and no other query is running
+	// Post: The cell is changed and the maze's distances repaired around it. The response
+	//		 holding how many cells were looked at, or that the cell is off the board, is returned
+	string Edit(/*IN/OUT*/ServedMazeRec& maze,			// The maze being changed
+				/*IN*/const Location2DRec& loc,			// The cell being changed
+				/*IN*/const StateEnum& newStatus);		// WALL or OPEN
+
+
+
+	// O(Q log Q) for Q queries answered
+	// Purpose: Print the latency percentiles of each kind of query
+	// Pre: N/A
+	// Post: One line per kind of query answered so far is returned, with how many there were
+	//		 and their 50th, 90th and 99th percentile and longest latencies
+	string Latencies();
+
+
+
+	// O(1)
+	// Purpose: Check if the maze's paths are known without searching
+	// Pre: A maze being served
+	// Post: true is returned if the entrance is a wall, cannot reach an exit, or is on the only exit,
+	//		 with pathCt holding the number of paths and pathText the printed path if there is one
+	bool HasEasyAnswer(/*IN*/const ServedMazeRec& maze,		// The maze being asked about
+					   /*OUT*/long long& pathCt,			// The number of paths if easily answered
+					   /*OUT*/string& pathText) const;		// The only path, if there is one
+
+};
@@ -0,0 +1,961 @@
+// Project Maze
+// FileName : meetcount.cpp
+// Author: Christian Siletti
+// Purpose : This file contains the implementation for all of the methods
+//			 defined in meetcount.h
+
+#include "meetcount.h"		// The header file
+#include "navigation.h"		// For the search's direction order
+#include "gbExceptions.h"	// Holds the out of memory exception
+#include "memaccount.h"		// For counting the cell arrays, the walks and the halves
+#include <thread>			// For the walking and comparing threads
+#include <chrono>			// For timing the count
+#include <cstring>			// For copying signatures in and out of their keys
+#include <cstdlib>			// For the rows and columns between the entrance and an exit
+#include <climits>			// For the bits in a group key's bytes
+#include <algorithm>		// For the longest separator a board can have
+#include <new>				// Contains the bad_alloc exception
+
+const int SEP_ENDS = 1;		// The moves a half makes on a separator cell it ends a segment on
+const int SEP_PASSES = 2;	// The moves a half makes on a separator cell it passes through
+
+
+
+// O(1)
+// Purpose: Return what a half does on a separator cell
+// Pre: A signature and one of its separator indexes
+// Post: SEP_UNUSED, SEP_THROUGH, SEP_ANCHOR or the separator index of the other end of the segment
+//		 ending on the cell is returned
+static int SepValue(/*IN*/const string& sig,		// The half's signature
+					/*IN*/const int& sep)			// The separator index
+{
+	int value;		// What the half does on the cell
+
+	memcpy(&value, sig.data() + (size_t)sep * sizeof(value), sizeof(value));
+
+	return value;
+
+}// end SepValue
+
+
+
+
+// O(1)
+// Purpose: Return the number of moves a half makes on a separator cell
+// Pre: What the half does on the cell
+// Post: 0 for a cell left alone, SEP_PASSES for one passed through, otherwise SEP_ENDS
+static int SepMoves(/*IN*/const int& value)		// What the half does on the cell
+{
+	if (value == SEP_UNUSED)
+		return ZERO;
+
+	return value == SEP_THROUGH ? SEP_PASSES : SEP_ENDS;
+
+}// end SepMoves
+
+
+
+
+// O(1)
+// Purpose: Return the bytes a table of halves takes from the heap
+// Pre: A table of halves, their keys all the same length
+// Post: The bytes of the entries, their keys and hash table links, and of the buckets are returned
+static long long TableBytes(/*IN*/const HalfMap& halves)		// The halves counted
+{
+	long long entryBytes = sizeof(HalfMap::value_type) + sizeof(void*) + sizeof(size_t);	// An entry, its link and its hash
+
+	if (!halves.empty())
+		entryBytes += (long long)halves.begin()->first.capacity() + OFFSET;
+
+	return (long long)halves.size() * entryBytes + (long long)halves.bucket_count() * sizeof(void*);
+
+}// end TableBytes
+
+
+
+
+// O(1) - Default Constructor
+// Pre: N/A
+// Post: A meet counter with nothing counted is created
+MeetCounter::MeetCounter()
+{
+	maxRows = ZERO;
+	maxCols = ZERO;
+	startCell = ZERO;
+	sepCt = ZERO;
+	exitSep = NO_CELL;
+	threadCt = ZERO;
+	seconds = ZERO;
+	memBytes = ZERO;
+	halfBytes = ZERO;
+
+}// end DC
+
+
+
+
+// O(1) - Destructor
+// Pre: N/A
+// Post: The class object is destroyed
+MeetCounter::~MeetCounter()
+{
+	// The cell arrays and the halves free themselves, they are no longer counted
+	MemRelease(MEM_MAPS, memBytes + halfBytes);
+
+}// end Destructor
+
+
+
+
+// O((F + B + P) / T) for F near halves, B far halves and P pairs compared on T threads
+// Pre: The board with only its walls set, its layout, and at least one thread
+// Post: The number of paths the search would find is returned
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+long long MeetCounter::Count(/*IN*/const GameBoard& board,		// The board being counted
+							 /*IN*/const LayoutRec& layout,		// The entrance and exits
+							 /*IN*/const int& threads)			// The number of threads the halves are walked and compared on
+{
+	Location2DRec loc;				// The cell being set up
+	Location2DRec nextLoc;			// The cell's neighbour
+	int cell;						// The cell's row major index
+	int exitCell;					// The exit's cell
+	DirectionEnum dir;				// The direction to the neighbour
+	MeetExitRec exitRec;			// How the exit's paths are counted
+	bool walkedNear = false;		// Holds if near halves have been walked for a separator
+	vector<thread> threadArr;		// The comparing threads
+	vector<long long> pathsArr;		// The paths each thread counted
+	vector<long long> pairsArr;		// The halves each thread compared
+	atomic<long long> nextNear;		// The next near half to be taken by a comparing thread
+	HalfMap::const_iterator half;	// A half being grouped
+	long long total = ZERO;			// The paths to every exit
+	chrono::steady_clock::time_point startTime = chrono::steady_clock::now();	// When the count began
+
+	board.GetSize(maxRows, maxCols);
+	startCell = layout.start.x * maxCols + layout.start.y;
+	threadCt = threads;
+	exitRecArr.clear();
+
+	try
+	{
+		nextArr.assign((size_t)maxRows * maxCols * DIR_COUNT, NO_CELL);
+		openArr.assign((size_t)maxRows * maxCols, false);
+
+		// Link every open cell to its open neighbours, in the search's direction order
+		for (loc.x = ZERO; loc.x < maxRows; loc.x++)
+			for (loc.y = ZERO; loc.y < maxCols; loc.y++)
+			{
+				if (board.GetStatus(loc) != OPEN)
+					continue;
+
+				cell = loc.x * maxCols + loc.y;
+				openArr[cell] = true;
+				for (dir = NextDir(NA); dir != NA; dir = NextDir(dir))
+				{
+					nextLoc = Move(dir, loc);
+					if (board.GetStatus(nextLoc) == OPEN)
+						nextArr[(size_t)cell * DIR_COUNT + dir - OFFSET] = nextLoc.x * maxCols + nextLoc.y;
+				}
+			}
+
+		pathsArr.resize(threads);
+		pairsArr.resize(threads);
+	}
+	catch (std::bad_alloc)	// The heap space memory has run out
+	{
+		// Throw the exception
+		throw GBOutOfMemoryException();
+	}
+
+	CountMemory();
+
+	// Count the paths to each exit in turn
+	for (size_t i = ZERO; i < layout.exits.size(); i++)
+	{
+		exitCell = layout.exits[i].loc.x * maxCols + layout.exits[i].loc.y;
+		exitRec.byRows = false;
+		exitRec.line = NO_CELL;
+		exitRec.frontCt = ZERO;
+		exitRec.backCt = ZERO;
+		exitRec.frontSigCt = ZERO;
+		exitRec.backSigCt = ZERO;
+		exitRec.pairCt = ZERO;
+		exitRec.paths = ZERO;
+
+		// A walled exit is never reached, and an entrance that is an exit is a path of only the exit move
+		if (!openArr[exitCell] || exitCell == startCell)
+		{
+			if (exitCell == startCell)
+				exitRec.paths = OFFSET;
+			total += exitRec.paths;
+			exitRecArr.push_back(exitRec);
+			continue;
+		}
+
+		// Split the board, the near halves only change if the separator moved
+		Split(layout.start, layout.exits[i].loc, exitRec);
+		CountMemory();
+		if (walkedNear && exitRec.byRows == exitRecArr.back().byRows && exitRec.line == exitRecArr.back().line)
+			exitRec.frontCt = exitRecArr.back().frontCt;
+		else
+		{
+			WalkSide(startCell, false, nearMap, exitRec.frontCt);
+			walkedNear = true;
+		}
+
+		// An exit on the separator starts no far segment of its own
+		WalkSide(exitSep == NO_CELL ? exitCell : NO_CELL, true, farMap, exitRec.backCt);
+		exitRec.frontSigCt = (long long)nearMap.size();
+		exitRec.backSigCt = (long long)farMap.size();
+
+		// Group the far halves by the separator cells their segments end on, and line up the near halves
+		try
+		{
+			farGroupMap.clear();
+			nearItArr.clear();
+			for (half = farMap.begin(); half != farMap.end(); half++)
+				farGroupMap[GroupKey(half->first)].push_back(half);
+			for (half = nearMap.begin(); half != nearMap.end(); half++)
+				nearItArr.push_back(half);
+		}
+		catch (std::bad_alloc)	// The heap space memory has run out
+		{
+			// Throw the exception
+			throw GBOutOfMemoryException();
+		}
+		CountMemory();
+
+		// Compare each near half with its group, each thread taking the next near half left
+		nextNear = ZERO;
+		threadArr.clear();
+		for (int t = ZERO; t < threads; t++)
+			threadArr.push_back(thread(&MeetCounter::CombineLoop, this, ref(nextNear),
+									   ref(pathsArr[t]), ref(pairsArr[t])));
+
+		// Add up every thread's counts once it is done
+		for (int t = ZERO; t < threads; t++)
+		{
+			threadArr[t].join();
+			exitRec.paths += pathsArr[t];
+			exitRec.pairCt += pairsArr[t];
+		}
+
+		total += exitRec.paths;
+		exitRecArr.push_back(exitRec);
+	}
+
+	seconds = chrono::duration<double>(chrono::steady_clock::now() - startTime).count();
+
+	return total;
+
+}// end Count
+
+
+
+
+// O(E) for E exits - Observer
+// Pre: Count has been called
+// Post: A line for each exit and one for the time taken is printed to out
+void MeetCounter::Report(/*IN/OUT*/ostream& out) const		// Where the report is printed
+{
+	out << "Counted by meeting in the middle, the halves walked and compared on " << threadCt << " threads:\n";
+
+	for (size_t i = ZERO; i < exitRecArr.size(); i++)
+	{
+		out << "Exit " << i + OFFSET << ": ";
+
+		// The exits that were not split
+		if (exitRecArr[i].line == NO_CELL)
+			out << (exitRecArr[i].paths > ZERO ? "the entrance, 1 path" : "walled, no paths") << "\n";
+
+		else
+			out << (exitRecArr[i].byRows ? "row " : "column ") << exitRecArr[i].line << ", "
+				<< exitRecArr[i].frontCt << " halves on the entrance's side (" << exitRecArr[i].frontSigCt
+				<< " signatures) and " << exitRecArr[i].backCt << " on the exit's (" << exitRecArr[i].backSigCt
+				<< " signatures), " << exitRecArr[i].pairCt << " pairs compared, " << exitRecArr[i].paths << " paths\n";
+	}
+
+	out << "Count time: " << seconds << " seconds" << endl;
+
+}// end Report
+
+
+
+
+// O(N^2)
+// Pre: The entrance and an exit that is not the entrance
+// Post: sideArr, sepArr, sepCellArr, sepCt and exitSep describe the separator, and exitRec holds where it is
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+void MeetCounter::Split(/*IN*/const Location2DRec& start,		// The entrance
+						/*IN*/const Location2DRec& exit,		// The exit being counted
+						/*OUT*/MeetExitRec& exitRec)			// Where the separator is recorded
+{
+	int startPos;		// The entrance's row or column across the separator
+	int gap;			// The rows or columns from the entrance to the exit
+	int pos;			// A cell's row or column across the separator
+	int cell;			// The cell's row major index
+
+	// Split across whichever way the exit is further from the entrance. The exit is not the
+	// entrance, so there is a gap and the entrance is on the near side
+	exitRec.byRows = abs(exit.x - start.x) > abs(exit.y - start.y);
+	startPos = exitRec.byRows ? start.x : start.y;
+	gap = (exitRec.byRows ? exit.x : exit.y) - startPos;
+
+	// Halfway between them, an odd gap putting the separator nearer the exit
+	if (gap > ZERO)
+		exitRec.line = startPos + (gap + OFFSET) / 2;
+	else
+		exitRec.line = startPos + (gap - OFFSET) / 2;
+
+	try
+	{
+		sideArr.assign((size_t)maxRows * maxCols, SIDE_NEAR);
+		sepArr.assign((size_t)maxRows * maxCols, NO_CELL);
+		sepCellArr.clear();
+
+		// Number the open separator cells, and mark the side every other cell is on
+		for (int x = ZERO; x < maxRows; x++)
+			for (int y = ZERO; y < maxCols; y++)
+			{
+				cell = x * maxCols + y;
+				pos = exitRec.byRows ? x : y;
+
+				if (pos == exitRec.line)
+				{
+					sideArr[cell] = SIDE_SEP;
+					if (openArr[cell])
+					{
+						sepArr[cell] = (int)sepCellArr.size();
+						sepCellArr.push_back(cell);
+					}
+				}
+				else if ((gap > ZERO && pos > exitRec.line) || (gap < ZERO && pos < exitRec.line))
+					sideArr[cell] = SIDE_FAR;
+			}
+	}
+	catch (std::bad_alloc)	// The heap space memory has run out
+	{
+		// Throw the exception
+		throw GBOutOfMemoryException();
+	}
+
+	sepCt = (int)sepCellArr.size();
+	exitSep = sepArr[exit.x * maxCols + exit.y];
+
+}// end Split
+
+
+
+
+// O(H * N^2 / T) for H partial halves on T threads, each move checked with a flood fill
+// Pre: The separator has been picked
+// Post: halves holds the side's halves counted by signature, and halfCt how many were kept.
+//		 The first segment is walked from the anchor cell if there is one, otherwise the side
+//		 may keep a half with no segments
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+void MeetCounter::WalkSide(/*IN*/const int& anchorCell,		// The entrance or exit, or NO_CELL for none
+						   /*IN*/const bool& far,			// Holds if the far side is walked
+						   /*OUT*/HalfMap& halves,			// The side's halves by signature
+						   /*OUT*/long long& halfCt)		// The number of halves kept
+{
+	MeetScratchRec scratch;						// The cells and segments of the walk on this thread
+	vector<MeetFrameRec> frames;				// The walk's frames
+	vector<vector<MeetFrameRec> > taskArr;		// The walks left after the first moves
+	MeetFrameRec first;							// The walk's first frame
+	vector<thread> threadArr;					// The walking threads
+	vector<HalfMap> halvesArr;					// The halves each thread kept
+	vector<long long> halfCtArr;				// The number of halves each thread kept
+	atomic<long long> nextTask;					// The next walk to be taken by a walking thread
+	HalfMap::const_iterator half;				// A half being added up
+	int capDepth = OFFSET;						// The frames the first moves are walked to
+	long long scratchBytes;						// The bytes of the walk on this thread counted in memaccount.h
+	long long threadBytes = ZERO;				// The bytes of the threads' halves counted in memaccount.h
+
+	StartScratch(scratch, scratchBytes);
+
+	// The walk starts on the anchor's segment, or between segments if the side has no anchor
+	first.cell = anchorCell;
+	first.segStart = SEP_ANCHOR;
+	first.choice = ZERO;
+	first.isBreak = anchorCell == NO_CELL;
+
+	// Walk the first moves on this thread, a frame deeper each time, until there are enough walks
+	// left to share out. A board small enough to be walked this deep is walked here in full
+	do
+	{
+		capDepth++;
+		halves.clear();
+		halfCt = ZERO;
+		taskArr.clear();
+
+		// A side with no anchor keeps the half with no segments
+		if (first.isBreak)
+		{
+			KeepHalf(scratch, halves);
+			halfCt++;
+		}
+
+		PushFrame(frames, scratch, first);
+		Walk(frames, OFFSET, capDepth, far, scratch, halves, halfCt, taskArr);
+
+	} while (!taskArr.empty() && (long long)taskArr.size() < (long long)threadCt * MEET_TASKS_PER_THREAD &&
+			 capDepth < MEET_TASK_DEPTH_MAX);
+
+	// The walk on this thread is done with
+	MemRelease(MEM_MAPS, scratchBytes);
+
+	if (taskArr.empty())
+		return;
+
+	// Finish the walks left, each thread taking the next walk left
+	try
+	{
+		halvesArr.resize(threadCt);
+		halfCtArr.resize(threadCt);
+	}
+	catch (std::bad_alloc)	// The heap space memory has run out
+	{
+		// Throw the exception
+		throw GBOutOfMemoryException();
+	}
+
+	nextTask = ZERO;
+	for (int t = ZERO; t < threadCt; t++)
+		threadArr.push_back(thread(&MeetCounter::WalkTasks, this, ref(nextTask), cref(taskArr), far,
+								   ref(halvesArr[t]), ref(halfCtArr[t])));
+
+	// Count every thread's halves once they are all done
+	for (int t = ZERO; t < threadCt; t++)
+	{
+		threadArr[t].join();
+		halfCt += halfCtArr[t];
+		threadBytes += TableBytes(halvesArr[t]);
+	}
+	MemAdd(MEM_MAPS, threadBytes);
+
+	// Add every thread's halves in
+	for (int t = ZERO; t < threadCt; t++)
+	{
+		try
+		{
+			for (half = halvesArr[t].begin(); half != halvesArr[t].end(); half++)
+				halves[half->first] += half->second;
+		}
+		catch (std::bad_alloc)	// The heap space memory has run out
+		{
+			// Throw the exception
+			throw GBOutOfMemoryException();
+		}
+
+		halvesArr[t].clear();
+	}
+
+	// The threads' halves are freed on the way out
+	MemRelease(MEM_MAPS, threadBytes);
+
+}// end WalkSide
+
+
+
+
+// O(H * N^2) for H partial halves in the walks taken, each move checked with a flood fill
+// Pre: The first moves have been walked and the walks left after them are in taskArr
+// Post: halves holds the halves of the walks the thread took, and halfCt how many there were
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+void MeetCounter::WalkTasks(/*IN/OUT*/atomic<long long>& nextTask,						// The next walk to be taken
+							/*IN*/const vector<vector<MeetFrameRec> >& taskArr,			// The walks left after the first moves
+							/*IN*/const bool& far,										// Holds if the far side is walked
+							/*OUT*/HalfMap& halves,										// The halves the thread kept
+							/*OUT*/long long& halfCt) const								// The number of halves it kept
+{
+	MeetScratchRec scratch;						// The cells and segments of the walk on this thread
+	vector<MeetFrameRec> frames;				// The walk's frames
+	vector<vector<MeetFrameRec> > noTasks;		// Nothing is left for later on a walking thread
+	long long scratchBytes;						// The bytes of the walk on this thread counted in memaccount.h
+
+	halfCt = ZERO;
+	StartScratch(scratch, scratchBytes);
+
+	// Take walks until there are none left
+	for (long long task = nextTask++; task < (long long)taskArr.size(); task = nextTask++)
+	{
+		// Put the walk's frames back, then walk on from the top one only
+		for (size_t i = ZERO; i < taskArr[task].size(); i++)
+			PushFrame(frames, scratch, taskArr[task][i]);
+		Walk(frames, (int)frames.size(), ZERO, far, scratch, halves, halfCt, noTasks);
+
+		// Clear the frames below it for the next walk
+		while (!frames.empty())
+			PopFrame(frames, scratch);
+	}
+
+	// The walk on this thread is freed on the way out
+	MemRelease(MEM_MAPS, scratchBytes);
+
+}// end WalkTasks
+
+
+
+
+// O(H * N^2) for H partial halves, each move checked with a flood fill
+// Pre: The walk's frames, with what they hold marked in scratch, and at least baseDepth of them
+// Post: Every half on from the frames is counted in halves and halfCt, and the walk is back
+//		 to baseDepth - 1 frames. With a capDepth above zero, a walk that reaches capDepth frames
+//		 is put in taskArr and not walked on
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+void MeetCounter::Walk(/*IN/OUT*/vector<MeetFrameRec>& frames,					// The walk's frames
+					   /*IN*/const int& baseDepth,								// The fewest frames the walk goes back to
+					   /*IN*/const int& capDepth,								// The most frames before the walk is left for later, or 0
+					   /*IN*/const bool& far,									// Holds if the far side is walked
+					   /*IN/OUT*/MeetScratchRec& scratch,						// The walk's cells and segments
+					   /*IN/OUT*/HalfMap& halves,								// The halves kept
+					   /*IN/OUT*/long long& halfCt,								// The number of halves kept
+					   /*IN/OUT*/vector<vector<MeetFrameRec> >& taskArr) const	// The walks left for later
+{
+	MeetFrameRec next;		// The frame being put on top
+	int cell;				// The top cell of the segment being walked
+	int endSep;				// The separator index a segment ends on
+
+	next.choice = ZERO;
+
+	while ((int)frames.size() >= baseDepth)
+	{
+		MeetFrameRec& top = frames.back();		// The walk's top frame
+
+		// Between two segments, start the next on each separator cell after the last one started on,
+		// so each set of segments is walked in only one order
+		if (top.isBreak)
+		{
+			if (top.choice >= sepCt)
+			{
+				PopFrame(frames, scratch);
+				continue;
+			}
+
+			next.cell = sepCellArr[top.choice];
+			next.segStart = top.choice++;
+			next.isBreak = false;
+			if (scratch.onPath[next.cell])
+				continue;
+		}
+
+		// Try each direction from the segment's top cell
+		else if (top.choice < DIR_COUNT)
+		{
+			cell = top.cell;
+			next.cell = nextArr[(size_t)cell * DIR_COUNT + top.choice++];
+			next.segStart = top.segStart;
+			next.isBreak = false;
+
+			// The near side moves among its cells and the separator's, the far side among its own and
+			// onto and off the separator, a move along the separator being the near side's
+			if (next.cell == NO_CELL || scratch.onPath[next.cell] ||
+				sideArr[next.cell] == (far ? SIDE_NEAR : SIDE_FAR) ||
+				(far && sideArr[next.cell] == SIDE_SEP && sideArr[cell] == SIDE_SEP))
+				continue;
+
+			// Most of the ways into a side lead nowhere a segment can end, and they are cut off here
+			if (sideArr[next.cell] != SIDE_SEP && !ReachesSeparator(next.cell, far, scratch))
+				continue;
+		}
+
+		// Then end the segment on its top cell if it is a separator cell other than the one it started
+		// on, a segment between two separator cells only ending on the later of them, and keep the half
+		else if (top.choice == DIR_COUNT)
+		{
+			top.choice++;
+			endSep = sepArr[top.cell];
+			if (endSep == NO_CELL || endSep <= top.segStart)
+				continue;
+
+			next.cell = top.cell;
+			next.segStart = top.segStart;
+			next.isBreak = true;
+			PushFrame(frames, scratch, next);
+			KeepHalf(scratch, halves);
+			halfCt++;
+
+			// The next segment starts after the last one started on
+			frames.back().choice = next.segStart == SEP_ANCHOR ? ZERO : next.segStart + OFFSET;
+			if (capDepth > ZERO && (int)frames.size() == capDepth)
+			{
+				taskArr.push_back(frames);
+				PopFrame(frames, scratch);
+			}
+			continue;
+		}
+
+		// Every way on from the cell has been tried
+		else
+		{
+			PopFrame(frames, scratch);
+			continue;
+		}
+
+		// Go on from the new top cell, or leave it for later if the first moves are deep enough
+		PushFrame(frames, scratch, next);
+		if (capDepth > ZERO && (int)frames.size() == capDepth)
+		{
+			try
+			{
+				taskArr.push_back(frames);
+			}
+			catch (std::bad_alloc)	// The heap space memory has run out
+			{
+				// Throw the exception
+				throw GBOutOfMemoryException();
+			}
+
+			PopFrame(frames, scratch);
+		}
+	}
+
+}// end Walk
+
+
+
+
+// O(N^2)
+// Pre: The separator has been picked
+// Post: scratch holds no cells and no segments, and scratchBytes its bytes, which are counted in
+//		 memaccount.h until the caller releases them
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+void MeetCounter::StartScratch(/*OUT*/MeetScratchRec& scratch,				// The walk's cells and segments
+							   /*OUT*/long long& scratchBytes) const		// The bytes of scratch counted in memaccount.h
+{
+	try
+	{
+		scratch.onPath.assign((size_t)maxRows * maxCols, false);
+		scratch.partnerArr.assign(sepCt, SEP_UNUSED);
+		scratch.fill.clear();
+		scratch.fill.reserve((size_t)maxRows * maxCols);
+		scratch.seen.assign((size_t)maxRows * maxCols, ZERO);
+		scratch.key.assign((size_t)sepCt * sizeof(int), ZERO);
+	}
+	catch (std::bad_alloc)	// The heap space memory has run out
+	{
+		// Throw the exception
+		throw GBOutOfMemoryException();
+	}
+
+	scratch.fillCt = ZERO;
+
+	scratchBytes = (long long)scratch.onPath.capacity() * sizeof(unsigned char) + (long long)scratch.partnerArr.capacity() * sizeof(int) +
+				   (long long)scratch.fill.capacity() * sizeof(int) + (long long)scratch.seen.capacity() * sizeof(unsigned long long) +
+				   (long long)scratch.key.capacity();
+	MemAdd(MEM_MAPS, scratchBytes);
+
+}// end StartScratch
+
+
+
+
+// O(1)
+// Pre: A cell frame's cell is not on the walk
+// Post: The frame is on top, a cell frame's cell is on the walk and a break's segment is ended
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+void MeetCounter::PushFrame(/*IN/OUT*/vector<MeetFrameRec>& frames,		// The walk's frames
+							/*IN/OUT*/MeetScratchRec& scratch,			// The walk's cells and segments
+							/*IN*/const MeetFrameRec& frame) const		// The frame being put on top
+{
+	int endSep;		// The separator index the break's segment ended on
+
+	try
+	{
+		frames.push_back(frame);
+	}
+	catch (std::bad_alloc)	// The heap space memory has run out
+	{
+		// Throw the exception
+		throw GBOutOfMemoryException();
+	}
+
+	// A break ends the segment before it, both its ends are tied to each other
+	if (frame.isBreak)
+	{
+		if (frame.cell == NO_CELL)
+			return;
+
+		endSep = sepArr[frame.cell];
+		scratch.partnerArr[endSep] = frame.segStart;
+		if (frame.segStart != SEP_ANCHOR)
+			scratch.partnerArr[frame.segStart] = endSep;
+	}
+	else
+		scratch.onPath[frame.cell] = true;
+
+}// end PushFrame
+
+
+
+
+// O(1)
+// Pre: The walk has a frame
+// Post: The top frame is gone, a cell frame's cell is off the walk and a break's segment is open again
+void MeetCounter::PopFrame(/*IN/OUT*/vector<MeetFrameRec>& frames,		// The walk's frames
+						   /*IN/OUT*/MeetScratchRec& scratch) const		// The walk's cells and segments
+{
+	const MeetFrameRec& top = frames.back();		// The frame being taken off
+
+	if (top.isBreak)
+	{
+		if (top.cell != NO_CELL)
+		{
+			scratch.partnerArr[sepArr[top.cell]] = SEP_UNUSED;
+			if (top.segStart != SEP_ANCHOR)
+				scratch.partnerArr[top.segStart] = SEP_UNUSED;
+		}
+	}
+	else
+		scratch.onPath[top.cell] = false;
+
+	frames.pop_back();
+
+}// end PopFrame
+
+
+
+
+// O(S) for S separator cells
+// Pre: Every segment of the walk has ended
+// Post: The half is counted under its signature, scratch's key holds the signature
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+void MeetCounter::KeepHalf(/*IN/OUT*/MeetScratchRec& scratch,		// The walk's cells and segments
+						   /*IN/OUT*/HalfMap& halves) const			// The halves kept
+{
+	int value;		// What the half does on a separator cell
+
+	// A separator cell on the walk that ends no segment is passed through
+	for (int sep = ZERO; sep < sepCt; sep++)
+	{
+		value = scratch.partnerArr[sep];
+		if (value == SEP_UNUSED && scratch.onPath[sepCellArr[sep]])
+			value = SEP_THROUGH;
+		memcpy(&scratch.key[(size_t)sep * sizeof(value)], &value, sizeof(value));
+	}
+
+	try
+	{
+		halves[scratch.key]++;
+	}
+	catch (std::bad_alloc)	// The heap space memory has run out
+	{
+		// Throw the exception
+		throw GBOutOfMemoryException();
+	}
+
+}// end KeepHalf
+
+
+
+
+// O(N^2)
+// Pre: The cell the walk is moving into, not yet on the walk and not on the separator
+// Post: false is returned only if no separator cell off the walk can be reached from the cell,
+//		 moving only on the walk's side
+bool MeetCounter::ReachesSeparator(/*IN*/const int& cell,					// The cell the walk is moving into
+								   /*IN*/const bool& far,					// Holds if the far side is walked
+								   /*IN/OUT*/MeetScratchRec& scratch) const	// The walk's cells and segments
+{
+	int curr;				// The cell being spread from
+	int next;				// Its neighbour
+	int blockedCt = ZERO;	// The cell's neighbours that are walls, off the board or on the walk
+	unsigned long long fillNum = ++scratch.fillCt;	// The number of this flood fill
+	unsigned char side = far ? SIDE_FAR : SIDE_NEAR;	// The side the walk is on
+
+	// A walk is mostly cut off where it touches itself or a wall, so a cell with only the walk's
+	// last cell blocked next to it is taken to reach one. Going on past it is never wrong, it is
+	// only a walk that may not be cut off as early
+	for (int d = ZERO; d < DIR_COUNT; d++)
+	{
+		next = nextArr[(size_t)cell * DIR_COUNT + d];
+		if (next == NO_CELL || scratch.onPath[next])
+			blockedCt++;
+	}
+	if (blockedCt <= OFFSET)
+		return true;
+
+	scratch.fill.clear();
+	scratch.fill.push_back(cell);
+	scratch.seen[cell] = fillNum;
+
+	// Spread through the side's cells off the walk until a separator cell off the walk is reached
+	for (size_t front = ZERO; front < scratch.fill.size(); front++)
+	{
+		curr = scratch.fill[front];
+		for (int d = ZERO; d < DIR_COUNT; d++)
+		{
+			next = nextArr[(size_t)curr * DIR_COUNT + d];
+			if (next == NO_CELL || scratch.onPath[next] || scratch.seen[next] == fillNum)
+				continue;
+
+			if (sideArr[next] == SIDE_SEP)
+				return true;
+
+			scratch.seen[next] = fillNum;
+			if (sideArr[next] == side)
+				scratch.fill.push_back(next);
+		}
+	}
+
+	return false;
+
+}// end ReachesSeparator
+
+
+
+
+// O(S) for S separator cells
+// Pre: A signature
+// Post: A bit set for each separator cell, other than the exit, a segment of the half ends on is returned
+string MeetCounter::GroupKey(/*IN*/const string& sig) const		// The half's signature
+{
+	string key((size_t)(sepCt + WORD_BITS - OFFSET) / WORD_BITS * sizeof(unsigned long long), ZERO);	// The cells as bits
+
+	for (int sep = ZERO; sep < sepCt; sep++)
+		if (sep != exitSep && SepMoves(SepValue(sig, sep)) == SEP_ENDS)
+			key[sep / CHAR_BIT] |= (char)(OFFSET << (sep % CHAR_BIT));
+
+	return key;
+
+}// end GroupKey
+
+
+
+
+// O(S) for S separator cells
+// Pre: The signatures of a near and a far half in the same group
+// Post: true is returned if every separator cell is left alone by both, passed through by one,
+//		 or ends a segment of each (only one for the exit), and the segments joined up from the
+//		 entrance reach the exit with none left over
+bool MeetCounter::Joins(/*IN*/const string& nearSig,			// The near half's signature
+						/*IN*/const string& farSig) const		// The far half's signature
+{
+	int moves;				// The moves both halves make on a separator cell
+	int nearEnds = ZERO;	// The segment ends of the near half on the separator
+	int farEnds = ZERO;		// The segment ends of the far half on the separator
+	int segCt;				// The segments of both halves
+	int joinedCt = OFFSET;	// The segments joined up from the entrance
+	int sep = NO_CELL;		// The separator cell the joined segments have reached
+
+	// A path makes two moves on each separator cell it passes, and one on the exit
+	for (int s = ZERO; s < sepCt; s++)
+	{
+		moves = SepMoves(SepValue(nearSig, s)) + SepMoves(SepValue(farSig, s));
+		if (s == exitSep ? moves != SEP_ENDS : moves != ZERO && moves != SEP_PASSES)
+			return false;
+
+		nearEnds += SepMoves(SepValue(nearSig, s)) == SEP_ENDS;
+		farEnds += SepMoves(SepValue(farSig, s)) == SEP_ENDS;
+		if (SepValue(nearSig, s) == SEP_ANCHOR)
+			sep = s;
+	}
+
+	// The entrance's segment has one end on the separator, and so does the exit's if it is past it
+	segCt = (nearEnds + OFFSET) / 2 + (exitSep == NO_CELL ? farEnds + OFFSET : farEnds) / 2;
+
+	// Follow the segments from the entrance's, a near segment then a far one, until the exit is reached
+	while (sep != exitSep)
+	{
+		sep = SepValue(farSig, sep);
+		joinedCt++;
+		if (sep == SEP_ANCHOR || sep == exitSep)
+			break;
+
+		sep = SepValue(nearSig, sep);
+		joinedCt++;
+		if (sep == SEP_ANCHOR)
+			return false;
+	}
+
+	// Any segment not joined up is part of a loop
+	return joinedCt == segCt;
+
+}// end Joins
+
+
+
+
+// O(P) for P pairs compared
+// Pre: Both sides' halves have been walked and grouped
+// Post: paths holds the paths made by the near halves the thread took, pairs the halves it compared
+void MeetCounter::CombineLoop(/*IN/OUT*/atomic<long long>& nextNear,		// The next near half to be taken
+							  /*OUT*/long long& paths,					// The paths the thread counted
+							  /*OUT*/long long& pairs) const			// The pairs of halves it compared
+{
+	unordered_map<string, vector<HalfMap::const_iterator> >::const_iterator group;		// The near half's group
+	HalfMap::const_iterator nearHalf;		// The near half's signature and count
+
+	paths = ZERO;
+	pairs = ZERO;
+
+	// Take near halves until there are none left
+	for (long long n = nextNear++; n < (long long)nearItArr.size(); n = nextNear++)
+	{
+		nearHalf = nearItArr[n];
+		group = farGroupMap.find(GroupKey(nearHalf->first));
+		if (group == farGroupMap.end())
+			continue;
+
+		for (size_t f = ZERO; f < group->second.size(); f++)
+		{
+			pairs++;
+			if (Joins(nearHalf->first, group->second[f]->first))
+				paths += nearHalf->second * group->second[f]->second;
+		}
+	}
+
+}// end CombineLoop
+
+
+
+
+// O(H) for H far halves
+// Pre: N/A
+// Post: memBytes holds the bytes of the cell arrays and halfBytes those of the halves, their
+//		 groups and the near halves' list, and memaccount.h counts them instead of the bytes
+//		 they held before. A half's bytes are its entry, key and hash table link
+void MeetCounter::CountMemory()
+{
+	unordered_map<string, vector<HalfMap::const_iterator> >::const_iterator group;	// A group of far halves
+
+	MemRelease(MEM_MAPS, memBytes + halfBytes);
+
+	memBytes = (long long)nextArr.capacity() * sizeof(int) + (long long)openArr.capacity() * sizeof(unsigned char) +
+			   (long long)sideArr.capacity() * sizeof(unsigned char) + (long long)sepArr.capacity() * sizeof(int) +
+			   (long long)sepCellArr.capacity() * sizeof(int);
+
+	halfBytes = TableBytes(nearMap) + TableBytes(farMap) + (long long)nearItArr.capacity() * sizeof(HalfMap::const_iterator) +
+				(long long)farGroupMap.bucket_count() * sizeof(void*);
+	for (group = farGroupMap.begin(); group != farGroupMap.end(); group++)
+		halfBytes += sizeof(*group) + sizeof(void*) + sizeof(size_t) + (long long)group->first.capacity() + OFFSET +
+					 (long long)group->second.capacity() * sizeof(HalfMap::const_iterator);
+
+	MemAdd(MEM_MAPS, memBytes + halfBytes);
+
+}// end CountMemory
+
+
+
+
+// O(1)
+// Pre: The number of rows and columns, and at least one thread
+// Post: The bytes of each cell's neighbours, side and separator index, and of a walk's cells and
+//		 flood fill for each thread and the one sharing the walks out, are returned, as counted in
+//		 memaccount.h. The halves are not included, their number is only known once they are walked
+long long MeetCounter::CountBytes(/*IN*/const int& rows,			// The number of rows
+								  /*IN*/const int& cols,			// The number of columns
+								  /*IN*/const int& threads)			// The number of threads the halves are walked on
+{
+	long long cellCt = (long long)rows * cols;		// The number of cells in the board
+	long long sepMax = max(rows, cols);				// The most cells a separator can have
+	long long cellBytes;							// The bytes of the cell arrays
+	long long scratchBytes;							// The bytes of one walk
+
+	cellBytes = cellCt * (DIR_COUNT * sizeof(int) + sizeof(unsigned char) + sizeof(unsigned char) + sizeof(int)) +
+				sepMax * sizeof(int);
+	scratchBytes = cellCt * (sizeof(unsigned char) + sizeof(int) + sizeof(unsigned long long)) +
+				   sepMax * (sizeof(int) + sizeof(int));
+
+	return cellBytes + (threads + OFFSET) * scratchBytes;
+
+}// end CountBytes
@@ -0,0 +1,438 @@
+#pragma once
+/*
+	FileName : meetcount.h
+	Author: Christian Siletti
+	Date: 5/16/24
+	Project Maze
+
+	PURPOSE:
+		Contains the specifications for a MeetCounter Class. A meet counter counts a board's paths
+		(--engine meet) without walking each of them from end to end. The search goes down every
+		path from the entrance, so each way the path could go on past a cell is walked again for
+		each way there was of reaching the cell. The meet counter walks what the paths do on each
+		half of the board once, and puts the halves together.
+
+		The board is split by a separator, the column (or row, whichever the entrance and exit are
+		further apart in) halfway between them. The cells on the entrance's side of it are its near
+		side and the cells on the exit's side its far side, the exit being on the separator or past it.
+		A path may cross the separator any number of times, so what it does on each side is a set of
+		segments that do not touch, each running between two separator cells:
+			- The near side half is the path's moves between near side and separator cells, and
+			  along the separator. Its segments are walked from the entrance, which starts one of
+			  them, and from each separator cell, never leaving the near side and the separator.
+			- The far side half is the path's moves between far side and separator cells. Its
+			  segments are walked the same way from the exit, when it is past the separator, and
+			  from each separator cell, never leaving the far side and the separator.
+		A half is kept under its signature, what it does on each separator cell: nothing, passes
+		through it, or ends a segment on it and which cell (or the entrance or exit) the segment's
+		other end is. The halves with the same signature are counted together in a hash map. A near
+		and a far half make a path when every separator cell they use is passed through by one of
+		them, or ends a segment of each, and the segments joined up from the entrance reach the exit
+		with none left over. Only halves ending segments on the same separator cells can join, so
+		the far halves are grouped by those cells and each near half is only compared with its group.
+		The paths are the sum of the joining pairs' counts.
+
+		So the work is the halves of each side plus the pairs compared, instead of every path.
+		Each side is walked as a search of its own is, on as many threads as are given. The first
+		moves are walked on one thread until there are MEET_TASKS_PER_THREAD walks left per
+		thread, and the threads each take the next walk left and finish it. The near halves are
+		compared with their groups the same way. On an open 6 by 6 board there are 140,390 near
+		halves under 428 signatures and 520 far halves under 70, and 884 pairs are compared, for
+		1,262,816 paths.
+
+		With several exits the paths to each exit are counted this way in turn, and added up,
+		as the search prints a path at every exit it reaches. The near halves are only walked again
+		if the separator moved.
+
+
+	ASSUMPTIONS:
+		1) The board passed to Count has only its walls set, and its entrance is open
+		2) Only the number of paths is found, no path is printed, and there are no length limits
+		3) The halves of each side fit in memory, a board the search could never finish may have
+		   too many of them
+
+
+	EXCEPTION HANDLING/ERROR CHECKING:
+		1) A walled exit has no paths.
+		2) GBOutOfMemoryException thrown when memory from the heap has run out
+
+
+						   SUMMARY OF METHODS:
+	PUBLIC METHODS
+		MeetCounter() - Instantiate a meet counter with no board
+		virtual ~MeetCounter() - Destroy the class object
+		long long Count(*IN*const GameBoard& board,		// The board being counted
+						*IN*const LayoutRec& layout,	// The entrance and exits
+						*IN*const int& threads)			// The number of threads the halves are walked and compared on
+					- Count the paths from the entrance to the exits by meeting in the middle
+		void Report(*IN/OUT*ostream& out) const		// Where the report is printed
+					- Print where each exit's paths were split and how many halves met
+		static long long CountBytes(*IN*const int& rows,		// The number of rows
+									*IN*const int& cols,		// The number of columns
+									*IN*const int& threads)		// The number of threads the halves are walked on
+					- Return the bytes the cell arrays and the walks of a board's size take from the heap
+
+
+	PRIVATE MEMBERS:
+		int maxRows;							// The number of rows in the board
+		int maxCols;							// The number of columns in the board
+		int startCell;							// The entrance's cell
+		vector<int> nextArr;					// Each cell's neighbour in each direction, or NO_CELL
+		vector<unsigned char> openArr;			// Holds which cells are open
+		vector<unsigned char> sideArr;			// Which side of the separator each cell is on
+		vector<int> sepArr;						// Each separator cell's index, or NO_CELL
+		vector<int> sepCellArr;					// Each separator index's cell
+		int sepCt;								// The number of separator cells
+		int exitSep;							// The exit's separator index, or NO_CELL if it is past the separator
+		HalfMap nearMap;						// The near side's halves by signature
+		HalfMap farMap;							// The far side's halves by signature
+		vector<HalfMap::const_iterator> nearItArr;			// The near halves, for the comparing threads to share out
+		unordered_map<string, vector<HalfMap::const_iterator> > farGroupMap;	// The far halves by the separator cells their segments end on
+		vector<MeetExitRec> exitRecArr;			// How each exit's paths were counted
+		int threadCt;							// The number of threads the halves were walked and compared on
+		double seconds;							// How long the count took
+		long long memBytes;						// The bytes of the cell arrays counted in memaccount.h
+		long long halfBytes;					// The bytes of the halves and their groups counted in memaccount.h
+
+
+	PRIVATE METHODS:
+		void Split(*IN*const Location2DRec& start,		// The entrance
+				   *IN*const Location2DRec& exit,		// The exit being counted
+				   *OUT*MeetExitRec& exitRec)			// Where the separator is recorded
+					- Pick the separator between the entrance and an exit, and mark each cell's side
+		void WalkSide(*IN*const int& anchorCell,		// The entrance or exit, or NO_CELL for none
+					  *IN*const bool& far,				// Holds if the far side is walked
+					  *OUT*HalfMap& halves,				// The side's halves by signature
+					  *OUT*long long& halfCt)			// The number of halves kept
+					- Walk every half of one side, sharing the walks out among the threads
+		void WalkTasks(*IN/OUT*atomic<long long>& nextTask,						// The next walk to be taken
+					   *IN*const vector<vector<MeetFrameRec> >& taskArr,		// The walks left after the first moves
+					   *IN*const bool& far,										// Holds if the far side is walked
+					   *OUT*HalfMap& halves,									// The halves the thread kept
+					   *OUT*long long& halfCt) const							// The number of halves it kept
+					- Finish the walks left, on a thread of its own
+		void Walk(*IN/OUT*vector<MeetFrameRec>& frames,					// The walk's frames
+				  *IN*const int& baseDepth,								// The fewest frames the walk goes back to
+				  *IN*const int& capDepth,								// The most frames before the walk is left for later, or 0
+				  *IN*const bool& far,									// Holds if the far side is walked
+				  *IN/OUT*MeetScratchRec& scratch,						// The walk's cells and segments
+				  *IN/OUT*HalfMap& halves,								// The halves kept
+				  *IN/OUT*long long& halfCt,							// The number of halves kept
+				  *IN/OUT*vector<vector<MeetFrameRec> >& taskArr) const	// The walks left for later
+					- Walk every half on from a walk's top frame, keeping one each time a segment ends
+		void StartScratch(*OUT*MeetScratchRec& scratch,			// The walk's cells and segments
+						  *OUT*long long& scratchBytes) const	// The bytes of scratch counted in memaccount.h
+					- Make room for a walk with nothing on it
+		void PushFrame(*IN/OUT*vector<MeetFrameRec>& frames,		// The walk's frames
+					   *IN/OUT*MeetScratchRec& scratch,				// The walk's cells and segments
+					   *IN*const MeetFrameRec& frame) const			// The frame being put on top
+					- Put a frame on top of a walk and mark what it holds
+		void PopFrame(*IN/OUT*vector<MeetFrameRec>& frames,		// The walk's frames
+					  *IN/OUT*MeetScratchRec& scratch) const		// The walk's cells and segments
+					- Take a walk's top frame off and unmark what it held
+		void KeepHalf(*IN/OUT*MeetScratchRec& scratch,		// The walk's cells and segments
+					  *IN/OUT*HalfMap& halves) const		// The halves kept
+					- Count the walk's half under its signature
+		bool ReachesSeparator(*IN*const int& cell,					// The cell the walk is moving into
+							  *IN*const bool& far,					// Holds if the far side is walked
+							  *IN/OUT*MeetScratchRec& scratch) const	// The walk's cells and segments
+					- Check if the walk can still end a segment after moving into a cell
+		string GroupKey(*IN*const string& sig) const		// The half's signature
+					- Return the separator cells a half's segments end on, the exit left out
+		bool Joins(*IN*const string& nearSig,				// The near half's signature
+				   *IN*const string& farSig) const		// The far half's signature
+					- Check if a near and a far half make a path
+		void CombineLoop(*IN/OUT*atomic<long long>& nextNear,		// The next near half to be taken
+						 *OUT*long long& paths,						// The paths the thread counted
+						 *OUT*long long& pairs) const				// The pairs of halves it compared
+					- Count the paths the near halves make with the far halves, on a thread of its own
+		void CountMemory()
+					- Count the cell arrays and the halves in memaccount.h in place of what they were before
+*/
+
+#include "gameboard.h"		// Allows access to the gameboard ADT
+#include "layoutrec.h"		// The entrance and exits record
+#include "pathrank.h"		// For NO_CELL and DIR_COUNT
+#include <vector>			// For the cells and the halves
+#include <string>			// For the signatures as hash keys
+#include <unordered_map>	// For counting the halves by signature
+#include <atomic>			// For handing out the walks and the near halves
+#include <ostream>			// For printing the report
+
+using namespace std;    // Standard namespace
+
+
+const int MEET_TASKS_PER_THREAD = 16;	// The walks left for each thread once the first moves are walked
+const int MEET_TASK_DEPTH_MAX = 32;		// The most frames deep the first moves are walked to share out
+const int SEP_UNUSED = -1;				// A separator cell a half does nothing on
+const int SEP_THROUGH = -2;				// A separator cell a half passes through
+const int SEP_ANCHOR = -3;				// A segment's other end that is the entrance or the exit
+
+
+// Enumerated type for which side of the separator a cell is on
+enum SideEnum { SIDE_NEAR, SIDE_SEP, SIDE_FAR };
+
+
+// Each signature of one side's halves, and how many halves have it
+typedef unordered_map<string, long long> HalfMap;
+
+
+// How one exit's paths were counted
+struct MeetExitRec
+{
+	bool byRows;			// Holds if the separator is a row, otherwise it is a column
+	int line;				// The separator's row or column
+	long long frontCt;		// The number of near halves walked
+	long long backCt;		// The number of far halves walked
+	long long frontSigCt;	// The number of near signatures
+	long long backSigCt;	// The number of far signatures
+	long long pairCt;		// The number of near and far signatures compared
+	long long paths;		// The number of paths to the exit
+};
+
+
+// A step of a walk on one side, either the top cell of the segment being walked or a break
+// between two segments
+struct MeetFrameRec
+{
+	int cell;			// The segment's top cell, or for a break the cell the segment before it ended on, NO_CELL for none
+	int segStart;		// The separator index the segment started on, or SEP_ANCHOR for the entrance's or exit's
+	int choice;			// The next direction to try, DIR_COUNT to end the segment, or for a break
+						// the next separator index to start a segment on
+	bool isBreak;		// Holds if the frame is a break between two segments
+};
+
+
+// What a walk needs of its own, each thread walking has one
+struct MeetScratchRec
+{
+	vector<unsigned char> onPath;		// Holds which cells are on the walk
+	vector<int> partnerArr;				// Each separator cell's segment's other end, or SEP_UNUSED if it ends none
+	vector<int> fill;					// The cells waiting in a flood fill
+	vector<unsigned long long> seen;	// The flood fill each cell was last reached by
+	unsigned long long fillCt;			// The number of flood fills made
+	string key;							// The walk's signature as a hash key
+};
+
+
+
+class MeetCounter
+{
+public:
+
+	// O(1) - Default Constructor
+	// Purpose: Instantiate a meet counter with no board
+	// Pre: N/A
+	// Post: A meet counter with nothing counted is created
+	MeetCounter();
+
+
+
+	// O(1) - Destructor
+	// Purpose: Destroy the class object
+	// Pre: N/A
+	// Post: The class object is destroyed
+	virtual ~MeetCounter();
+
+
+
+	// O((F + B + P) / T) for F near halves, B far halves and P pairs compared on T threads
+	// Purpose: Count the paths from the entrance to the exits by meeting in the middle
+	// Pre: The board with only its walls set, its layout, and at least one thread
+	// Post: The number of paths the search would find is returned
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	long long Count(/*IN*/const GameBoard& board,		// The board being counted
+					/*IN*/const LayoutRec& layout,		// The entrance and exits
+					/*IN*/const int& threads);			// The number of threads the halves are walked and compared on
+
+
+
+	// O(E) for E exits - Observer
+	// Purpose: Print where each exit's paths were split and how many halves met
+	// Pre: Count has been called
+	// Post: A line for each exit and one for the time taken is printed to out
+	void Report(/*IN/OUT*/ostream& out) const;		// Where the report is printed
+
+
+
+	// O(1)
+	// Purpose: Return the bytes the cell arrays and the walks of a board's size take from the heap
+	// Pre: The number of rows and columns, and at least one thread
+	// Post: The bytes of each cell's neighbours, side and separator index, and of a walk's cells and
+	//		 flood fill for each thread and the one sharing the walks out, are returned, as counted in
+	//		 memaccount.h. The halves are not included, their number is only known once they are walked
+	static long long CountBytes(/*IN*/const int& rows,			// The number of rows
+								/*IN*/const int& cols,			// The number of columns
+								/*IN*/const int& threads);		// The number of threads the halves are walked on
+
+
+
+private:
+	int maxRows;							// The number of rows in the board
+	int maxCols;							// The number of columns in the board
+	int startCell;							// The entrance's cell
+	vector<int> nextArr;					// Each cell's neighbour in each direction, or NO_CELL
+	vector<unsigned char> openArr;			// Holds which cells are open
+	vector<unsigned char> sideArr;			// Which side of the separator each cell is on
+	vector<int> sepArr;						// Each separator cell's index, or NO_CELL
+	vector<int> sepCellArr;					// Each separator index's cell
+	int sepCt;								// The number of separator cells
+	int exitSep;							// The exit's separator index, or NO_CELL if it is past the separator
+	HalfMap nearMap;						// The near side's halves by signature
+	HalfMap farMap;							// The far side's halves by signature
+	vector<HalfMap::const_iterator> nearItArr;			// The near halves, for the comparing threads to share out
+	unordered_map<string, vector<HalfMap::const_iterator> > farGroupMap;	// The far halves by the separator cells their segments end on
+	vector<MeetExitRec> exitRecArr;			// How each exit's paths were counted
+	int threadCt;							// The number of threads the halves were walked and compared on
+	double seconds;							// How long the count took
+	long long memBytes;						// The bytes of the cell arrays counted in memaccount.h
+	long long halfBytes;					// The bytes of the halves and their groups counted in memaccount.h
+
+
+
+	// O(N^2)
+	// Purpose: Pick the separator between the entrance and an exit, and mark each cell's side
+	// Pre: The entrance and an exit that is not the entrance
+	// Post: sideArr, sepArr, sepCellArr, sepCt and exitSep describe the separator, and exitRec holds where it is
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	void Split(/*IN*/const Location2DRec& start,		// The entrance
+			   /*IN*/const Location2DRec& exit,			// The exit being counted
+			   /*OUT*/MeetExitRec& exitRec);			// Where the separator is recorded
+
+
+
+	// O(H * N^2 / T) for H partial halves on T threads, each move checked with a flood fill
+	// Purpose: Walk every half of one side, sharing the walks out among the threads
+	// Pre: The separator has been picked
+	// Post: halves holds the side's halves counted by signature, and halfCt how many were kept.
+	//		 The first segment is walked from the anchor cell if there is one, otherwise the side
+	//		 may keep a half with no segments
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	void WalkSide(/*IN*/const int& anchorCell,		// The entrance or exit, or NO_CELL for none
+				  /*IN*/const bool& far,			// Holds if the far side is walked
+				  /*OUT*/HalfMap& halves,			// The side's halves by signature
+				  /*OUT*/long long& halfCt);		// The number of halves kept
+
+
+
+	// O(H * N^2) for H partial halves in the walks taken, each move checked with a flood fill
+	// Purpose: Finish the walks left, on a thread of its own
+	// Pre: The first moves have been walked and the walks left after them are in taskArr
+	// Post: halves holds the halves of the walks the thread took, and halfCt how many there were
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	void WalkTasks(/*IN/OUT*/atomic<long long>& nextTask,						// The next walk to be taken
+				   /*IN*/const vector<vector<MeetFrameRec> >& taskArr,			// The walks left after the first moves
+				   /*IN*/const bool& far,										// Holds if the far side is walked
+				   /*OUT*/HalfMap& halves,										// The halves the thread kept
+				   /*OUT*/long long& halfCt) const;								// The number of halves it kept
+
+
+
+	// O(H * N^2) for H partial halves, each move checked with a flood fill
+	// Purpose: Walk every half on from a walk's top frame, keeping one each time a segment ends
+	// Pre: The walk's frames, with what they hold marked in scratch, and at least baseDepth of them
+	// Post: Every half on from the frames is counted in halves and halfCt, and the walk is back
+	//		 to baseDepth - 1 frames. With a capDepth above zero, a walk that reaches capDepth frames
+	//		 is put in taskArr and not walked on
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	void Walk(/*IN/OUT*/vector<MeetFrameRec>& frames,					// The walk's frames
+			  /*IN*/const int& baseDepth,								// The fewest frames the walk goes back to
+			  /*IN*/const int& capDepth,								// The most frames before the walk is left for later, or 0
+			  /*IN*/const bool& far,									// Holds if the far side is walked
+			  /*IN/OUT*/MeetScratchRec& scratch,						// The walk's cells and segments
+			  /*IN/OUT*/HalfMap& halves,								// The halves kept
+			  /*IN/OUT*/long long& halfCt,								// The number of halves kept
+			  /*IN/OUT*/vector<vector<MeetFrameRec> >& taskArr) const;	// The walks left for later
+
+
+
+	// O(N^2)
+	// Purpose: Make room for a walk with nothing on it
+	// Pre: The separator has been picked
+	// Post: scratch holds no cells and no segments, and scratchBytes its bytes, which are counted in
+	//		 memaccount.h until the caller releases them
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	void StartScratch(/*OUT*/MeetScratchRec& scratch,				// The walk's cells and segments
+					  /*OUT*/long long& scratchBytes) const;		// The bytes of scratch counted in memaccount.h
+
+
+
+	// O(1)
+	// Purpose: Put a frame on top of a walk and mark what it holds
+	// Pre: A cell frame's cell is not on the walk
+	// Post: The frame is on top, a cell frame's cell is on the walk and a break's segment is ended
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	void PushFrame(/*IN/OUT*/vector<MeetFrameRec>& frames,		// The walk's frames
+				   /*IN/OUT*/MeetScratchRec& scratch,			// The walk's cells and segments
+				   /*IN*/const MeetFrameRec& frame) const;		// The frame being put on top
+
+
+
+	// O(1)
+	// Purpose: Take a walk's top frame off and unmark what it held
+	// Pre: The walk has a frame
+	// Post: The top frame is gone, a cell frame's cell is off the walk and a break's segment is open again
+	void PopFrame(/*IN/OUT*/vector<MeetFrameRec>& frames,		// The walk's frames
+				  /*IN/OUT*/MeetScratchRec& scratch) const;		// The walk's cells and segments
+
+
+
+	// O(S) for S separator cells
+	// Purpose: Count the walk's half under its signature
+	// Pre: Every segment of the walk has ended
+	// Post: The half is counted under its signature, scratch's key holds the signature
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	void KeepHalf(/*IN/OUT*/MeetScratchRec& scratch,		// The walk's cells and segments
+				  /*IN/OUT*/HalfMap& halves) const;			// The halves kept
+
+
+
+	// O(N^2)
+	// Purpose: Check if the walk can still end a segment after moving into a cell
+	// Pre: The cell the walk is moving into, not yet on the walk and not on the separator
+	// Post: false is returned only if no separator cell off the walk can be reached from the cell,
+	//		 moving only on the walk's side
+	bool ReachesSeparator(/*IN*/const int& cell,					// The cell the walk is moving into
+						  /*IN*/const bool& far,					// Holds if the far side is walked
+						  /*IN/OUT*/MeetScratchRec& scratch) const;	// The walk's cells and segments
+
+
+
+	// O(S) for S separator cells
+	// Purpose: Return the separator cells a half's segments end on, the exit left out
+	// Pre: A signature
+	// Post: A bit set for each separator cell, other than the exit, a segment of the half ends on is returned
+	string GroupKey(/*IN*/const string& sig) const;		// The half's signature
+
+
+
+	// O(S) for S separator cells
+	// Purpose: Check if a near and a far half make a path
+	// Pre: The signatures of a near and a far half in the same group
+	// Post: true is returned if every separator cell is left alone by both, passed through by one,
+	//		 or ends a segment of each (only one for the exit), and the segments joined up from the
+	//		 entrance reach the exit with none left over
+	bool Joins(/*IN*/const string& nearSig,				// The near half's signature
+			   /*IN*/const string& farSig) const;		// The far half's signature
+
+
+
+	// O(P) for P pairs compared
+	// Purpose: Count the paths the near halves make with the far halves, on a thread of its own
+	// Pre: Both sides' halves have been walked and grouped
+	// Post: paths holds the paths made by the near halves the thread took, pairs the halves it compared
+	void CombineLoop(/*IN/OUT*/atomic<long long>& nextNear,		// The next near half to be taken
+					 /*OUT*/long long& paths,					// The paths the thread counted
+					 /*OUT*/long long& pairs) const;			// The pairs of halves it compared
+
+
+
+	// O(H) for H far halves
+	// Purpose: Count the cell arrays and the halves in memaccount.h in place of what they were before
+	// Pre: N/A
+	// Post: memBytes holds the bytes of the cell arrays and halfBytes those of the halves, their
+	//		 groups and the near halves' list, and memaccount.h counts them instead of the bytes
+	//		 they held before. A half's bytes are its entry, key and hash table link
+	void CountMemory();
+
+};
@@ -0,0 +1,119 @@
+// Project Maze
+// FileName : memaccount.cpp
+// Author: Christian Siletti
+// Purpose : This file contains the implementation for all of the functions
+//			 defined in memaccount.h
+
+#include "memaccount.h"		// The header file
+#include <atomic>			// For counting on any thread
+
+using namespace std;	// Standard Namespace
+
+
+const string MEM_USE_NAMES[MEM_USE_CT] = { "board", "path stack", "output buffers", "maps" };	// Each kind's name in the report
+
+static atomic<long long> currentArr[MEM_USE_CT];		// The bytes of each kind in use
+static atomic<long long> peakArr[MEM_USE_CT];			// The most bytes of each kind there have been in use
+static atomic<long long> totalCurrent(ZERO);			// The bytes of every kind in use
+static atomic<long long> totalPeak(ZERO);				// The most bytes of every kind together there have been in use
+
+
+
+// O(1) for each thread racing it
+// Purpose: Raise a peak to a count if the count is above it
+// Pre: The peak and the count just reached
+// Post: The peak is at least the count
+static void RaisePeak(/*IN/OUT*/atomic<long long>& peak,		// The peak being raised
+					  /*IN*/const long long& count)				// The count just reached
+{
+	long long seen = peak.load(memory_order_relaxed);	// The peak as this thread last saw it
+
+	// Another thread may raise it first, try again until it is at least the count
+	while (count > seen && !peak.compare_exchange_weak(seen, count, memory_order_relaxed))
+		;
+
+}// end RaisePeak
+
+
+
+// O(1)
+// Pre: The kind of memory and the bytes taken
+// Post: The bytes in use of the kind and in total are raised, and their peaks if they are passed
+void MemAdd(/*IN*/const MemUseEnum& use,		// The kind of memory taken
+			/*IN*/const long long& bytes)		// The number of bytes taken
+{
+	RaisePeak(peakArr[use], currentArr[use].fetch_add(bytes, memory_order_relaxed) + bytes);
+	RaisePeak(totalPeak, totalCurrent.fetch_add(bytes, memory_order_relaxed) + bytes);
+
+}// end MemAdd
+
+
+
+// O(1)
+// Pre: The kind of memory and the bytes given back, which were added before
+// Post: The bytes in use of the kind and in total are lowered
+void MemRelease(/*IN*/const MemUseEnum& use,		// The kind of memory given back
+				/*IN*/const long long& bytes)		// The number of bytes given back
+{
+	currentArr[use].fetch_sub(bytes, memory_order_relaxed);
+	totalCurrent.fetch_sub(bytes, memory_order_relaxed);
+
+}// end MemRelease
+
+
+
+// O(1) - Observer Accessor
+// Pre: A kind of memory counted
+// Post: The bytes added and not yet released are returned
+long long MemCurrent(/*IN*/const MemUseEnum& use)		// The kind of memory
+{
+	return currentArr[use].load(memory_order_relaxed);
+
+}// end MemCurrent
+
+
+
+// O(1) - Observer Accessor
+// Pre: A kind of memory counted
+// Post: The peak of the bytes in use is returned
+long long MemPeak(/*IN*/const MemUseEnum& use)		// The kind of memory
+{
+	return peakArr[use].load(memory_order_relaxed);
+
+}// end MemPeak
+
+
+
+// O(1) - Observer Accessor
+// Pre: N/A
+// Post: The bytes added and not yet released, of every kind, are returned
+long long MemTotalCurrent()
+{
+	return totalCurrent.load(memory_order_relaxed);
+
+}// end MemTotalCurrent
+
+
+
+// O(1) - Observer Accessor
+// Pre: N/A
+// Post: The peak of the total bytes in use is returned, never more than the kinds' peaks added up
+long long MemTotalPeak()
+{
+	return totalPeak.load(memory_order_relaxed);
+
+}// end MemTotalPeak
+
+
+
+// O(1)
+// Pre: N/A
+// Post: One line holding the total in use now and at its peak, then the peak of each kind, is printed
+void PrintMemory(/*IN/OUT*/ostream& out)		// Where the report is printed
+{
+	out << "Memory: " << MemTotalCurrent() << " bytes in use, " << MemTotalPeak() << " bytes at the peak (";
+	for (int use = ZERO; use < MEM_USE_CT; use++)
+		out << (use == ZERO ? "" : ", ") << MEM_USE_NAMES[use] << " " << MemPeak((MemUseEnum)use);
+	out << " at their peaks)" << endl;
+
+}// end PrintMemory
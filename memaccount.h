@@ -0,0 +1,117 @@
+#pragma once
+/*
+	FileName : memaccount.h
+	Author: Christian Siletti
+	Date: 5/9/24
+	Project Maze
+
+	PURPOSE:
+		Contains the memory accounting for a run. The structures that grow with the board,
+		the gameboard's cells (see gameboard.h), the path stack's items (see stack.h), the
+		path writer's ring (see pathwriter.h) and the maps worked out around the search (the
+		connectivity, distance, direction order, cost and dynamic maps, the graph engines' graphs,
+		the path statistics and the meet engine's cell arrays, walks and halves), add the bytes they
+		take from the heap when they take them and release them when they give them back. The bytes in use for each kind of
+		memory, and for all of them together, are kept along with the most there ever were,
+		so a run can say how much it needed and where, and how close it came to its budget.
+
+		The counts are atomic, so boards and stacks on any thread are counted together. They
+		are only updated when memory is taken from or given back to the heap. The path stack
+		keeps the nodes it pops for its next pushes, so the search loop only pays for a count
+		when its path grows deeper than it has been before.
+
+
+	ASSUMPTIONS:
+		1) The bytes counted are the bytes asked for, the heap's own bookkeeping is not counted
+		2) Every byte added is released with the same kind of memory
+
+
+	EXCEPTION HANDLING/ERROR CHECKING:
+		1) N/A
+
+
+						   SUMMARY OF FUNCTIONS:
+	void MemAdd(*IN*const MemUseEnum& use,		// The kind of memory taken
+				*IN*const long long& bytes)		// The number of bytes taken
+		- Count memory taken from the heap
+	void MemRelease(*IN*const MemUseEnum& use,		// The kind of memory given back
+					*IN*const long long& bytes)		// The number of bytes given back
+		- Count memory given back to the heap
+	long long MemCurrent(*IN*const MemUseEnum& use)		// The kind of memory
+		- Return the bytes of a kind of memory in use
+	long long MemPeak(*IN*const MemUseEnum& use)		// The kind of memory
+		- Return the most bytes of a kind of memory there have been in use
+	long long MemTotalCurrent() - Return the bytes of every kind of memory in use
+	long long MemTotalPeak() - Return the most bytes of every kind of memory together there have been in use
+	void PrintMemory(*IN/OUT*ostream& out)		// Where the report is printed
+		- Print the bytes in use and at the peak, all together and by kind
+*/
+
+#include "Constants.h"		// File containing appropriate constants
+#include <iostream>			// For printing the report
+
+using namespace std;    // Standard namespace
+
+
+// Enumerated type for the kinds of memory counted, the gameboard's cells, the path stack's items,
+// the buffers the paths are handed to the output file through, and the maps of the board's cells
+// built around the search
+enum MemUseEnum { MEM_BOARD, MEM_STACK, MEM_OUTPUT, MEM_MAPS, MEM_USE_CT };
+
+
+
+// O(1)
+// Purpose: Count memory taken from the heap
+// Pre: The kind of memory and the bytes taken
+// Post: The bytes in use of the kind and in total are raised, and their peaks if they are passed
+void MemAdd(/*IN*/const MemUseEnum& use,		// The kind of memory taken
+			/*IN*/const long long& bytes);		// The number of bytes taken
+
+
+
+// O(1)
+// Purpose: Count memory given back to the heap
+// Pre: The kind of memory and the bytes given back, which were added before
+// Post: The bytes in use of the kind and in total are lowered
+void MemRelease(/*IN*/const MemUseEnum& use,		// The kind of memory given back
+				/*IN*/const long long& bytes);		// The number of bytes given back
+
+
+
+// O(1) - Observer Accessor
+// Purpose: Return the bytes of a kind of memory in use
+// Pre: A kind of memory counted
+// Post: The bytes added and not yet released are returned
+long long MemCurrent(/*IN*/const MemUseEnum& use);		// The kind of memory
+
+
+
+// O(1) - Observer Accessor
+// Purpose: Return the most bytes of a kind of memory there have been in use
+// Pre: A kind of memory counted
+// Post: The peak of the bytes in use is returned
+long long MemPeak(/*IN*/const MemUseEnum& use);		// The kind of memory
+
+
+
+// O(1) - Observer Accessor
+// Purpose: Return the bytes of every kind of memory in use
+// Pre: N/A
+// Post: The bytes added and not yet released, of every kind, are returned
+long long MemTotalCurrent();
+
+
+
+// O(1) - Observer Accessor
+// Purpose: Return the most bytes of every kind of memory together there have been in use
+// Pre: N/A
+// Post: The peak of the total bytes in use is returned, never more than the kinds' peaks added up
+long long MemTotalPeak();
+
+
+
+// O(1)
+// Purpose: Print the bytes in use and at the peak, all together and by kind
+// Pre: N/A
+// Post: One line holding the total in use now and at its peak, then the peak of each kind, is printed
+void PrintMemory(/*IN/OUT*/ostream& out);		// Where the report is printed
@@ -0,0 +1,111 @@
+#pragma once
+/*
+	FileName : navigation.h
+	Author: Christian Siletti
+	Date: 4/15/24
+	Project Maze
+
+	PURPOSE:
+		Contains the functions used to step around a gameboard. They are shared by the
+		path search in the client and by anything else that needs to walk the board.
+		They are defined inline here since they sit in the innermost search loop, which lets
+		the compiler fold the direction switches away.
+
+
+	ASSUMPTIONS:
+		1) Directions are searched in the order NA -> N -> E -> S -> W -> NA
+		2) NORTH decreases the row, EAST increases the column
+
+
+						   SUMMARY OF FUNCTIONS:
+	DirectionEnum NextDir(*IN*const DirectionEnum& dir)		// The current direction
+		- Get the next direction based off a direction sent in (Order: NA -> N -> E -> S -> W -> NA)
+	Location2DRec Move(*IN*const DirectionEnum& dir,		// The desired direction to move in
+					   *IN*const Location2DRec& currPos)	// The current location
+		- Increment a Location2DRec in a single direction
+	const char* DirText(*IN*const DirectionEnum& dir)		// The direction travelled
+		- Get the text printed for a direction in a path, the letter followed by a "-"
+*/
+
+#include "Constants.h"  // File containing appropriate constants
+
+
+const int DIR_TEXT_LEN = 2;		// The length of a direction and its "-" in a printed path
+
+
+
+// O(1)
+// Purpose: Get the next direction based off a direction sent in (Order: NA -> N -> E -> S -> W -> NA)
+// Pre: The current direction
+// Post: The next direction will be returned
+inline DirectionEnum NextDir(/*IN*/const DirectionEnum& dir)		// The current direction
+{
+	// Return the appropriate direction
+	switch (dir)
+	{
+	case NA: return NORTH;
+	case NORTH: return EAST;
+	case EAST: return SOUTH;
+	case SOUTH: return WEST;
+	case WEST: return NA;
+	default: return NA;
+	};
+
+}// end NextDir
+
+
+
+// O(1)
+// Purpose: Increment a Location2DRec in a single direction
+// Pre: The desired direction and the Location2DRec being changed
+// Post: A Location2DRec will be returned with the new coordinate
+//		 If NA or another non compass direction is sent in, the new location will
+//		 be the same as the old location
+inline Location2DRec Move(/*IN*/const DirectionEnum& dir,		// The desired direction to move in
+						  /*IN*/const Location2DRec& currPos)	// The current location
+{
+	Location2DRec newPos = currPos;		// The updated location
+
+	// Increment newPos according to the specified direction
+	switch (dir)
+	{
+	case NORTH:
+		newPos.x--;
+		break;
+	case SOUTH:
+		newPos.x++;
+		break;
+	case EAST:
+		newPos.y++;
+		break;
+	case WEST:
+		newPos.y--;
+		break;
+	default:
+		break;
+	};
+
+	// Return the updated position
+	return newPos;
+
+}// end Move
+
+
+
+// O(1)
+// Purpose: Get the text printed for a direction in a path, the letter followed by a "-"
+// Pre: The direction travelled
+// Post: "N-", "E-", "S-" or "W-" is returned, an empty string for any other direction
+inline const char* DirText(/*IN*/const DirectionEnum& dir)		// The direction travelled
+{
+	// Return the appropriate text
+	switch (dir)
+	{
+	case NORTH: return "N-";
+	case EAST: return "E-";
+	case SOUTH: return "S-";
+	case WEST: return "W-";
+	default: return "";
+	};
+
+}// end DirText
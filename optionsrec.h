@@ -0,0 +1,88 @@
+#pragma once
+/*
+	FileName : optionsrec.h
+	Author: Christian Siletti
+	Date: 4/12/24
+	Project Maze
+
+	Purpose: This file contains the specification for the record holding the
+			 run options read in from the command line.
+
+	ASSUMPTIONS:
+		1) An empty string means the option was not given
+		2) A time value of zero or less means the option is disabled
+*/
+
+#include "Constants.h"  // File containing appropriate constants
+
+
+// Enumerated type for the search engine, the board search, the compiled graph search,
+// the compiled graph search with its corridors contracted, or the count of halves met in the middle
+enum EngineEnum { ENGINE_BOARD, ENGINE_GRAPH, ENGINE_CORRIDOR, ENGINE_MEET };
+
+
+// Enumerated type for how an estimate's probes pick their moves, each equally likely,
+// or in proportion to the cells reachable past them
+enum SampleEnum { SAMPLE_UNIFORM, SAMPLE_REACH };
+
+
+// Enumerated type for how the board's cells are laid out, a row at a time,
+// or in small square tiles with each tile's cells in z-order
+enum CellOrderEnum { ORDER_ROWS, ORDER_ZORDER };
+
+
+// Enumerated type for the order a cell's neighbours are searched in, always N, E, S, W,
+// nearest an exit by rows plus columns first, or fewest moves from an exit first
+enum DirOrderEnum { DIR_ORDER_FIXED, DIR_ORDER_MANHATTAN, DIR_ORDER_DISTANCE };
+
+
+// Enumerated type for the options a mode may not be run with, each given if it is not left at its default,
+// OPTION_CT is the number of them
+enum OptionEnum { OPTION_INPUT_FILE, OPTION_CHECKPOINT, OPTION_RESUME, OPTION_TIME_BUDGET, OPTION_MAX_LEN,
+				  OPTION_MIN_LEN, OPTION_ENGINE, OPTION_VIEW, OPTION_TRACE, OPTION_STATS, OPTION_NO_PATHS,
+				  OPTION_SHARD, OPTION_PATH, OPTION_TO, OPTION_FIRST, OPTION_ORDER, OPTION_ESTIMATE,
+				  OPTION_CHEAPEST, OPTION_SHORTEST, OPTION_EDITS, OPTION_SERVE, OPTION_CACHE, OPTION_MEM_MB,
+				  OPTION_CELL_ORDER, OPTION_HUGE_PAGES, OPTION_CT };
+
+
+struct OptionsRec
+{
+	string inputFile;		// The name of the input file, asked for if empty
+	string checkpointFile;	// The file the search state is saved to
+	string resumeFile;		// The checkpoint file the search is resumed from
+	int checkpointSecs;		// The number of seconds between checkpoints
+	int timeBudgetSecs;		// The number of seconds the search may run for
+	int maxLen;				// The most moves a printed path may have
+	int minLen;				// The fewest moves a printed path may have
+	EngineEnum engine;		// The search engine the paths are found with
+	int viewFps;			// The number of frames a second the live view draws, zero for no view
+	string traceFile;		// The file the search is traced to
+	string replayFile;		// The trace file replayed instead of searching
+	int replaySpeed;		// The number of trace events replayed a second, zero to jump to the end
+	int seekPath;			// The path a replay skips ahead to, zero to start at the beginning
+	string imageFile;		// The image file the last frame of a replay is saved to
+	string statsBase;		// The start of the statistics files' names, empty for no statistics
+	bool noPaths;			// Holds if the paths are counted without being printed
+	bool syncWrite;			// Holds if the paths are printed on the search's thread
+	string shardBase;		// The start of the shard and index file names, empty to print to OUTPUT_FILE
+	int shardMb;			// The size a shard is closed at, in megabytes
+	string lookupBase;		// The sharded paths looked up instead of searching
+	long long firstPath;	// The number of the first path looked up or searched for, zero for the first there is
+	long long lastPath;		// The number of the last path looked up or searched for, zero for only the first
+							// path looked up or every path searched for
+	long long estimateProbes;	// The number of probes the path count is estimated from, zero to search
+	int threads;			// The number of threads the probes, the served queries or the meet engine run on
+	SampleEnum estimateSample;	// How the probes pick their moves
+	long long estimateSeed;		// Starts the probes' random numbers
+	bool cheapest;				// Holds if the cheapest path to each exit is found instead of every path
+	bool shortest;				// Holds if a shortest path to the nearest exit is found instead of every path
+	string editsFile;			// The file of wall edits made one at a time instead of searching, empty for none
+	bool serve;					// Holds if queries are answered from the console instead of searching
+	string cacheDir;			// The directory results are read back from and saved to, empty for no cache
+	int cacheMb;				// The size the cache directory is kept under, in megabytes
+	long long memMb;			// The most memory the board and the search may take, in megabytes, zero for no budget
+	CellOrderEnum cellOrder;	// How the board's cells are laid out
+	bool hugePages;				// Holds if the board's cells are put on huge pages
+	DirOrderEnum dirOrder;		// The order each cell's neighbours are searched in
+	bool first;					// Holds if the search stops at its first path and reports how long it took
+};
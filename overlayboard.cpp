@@ -0,0 +1,456 @@
+// Project Maze
+// FileName : overlayboard.cpp
+// Author: Christian Siletti
+// Purpose : This file contains the implementation for all of the methods
+//			 defined in overlayboard.h
+
+#include "overlayboard.h"	// The header file
+#include "memaccount.h"		// For counting the bits' memory
+#include <new>				// Contains the bad_alloc exception
+
+using namespace std;	// Standard Namespace
+
+
+
+// O(1)
+// Purpose: Return the number of words a packed row of cells takes up
+// Pre: The number of columns
+// Post: The words needed for a bit per column are returned
+static int RowWordCt(/*IN*/const int& cols)		// The number of columns
+{
+	return (cols + WORD_BITS - 1) / WORD_BITS;
+
+}// end RowWordCt
+
+
+
+// O(1)
+// Purpose: Return the bit of a cell in its packed word
+// Pre: The cell's coordinate
+// Post: The mask of the cell's bit is returned
+static unsigned long long CellBit(/*IN*/const Location2DRec& loc)		// The cell's coordinate
+{
+	return 1ULL << (loc.y % WORD_BITS);
+
+}// end CellBit
+
+
+
+// =========================== WALLLAYER METHODS ==============================
+
+
+
+// O(1) - Default Constructor
+// Pre: N/A
+// Post: A zero by zero layer is created, Build must be called before it is used
+WallLayer::WallLayer()
+{
+	maxRows = ZERO;
+	maxCols = ZERO;
+	rowWords = ZERO;
+
+}// end DC
+
+
+
+// O(1) - Destructor
+// Pre: N/A
+// Post: The layer's bits and costs are counted as given back (see memaccount.h)
+WallLayer::~WallLayer()
+{
+	MemRelease(MEM_BOARD, (long long)(wallArr.size() * sizeof(unsigned long long) + costArr.size()));
+
+}// end Destructor
+
+
+
+// O(N^2)
+// Pre: The board with its walls and costs set, no overlay of the layer is being searched
+// Post: The layer holds the board's size, walls, and costs if any is not DEFAULT_CELL_COST
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+void WallLayer::Build(/*IN*/const GameBoard& board)		// The board whose walls are kept
+{
+	Location2DRec loc;		// The cell being kept
+	bool costly = false;	// Holds if a cell has a cost other than the default
+
+	// Give back what an earlier build took
+	MemRelease(MEM_BOARD, (long long)(wallArr.size() * sizeof(unsigned long long) + costArr.size()));
+	wallArr.clear();
+	costArr.clear();
+
+	board.GetSize(maxRows, maxCols);
+	rowWords = RowWordCt(maxCols);
+
+	try
+	{
+		wallArr.assign((size_t)maxRows * rowWords, 0ULL);
+
+		for (loc.x = ZERO; loc.x < maxRows; loc.x++)
+			for (loc.y = ZERO; loc.y < maxCols; loc.y++)
+			{
+				if (board.GetStatus(loc) == WALL)
+					wallArr[(size_t)loc.x * rowWords + loc.y / WORD_BITS] |= CellBit(loc);
+
+				costly = costly || board.GetCost(loc) != DEFAULT_CELL_COST;
+			}
+
+		// Only keep the costs if they are not all the default
+		if (costly)
+		{
+			costArr.resize((size_t)maxRows * maxCols);
+			for (loc.x = ZERO; loc.x < maxRows; loc.x++)
+				for (loc.y = ZERO; loc.y < maxCols; loc.y++)
+					costArr[(size_t)loc.x * maxCols + loc.y] = (unsigned char)board.GetCost(loc);
+		}
+	}
+	catch (std::bad_alloc)	// The heap space memory has run out
+	{
+		// Throw the exception
+		throw GBOutOfMemoryException();
+	}
+
+	// Count the memory taken
+	MemAdd(MEM_BOARD, (long long)(wallArr.size() * sizeof(unsigned long long) + costArr.size()));
+
+}// end Build
+
+
+
+// O(1) - Observer Predicate
+// Pre: The layer has been built
+// Post: true is returned if the cell is on the layer and a wall
+bool WallLayer::IsWall(/*IN*/const Location2DRec& loc) const		// The desired cell's coordinate
+{
+	if (loc.x < ZERO || loc.x >= maxRows || loc.y < ZERO || loc.y >= maxCols)
+		return false;
+
+	return (wallArr[(size_t)loc.x * rowWords + loc.y / WORD_BITS] & CellBit(loc)) != 0ULL;
+
+}// end IsWall
+
+
+
+// O(1) - Observer Accessor
+// Pre: The layer has been built
+// Post: The cell's cost is returned, zero if loc is outside the layer
+int WallLayer::GetCost(/*IN*/const Location2DRec& loc) const		// The desired cell's coordinate
+{
+	if (loc.x < ZERO || loc.x >= maxRows || loc.y < ZERO || loc.y >= maxCols)
+		return ZERO;
+
+	if (costArr.empty())
+		return DEFAULT_CELL_COST;
+
+	return costArr[(size_t)loc.x * maxCols + loc.y];
+
+}// end GetCost
+
+
+
+// O(1) - Observer Accessor
+// Pre: N/A
+// Post: The size of the layer will be stored into the incoming rows and columns variables
+void WallLayer::GetSize(/*OUT*/int& rows,				// The location to store the row size
+						/*OUT*/int& cols) const			// The location to store the column size
+{
+	rows = maxRows;
+	cols = maxCols;
+
+}// end GetSize
+
+
+
+// O(1) - Mutator
+// Pre: The layer has been built, no overlay of it is being searched
+// Post: The cell is a wall if isWall holds and open if not, nothing happens if loc is outside the layer
+void WallLayer::SetWall(/*IN*/const Location2DRec& loc,		// The desired cell's coordinate
+						/*IN*/const bool& isWall)			// Holds if the cell becomes a wall
+{
+	if (loc.x < ZERO || loc.x >= maxRows || loc.y < ZERO || loc.y >= maxCols)
+		return;
+
+	if (isWall)
+		wallArr[(size_t)loc.x * rowWords + loc.y / WORD_BITS] |= CellBit(loc);
+	else
+		wallArr[(size_t)loc.x * rowWords + loc.y / WORD_BITS] &= ~CellBit(loc);
+
+}// end SetWall
+
+
+
+// O(1) - Observer Accessor
+// Pre: The layer has been built
+// Post: The first word of the first row is returned, cell (x, y) is bit y % 64 of word x * rowWords + y / 64
+const unsigned long long* WallLayer::GetWallWords() const
+{
+	return wallArr.data();
+
+}// end GetWallWords
+
+
+
+// O(1) - Observer Accessor
+// Pre: N/A
+// Post: The number of words each row's bits take up is returned
+int WallLayer::GetRowWords() const
+{
+	return rowWords;
+
+}// end GetRowWords
+
+
+
+// ========================== OVERLAYBOARD METHODS =============================
+
+
+
+// O(N^2 / 64) - Non Default Constructor
+// Pre: A built wall layer
+// Post: An overlay the size of the layer is created, its walls are the layer's
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+OverlayBoard::OverlayBoard(/*IN*/const shared_ptr<const WallLayer>& walls)		// The shared walls
+	: GameBoard(ZERO, ZERO, false), walls(walls)
+{
+	int rows;	// The number of rows of the layer
+	int cols;	// The number of columns of the layer
+
+	walls->GetSize(rows, cols);
+	rowWords = walls->GetRowWords();
+
+	try
+	{
+		visitedArr.assign((size_t)rows * rowWords, 0ULL);
+	}
+	catch (std::bad_alloc)	// The heap space memory has run out
+	{
+		// Throw the exception
+		throw GBOutOfMemoryException();
+	}
+
+	// Count the memory taken
+	MemAdd(MEM_BOARD, (long long)(visitedArr.size() * sizeof(unsigned long long)));
+
+}// end NDC
+
+
+
+// O(N^2 / 64) - Copy Constructor
+// Pre: The overlay to be copied exists
+// Post: An overlay on the same walls, with the same cells VISITED, is created
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+OverlayBoard::OverlayBoard(/*IN*/const OverlayBoard& orig)		// The overlay to be copied
+	: GameBoard(ZERO, ZERO, false), walls(orig.walls), rowWords(orig.rowWords)
+{
+	try
+	{
+		visitedArr = orig.visitedArr;
+	}
+	catch (std::bad_alloc)	// The heap space memory has run out
+	{
+		// Throw the exception
+		throw GBOutOfMemoryException();
+	}
+
+	// Count the memory taken
+	MemAdd(MEM_BOARD, (long long)(visitedArr.size() * sizeof(unsigned long long)));
+
+}// end CC
+
+
+
+// O(1) - Move Constructor
+// Pre: The overlay to be moved exists
+// Post: This overlay holds orig's walls and visited cells, and orig is left with no cells
+OverlayBoard::OverlayBoard(/*IN/OUT*/OverlayBoard&& orig) noexcept		// The overlay being moved
+	: GameBoard(move(orig)), walls(move(orig.walls)), rowWords(orig.rowWords), visitedArr(move(orig.visitedArr))
+{
+	// Leave nothing behind to be counted twice
+	orig.rowWords = ZERO;
+	orig.visitedArr.clear();
+
+}// end MC
+
+
+
+// O(1) - Destructor
+// Pre: N/A
+// Post: The visited bits are counted as given back (see memaccount.h), the layer is let go of
+OverlayBoard::~OverlayBoard()
+{
+	MemRelease(MEM_BOARD, (long long)(visitedArr.size() * sizeof(unsigned long long)));
+
+}// end Destructor
+
+
+
+// O(1) - Observer Accessor
+// Pre: The coordinate of the desired cell
+// Post: WALL is returned for the layer's walls, VISITED for the cells marked, and OPEN for the rest.
+//       If loc is outside the bounds of the overlay the status OUT_OF_BOUNDS will be returned
+StateEnum OverlayBoard::GetStatus(/*IN*/const Location2DRec& loc) const		// The desired cell's coordinate
+{
+	int rows;	// The number of rows of the overlay
+	int cols;	// The number of columns of the overlay
+
+	GetSize(rows, cols);
+	if (loc.x < ZERO || loc.x >= rows || loc.y < ZERO || loc.y >= cols)
+		return OUT_OF_BOUNDS;
+
+	if (walls->IsWall(loc))
+		return WALL;
+
+	if ((visitedArr[(size_t)loc.x * rowWords + loc.y / WORD_BITS] & CellBit(loc)) != 0ULL)
+		return VISITED;
+
+	return OPEN;
+
+}// end GetStatus
+
+
+
+// O(1) - Mutator
+// Pre: The coordinate of the desired cell and its new status
+// Post: The cell is marked if the status is VISITED and unmarked if it is OPEN.
+//       Any other status, or a loc outside the overlay, changes nothing
+void OverlayBoard::SetStatus(/*IN*/const Location2DRec& loc,			// The desired cell's coordinate
+							 /*IN*/const StateEnum& newStatus)			// The cells new status
+{
+	int rows;	// The number of rows of the overlay
+	int cols;	// The number of columns of the overlay
+
+	GetSize(rows, cols);
+	if (loc.x < ZERO || loc.x >= rows || loc.y < ZERO || loc.y >= cols)
+		return;
+
+	if (newStatus == VISITED)
+		visitedArr[(size_t)loc.x * rowWords + loc.y / WORD_BITS] |= CellBit(loc);
+	else if (newStatus == OPEN)
+		visitedArr[(size_t)loc.x * rowWords + loc.y / WORD_BITS] &= ~CellBit(loc);
+
+}// end SetStatus
+
+
+
+// O(1) - Observer Accessor
+// Pre: N/A
+// Post: The size of the layer will be stored into the incoming rows and columns variables
+void OverlayBoard::GetSize(/*OUT*/int& rows,				// The location to store the row size
+						   /*OUT*/int& cols) const			// The location to store the column size
+{
+	// An overlay moved from has no cells
+	if (walls == nullptr)
+	{
+		rows = ZERO;
+		cols = ZERO;
+		return;
+	}
+
+	walls->GetSize(rows, cols);
+
+}// end GetSize
+
+
+
+// O(1) - Observer Accessor
+// Pre: The coordinate of the desired cell
+// Post: The layer's cost of the cell is returned, zero if loc is outside the overlay
+int OverlayBoard::GetCost(/*IN*/const Location2DRec& loc) const		// The desired cell's coordinate
+{
+	if (walls == nullptr)
+		return ZERO;
+
+	return walls->GetCost(loc);
+
+}// end GetCost
+
+
+
+// O(1) - Mutator
+// Pre: N/A
+// Post: Nothing changes
+void OverlayBoard::SetCost(/*IN*/const Location2DRec& /*loc*/,		// The desired cell's coordinate
+						   /*IN*/const int& /*newCost*/)			// The cells new cost
+{
+	// The costs belong to the layer every overlay of it shares
+
+}// end SetCost
+
+
+
+// O(N^2) - Overloaded Operator
+// Pre: A board the size of the overlay, with the same walls
+// Post: The cells VISITED on orig are marked and every other cell is not
+void OverlayBoard::operator =(/*IN*/const GameBoard& orig)		// The board whose visited cells are copied
+{
+	Location2DRec loc;	// The cell being copied
+	int rows;			// The number of rows of the overlay
+	int cols;			// The number of columns of the overlay
+
+	// A board copied onto itself is already a copy
+	if (this == &orig)
+		return;
+
+	Reset();
+	GetSize(rows, cols);
+	for (loc.x = ZERO; loc.x < rows; loc.x++)
+		for (loc.y = ZERO; loc.y < cols; loc.y++)
+			if (orig.GetStatus(loc) == VISITED)
+				SetStatus(loc, VISITED);
+
+}// end operator =
+
+
+
+// O(N^2) - Overloaded Operator
+// Pre: A board the size of the overlay, with the same walls
+// Post: The cells VISITED on orig are marked and every other cell is not, orig is left as it was
+void OverlayBoard::operator =(/*IN/OUT*/GameBoard&& orig)		// The board whose visited cells are copied
+{
+	// There are no cells to take, only marks to copy
+	operator=((const GameBoard&)orig);
+
+}// end operator =
+
+
+
+// O(N^2 / 64) - Overloaded Operator
+// Pre: The overlay to be copied
+// Post: This overlay is on orig's walls with the same cells VISITED
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+void OverlayBoard::operator =(/*IN*/const OverlayBoard& orig)		// The overlay to be copied
+{
+	// An overlay copied onto itself is already a copy
+	if (this == &orig)
+		return;
+
+	MemRelease(MEM_BOARD, (long long)(visitedArr.size() * sizeof(unsigned long long)));
+
+	walls = orig.walls;
+	rowWords = orig.rowWords;
+	try
+	{
+		visitedArr = orig.visitedArr;
+	}
+	catch (std::bad_alloc)	// The heap space memory has run out
+	{
+		// Throw the exception
+		visitedArr.clear();
+		throw GBOutOfMemoryException();
+	}
+
+	// Count the memory taken
+	MemAdd(MEM_BOARD, (long long)(visitedArr.size() * sizeof(unsigned long long)));
+
+}// end operator =
+
+
+
+// O(N^2 / 64) - Mutator
+// Pre: N/A
+// Post: Every cell of the overlay is back to its layer's status
+void OverlayBoard::Reset()
+{
+	for (size_t i = ZERO; i < visitedArr.size(); i++)
+		visitedArr[i] = 0ULL;
+
+}// end Reset
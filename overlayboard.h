@@ -0,0 +1,320 @@
+#pragma once
+/*
+	FileName : overlayboard.h
+	Author: Christian Siletti
+	Date: 5/10/24
+	Project Maze
+
+	PURPOSE:
+		Contains the specifications for the WallLayer and OverlayBoard Classes. A search only
+		ever changes which cells are VISITED, never where the walls are, so the walls are kept
+		once in a WallLayer that any number of searches share, and each search marks the cells
+		it visits in an OverlayBoard of its own on top of it.
+
+		The wall layer holds a bit per cell for its walls, packed rowWords words to a row, and
+		the cells' costs if any cell has a cost other than DEFAULT_CELL_COST. It is built once
+		from a gameboard and shared read-only through a shared_ptr, so it lives as long as the
+		last search using it.
+
+		An overlay is a GameBoard, so every search, map and engine that takes a gameboard runs
+		on it as it is. It holds only a bit per cell for its visited cells, so making one for a
+		search is O(N^2 / 64) instead of the O(N^2) copy of a whole gameboard, and copying one
+		shares the walls and copies only the visited bits. Reset clears the visited bits so an
+		overlay can be reused for the next search.
+
+
+	ASSUMPTIONS:
+		1) A wall layer is only changed with SetWall while no search is running on an overlay of it
+		2) An overlay's walls and costs are its layer's, setting WALL or a cost on it is ignored
+		3) Only the OPEN, VISITED and WALL statuses are stored, every cell starts OPEN
+
+
+	EXCEPTION HANDLING/ERROR CHECKING:
+		1) If an invalid location is sent into GetStatus a OUT_OF_BOUNDS status will be returned.
+		2) If an invalid location is sent into SetStatus the status of the location will not change,
+		   the program will move on.
+		3) GBOutOfMemoryException thrown when memory from the heap has run out
+
+
+						   SUMMARY OF METHODS:
+	WALLLAYER PUBLIC METHODS
+		WallLayer() - Instantiate a layer with no cells
+		~WallLayer() - Count the layer's memory as given back
+		void Build(*IN*const GameBoard& board)		// The board whose walls are kept
+					- Keep a board's walls and costs
+		bool IsWall(*IN*const Location2DRec& loc) const		// The desired cell's coordinate
+					- Check if a cell is a wall
+		int GetCost(*IN*const Location2DRec& loc) const		// The desired cell's coordinate
+					- Return the cost of moving into a cell
+		void GetSize(*OUT*int& rows,			// The location to store the row size
+					 *OUT*int& cols) const		// The location to store the column size
+					- Return the size of the layer
+		void SetWall(*IN*const Location2DRec& loc,		// The desired cell's coordinate
+					 *IN*const bool& isWall)			// Holds if the cell becomes a wall
+					- Put up or take down a wall
+		const unsigned long long* GetWallWords() const - Return the packed wall bits
+		int GetRowWords() const - Return the number of words in a packed row
+
+	WALLLAYER PRIVATE MEMBERS:
+		int maxRows;						// The number of rows
+		int maxCols;						// The number of columns
+		int rowWords;						// The number of words in a packed row
+		vector<unsigned long long> wallArr;	// The wall bits, rowWords words per row
+		vector<unsigned char> costArr;		// Each cell's cost in row major order, empty if every cost is the default
+
+	OVERLAYBOARD PUBLIC METHODS
+		OverlayBoard(*IN*const shared_ptr<const WallLayer>& walls)	// The shared walls
+					- Instantiate an overlay on a wall layer with every cell not VISITED
+		OverlayBoard(*IN*const OverlayBoard& orig)		// The overlay to be copied
+					- Share another overlay's walls and copy its visited cells
+		OverlayBoard(*IN/OUT*OverlayBoard&& orig)		// The overlay being moved
+					- Take over another overlay's walls and visited cells
+		~OverlayBoard() - Count the visited bits' memory as given back
+		virtual StateEnum GetStatus(*IN*const Location2DRec& loc) const	// The desired cell's coordinate
+					- To return the status of a specified cell
+		virtual void SetStatus(*IN*const Location2DRec& loc,		// The desired cell's coordinate
+							   *IN*const StateEnum& newStatus)		// The cells new status
+					- To mark a cell VISITED or OPEN
+		virtual void GetSize(*OUT*int& rows,			// The location to store the row size
+							 *OUT*int& cols) const		// The location to store the column size
+					- To return the size of the overlay
+		virtual int GetCost(*IN*const Location2DRec& loc) const	// The desired cell's coordinate
+					- To return the cost of moving into a specified cell
+		virtual void SetCost(*IN*const Location2DRec& loc,		// The desired cell's coordinate
+							 *IN*const int& newCost)			// The cells new cost
+					- Ignored, the costs are the layer's
+		virtual void operator =(*IN*const GameBoard& orig)		// The board whose visited cells are copied
+					- To copy the visited cells of a board of the same size
+		virtual void operator =(*IN/OUT*GameBoard&& orig)		// The board whose visited cells are copied
+					- To copy the visited cells of a board of the same size
+		void operator =(*IN*const OverlayBoard& orig)			// The overlay to be copied
+					- To share another overlay's walls and copy its visited cells
+		void Reset() - Mark every cell not VISITED
+
+	OVERLAYBOARD PRIVATE MEMBERS:
+		shared_ptr<const WallLayer> walls;		// The shared walls and costs
+		int rowWords;							// The number of words in a packed row
+		vector<unsigned long long> visitedArr;	// The visited bits, rowWords words per row
+*/
+
+#include "gameboard.h"		// Allows access to the gameboard ADT
+#include <vector>			// For the packed bits and the costs
+#include <memory>			// For sharing the wall layer
+
+using namespace std;    // Standard namespace
+
+
+
+class WallLayer
+{
+public:
+
+	// O(1) - Default Constructor
+	// Purpose: Instantiate a layer with no cells
+	// Pre: N/A
+	// Post: A zero by zero layer is created, Build must be called before it is used
+	WallLayer();
+
+
+
+	// O(1) - Destructor
+	// Purpose: Count the layer's memory as given back
+	// Pre: N/A
+	// Post: The layer's bits and costs are counted as given back (see memaccount.h)
+	~WallLayer();
+
+
+
+	// O(N^2)
+	// Purpose: Keep a board's walls and costs
+	// Pre: The board with its walls and costs set, no overlay of the layer is being searched
+	// Post: The layer holds the board's size, walls, and costs if any is not DEFAULT_CELL_COST
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	void Build(/*IN*/const GameBoard& board);		// The board whose walls are kept
+
+
+
+	// O(1) - Observer Predicate
+	// Purpose: Check if a cell is a wall
+	// Pre: The layer has been built
+	// Post: true is returned if the cell is on the layer and a wall
+	bool IsWall(/*IN*/const Location2DRec& loc) const;		// The desired cell's coordinate
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return the cost of moving into a cell
+	// Pre: The layer has been built
+	// Post: The cell's cost is returned, zero if loc is outside the layer
+	int GetCost(/*IN*/const Location2DRec& loc) const;		// The desired cell's coordinate
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return the size of the layer
+	// Pre: N/A
+	// Post: The size of the layer will be stored into the incoming rows and columns variables
+	void GetSize(/*OUT*/int& rows,				// The location to store the row size
+				 /*OUT*/int& cols) const;		// The location to store the column size
+
+
+
+	// O(1) - Mutator
+	// Purpose: Put up or take down a wall
+	// Pre: The layer has been built, no overlay of it is being searched
+	// Post: The cell is a wall if isWall holds and open if not, nothing happens if loc is outside the layer
+	void SetWall(/*IN*/const Location2DRec& loc,		// The desired cell's coordinate
+				 /*IN*/const bool& isWall);				// Holds if the cell becomes a wall
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return the packed wall bits
+	// Pre: The layer has been built
+	// Post: The first word of the first row is returned, cell (x, y) is bit y % 64 of word x * rowWords + y / 64
+	const unsigned long long* GetWallWords() const;
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return the number of words in a packed row
+	// Pre: N/A
+	// Post: The number of words each row's bits take up is returned
+	int GetRowWords() const;
+
+
+
+private:
+	int maxRows;						// The number of rows
+	int maxCols;						// The number of columns
+	int rowWords;						// The number of words in a packed row
+	vector<unsigned long long> wallArr;	// The wall bits, rowWords words per row
+	vector<unsigned char> costArr;		// Each cell's cost in row major order, empty if every cost is the default
+
+};
+
+
+
+
+class OverlayBoard : public GameBoard
+{
+public:
+
+	// O(N^2 / 64) - Non Default Constructor
+	// Purpose: Instantiate an overlay on a wall layer with every cell not VISITED
+	// Pre: A built wall layer
+	// Post: An overlay the size of the layer is created, its walls are the layer's
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	OverlayBoard(/*IN*/const shared_ptr<const WallLayer>& walls);		// The shared walls
+
+
+
+	// O(N^2 / 64) - Copy Constructor
+	// Purpose: Share another overlay's walls and copy its visited cells
+	// Pre: The overlay to be copied exists
+	// Post: An overlay on the same walls, with the same cells VISITED, is created
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	OverlayBoard(/*IN*/const OverlayBoard& orig);		// The overlay to be copied
+
+
+
+	// O(1) - Move Constructor
+	// Purpose: Take over another overlay's walls and visited cells
+	// Pre: The overlay to be moved exists
+	// Post: This overlay holds orig's walls and visited cells, and orig is left with no cells
+	OverlayBoard(/*IN/OUT*/OverlayBoard&& orig) noexcept;		// The overlay being moved
+
+
+
+	// O(1) - Destructor
+	// Purpose: Count the visited bits' memory as given back
+	// Pre: N/A
+	// Post: The visited bits are counted as given back (see memaccount.h), the layer is let go of
+	~OverlayBoard();
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: To return the status of a specified cell
+	// Pre: The coordinate of the desired cell
+	// Post: WALL is returned for the layer's walls, VISITED for the cells marked, and OPEN for the rest.
+	//       If loc is outside the bounds of the overlay the status OUT_OF_BOUNDS will be returned
+	virtual StateEnum GetStatus(/*IN*/const Location2DRec& loc) const;		// The desired cell's coordinate
+
+
+
+	// O(1) - Mutator
+	// Purpose: To mark a cell VISITED or OPEN
+	// Pre: The coordinate of the desired cell and its new status
+	// Post: The cell is marked if the status is VISITED and unmarked if it is OPEN.
+	//       Any other status, or a loc outside the overlay, changes nothing
+	virtual void SetStatus(/*IN*/const Location2DRec& loc,			// The desired cell's coordinate
+						   /*IN*/const StateEnum& newStatus);		// The cells new status
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: To return the size of the overlay
+	// Pre: N/A
+	// Post: The size of the layer will be stored into the incoming rows and columns variables
+	virtual void GetSize(/*OUT*/int& rows,				// The location to store the row size
+						 /*OUT*/int& cols) const;		// The location to store the column size
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: To return the cost of moving into a specified cell
+	// Pre: The coordinate of the desired cell
+	// Post: The layer's cost of the cell is returned, zero if loc is outside the overlay
+	virtual int GetCost(/*IN*/const Location2DRec& loc) const;		// The desired cell's coordinate
+
+
+
+	// O(1) - Mutator
+	// Purpose: Ignored, the costs are the layer's
+	// Pre: N/A
+	// Post: Nothing changes
+	virtual void SetCost(/*IN*/const Location2DRec& loc,		// The desired cell's coordinate
+						 /*IN*/const int& newCost);			// The cells new cost
+
+
+
+	// O(N^2) - Overloaded Operator
+	// Purpose: To copy the visited cells of a board of the same size
+	// Pre: A board the size of the overlay, with the same walls
+	// Post: The cells VISITED on orig are marked and every other cell is not
+	virtual void operator =(/*IN*/const GameBoard& orig);		// The board whose visited cells are copied
+
+
+
+	// O(N^2) - Overloaded Operator
+	// Purpose: To copy the visited cells of a board of the same size
+	// Pre: A board the size of the overlay, with the same walls
+	// Post: The cells VISITED on orig are marked and every other cell is not, orig is left as it was
+	virtual void operator =(/*IN/OUT*/GameBoard&& orig);		// The board whose visited cells are copied
+
+
+
+	// O(N^2 / 64) - Overloaded Operator
+	// Purpose: To share another overlay's walls and copy its visited cells
+	// Pre: The overlay to be copied
+	// Post: This overlay is on orig's walls with the same cells VISITED
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	void operator =(/*IN*/const OverlayBoard& orig);		// The overlay to be copied
+
+
+
+	// O(N^2 / 64) - Mutator
+	// Purpose: Mark every cell not VISITED
+	// Pre: N/A
+	// Post: Every cell of the overlay is back to its layer's status
+	void Reset();
+
+
+
+private:
+	shared_ptr<const WallLayer> walls;		// The shared walls and costs
+	int rowWords;							// The number of words in a packed row
+	vector<unsigned long long> visitedArr;	// The visited bits, rowWords words per row
+
+};
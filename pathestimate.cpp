@@ -0,0 +1,624 @@
+// Project Maze
+// FileName : pathestimate.cpp
+// Author: Christian Siletti
+// Purpose : This file contains the implementation for all of the methods
+//			 defined in pathestimate.h
+
+#include "pathestimate.h"	// The header file
+#include "navigation.h"		// For the search's direction order
+#include "gbExceptions.h"	// Holds the out of memory exception
+#include <thread>			// For the probing threads
+#include <chrono>			// For timing the plain search
+#include <cmath>			// For the standard error
+#include <iomanip>			// For printing the estimates
+#include <sstream>			// For formatting the estimates
+#include <new>				// Contains the bad_alloc exception
+
+const unsigned long long SEED_STEP = 0x9E3779B97F4A7C15ULL;	// Spreads the threads' seeds apart
+const double EXACT_COUNT_MAX = 1e15;	// Counts below this are printed in full
+const int SIG_DIGITS = 4;				// The significant digits of a count too big to print in full
+const double SECS_PER_MIN = 60.0;		// Seconds in a minute
+const double SECS_PER_HOUR = 3600.0;	// Seconds in an hour
+const double SECS_PER_DAY = 86400.0;	// Seconds in a day
+const double SECS_PER_YEAR = 31557600.0;	// Seconds in a year
+const double UNIT_LIMIT = 2.0;			// How many of the next unit up a time is printed in its own unit for
+
+
+
+// O(1)
+// Purpose: Check if a cell's bit is set in a bitmap
+// Pre: A bitmap and a cell on the board
+// Post: true is returned if the cell's bit is set
+static inline bool HasCell(/*IN*/const vector<unsigned long long>& bitmap,	// The bitmap being checked
+						   /*IN*/const int& cell)							// The cell being checked
+{
+	return (bitmap[cell >> WORD_SHIFT] >> (cell & BIT_MASK)) & OFFSET;
+
+}// end HasCell
+
+
+
+// O(1)
+// Purpose: Format a count, in full if it is small enough and with SIG_DIGITS digits if not
+// Pre: A count of zero or more
+// Post: The count's text is returned
+static string FormatCount(/*IN*/const double& count)	// The count being printed
+{
+	ostringstream text;		// The text being built
+
+	if (count < EXACT_COUNT_MAX)
+		text << fixed << setprecision(ZERO) << count;
+	else
+		text << setprecision(SIG_DIGITS) << count;
+
+	return text.str();
+
+}// end FormatCount
+
+
+
+// O(1)
+// Purpose: Format a number of seconds in the unit that reads best
+// Pre: A number of seconds of zero or more
+// Post: The time's text in seconds, minutes, hours, days or years is returned
+static string FormatSeconds(/*IN*/const double& secs)		// The time being printed
+{
+	ostringstream text;		// The text being built
+
+	text << setprecision(SIG_DIGITS);
+	if (secs < UNIT_LIMIT * SECS_PER_MIN)
+		text << secs << " seconds";
+	else if (secs < UNIT_LIMIT * SECS_PER_HOUR)
+		text << secs / SECS_PER_MIN << " minutes";
+	else if (secs < UNIT_LIMIT * SECS_PER_DAY)
+		text << secs / SECS_PER_HOUR << " hours";
+	else if (secs < UNIT_LIMIT * SECS_PER_YEAR)
+		text << secs / SECS_PER_DAY << " days";
+	else
+		text << secs / SECS_PER_YEAR << " years";
+
+	return text.str();
+
+}// end FormatSeconds
+
+
+
+// O(1) - Default Constructor
+// Pre: N/A
+// Post: An estimator with no cells is created, Build must be called before it is used
+PathEstimator::PathEstimator()
+{
+	maxCols = ZERO;
+	bitmapWords = ZERO;
+	startCell = ZERO;
+	minLen = ZERO;
+	maxLen = ZERO;
+	manyExits = false;
+	sample = SAMPLE_UNIFORM;
+	probeCt = ZERO;
+	exact = false;
+	nodeRate = ZERO;
+	sums.paths = ZERO;
+	sums.pathsSq = ZERO;
+	sums.nodes = ZERO;
+	sums.nodesSq = ZERO;
+
+}// end DC
+
+
+
+
+// O(N) - Mutator
+// Pre: The board with only its walls set, its layout, the options, and the distance map
+//		if a maximum length is set
+// Post: The estimator probes the tree the search would make on the board, nothing is estimated yet
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+void PathEstimator::Build(/*IN*/const GameBoard& board,			// The board being estimated
+						  /*IN*/const LayoutRec& layout,		// The entrance and exits
+						  /*IN*/const OptionsRec& opts,			// The options holding the length limits
+						  /*IN*/const DistanceMap& distMap)		// Each cell's distance from the exit
+{
+	Location2DRec loc;		// The cell being set up
+	Location2DRec nextLoc;	// The cell's neighbour
+	int rows;				// Number of rows in the board
+	int cell;				// The cell's row major index
+	DirectionEnum dir;		// The direction to the neighbour
+
+	board.GetSize(rows, maxCols);
+	bitmapWords = (rows * maxCols + WORD_BITS - OFFSET) / WORD_BITS;
+	startCell = layout.start.x * maxCols + layout.start.y;
+	minLen = opts.minLen;
+	maxLen = opts.maxLen;
+	manyExits = layout.exits.size() > OFFSET;
+
+	try
+	{
+		nextArr.assign((size_t)rows * maxCols * DIR_COUNT, NO_CELL);
+		exitArr.assign((size_t)rows * maxCols, NO_EXIT);
+		distArr.assign((size_t)rows * maxCols, NO_DISTANCE);
+		freeArr.assign(bitmapWords, ZERO);
+
+		// Link every open cell to its open neighbours, in the search's direction order
+		for (loc.x = ZERO; loc.x < rows; loc.x++)
+			for (loc.y = ZERO; loc.y < maxCols; loc.y++)
+			{
+				if (board.GetStatus(loc) != OPEN)
+					continue;
+
+				cell = loc.x * maxCols + loc.y;
+				freeArr[cell >> WORD_SHIFT] |= 1ULL << (cell & BIT_MASK);
+				if (maxLen > ZERO)
+					distArr[cell] = distMap.GetDistance(loc);
+
+				for (dir = NextDir(NA); dir != NA; dir = NextDir(dir))
+				{
+					nextLoc = Move(dir, loc);
+					if (board.GetStatus(nextLoc) == OPEN)
+						nextArr[(size_t)cell * DIR_COUNT + dir - OFFSET] = nextLoc.x * maxCols + nextLoc.y;
+				}
+			}
+	}
+	catch (std::bad_alloc)	// The heap space memory has run out
+	{
+		// Throw the exception
+		throw GBOutOfMemoryException();
+	}
+
+	// Mark the exits, walled ones are never moved into
+	for (int i = ZERO; i < (int)layout.exits.size(); i++)
+		exitArr[layout.exits[i].loc.x * maxCols + layout.exits[i].loc.y] = i;
+
+	// The entrance is on every path
+	freeArr[startCell >> WORD_SHIFT] &= ~(1ULL << (startCell & BIT_MASK));
+
+}// end Build
+
+
+
+
+// O(P * N^2 / T) for P probes on T threads
+// Pre: The estimator has been built, at least one probe and one thread
+// Post: The counts are exact if the plain search finished, otherwise they are the mean
+//		 of the probes' estimates
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+void PathEstimator::Run(/*IN*/const long long& probes,				// The number of probes
+						/*IN*/const int& threads,					// The number of threads probing
+						/*IN*/const SampleEnum& sample,				// How a probe picks its move
+						/*IN*/const unsigned long long& seed)		// Starts the random numbers
+{
+	vector<thread> threadArr;			// The probing threads
+	vector<ProbeSumsRec> threadSumsArr;	// Each thread's sums
+	vector<long long> threadProbesArr;	// The number of probes each thread makes
+
+	this->sample = sample;
+	probeCt = ZERO;
+	exact = false;
+
+	// A board small enough to search in the time it is timed for needs no estimate
+	nodeRate = TimeSearch();
+	if (exact)
+		return;
+
+	try
+	{
+		// Share the probes out, the first threads take one more if they do not divide evenly
+		threadSumsArr.resize(threads);
+		threadProbesArr.assign(threads, probes / threads);
+		for (long long i = ZERO; i < probes % threads; i++)
+			threadProbesArr[(size_t)i]++;
+
+		for (int i = ZERO; i < threads; i++)
+			threadArr.push_back(thread(&PathEstimator::ProbeLoop, this, threadProbesArr[i],
+									   seed + SEED_STEP * (unsigned long long)i, ref(threadSumsArr[i])));
+	}
+	catch (std::bad_alloc)	// The heap space memory has run out
+	{
+		// Throw the exception
+		throw GBOutOfMemoryException();
+	}
+
+	// Add up every thread's sums once it is done
+	sums.paths = ZERO;
+	sums.pathsSq = ZERO;
+	sums.nodes = ZERO;
+	sums.nodesSq = ZERO;
+	for (int i = ZERO; i < threads; i++)
+	{
+		threadArr[i].join();
+		sums.paths += threadSumsArr[i].paths;
+		sums.pathsSq += threadSumsArr[i].pathsSq;
+		sums.nodes += threadSumsArr[i].nodes;
+		sums.nodesSq += threadSumsArr[i].nodesSq;
+	}
+	probeCt = probes;
+
+}// end Run
+
+
+
+
+// O(1) - Observer Predicate
+// Pre: Run has been called
+// Post: true is returned if the counts were found by searching every partial path
+bool PathEstimator::IsExact() const
+{
+	return exact;
+
+}// end IsExact
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: Run has been called
+// Post: The estimate and its 95% confidence interval are returned
+EstimateRec PathEstimator::GetPaths() const
+{
+	return Interval(sums.paths, sums.pathsSq, OFFSET);
+
+}// end GetPaths
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: Run has been called
+// Post: The estimate and its 95% confidence interval are returned
+EstimateRec PathEstimator::GetNodes() const
+{
+	return Interval(sums.nodes, sums.nodesSq, OFFSET);
+
+}// end GetNodes
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: Run has been called
+// Post: The tree size and its interval over the plain search's speed are returned
+EstimateRec PathEstimator::GetSeconds() const
+{
+	return Interval(sums.nodes, sums.nodesSq, OFFSET / nodeRate);
+
+}// end GetSeconds
+
+
+
+
+// O(1) - Observer
+// Pre: Run has been called
+// Post: A line each for the paths, the tree size and the search time is printed to out
+void PathEstimator::Report(/*IN/OUT*/ostream& out) const		// Where the estimate is printed
+{
+	EstimateRec paths = GetPaths();		// The estimated number of paths
+	EstimateRec nodes = GetNodes();		// The estimated tree size
+	EstimateRec secs = GetSeconds();	// The estimated search time
+
+	// A finished search has nothing to be unsure of
+	if (exact)
+	{
+		out << "Counted exactly by searching the board:\n"
+			<< "Paths: " << FormatCount(paths.value) << "\n"
+			<< "Partial paths searched: " << FormatCount(nodes.value) << "\n"
+			<< "Search time: " << FormatSeconds(secs.value) << endl;
+		return;
+	}
+
+	out << "Estimated from " << probeCt << " probes"
+		<< (sample == SAMPLE_REACH ? " following the larger branches" : "") << ", with 95% confidence intervals:\n"
+		<< "Paths: " << FormatCount(paths.value)
+		<< " (" << FormatCount(paths.low) << " to " << FormatCount(paths.high) << ")\n"
+		<< "Partial paths searched: " << FormatCount(nodes.value)
+		<< " (" << FormatCount(nodes.low) << " to " << FormatCount(nodes.high) << ")\n"
+		<< "Search time: " << FormatSeconds(secs.value)
+		<< " (" << FormatSeconds(secs.low) << " to " << FormatSeconds(secs.high) << ")"
+		<< " at " << FormatCount(nodeRate) << " partial paths a second" << endl;
+
+}// end Report
+
+
+
+
+// O(N!) cut off after ESTIMATE_CALIBRATE_MS
+// Pre: The estimator has been built
+// Post: The partial paths a second the search made is returned. If it finished,
+//		 exact is set and sums holds the paths and tree size it counted
+double PathEstimator::TimeSearch()
+{
+	vector<unsigned long long> free = freeArr;	// The open cells off the path
+	vector<int> cellStack;			// The cells on the path
+	vector<int> dirStack;			// The next direction to try from each cell on the path
+	double paths = ZERO;			// The paths found
+	double nodes = OFFSET;			// The partial paths made, the entrance included
+	long long stepCt = ZERO;		// The number of steps taken since the clock was checked
+	int cell;						// The cell on top of the path
+	int next;						// The cell being moved into
+	int pathLen;					// The number of moves made
+	chrono::steady_clock::time_point startTime = chrono::steady_clock::now();	// When the search began
+	chrono::duration<double> elapsed;	// How long the search has run
+
+	// An entrance that is an exit is a path of only the exit move
+	if (exitArr[startCell] != NO_EXIT && IsFound(startCell, -OFFSET))
+		paths++;
+
+	cellStack.push_back(startCell);
+	dirStack.push_back(ZERO);
+
+	// Search the way FindPaths does until the time runs out
+	while (!cellStack.empty())
+	{
+		if (++stepCt % CLOCK_CHECK_STEPS == ZERO &&
+			chrono::steady_clock::now() - startTime >= chrono::milliseconds(ESTIMATE_CALIBRATE_MS))
+			break;
+
+		// Back track once every direction has been tried
+		cell = cellStack.back();
+		if (dirStack.back() == DIR_COUNT)
+		{
+			cellStack.pop_back();
+			dirStack.pop_back();
+			if (!cellStack.empty())
+				free[cell >> WORD_SHIFT] |= 1ULL << (cell & BIT_MASK);
+			continue;
+		}
+
+		next = nextArr[(size_t)cell * DIR_COUNT + dirStack.back()];
+		dirStack.back()++;
+		pathLen = (int)cellStack.size() - OFFSET;
+		if (next == NO_CELL || !CanMove(free, next, pathLen))
+			continue;
+
+		// Count the move and the path it finds, and go on past it
+		nodes++;
+		if (IsFound(next, pathLen))
+			paths++;
+		if (GoesOn(next))
+		{
+			free[next >> WORD_SHIFT] &= ~(1ULL << (next & BIT_MASK));
+			cellStack.push_back(next);
+			dirStack.push_back(ZERO);
+		}
+	}
+
+	elapsed = chrono::steady_clock::now() - startTime;
+
+	// Every partial path was made, so the counts are the real ones
+	if (cellStack.empty())
+	{
+		exact = true;
+		sums.paths = paths;
+		sums.pathsSq = ZERO;
+		sums.nodes = nodes;
+		sums.nodesSq = ZERO;
+	}
+
+	return nodes / max(elapsed.count(), numeric_limits<double>::min());
+
+}// end TimeSearch
+
+
+
+
+// O(P * N^2) for P probes
+// Pre: The estimator has been built
+// Post: threadSums holds the probes' estimates and their squares added up
+void PathEstimator::ProbeLoop(/*IN*/const long long& probes,				// The number of probes
+							  /*IN*/const unsigned long long& seed,		// Starts the random numbers
+							  /*OUT*/ProbeSumsRec& threadSums) const		// The probes' estimates added up
+{
+	mt19937_64 random(seed);					// The thread's own random numbers
+	vector<unsigned long long> free = freeArr;	// The thread's own copy of the free cells
+	vector<unsigned long long> reach(bitmapWords);	// The cells a flood fill has reached
+	vector<int> fill;							// The cells waiting in a flood fill
+	double paths;								// A probe's estimate of the paths
+	double nodes;								// A probe's estimate of the tree size
+
+	threadSums.paths = ZERO;
+	threadSums.pathsSq = ZERO;
+	threadSums.nodes = ZERO;
+	threadSums.nodesSq = ZERO;
+
+	for (long long i = ZERO; i < probes; i++)
+	{
+		Probe(random, free, fill, reach, paths, nodes);
+		threadSums.paths += paths;
+		threadSums.pathsSq += paths * paths;
+		threadSums.nodes += nodes;
+		threadSums.nodesSq += nodes * nodes;
+	}
+
+}// end ProbeLoop
+
+
+
+
+// O(N^2)
+// Pre: free holds the open cells off the entrance
+// Post: paths and nodes hold the probe's estimates, free is as it was
+void PathEstimator::Probe(/*IN/OUT*/mt19937_64& random,					// The random numbers
+						  /*IN/OUT*/vector<unsigned long long>& free,	// The open cells off the path
+						  /*IN/OUT*/vector<int>& fill,					// The cells waiting in a flood fill
+						  /*IN/OUT*/vector<unsigned long long>& reach,	// The cells a flood fill has reached
+						  /*OUT*/double& paths,							// The probe's estimate of the paths
+						  /*OUT*/double& nodes) const					// The probe's estimate of the tree size
+{
+	int moveArr[DIR_COUNT];			// The moves that lead further
+	double weightArr[DIR_COUNT];	// How likely each of them is to be taken, before dividing by the total
+	double totalWeight;				// The weights added up
+	double pick;					// Where the move taken falls in the weights
+	int moveCt;						// The number of moves that lead further
+	int taken;						// The move taken
+	int next;						// The cell being moved into
+	int cell = startCell;			// The cell on top of the path
+	int pathLen = ZERO;				// The number of moves made
+	double scale = OFFSET;			// One over the chance of the probe having come this way
+	vector<int> pathArr;			// The cells the probe moved into, to free them again
+
+	// The entrance is the tree's root, and may be a path of only the exit move
+	nodes = OFFSET;
+	paths = (exitArr[startCell] != NO_EXIT && IsFound(startCell, -OFFSET)) ? OFFSET : ZERO;
+
+	while (true)
+	{
+		// Every move from here is seen, the ones that lead further are kept to pick from
+		moveCt = ZERO;
+		totalWeight = ZERO;
+		for (int d = ZERO; d < DIR_COUNT; d++)
+		{
+			next = nextArr[(size_t)cell * DIR_COUNT + d];
+			if (next == NO_CELL || !CanMove(free, next, pathLen))
+				continue;
+
+			nodes += scale;
+			if (IsFound(next, pathLen))
+				paths += scale;
+
+			if (GoesOn(next))
+			{
+				moveArr[moveCt] = next;
+				weightArr[moveCt] = (sample == SAMPLE_REACH) ? ReachCount(next, free, fill, reach) + OFFSET : OFFSET;
+				totalWeight += weightArr[moveCt];
+				moveCt++;
+			}
+		}
+
+		// The probe has reached the bottom of the tree
+		if (moveCt == ZERO)
+			break;
+
+		// Take a move, the less likely it was the more its branch stands for
+		pick = uniform_real_distribution<double>(ZERO, totalWeight)(random);
+		taken = ZERO;
+		while (taken + OFFSET < moveCt && pick >= weightArr[taken])
+		{
+			pick -= weightArr[taken];
+			taken++;
+		}
+		scale *= totalWeight / weightArr[taken];
+
+		cell = moveArr[taken];
+		free[cell >> WORD_SHIFT] &= ~(1ULL << (cell & BIT_MASK));
+		pathArr.push_back(cell);
+		pathLen++;
+	}
+
+	// Free the cells the probe moved into
+	for (size_t i = ZERO; i < pathArr.size(); i++)
+		free[pathArr[i] >> WORD_SHIFT] |= 1ULL << (pathArr[i] & BIT_MASK);
+
+}// end Probe
+
+
+
+
+// O(N)
+// Pre: A cell, free or not
+// Post: The number of free cells reached is returned, a lone exit not being gone through
+int PathEstimator::ReachCount(/*IN*/const int& cell,							// The cell spread from
+							  /*IN*/const vector<unsigned long long>& free,		// The open cells off the path
+							  /*IN/OUT*/vector<int>& fill,						// The cells waiting in a flood fill
+							  /*IN/OUT*/vector<unsigned long long>& reach) const	// The cells reached
+{
+	int from;			// The cell being spread from
+	int next;			// Its neighbour
+	int count = ZERO;	// The number of cells reached
+
+	// The cell itself is on the path once it is moved into, so it is not counted
+	reach.assign(bitmapWords, ZERO);
+	reach[cell >> WORD_SHIFT] |= 1ULL << (cell & BIT_MASK);
+	fill.push_back(cell);
+	while (!fill.empty())
+	{
+		from = fill.back();
+		fill.pop_back();
+		for (int d = ZERO; d < DIR_COUNT; d++)
+		{
+			next = nextArr[(size_t)from * DIR_COUNT + d];
+			if (next == NO_CELL || !HasCell(free, next) || HasCell(reach, next))
+				continue;
+
+			reach[next >> WORD_SHIFT] |= 1ULL << (next & BIT_MASK);
+			count++;
+			if (GoesOn(next))
+				fill.push_back(next);
+		}
+	}
+
+	return count;
+
+}// end ReachCount
+
+
+
+
+// O(1) - Observer Predicate
+// Pre: A neighbour of the cell on top of the path
+// Post: true is returned if the cell is free, and if a maximum length is set its
+//		 shortest way out still fits, as FitsMaxLen checks
+bool PathEstimator::CanMove(/*IN*/const vector<unsigned long long>& free,	// The open cells off the path
+							/*IN*/const int& next,							// The cell being moved into
+							/*IN*/const int& pathLen) const					// The number of moves made before the move
+{
+	return HasCell(free, next) &&
+		   (maxLen == ZERO || (distArr[next] != NO_DISTANCE && pathLen + OFFSET + distArr[next] + OFFSET <= maxLen));
+
+}// end CanMove
+
+
+
+
+// O(1) - Observer Predicate
+// Pre: A cell the search moves into
+// Post: true is returned if the cell is an exit and the path is within the length limits,
+//		 counting the exit move
+bool PathEstimator::IsFound(/*IN*/const int& next,			// The cell being moved into
+							/*IN*/const int& pathLen) const	// The number of moves made before the move
+{
+	int len = pathLen + OFFSET + OFFSET;	// The path's moves, the exit move included
+
+	return exitArr[next] != NO_EXIT && len >= minLen && (maxLen == ZERO || len <= maxLen);
+
+}// end IsFound
+
+
+
+
+// O(1) - Observer Predicate
+// Pre: A cell the search moves into
+// Post: true is returned unless the cell is a lone exit
+bool PathEstimator::GoesOn(/*IN*/const int& next) const		// The cell moved into
+{
+	return manyExits || exitArr[next] == NO_EXIT;
+
+}// end GoesOn
+
+
+
+
+// O(1)
+// Pre: The sums of probeCt estimates and of their squares
+// Post: The mean estimate and the mean plus and minus ESTIMATE_Z standard errors are returned,
+//		 each multiplied by scale
+EstimateRec PathEstimator::Interval(/*IN*/const double& sum,			// The probes' estimates added up
+									/*IN*/const double& sumSq,			// Their squares added up
+									/*IN*/const double& scale) const	// What each estimate is multiplied by
+{
+	EstimateRec est;				// The estimate being built
+	double n = exact ? OFFSET : (double)probeCt;	// The number of estimates added up
+	double variance = ZERO;			// The spread of the estimates
+	double halfWidth;				// How far the interval reaches either side of the mean
+
+	est.value = sum / n;
+
+	// The estimates' sample variance, rounding can take it just under zero
+	if (n > OFFSET)
+		variance = max((sumSq - sum * est.value) / (n - OFFSET), (double)ZERO);
+
+	halfWidth = ESTIMATE_Z * sqrt(variance / n);
+	est.low = max(est.value - halfWidth, (double)ZERO) * scale;
+	est.high = (est.value + halfWidth) * scale;
+	est.value *= scale;
+
+	return est;
+
+}// end Interval
@@ -0,0 +1,331 @@
+#pragma once
+/*
+	FileName : pathestimate.h
+	Author: Christian Siletti
+	Date: 5/3/24
+	Project Maze
+
+	PURPOSE:
+		Contains the specifications for a PathEstimator Class. A path estimator guesses how many
+		paths a board has, how big the search's tree of partial paths is and how long the search
+		would take to go through it, for boards too big to find out by searching.
+
+		Each probe walks from the entrance down one random branch of the search's tree, the way
+		the search would go, until it can go no further (Knuth's estimator). At each partial path
+		on the way it sees every move the search could make from there, and counts the moves and
+		the paths they find, each scaled by the chance of the probe having come this way. The
+		probe then takes one of the moves that lead further, with each move equally likely, or
+		with SAMPLE_REACH in proportion to how many cells can still be reached past it so the
+		bigger branches are followed more often. Either way each probe's counts average out to
+		the real ones, and the spread of the probes gives a 95% confidence interval.
+
+		The probes are split over a number of threads, each with its own random numbers and
+		its own copy of the free cells, and their sums are added together once they are done.
+
+		The enumeration time is the estimated tree size over how many partial paths a second
+		a plain search of the board makes, measured by searching it for ESTIMATE_CALIBRATE_MS.
+		A board whose search finishes in that time is counted exactly.
+
+
+	ASSUMPTIONS:
+		1) The board passed to Build has only its walls set, and its entrance is open
+		2) The tree holds every partial path the search makes, moves into a lone exit included,
+		   and the paths are the ones it prints (see pathrank.h)
+		3) The confidence intervals take the probes' estimates as normally distributed about their
+		   mean, which a heavy tailed tree only reaches after many probes
+
+
+	EXCEPTION HANDLING/ERROR CHECKING:
+		1) Fewer than two probes give no spread, so their intervals are the estimate itself.
+		2) GBOutOfMemoryException thrown when memory from the heap has run out
+
+
+						   SUMMARY OF METHODS:
+	PUBLIC METHODS
+		PathEstimator() - Instantiate an estimator with no board
+		void Build(*IN*const GameBoard& board,			// The board being estimated
+				   *IN*const LayoutRec& layout,			// The entrance and exits
+				   *IN*const OptionsRec& opts,			// The options holding the length limits
+				   *IN*const DistanceMap& distMap)		// Each cell's distance from the exit
+					- Set up the cells, exits and length limits the probes walk
+		void Run(*IN*const long long& probes,			// The number of probes
+				 *IN*const int& threads,				// The number of threads probing
+				 *IN*const SampleEnum& sample,			// How a probe picks its move
+				 *IN*const unsigned long long& seed)	// Starts the random numbers
+					- Time a plain search of the board, then probe it if the search did not finish
+		bool IsExact() const - Check if the plain search finished, so the counts are exact
+		EstimateRec GetPaths() const - Return the estimated number of paths
+		EstimateRec GetNodes() const - Return the estimated number of partial paths the search makes
+		EstimateRec GetSeconds() const - Return the estimated number of seconds the search takes
+		void Report(*IN/OUT*ostream& out) const		// Where the estimate is printed
+					- Print the estimates and their confidence intervals
+
+
+	PRIVATE MEMBERS:
+		int maxCols;							// The number of columns in the board
+		int bitmapWords;						// The number of words in a cell bitmap
+		int startCell;							// The entrance's cell
+		int minLen;								// The fewest moves a path may have
+		int maxLen;								// The most moves a path may have, zero for no limit
+		bool manyExits;							// Holds if paths go on past an exit
+		vector<int> nextArr;					// Each cell's neighbour in each direction, or NO_CELL
+		vector<int> exitArr;					// Each cell's exit index, or NO_EXIT
+		vector<int> distArr;					// Each cell's distance to the nearest exit, or NO_DISTANCE
+		vector<unsigned long long> freeArr;		// The open cells off the entrance, one bit each
+		SampleEnum sample;						// How a probe picks its move
+		long long probeCt;						// The number of probes made
+		bool exact;								// Holds if the plain search finished
+		double nodeRate;						// The partial paths a second the plain search made
+		ProbeSumsRec sums;						// The probes' estimates added up, or the exact counts
+
+	PRIVATE METHODS:
+		double TimeSearch() - Search the board for up to ESTIMATE_CALIBRATE_MS and measure its speed
+		void ProbeLoop(*IN*const long long& probes,				// The number of probes
+					   *IN*const unsigned long long& seed,		// Starts the random numbers
+					   *OUT*ProbeSumsRec& threadSums) const		// The probes' estimates added up
+					- Make probes and add up their estimates, on a thread of its own
+		void Probe(*IN/OUT*mt19937_64& random,					// The random numbers
+				   *IN/OUT*vector<unsigned long long>& free,	// The open cells off the path
+				   *IN/OUT*vector<int>& fill,					// The cells waiting in a flood fill
+				   *IN/OUT*vector<unsigned long long>& reach,	// The cells a flood fill has reached
+				   *OUT*double& paths,							// The probe's estimate of the paths
+				   *OUT*double& nodes) const					// The probe's estimate of the tree size
+					- Walk one random branch of the tree and estimate the paths and tree size from it
+		int ReachCount(*IN*const int& cell,							// The cell spread from
+					   *IN*const vector<unsigned long long>& free,		// The open cells off the path
+					   *IN/OUT*vector<int>& fill,						// The cells waiting in a flood fill
+					   *IN/OUT*vector<unsigned long long>& reach) const	// The cells reached
+					- Count the free cells that can be reached from a cell
+		bool CanMove(*IN*const vector<unsigned long long>& free,	// The open cells off the path
+					 *IN*const int& next,							// The cell being moved into
+					 *IN*const int& pathLen) const					// The number of moves made before the move
+					- Check if the search would move into a cell
+		bool IsFound(*IN*const int& next,			// The cell being moved into
+					 *IN*const int& pathLen) const	// The number of moves made before the move
+					- Check if moving into a cell finds a path
+		bool GoesOn(*IN*const int& next) const		// The cell moved into
+					- Check if a path goes on from a cell it moved into
+		EstimateRec Interval(*IN*const double& sum,			// The probes' estimates added up
+							 *IN*const double& sumSq,		// Their squares added up
+							 *IN*const double& scale) const	// What each estimate is multiplied by
+					- Turn the sums of the probes' estimates into an estimate and its interval
+*/
+
+#include "gameboard.h"		// Allows access to the gameboard ADT
+#include "layoutrec.h"		// The entrance and exits record
+#include "optionsrec.h"		// The command line options record
+#include "distancemap.h"	// For the cells that are too far from an exit
+#include "pathrank.h"		// For NO_CELL and DIR_COUNT
+#include <vector>			// For the cells and their bitmaps
+#include <random>			// For the probes' random numbers
+#include <ostream>			// For printing the estimate
+
+using namespace std;    // Standard namespace
+
+
+const double ESTIMATE_Z = 1.96;				// Standard deviations either side of a 95% confidence interval
+const int ESTIMATE_CALIBRATE_MS = 250;		// How long the plain search is timed for
+const long long DEFAULT_ESTIMATE_SEED = 1;	// Starts the random numbers so an estimate can be repeated
+
+
+// An estimate and its 95% confidence interval
+struct EstimateRec
+{
+	double value;	// The estimate
+	double low;		// The bottom of the interval, never below zero
+	double high;	// The top of the interval
+};
+
+
+// The probes' estimates added up, to be turned into means and spreads
+struct ProbeSumsRec
+{
+	double paths;		// The estimates of the paths
+	double pathsSq;		// Their squares
+	double nodes;		// The estimates of the tree size
+	double nodesSq;		// Their squares
+};
+
+
+
+class PathEstimator
+{
+public:
+
+	// O(1) - Default Constructor
+	// Purpose: Instantiate an estimator with no board
+	// Pre: N/A
+	// Post: An estimator with no cells is created, Build must be called before it is used
+	PathEstimator();
+
+
+
+	// O(N) - Mutator
+	// Purpose: Set up the cells, exits and length limits the probes walk
+	// Pre: The board with only its walls set, its layout, the options, and the distance map
+	//		if a maximum length is set
+	// Post: The estimator probes the tree the search would make on the board, nothing is estimated yet
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	void Build(/*IN*/const GameBoard& board,			// The board being estimated
+			   /*IN*/const LayoutRec& layout,			// The entrance and exits
+			   /*IN*/const OptionsRec& opts,			// The options holding the length limits
+			   /*IN*/const DistanceMap& distMap);		// Each cell's distance from the exit
+
+
+
+	// O(P * N^2 / T) for P probes on T threads
+	// Purpose: Time a plain search of the board, then probe it if the search did not finish
+	// Pre: The estimator has been built, at least one probe and one thread
+	// Post: The counts are exact if the plain search finished, otherwise they are the mean
+	//		 of the probes' estimates
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	void Run(/*IN*/const long long& probes,				// The number of probes
+			 /*IN*/const int& threads,					// The number of threads probing
+			 /*IN*/const SampleEnum& sample,			// How a probe picks its move
+			 /*IN*/const unsigned long long& seed);		// Starts the random numbers
+
+
+
+	// O(1) - Observer Predicate
+	// Purpose: Check if the plain search finished, so the counts are exact
+	// Pre: Run has been called
+	// Post: true is returned if the counts were found by searching every partial path
+	bool IsExact() const;
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return the estimated number of paths
+	// Pre: Run has been called
+	// Post: The estimate and its 95% confidence interval are returned
+	EstimateRec GetPaths() const;
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return the estimated number of partial paths the search makes
+	// Pre: Run has been called
+	// Post: The estimate and its 95% confidence interval are returned
+	EstimateRec GetNodes() const;
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return the estimated number of seconds the search takes
+	// Pre: Run has been called
+	// Post: The tree size and its interval over the plain search's speed are returned
+	EstimateRec GetSeconds() const;
+
+
+
+	// O(1) - Observer
+	// Purpose: Print the estimates and their confidence intervals
+	// Pre: Run has been called
+	// Post: A line each for the paths, the tree size and the search time is printed to out
+	void Report(/*IN/OUT*/ostream& out) const;		// Where the estimate is printed
+
+
+
+private:
+	int maxCols;							// The number of columns in the board
+	int bitmapWords;						// The number of words in a cell bitmap
+	int startCell;							// The entrance's cell
+	int minLen;								// The fewest moves a path may have
+	int maxLen;								// The most moves a path may have, zero for no limit
+	bool manyExits;							// Holds if paths go on past an exit
+	vector<int> nextArr;					// Each cell's neighbour in each direction, or NO_CELL
+	vector<int> exitArr;					// Each cell's exit index, or NO_EXIT
+	vector<int> distArr;					// Each cell's distance to the nearest exit, or NO_DISTANCE
+	vector<unsigned long long> freeArr;		// The open cells off the entrance, one bit each
+
+	SampleEnum sample;						// How a probe picks its move
+	long long probeCt;						// The number of probes made
+	bool exact;								// Holds if the plain search finished
+	double nodeRate;						// The partial paths a second the plain search made
+	ProbeSumsRec sums;						// The probes' estimates added up, or the exact counts
+
+
+
+	// O(N!) cut off after ESTIMATE_CALIBRATE_MS
+	// Purpose: Search the board for up to ESTIMATE_CALIBRATE_MS and measure its speed
+	// Pre: The estimator has been built
+	// Post: The partial paths a second the search made is returned. If it finished,
+	//		 exact is set and sums holds the paths and tree size it counted
+	double TimeSearch();
+
+
+
+	// O(P * N^2) for P probes
+	// Purpose: Make probes and add up their estimates, on a thread of its own
+	// Pre: The estimator has been built
+	// Post: threadSums holds the probes' estimates and their squares added up
+	void ProbeLoop(/*IN*/const long long& probes,				// The number of probes
+				   /*IN*/const unsigned long long& seed,		// Starts the random numbers
+				   /*OUT*/ProbeSumsRec& threadSums) const;		// The probes' estimates added up
+
+
+
+	// O(N^2)
+	// Purpose: Walk one random branch of the tree and estimate the paths and tree size from it
+	// Pre: free holds the open cells off the entrance
+	// Post: paths and nodes hold the probe's estimates, free is as it was
+	void Probe(/*IN/OUT*/mt19937_64& random,					// The random numbers
+			   /*IN/OUT*/vector<unsigned long long>& free,		// The open cells off the path
+			   /*IN/OUT*/vector<int>& fill,						// The cells waiting in a flood fill
+			   /*IN/OUT*/vector<unsigned long long>& reach,		// The cells a flood fill has reached
+			   /*OUT*/double& paths,							// The probe's estimate of the paths
+			   /*OUT*/double& nodes) const;						// The probe's estimate of the tree size
+
+
+
+	// O(N)
+	// Purpose: Count the free cells that can be reached from a cell
+	// Pre: A cell, free or not
+	// Post: The number of free cells reached is returned, not counting the cell itself,
+	//		 a lone exit not being gone through
+	int ReachCount(/*IN*/const int& cell,							// The cell spread from
+				   /*IN*/const vector<unsigned long long>& free,	// The open cells off the path
+				   /*IN/OUT*/vector<int>& fill,						// The cells waiting in a flood fill
+				   /*IN/OUT*/vector<unsigned long long>& reach) const;	// The cells reached
+
+
+
+	// O(1) - Observer Predicate
+	// Purpose: Check if the search would move into a cell
+	// Pre: A neighbour of the cell on top of the path
+	// Post: true is returned if the cell is free, and if a maximum length is set its
+	//		 shortest way out still fits, as FitsMaxLen checks
+	bool CanMove(/*IN*/const vector<unsigned long long>& free,	// The open cells off the path
+				 /*IN*/const int& next,							// The cell being moved into
+				 /*IN*/const int& pathLen) const;				// The number of moves made before the move
+
+
+
+	// O(1) - Observer Predicate
+	// Purpose: Check if moving into a cell finds a path
+	// Pre: A cell the search moves into
+	// Post: true is returned if the cell is an exit and the path is within the length limits,
+	//		 counting the exit move
+	bool IsFound(/*IN*/const int& next,			// The cell being moved into
+				 /*IN*/const int& pathLen) const;	// The number of moves made before the move
+
+
+
+	// O(1) - Observer Predicate
+	// Purpose: Check if a path goes on from a cell it moved into
+	// Pre: A cell the search moves into
+	// Post: true is returned unless the cell is a lone exit
+	bool GoesOn(/*IN*/const int& next) const;		// The cell moved into
+
+
+
+	// O(1)
+	// Purpose: Turn the sums of the probes' estimates into an estimate and its interval
+	// Pre: The sums of probeCt estimates and of their squares
+	// Post: The mean estimate and the mean plus and minus ESTIMATE_Z standard errors are returned,
+	//		 each multiplied by scale
+	EstimateRec Interval(/*IN*/const double& sum,			// The probes' estimates added up
+						 /*IN*/const double& sumSq,			// Their squares added up
+						 /*IN*/const double& scale) const;	// What each estimate is multiplied by
+
+};
@@ -0,0 +1,415 @@
+// Project Maze
+// FileName : pathrank.cpp
+// Author: Christian Siletti
+// Purpose : This file contains the implementation for all of the methods
+//			 defined in pathrank.h
+
+#include "pathrank.h"		// The header file
+#include "navigation.h"		// For the search's direction order
+#include "gbExceptions.h"	// Holds the out of memory exception
+#include <algorithm>		// For the length the limits care about
+#include <cstring>			// For copying into a state key
+#include <new>				// Contains the bad_alloc exception
+
+
+
+// O(1)
+// Purpose: Check if a cell's bit is set in a bitmap
+// Pre: A bitmap and a cell on the board
+// Post: true is returned if the cell's bit is set
+static inline bool HasCell(/*IN*/const vector<unsigned long long>& bitmap,	// The bitmap being checked
+						   /*IN*/const int& cell)							// The cell being checked
+{
+	return (bitmap[cell >> WORD_SHIFT] >> (cell & BIT_MASK)) & OFFSET;
+
+}// end HasCell
+
+
+
+// O(1)
+// Purpose: Add two path counts, holding the sum at PATH_COUNT_MAX
+// Pre: Two counts
+// Post: Their sum is returned, PATH_COUNT_MAX if it does not fit
+static inline unsigned long long AddCounts(/*IN*/const unsigned long long& a,	// The first count
+										   /*IN*/const unsigned long long& b)	// The second count
+{
+	return (a > PATH_COUNT_MAX - b) ? PATH_COUNT_MAX : a + b;
+
+}// end AddCounts
+
+
+
+// O(1) - Default Constructor
+// Pre: N/A
+// Post: A ranker with no cells is created, Build must be called before it is used
+PathRanker::PathRanker()
+{
+	maxRows = ZERO;
+	maxCols = ZERO;
+	bitmapWords = ZERO;
+	wallHash = ZERO;
+	startCell = ZERO;
+	minLen = ZERO;
+	maxLen = ZERO;
+	manyExits = false;
+
+}// end DC
+
+
+
+
+// O(N) - Mutator
+// Pre: The board with only its walls set, its layout, the options, and the distance map
+//		if a maximum length is set
+// Post: The ranker counts the paths the search would find on the board, no counts are memoized
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+void PathRanker::Build(/*IN*/const GameBoard& board,			// The board being counted
+					   /*IN*/const LayoutRec& layout,			// The entrance and exits
+					   /*IN*/const OptionsRec& opts,			// The options holding the length limits
+					   /*IN*/const DistanceMap& distMap)		// Each cell's distance from the exit
+{
+	Location2DRec loc;		// The cell being set up
+	Location2DRec nextLoc;	// The cell's neighbour
+	int cell;				// The cell's row major index
+	DirectionEnum dir;		// The direction to the neighbour
+
+	board.GetSize(maxRows, maxCols);
+	bitmapWords = (maxRows * maxCols + WORD_BITS - OFFSET) / WORD_BITS;
+	wallHash = WallHash(board);
+	startCell = layout.start.x * maxCols + layout.start.y;
+	minLen = opts.minLen;
+	maxLen = opts.maxLen;
+	manyExits = layout.exits.size() > OFFSET;
+
+	try
+	{
+		nextArr.assign((size_t)maxRows * maxCols * DIR_COUNT, NO_CELL);
+		exitArr.assign((size_t)maxRows * maxCols, NO_EXIT);
+		distArr.assign((size_t)maxRows * maxCols, NO_DISTANCE);
+		freeArr.assign(bitmapWords, ZERO);
+		reachArr.assign(bitmapWords, ZERO);
+		fillArr.clear();
+		countMap.clear();
+
+		// Link every open cell to its open neighbours, in the search's direction order
+		for (loc.x = ZERO; loc.x < maxRows; loc.x++)
+			for (loc.y = ZERO; loc.y < maxCols; loc.y++)
+			{
+				if (board.GetStatus(loc) != OPEN)
+					continue;
+
+				cell = loc.x * maxCols + loc.y;
+				freeArr[cell >> WORD_SHIFT] |= 1ULL << (cell & BIT_MASK);
+				if (maxLen > ZERO)
+					distArr[cell] = distMap.GetDistance(loc);
+
+				for (dir = NextDir(NA); dir != NA; dir = NextDir(dir))
+				{
+					nextLoc = Move(dir, loc);
+					if (board.GetStatus(nextLoc) == OPEN)
+						nextArr[(size_t)cell * DIR_COUNT + dir - OFFSET] = nextLoc.x * maxCols + nextLoc.y;
+				}
+			}
+	}
+	catch (std::bad_alloc)	// The heap space memory has run out
+	{
+		// Throw the exception
+		throw GBOutOfMemoryException();
+	}
+
+	// Mark the exits, walled ones are never moved into
+	for (int i = ZERO; i < (int)layout.exits.size(); i++)
+		exitArr[layout.exits[i].loc.x * maxCols + layout.exits[i].loc.y] = i;
+
+	// The entrance is on every path
+	freeArr[startCell >> WORD_SHIFT] &= ~(1ULL << (startCell & BIT_MASK));
+
+}// end Build
+
+
+
+
+// O(2^N), far less where partial paths leave the same cells reachable
+// Pre: The ranker has been built
+// Post: The number of paths is returned, PATH_COUNT_MAX if there are at least that many
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+unsigned long long PathRanker::CountPaths()
+{
+	unsigned long long count = ZERO;	// The number of paths
+
+	// An entrance that is an exit is a path of only the exit move
+	if (exitArr[startCell] != NO_EXIT && IsFound(startCell, -OFFSET))
+		count++;
+
+	return AddCounts(count, CountFrom(startCell, ZERO));
+
+}// end CountPaths
+
+
+
+
+// O(N * count) - the counts are memoized, so after the first path each one is looked up
+// Pre: The ranker has been built and a path number of 2 or more
+// Post: ck holds the path up to the cell the move that finds the path is made from, the last
+//		 direction tried there, and the paths before it as the number found, as a checkpoint
+//		 taken at that point with the options' length limits would.
+//		 false is returned if there are fewer paths than pathNum
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+bool PathRanker::Unrank(/*IN*/const long long& pathNum,		// The number of the path wanted
+						/*OUT*/CheckpointRec& ck)			// The state the search starts from
+{
+	unsigned long long rank = (unsigned long long)pathNum;	// The path's place among the paths left
+	unsigned long long below;	// The number of paths a move leads on to
+	StackRec item;				// The path entry of a cell moved into
+	DirectionEnum dir = NA;		// The direction being tried
+	int cell = startCell;		// The cell on top of the path
+	int next;					// The cell being moved into
+	int pathLen = ZERO;			// The number of moves made
+	bool found = false;			// Holds if the move that finds the path has been reached
+
+	// The path starts at the entrance
+	ck.path.clear();
+	item.loc.x = startCell / maxCols;
+	item.loc.y = startCell % maxCols;
+	item.dir = NA;
+	ck.path.push_back(item);
+
+	// An entrance that is an exit is the first path
+	if (exitArr[startCell] != NO_EXIT && IsFound(startCell, -OFFSET))
+		rank--;
+
+	// Go down the directions in the search's order until the move that finds the path
+	while (!found)
+	{
+		// Every way on from here has been tried, there are not that many paths
+		dir = NextDir(dir);
+		if (dir == NA)
+			break;
+
+		next = nextArr[(size_t)cell * DIR_COUNT + dir - OFFSET];
+		if (next == NO_CELL || !CanMove(next, pathLen))
+			continue;
+
+		// The move itself finds a path
+		if (IsFound(next, pathLen))
+		{
+			found = (rank == OFFSET);
+			if (found)
+				break;
+			rank--;
+		}
+
+		if (!GoesOn(next))
+			continue;
+
+		// Count the paths past the move, go that way if the path is among them
+		freeArr[next >> WORD_SHIFT] &= ~(1ULL << (next & BIT_MASK));
+		below = CountFrom(next, pathLen + OFFSET);
+		if (rank <= below)
+		{
+			item.loc.x = next / maxCols;
+			item.loc.y = next % maxCols;
+			item.dir = dir;
+			ck.path.push_back(item);
+			cell = next;
+			pathLen++;
+			dir = NA;
+		}
+		else
+		{
+			rank -= below;
+			freeArr[next >> WORD_SHIFT] |= 1ULL << (next & BIT_MASK);
+		}
+	}
+
+	// The search goes on from the direction before the move, and every cell but the top one has been left
+	ck.rows = maxRows;
+	ck.cols = maxCols;
+	ck.wallHash = wallHash;
+	ck.dir = found ? (DirectionEnum)(dir - OFFSET) : NA;
+	ck.pathCt = pathNum - OFFSET;
+	ck.outputPos = ZERO;
+	ck.minLen = minLen;
+	ck.maxLen = maxLen;
+	ck.visited.assign(((long long)maxRows * maxCols + BITS_PER_BYTE - OFFSET) / BITS_PER_BYTE, ZERO);
+	for (size_t i = ZERO; i + OFFSET < ck.path.size(); i++)
+	{
+		next = ck.path[i].loc.x * maxCols + ck.path[i].loc.y;
+		ck.visited[next / BITS_PER_BYTE] |= (unsigned char)(OFFSET << (next % BITS_PER_BYTE));
+	}
+
+	// Free the path's cells again, the entrance is always on it
+	for (size_t i = OFFSET; i < ck.path.size(); i++)
+	{
+		next = ck.path[i].loc.x * maxCols + ck.path[i].loc.y;
+		freeArr[next >> WORD_SHIFT] |= 1ULL << (next & BIT_MASK);
+	}
+
+	return found;
+
+}// end Unrank
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: N/A
+// Post: The number of memoized counts is returned
+long long PathRanker::GetStateCount() const
+{
+	return (long long)countMap.size();
+
+}// end GetStateCount
+
+
+
+
+// O(2^N), far less where partial paths leave the same cells reachable
+// Pre: The path's cells are out of freeArr, cell is on top of it
+// Post: The number of paths found after the path's last move is returned,
+//		 freeArr is as it was
+unsigned long long PathRanker::CountFrom(/*IN*/const int& cell,			// The cell on top of the path
+										 /*IN*/const int& pathLen)		// The number of moves made
+{
+	string key;							// The state's key
+	unsigned long long count = ZERO;	// The number of paths
+	unordered_map<string, unsigned long long>::const_iterator known;	// The state's memoized count
+	int next;							// The cell being moved into
+
+	// A path that cannot reach an exit finds nothing, one counted before is looked up
+	if (!StateKey(cell, pathLen, key))
+		return ZERO;
+	known = countMap.find(key);
+	if (known != countMap.end())
+		return known->second;
+
+	// Add up the paths found by each move and the paths past it
+	for (int d = ZERO; d < DIR_COUNT; d++)
+	{
+		next = nextArr[(size_t)cell * DIR_COUNT + d];
+		if (next == NO_CELL || !CanMove(next, pathLen))
+			continue;
+
+		if (IsFound(next, pathLen))
+			count = AddCounts(count, OFFSET);
+
+		if (GoesOn(next))
+		{
+			freeArr[next >> WORD_SHIFT] &= ~(1ULL << (next & BIT_MASK));
+			count = AddCounts(count, CountFrom(next, pathLen + OFFSET));
+			freeArr[next >> WORD_SHIFT] |= 1ULL << (next & BIT_MASK);
+		}
+	}
+
+	try
+	{
+		countMap[key] = count;
+	}
+	catch (std::bad_alloc)	// The heap space memory has run out
+	{
+		// Throw the exception
+		throw GBOutOfMemoryException();
+	}
+
+	return count;
+
+}// end CountFrom
+
+
+
+
+// O(N)
+// Pre: The path's cells are out of freeArr, cell is on top of it
+// Post: key holds the cell, the part of the path's length the limits care about and every free
+//		 cell reachable from it, a lone exit not being gone through. false is returned if no
+//		 exit can be reached, as the path leads to no paths at all
+bool PathRanker::StateKey(/*IN*/const int& cell,		// The cell on top of the path
+						  /*IN*/const int& pathLen,		// The number of moves made
+						  /*OUT*/string& key)			// The state's key
+{
+	int lenKey;				// The part of the length the limits care about
+	int from;				// The cell being spread from
+	int next;				// Its neighbour
+	bool exitFound = false;	// Holds if an exit can be reached
+
+	// Spread from the cell through the free cells, a lone exit is as far as a path goes
+	fill(reachArr.begin(), reachArr.end(), ZERO);
+	fillArr.push_back(cell);
+	while (!fillArr.empty())
+	{
+		from = fillArr.back();
+		fillArr.pop_back();
+		for (int d = ZERO; d < DIR_COUNT; d++)
+		{
+			next = nextArr[(size_t)from * DIR_COUNT + d];
+			if (next == NO_CELL || !HasCell(freeArr, next) || HasCell(reachArr, next))
+				continue;
+
+			reachArr[next >> WORD_SHIFT] |= 1ULL << (next & BIT_MASK);
+			if (exitArr[next] != NO_EXIT)
+			{
+				exitFound = true;
+				if (!manyExits)
+					continue;
+			}
+			fillArr.push_back(next);
+		}
+	}
+
+	if (!exitFound)
+		return false;
+
+	// With only a minimum length, every path is long enough once the path is that long
+	lenKey = (maxLen > ZERO) ? pathLen : min(pathLen, minLen);
+
+	key.resize(sizeof(cell) + sizeof(lenKey) + (size_t)bitmapWords * sizeof(unsigned long long));
+	memcpy(&key[ZERO], &cell, sizeof(cell));
+	memcpy(&key[sizeof(cell)], &lenKey, sizeof(lenKey));
+	memcpy(&key[sizeof(cell) + sizeof(lenKey)], reachArr.data(), (size_t)bitmapWords * sizeof(unsigned long long));
+
+	return true;
+
+}// end StateKey
+
+
+
+
+// O(1) - Observer Predicate
+// Pre: A neighbour of the cell on top of the path
+// Post: true is returned if the cell is open and off the path, and if a maximum length is set
+//		 its shortest way out still fits, as FitsMaxLen checks
+bool PathRanker::CanMove(/*IN*/const int& next,			// The cell being moved into
+						 /*IN*/const int& pathLen) const	// The number of moves made before the move
+{
+	return HasCell(freeArr, next) &&
+		   (maxLen == ZERO || (distArr[next] != NO_DISTANCE && pathLen + OFFSET + distArr[next] + OFFSET <= maxLen));
+
+}// end CanMove
+
+
+
+
+// O(1) - Observer Predicate
+// Pre: A cell the search moves into
+// Post: true is returned if the cell is an exit and the path is within the length limits,
+//		 counting the exit move
+bool PathRanker::IsFound(/*IN*/const int& next,			// The cell being moved into
+						 /*IN*/const int& pathLen) const	// The number of moves made before the move
+{
+	int len = pathLen + OFFSET + OFFSET;	// The path's moves, the exit move included
+
+	return exitArr[next] != NO_EXIT && len >= minLen && (maxLen == ZERO || len <= maxLen);
+
+}// end IsFound
+
+
+
+
+// O(1) - Observer Predicate
+// Pre: A cell the search moves into
+// Post: true is returned unless the cell is a lone exit
+bool PathRanker::GoesOn(/*IN*/const int& next) const		// The cell moved into
+{
+	return manyExits || exitArr[next] == NO_EXIT;
+
+}// end GoesOn
@@ -0,0 +1,230 @@
+#pragma once
+/*
+	FileName : pathrank.h
+	Author: Christian Siletti
+	Date: 5/2/24
+	Project Maze
+
+	PURPOSE:
+		Contains the specifications for a PathRanker Class. A path ranker counts the paths the
+		search would find without finding them, and uses the counts to go straight to the Nth path
+		in the search's N, E, S, W order, so a page of paths deep in the output can be printed
+		without printing every path before it.
+
+		How many paths a partial path still leads to only depends on the cell it is on, the open
+		cells that can still be reached from there without crossing the path, and, with length
+		limits, how long it is. The counts are memoized on that key, so every partial path that
+		leaves the same cells reachable from the same cell is counted once. Partial paths that
+		cannot reach an exit at all are counted as zero without going down them.
+
+		To unrank, the ranker starts at the entrance and tries each direction in the search's
+		order. A direction whose paths all come before path N is skipped and its count taken off N,
+		otherwise the path goes that way, until the move that finds path N. The search is handed
+		the state just before that move, the same state a checkpoint holds (see checkpoint.h),
+		and carries on from there exactly as if it had found every path before it.
+
+
+	ASSUMPTIONS:
+		1) The board passed to Build has only its walls set, and its entrance is open
+		2) The paths counted are the ones the search prints: each exit reached within the length
+		   limits is a path, a lone exit is as far as a path goes, with several exits a path goes on
+		3) A count too large for an unsigned long long is held at PATH_COUNT_MAX, which is still
+		   more than any path number asked for
+
+
+	EXCEPTION HANDLING/ERROR CHECKING:
+		1) Unrank returns false if there are fewer paths than the one asked for.
+		2) GBOutOfMemoryException thrown when memory from the heap has run out
+
+
+						   SUMMARY OF METHODS:
+	PUBLIC METHODS
+		PathRanker() - Instantiate a ranker with no board
+		void Build(*IN*const GameBoard& board,			// The board being counted
+				   *IN*const LayoutRec& layout,			// The entrance and exits
+				   *IN*const OptionsRec& opts,			// The options holding the length limits
+				   *IN*const DistanceMap& distMap)		// Each cell's distance from the exit
+					- Set up the cells, exits and length limits the paths are counted on
+		unsigned long long CountPaths() - Count every path the search would find
+		bool Unrank(*IN*const long long& pathNum,		// The number of the path wanted
+					*OUT*CheckpointRec& ck)				// The state the search starts from
+					- Find the state the search is in just before it finds a path
+		long long GetStateCount() const - Return the number of partial paths whose counts are memoized
+
+
+	PRIVATE MEMBERS:
+		int maxRows;							// The number of rows in the board
+		int maxCols;							// The number of columns in the board
+		int bitmapWords;						// The number of words in a cell bitmap
+		unsigned long long wallHash;			// Hash of the board's walls
+		int startCell;							// The entrance's cell
+		int minLen;								// The fewest moves a path may have
+		int maxLen;								// The most moves a path may have, zero for no limit
+		bool manyExits;							// Holds if paths go on past an exit
+		vector<int> nextArr;					// Each cell's neighbour in each direction, or NO_CELL
+		vector<int> exitArr;					// Each cell's exit index, or NO_EXIT
+		vector<int> distArr;					// Each cell's distance to the nearest exit, or NO_DISTANCE
+		vector<unsigned long long> freeArr;		// The open cells not on the path, one bit each
+		vector<unsigned long long> reachArr;	// The free cells a flood fill has reached, one bit each
+		vector<int> fillArr;					// The cells waiting to be spread from in a flood fill
+		unordered_map<string, unsigned long long> countMap;	// The memoized counts, by state key
+
+	PRIVATE METHODS:
+		unsigned long long CountFrom(*IN*const int& cell,		// The cell on top of the path
+									 *IN*const int& pathLen)	// The number of moves made
+					- Count the paths a partial path still leads to
+		bool StateKey(*IN*const int& cell,			// The cell on top of the path
+					  *IN*const int& pathLen,		// The number of moves made
+					  *OUT*string& key)				// The state's key
+					- Build the key of a partial path from the cells it can still reach
+		bool CanMove(*IN*const int& next,			// The cell being moved into
+					 *IN*const int& pathLen) const	// The number of moves made before the move
+					- Check if the search would move into a cell
+		bool IsFound(*IN*const int& next,			// The cell being moved into
+					 *IN*const int& pathLen) const	// The number of moves made before the move
+					- Check if moving into a cell finds a path
+		bool GoesOn(*IN*const int& next) const		// The cell moved into
+					- Check if a path goes on from a cell it moved into
+*/
+
+#include "gameboard.h"		// Allows access to the gameboard ADT
+#include "layoutrec.h"		// The entrance and exits record
+#include "optionsrec.h"		// The command line options record
+#include "distancemap.h"	// For the cells that are too far from an exit
+#include "checkpoint.h"		// The state handed to the search
+#include <vector>			// For the cells and their bitmaps
+#include <string>			// For the state keys
+#include <unordered_map>	// For the memoized counts
+
+using namespace std;    // Standard namespace
+
+
+const int NO_CELL = -1;		// The neighbour of a cell on the edge of the board or next to a wall
+const int DIR_COUNT = 4;	// The number of directions a cell is left by
+const unsigned long long PATH_COUNT_MAX = 18446744073709551615ULL;	// The largest count held
+
+
+
+class PathRanker
+{
+public:
+
+	// O(1) - Default Constructor
+	// Purpose: Instantiate a ranker with no board
+	// Pre: N/A
+	// Post: A ranker with no cells is created, Build must be called before it is used
+	PathRanker();
+
+
+
+	// O(N) - Mutator
+	// Purpose: Set up the cells, exits and length limits the paths are counted on
+	// Pre: The board with only its walls set, its layout, the options, and the distance map
+	//		if a maximum length is set
+	// Post: The ranker counts the paths the search would find on the board, no counts are memoized
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	void Build(/*IN*/const GameBoard& board,			// The board being counted
+			   /*IN*/const LayoutRec& layout,			// The entrance and exits
+			   /*IN*/const OptionsRec& opts,			// The options holding the length limits
+			   /*IN*/const DistanceMap& distMap);		// Each cell's distance from the exit
+
+
+
+	// O(2^N), far less where partial paths leave the same cells reachable
+	// Purpose: Count every path the search would find
+	// Pre: The ranker has been built
+	// Post: The number of paths is returned, PATH_COUNT_MAX if there are at least that many
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	unsigned long long CountPaths();
+
+
+
+	// O(N * count) - the counts are memoized, so after the first path each one is looked up
+	// Purpose: Find the state the search is in just before it finds a path
+	// Pre: The ranker has been built and a path number of 2 or more
+	// Post: ck holds the path up to the cell the move that finds the path is made from, the last
+	//		 direction tried there, and the paths before it as the number found, as a checkpoint
+	//		 taken at that point with the options' length limits would.
+	//		 false is returned if there are fewer paths than pathNum
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	bool Unrank(/*IN*/const long long& pathNum,		// The number of the path wanted
+				/*OUT*/CheckpointRec& ck);			// The state the search starts from
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return the number of partial paths whose counts are memoized
+	// Pre: N/A
+	// Post: The number of memoized counts is returned
+	long long GetStateCount() const;
+
+
+
+private:
+	int maxRows;							// The number of rows in the board
+	int maxCols;							// The number of columns in the board
+	int bitmapWords;						// The number of words in a cell bitmap
+	unsigned long long wallHash;			// Hash of the board's walls
+	int startCell;							// The entrance's cell
+	int minLen;								// The fewest moves a path may have
+	int maxLen;								// The most moves a path may have, zero for no limit
+	bool manyExits;							// Holds if paths go on past an exit
+	vector<int> nextArr;					// Each cell's neighbour in each direction, or NO_CELL
+	vector<int> exitArr;					// Each cell's exit index, or NO_EXIT
+	vector<int> distArr;					// Each cell's distance to the nearest exit, or NO_DISTANCE
+	vector<unsigned long long> freeArr;		// The open cells not on the path, one bit each
+	vector<unsigned long long> reachArr;	// The free cells a flood fill has reached, one bit each
+	vector<int> fillArr;					// The cells waiting to be spread from in a flood fill
+	unordered_map<string, unsigned long long> countMap;	// The memoized counts, by state key
+
+
+
+	// O(2^N), far less where partial paths leave the same cells reachable
+	// Purpose: Count the paths a partial path still leads to
+	// Pre: The path's cells are out of freeArr, cell is on top of it
+	// Post: The number of paths found after the path's last move is returned,
+	//		 freeArr is as it was
+	unsigned long long CountFrom(/*IN*/const int& cell,			// The cell on top of the path
+								 /*IN*/const int& pathLen);		// The number of moves made
+
+
+
+	// O(N)
+	// Purpose: Build the key of a partial path from the cells it can still reach
+	// Pre: The path's cells are out of freeArr, cell is on top of it
+	// Post: key holds the cell, the part of the path's length the limits care about and every free
+	//		 cell reachable from it, a lone exit not being gone through. false is returned if no
+	//		 exit can be reached, as the path leads to no paths at all
+	bool StateKey(/*IN*/const int& cell,		// The cell on top of the path
+				  /*IN*/const int& pathLen,		// The number of moves made
+				  /*OUT*/string& key);			// The state's key
+
+
+
+	// O(1) - Observer Predicate
+	// Purpose: Check if the search would move into a cell
+	// Pre: A neighbour of the cell on top of the path
+	// Post: true is returned if the cell is open and off the path, and if a maximum length is set
+	//		 its shortest way out still fits, as FitsMaxLen checks
+	bool CanMove(/*IN*/const int& next,			// The cell being moved into
+				 /*IN*/const int& pathLen) const;	// The number of moves made before the move
+
+
+
+	// O(1) - Observer Predicate
+	// Purpose: Check if moving into a cell finds a path
+	// Pre: A cell the search moves into
+	// Post: true is returned if the cell is an exit and the path is within the length limits,
+	//		 counting the exit move
+	bool IsFound(/*IN*/const int& next,			// The cell being moved into
+				 /*IN*/const int& pathLen) const;	// The number of moves made before the move
+
+
+
+	// O(1) - Observer Predicate
+	// Purpose: Check if a path goes on from a cell it moved into
+	// Pre: A cell the search moves into
+	// Post: true is returned unless the cell is a lone exit
+	bool GoesOn(/*IN*/const int& next) const;		// The cell moved into
+
+};
@@ -0,0 +1,374 @@
+// Project Maze
+// FileName : pathsearch.cpp
+// Author: Christian Siletti
+// Purpose : This file contains the implementation for the functions defined in
+//			 pathsearch.h that are not templates
+
+#include "pathsearch.h"	// The header file
+#include <algorithm>		// For sorting the exits' cells
+#include <new>				// Contains the bad_alloc exception
+
+using namespace std;	// Standard Namespace
+
+
+
+// O(N)
+// Pre: The stack containing the path
+// Post: path holds the stack's entries from the bottom up
+void PathItems(/*IN*/const StackClass& pathStack,		// The stack containing the path
+			   /*OUT*/vector<StackRec>& path)			// The path, the entrance first
+{
+	StackClass copy = pathStack;	// Copy of the path that can be emptied
+
+	// The stack gives the path back top first so flip it afterwards
+	path.clear();
+	while (!copy.IsEmpty())
+	{
+		path.push_back(copy.Retrieve());
+		copy.Pop();
+	}
+	reverse(path.begin(), path.end());
+
+}// end PathItems
+
+
+
+// O(1)
+// Pre: The distance map built from the exits, the cell being moved into,
+//		the number of moves made including the move into the cell, and the maximum length
+// Post: true is returned if the path can still reach an exit in at most maxLen moves,
+//		 counting the final exit move. false is returned if it cannot reach an exit at all
+bool FitsMaxLen(/*IN*/const DistanceMap& distMap,	// Each cell's distance from the exit
+				/*IN*/const Location2DRec& loc,		// The cell being moved into
+				/*IN*/const int& pathLen,			// The number of moves made including this one
+				/*IN*/const int& maxLen)			// The maximum number of moves allowed
+{
+	int dist = distMap.GetDistance(loc);	// The fewest moves from the cell to the nearest exit
+
+	// The distance ignores the path, so it is never more than the moves really needed
+	return dist != NO_DISTANCE && pathLen + dist + OFFSET <= maxLen;
+
+}// end FitsMaxLen
+
+
+
+// O(1)
+// Pre: The number of moves in the path including the final exit move
+// Post: true is returned if the path is long enough and not too long,
+//		 a limit of zero is not checked
+bool WithinLenLimits(/*IN*/const int& pathLen,		// The number of moves in a finished path
+					 /*IN*/const OptionsRec& opts)	// The options holding the limits
+{
+	return pathLen >= opts.minLen && (opts.maxLen == ZERO || pathLen <= opts.maxLen);
+
+}// end WithinLenLimits
+
+
+
+// O(1)
+// Pre: The options the search runs with
+// Post: The checkpoint file if one was given, otherwise the file the search was resumed from,
+//		 otherwise CHECKPOINT_FILE is returned
+string BudgetFile(/*IN*/const OptionsRec& opts)	// The options the search runs with
+{
+	// Save over the checkpoint file if one was given
+	if (!opts.checkpointFile.empty())
+		return opts.checkpointFile;
+
+	// Otherwise keep saving to where the search was resumed from
+	if (!opts.resumeFile.empty())
+		return opts.resumeFile;
+
+	return CHECKPOINT_FILE;
+
+}// end BudgetFile
+
+
+
+// O(1)
+// Pre: Two exits' cells
+// Post: true is returned if the first exit's cell comes before the second's
+static bool CellBefore(/*IN*/const ExitCellRec& first,		// The exit that may come first
+					   /*IN*/const ExitCellRec& second)		// The exit it is compared to
+{
+	return first.cell < second.cell;
+
+}// end CellBefore
+
+
+
+// O(E log E) for E exits
+// Pre: The layout and the number of columns in the board
+// Post: exitCells holds each exit's cell in row major order and its index, sorted by cell
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+void SortExitCells(/*IN*/const LayoutRec& layout,				// The entrance and exits
+				   /*IN*/const int& cols,						// Number of columns in the board
+				   /*OUT*/vector<ExitCellRec>& exitCells)		// Each exit's cell and index, sorted by cell
+{
+	ExitCellRec exitCell;	// The exit being listed
+
+	try
+	{
+		exitCells.clear();
+		for (int i = ZERO; i < (int)layout.exits.size(); i++)
+		{
+			exitCell.cell = (size_t)layout.exits[i].loc.x * cols + layout.exits[i].loc.y;
+			exitCell.exit = i;
+			exitCells.push_back(exitCell);
+		}
+	}
+	catch (std::bad_alloc)	// The heap space memory has run out
+	{
+		// Throw the exception
+		throw GBOutOfMemoryException();
+	}
+
+	sort(exitCells.begin(), exitCells.end(), CellBefore);
+
+}// end SortExitCells
+
+
+
+// O(N)
+// Pre: The path a new or resumed search starts from, and the paths found before it started
+// Post: The trace, if it is open, has begun with the path, and every cell of the path
+//		 has been entered in the statistics if they are being kept
+void StartRecording(/*IN*/const vector<StackRec>& path,	// The path the search starts from, the entrance first
+					/*IN*/const long long& pathCt,			// The number of paths found before the search started
+					/*IN/OUT*/TraceWriter& trace,			// The trace of the search
+					/*IN/OUT*/PathStats& stats)				// The statistics kept on the paths
+{
+	// Trace the path as the first moves
+	if (trace.IsOpen())
+		trace.Begin(path, pathCt);
+
+	// Put each of its cells on the statistics' path
+	if (stats.IsStarted())
+		for (size_t i = ZERO; i < path.size(); i++)
+			stats.Enter(path[i].loc);
+
+}// end StartRecording
+
+
+
+// O(N)
+// Pre: The layout, the size of the board and its wall hash
+// Post: The hash of the walls and the layout together is returned. The default layout
+//		 (START_POS and one EXIT_DIR exit in the bottom right corner) leaves the hash as it is,
+//		 so checkpoints saved before a layout could be given still resume
+unsigned long long LayoutHash(/*IN*/const LayoutRec& layout,		// The entrance and exits
+							  /*IN*/const int& rows,				// Number of rows in the board
+							  /*IN*/const int& cols,				// Number of columns in the board
+							  /*IN*/unsigned long long wallHash)	// Hash of the board's walls
+{
+	unsigned long long hash = wallHash;		// The hash being built
+
+	// Leave the default layout out of the hash
+	if (layout.start.x == START_POS.x && layout.start.y == START_POS.y && layout.exits.size() == OFFSET &&
+		layout.exits[ZERO].loc.x == rows - OFFSET && layout.exits[ZERO].loc.y == cols - OFFSET &&
+		layout.exits[ZERO].dir == EXIT_DIR)
+		return hash;
+
+	// Hash the entrance, then each exit's cell and direction in order
+	hash = HashMix(hash, (long long)layout.start.x * cols + layout.start.y);
+	for (size_t i = ZERO; i < layout.exits.size(); i++)
+	{
+		hash = HashMix(hash, (long long)layout.exits[i].loc.x * cols + layout.exits[i].loc.y);
+		for (size_t j = ZERO; j < layout.exits[i].dir.length(); j++)
+			hash = HashMix(hash, layout.exits[i].dir[j]);
+	}
+
+	return hash;
+
+}// end LayoutHash
+
+
+
+// O(N^2)
+// Pre: ck holds the state of a search at the top of its loop
+// Post: The output file is flushed and the checkpoint file holds the search state,
+//		 its wall hash taking in the layout.
+//		 A warning is displayed if the file could not be written, the search goes on either way
+void WriteSearch(/*IN*/const string& fileName,		// The checkpoint file
+				 /*IN*/const LayoutRec& layout,		// The entrance and exits
+				 /*IN*/const OptionsRec& opts,		// The options the search runs with
+				 /*IN/OUT*/CheckpointRec& ck,		// The captured search state
+				 /*IN/OUT*/ofstream& fout)			// The output file writer
+{
+	// Make sure every path found so far is in the output file before marking its end
+	fout.flush();
+	ck.outputPos = (long long)fout.tellp();
+
+	// Store the limits that decided which paths were numbered, and the layout they were found on
+	ck.minLen = opts.minLen;
+	ck.maxLen = opts.maxLen;
+	ck.wallHash = LayoutHash(layout, ck.rows, ck.cols, ck.wallHash);
+
+	// Save the state
+	if (!SaveCheckpoint(fileName, ck))
+		cout << "Warning - Could not save the checkpoint to '" << fileName << "'" << endl;
+
+}// end WriteSearch
+
+
+
+// O(N^2)
+// Pre: The size and wall hash of the board being searched, and the output file
+//		opened for reading and writing
+// Post: ck holds the saved state and the output file is cut back to the paths found up until then.
+//		 false is returned if the checkpoint is unreadable, belongs to a different board or layout,
+//		 or was taken with different length limits
+bool ReadSearch(/*IN*/const string& fileName,			// The checkpoint file
+				/*IN*/const LayoutRec& layout,			// The entrance and exits
+				/*IN*/const OptionsRec& opts,			// The options the search runs with
+				/*IN*/const int& rows,					// Number of rows in the board
+				/*IN*/const int& cols,					// Number of columns in the board
+				/*IN*/unsigned long long wallHash,		// Hash of the board's walls
+				/*IN/OUT*/ofstream& fout,				// The output file writer
+				/*OUT*/CheckpointRec& ck)				// The saved state
+{
+	error_code err;		// Holds any error from resizing the output file
+
+	// Read the checkpoint and make sure it was taken on this board and layout with the same limits
+	if (!fout || !LoadCheckpoint(fileName, ck) || ck.rows != rows || ck.cols != cols ||
+		ck.wallHash != LayoutHash(layout, rows, cols, wallHash) || ck.minLen != opts.minLen || ck.maxLen != opts.maxLen)
+		return false;
+
+	// Make sure the output file still holds everything written before the checkpoint
+	fout.seekp(ZERO, ios::end);
+	if ((long long)fout.tellp() < ck.outputPos)
+		return false;
+
+	// Throw away anything written after the checkpoint
+	fout.close();
+	filesystem::resize_file(OUTPUT_FILE, (uintmax_t)ck.outputPos, err);
+	fout.open(OUTPUT_FILE, ios::in | ios::out);
+	fout.seekp(ZERO, ios::end);
+
+	return !err && fout;
+
+}// end ReadSearch
+
+
+
+// O(2^N)
+// Purpose: Copy the board into a FixedBoard of size ROWS by COLS and search it there
+// Pre: The board is ROWS by COLS with its walls set, its layout, the options, the distance map,
+//		the state to start from, the live view, the trace, the statistics and the started path writer
+// Post: The paths are printed to the output file, pathCt holds how many were printed,
+//		 and the board's cells are left as the search left the FixedBoard's
+template <int ROWS, int COLS>
+static SearchResultEnum SearchFixed(/*IN/OUT*/GameBoard& board,			// The board being searched
+									/*IN*/const LayoutRec& layout,		// The entrance and exits
+									/*IN*/const OptionsRec& opts,		// The options the search runs with
+									/*IN*/const DistanceMap& distMap,	// Each cell's distance from the exit
+									/*IN*/const CheckpointRec* start,	// The state the search starts from, NULL for the entrance
+									/*IN/OUT*/SearchView& view,			// The live view of the search
+									/*IN/OUT*/TraceWriter& trace,		// The trace of the search
+									/*IN/OUT*/PathStats& stats,			// The statistics kept on the paths
+									/*IN/OUT*/PathWriter& writer,			// The writer printing the paths
+									/*OUT*/long long& pathCt)			// The number of paths found
+{
+	FixedBoard<ROWS, COLS> fixedBoard;	// The compile time sized copy of the board
+	SearchResultEnum result;			// How the search ended
+
+	// Search a copy of the board
+	CopyBoard(board, fixedBoard);
+	result = FindPaths(fixedBoard, layout, opts, distMap, start, view, trace, stats, writer, pathCt);
+
+	// Hand back where the search left the board
+	CopyBoard(fixedBoard, board);
+
+	return result;
+
+}// end SearchFixed
+
+
+
+// O(2^N)
+// Pre: The board with its walls set, its layout, the options, the distance map if a maximum length
+//		is set, the live view, the trace, the statistics, and the started path writer
+// Post: The paths are printed to the output file and pathCt holds how many were printed.
+//		 The board is left as the search left it, the graph engine does not change it.
+//		 A resumed search goes on from its checkpoint, and with a first path wanted the search starts
+//		 just before it; if there are not that many paths none are printed and pathCt holds how many there are.
+//		 SEARCH_BAD_CHECKPOINT is returned if the checkpoint cannot be resumed on the board
+SearchResultEnum SearchBoard(/*IN/OUT*/GameBoard& board,			// The board being searched
+							 /*IN*/const LayoutRec& layout,			// The entrance and exits
+							 /*IN*/const OptionsRec& opts,			// The options the search runs with
+							 /*IN*/const DistanceMap& distMap,		// Each cell's distance from the exit
+							 /*IN/OUT*/SearchView& view,			// The live view of the search
+							 /*IN/OUT*/TraceWriter& trace,			// The trace of the search
+							 /*IN/OUT*/PathStats& stats,			// The statistics kept on the paths
+							 /*IN/OUT*/PathWriter& writer,				// The writer printing the paths
+							 /*OUT*/long long& pathCt)				// The number of paths found
+{
+	int rows;					// Number of rows in the gameboard
+	int cols;					// Number of columns in the gameboard
+	MazeGraph graph;			// The compiled board for the graph engines
+	CorridorGraph corridors;	// The compiled board with its corridors contracted
+	CheckpointRec ck;			// The state the search starts from
+	const CheckpointRec* start = NULL;	// Points to ck unless the search starts at the entrance
+	PathRanker ranker;			// Finds the state just before the first path wanted
+
+	board.GetSize(rows, cols);
+
+	// Read the checkpoint being resumed and cut the output file back to it,
+	// give up if it does not belong to this board
+	if (!opts.resumeFile.empty())
+	{
+		if (!ReadSearch(opts.resumeFile, layout, opts, rows, cols, WallHash(board), writer.Drain(), ck))
+			return SEARCH_BAD_CHECKPOINT;
+		start = &ck;
+	}
+
+	// Go straight to the first path wanted without finding the paths before it
+	else if (opts.firstPath > OFFSET)
+	{
+		ranker.Build(board, layout, opts, distMap);
+
+		// There are not that many paths, hand back how many there are
+		if (!ranker.Unrank(opts.firstPath, ck))
+		{
+			pathCt = ranker.CountPaths();
+			return SEARCH_DONE;
+		}
+		start = &ck;
+	}
+
+	// Search the compiled graph if it was picked
+	if (opts.engine == ENGINE_GRAPH)
+	{
+		graph.Build(board);
+		return FindGraphPaths(graph, layout, opts, distMap, start, view, trace, stats, writer, pathCt);
+	}
+
+	// Search junction to junction if the corridors were to be contracted
+	if (opts.engine == ENGINE_CORRIDOR)
+	{
+		graph.Build(board);
+		corridors.Build(graph, layout);
+		return FindGraphPaths(corridors, layout, opts, distMap, start, view, trace, stats, writer, pathCt);
+	}
+
+	// Use a FixedBoard for the common square sizes
+	if (rows == cols)
+	{
+		switch (rows)
+		{
+		case 5: return SearchFixed<5, 5>(board, layout, opts, distMap, start, view, trace, stats, writer, pathCt);
+		case 6: return SearchFixed<6, 6>(board, layout, opts, distMap, start, view, trace, stats, writer, pathCt);
+		case 8: return SearchFixed<8, 8>(board, layout, opts, distMap, start, view, trace, stats, writer, pathCt);
+		case 10: return SearchFixed<10, 10>(board, layout, opts, distMap, start, view, trace, stats, writer, pathCt);
+		case 16: return SearchFixed<16, 16>(board, layout, opts, distMap, start, view, trace, stats, writer, pathCt);
+		case 20: return SearchFixed<20, 20>(board, layout, opts, distMap, start, view, trace, stats, writer, pathCt);
+		case 32: return SearchFixed<32, 32>(board, layout, opts, distMap, start, view, trace, stats, writer, pathCt);
+		case 64: return SearchFixed<64, 64>(board, layout, opts, distMap, start, view, trace, stats, writer, pathCt);
+		default: break;
+		};
+	}
+
+	// Any other size runs on the GameBoard itself
+	return FindPaths(board, layout, opts, distMap, start, view, trace, stats, writer, pathCt);
+
+}// end SearchBoard
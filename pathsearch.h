@@ -0,0 +1,1160 @@
+#pragma once
+/*
+	FileName : pathsearch.h
+	Author: Christian Siletti
+	Date: 4/19/24
+	Project Maze
+
+	PURPOSE:
+		Contains the search that finds every path from the entrance to the exits of a board.
+		The search is a template on the board type, so it runs the same way on a GameBoard
+		or on a FixedBoard. For a FixedBoard the compiler sees the board's size and its
+		non virtual GetStatus/SetStatus, so the neighbour checks in the search loop are
+		inlined down to bit tests. SearchBoard picks a FixedBoard when the board has one of
+		the common square sizes (5, 6, 8, 10, 16, 20, 32 or 64), and runs on the GameBoard otherwise.
+
+		Every engine finds the paths to all of a board's exits in one pass. The board engine keeps
+		its exits' cells sorted, so reaching an exit is a binary search over the few exits rather
+		than a table as large as the board, and each graph node holds the index of the exit on it.
+		With one exit a path stops there, with several a path is printed at each exit it reaches
+		and goes on towards the others, so the paths come out as if each exit had been searched
+		for on its own, merged in the order the search reaches them.
+
+
+	ASSUMPTIONS:
+		1) An exit's own direction movement is made on its tile to exit the board
+		2) The layout's entrance and exits are on the board (see layoutrec.h), and the entrance is open
+		3) With one exit the entrance is not the exit, with several exits an entrance that is an exit
+		   is printed as a path of only the exit movement
+		4) Any board type searched offers GetSize, GetStatus and SetStatus like GameBoard
+		5) The graph engines (--engine graph or corridor) try each cell's open neighbours in the
+		   same N, E, S, W order, so every engine prints the same paths and shares checkpoints.
+		   A graph searched offers the accessors of MazeGraph, an edge may be many moves long
+		6) With --view the search hands its path to the SearchView when it checks the clock
+		   and a frame is wanted, it never waits on the console (see searchview.h)
+		7) With --trace every move made and taken back, and every path found, is traced one
+		   cell at a time (see searchtrace.h)
+		8) With --stats every cell moved into and back out of, and every path found, is counted
+		   one cell at a time (see pathstats.h). With --no-paths paths are numbered but not printed
+		9) Paths are handed to the PathWriter, which prints them on a thread of its own unless
+		   --sync-write is given (see pathwriter.h). The writer is drained before a checkpoint is saved
+		10) With --path N the search starts just before path N, from the state the PathRanker finds
+		   without searching (see pathrank.h), as if it had been resumed from a checkpoint taken there.
+		   With --to M it stops once path M is found
+		11) With --order manhattan or distance the board engine tries each cell's neighbours in the
+		   order of a DirOrder (see dirorder.h) instead of N, E, S, W. The same paths are found in
+		   another order, so it is not used with a checkpoint or --path
+
+
+	EXCEPTION HANDLING/ERROR CHECKING:
+		1) A checkpoint that cannot be resumed on the board and layout makes the search return
+		   SEARCH_BAD_CHECKPOINT without writing anything to the output file.
+		2) A checkpoint that cannot be saved displays a warning, the search goes on.
+
+
+						   SUMMARY OF FUNCTIONS:
+	SearchResultEnum SearchBoard(*IN/OUT*GameBoard& board,			// The board being searched
+								 *IN*const LayoutRec& layout,		// The entrance and exits
+								 *IN*const OptionsRec& opts,		// The options the search runs with
+								 *IN*const DistanceMap& distMap,	// Each cell's distance from the exit
+								 *IN/OUT*SearchView& view,			// The live view of the search
+								 *IN/OUT*TraceWriter& trace,		// The trace of the search
+								 *IN/OUT*PathStats& stats,			// The statistics kept on the paths
+								 *IN/OUT*PathWriter& writer,			// The writer printing the paths
+								 *OUT*long long& pathCt)			// The number of paths found
+		- Find every path, on a FixedBoard if the board's size has one, or on a MazeGraph
+		  if the graph engine was picked
+	SearchResultEnum FindGraphPaths(*IN*const GraphT& graph,			// The compiled board being searched
+									*IN*const LayoutRec& layout,		// The entrance and exits
+									*IN*const OptionsRec& opts,		// The options the search runs with
+									*IN*const DistanceMap& distMap,	// Each cell's distance from the exit
+									*IN*const CheckpointRec* start,	// The state the search starts from, NULL for the entrance
+									*IN/OUT*SearchView& view,			// The live view of the search
+									*IN/OUT*TraceWriter& trace,		// The trace of the search
+									*IN/OUT*PathStats& stats,			// The statistics kept on the paths
+									*IN/OUT*PathWriter& writer,			// The writer printing the paths
+									*OUT*long long& pathCt)			// The number of paths found
+		- Find every path from the entrance to the exits by walking a graph's edge arrays
+	int EdgeAfter(*IN*const GraphT& graph,			// The graph being searched
+				  *IN*const int& node,				// The node whose edges are searched
+				  *IN*const DirectionEnum& dir)		// The last direction tried
+		- Find the first edge out of a node that comes after a direction
+	void GraphPathItems(*IN*const GraphT& graph,				// The graph being searched
+						*IN*const vector<int>& nodeStack,		// The nodes on the current path
+						*IN*const vector<int>& edgeStack,		// The next edge to try from each node
+						*OUT*vector<StackRec>& path)			// The path, one entry per cell
+		- Expand a graph search's path into one entry per cell, the entrance first
+	void SaveGraphSearch(*IN*const string& fileName,			// The checkpoint file
+						 *IN*const LayoutRec& layout,			// The entrance and exits
+						 *IN*const OptionsRec& opts,			// The options the search runs with
+						 *IN*const GraphT& graph,				// The graph being searched
+						 *IN*unsigned long long wallHash,		// Hash of the board's walls
+						 *IN*const vector<int>& nodeStack,		// The nodes on the current path
+						 *IN*const vector<int>& edgeStack,		// The next edge to try from each node
+						 *IN*const long long& pathCt,		// The number of paths found
+						 *IN/OUT*ofstream& fout)				// The output file writer
+		- Save the state of a graph search to a checkpoint file, one path entry per cell
+	bool RestoreGraphSearch(*IN*const GraphT& graph,				// The graph being searched
+							*IN*const CheckpointRec& ck,			// The saved state
+							*OUT*vector<int>& nodeStack,			// The nodes on the path
+							*OUT*vector<int>& edgeStack,			// The next edge to try from each node
+							*IN/OUT*vector<unsigned char>& onPath,	// Holds which nodes are on the path
+							*OUT*string& pathText,					// The directions travelled
+							*OUT*int& pathLen)						// The number of moves in the path
+		- Rebuild a graph search's path from a checkpoint taken by any engine
+	SearchResultEnum FindPaths(*IN/OUT*BoardT& board,				// The board being searched
+							   *IN*const LayoutRec& layout,			// The entrance and exits
+							   *IN*const OptionsRec& opts,			// The options the search runs with
+							   *IN*const DistanceMap& distMap,		// Each cell's distance from the exit
+							   *IN*const CheckpointRec* start,		// The state the search starts from, NULL for the entrance
+							   *IN/OUT*SearchView& view,			// The live view of the search
+							   *IN/OUT*TraceWriter& trace,			// The trace of the search
+							   *IN/OUT*PathStats& stats,			// The statistics kept on the paths
+							   *IN/OUT*PathWriter& writer,				// The writer printing the paths
+							   *OUT*long long& pathCt)				// The number of paths found
+		- Find every path from the entrance to the exits and print them to the output file
+	void CopyBoard(*IN*const SrcT& src,		// The board being copied
+				   *OUT*DstT& dst)			// The board receiving the statuses
+		- Copy every cell's status from one board to another of the same size
+	void PathItems(*IN*const StackClass& pathStack,	// The stack containing the path
+				   *OUT*vector<StackRec>& path)		// The path, the entrance first
+		- Copy a path stack into an array, the entrance first
+	bool FitsMaxLen(*IN*const DistanceMap& distMap,	// Each cell's distance from the exit
+					*IN*const Location2DRec& loc,		// The cell being moved into
+					*IN*const int& pathLen,			// The number of moves made including this one
+					*IN*const int& maxLen)			// The maximum number of moves allowed
+		- Check if the shortest way out from a cell keeps a path within the maximum length
+	bool WithinLenLimits(*IN*const int& pathLen,		// The number of moves in a finished path
+						 *IN*const OptionsRec& opts)	// The options holding the limits
+		- Check if a finished path's length is within the minimum and maximum lengths
+	string BudgetFile(*IN*const OptionsRec& opts)		// The options the search runs with
+		- Get the checkpoint file written when the time budget runs out
+	void SortExitCells(*IN*const LayoutRec& layout,				// The entrance and exits
+					   *IN*const int& cols,						// Number of columns in the board
+					   *OUT*vector<ExitCellRec>& exitCells)		// Each exit's cell and index, sorted by cell
+		- List the exits' cells in order so the search can look them up
+	int FindExit(*IN*const vector<ExitCellRec>& exitCells,		// Each exit's cell and index, sorted by cell
+				 *IN*const size_t& cell)						// The cell in row major order
+		- Get the index of the exit on a cell
+	void StartRecording(*IN*const vector<StackRec>& path,	// The path the search starts from, the entrance first
+						*IN*const long long& pathCt,		// The number of paths found before the search started
+						*IN/OUT*TraceWriter& trace,			// The trace of the search
+						*IN/OUT*PathStats& stats)			// The statistics kept on the paths
+		- Start the trace and the statistics from the path the search starts from
+	unsigned long long LayoutHash(*IN*const LayoutRec& layout,		// The entrance and exits
+								  *IN*const int& rows,				// Number of rows in the board
+								  *IN*const int& cols,				// Number of columns in the board
+								  *IN*unsigned long long wallHash)	// Hash of the board's walls
+		- Mix the entrance and exits into a board's wall hash
+	void WriteSearch(*IN*const string& fileName,	// The checkpoint file
+					 *IN*const LayoutRec& layout,	// The entrance and exits
+					 *IN*const OptionsRec& opts,	// The options the search runs with
+					 *IN/OUT*CheckpointRec& ck,		// The captured search state
+					 *IN/OUT*ofstream& fout)		// The output file writer
+		- Save a captured search state along with the output file's position
+	bool ReadSearch(*IN*const string& fileName,			// The checkpoint file
+					*IN*const LayoutRec& layout,			// The entrance and exits
+					*IN*const OptionsRec& opts,			// The options the search runs with
+					*IN*const int& rows,				// Number of rows in the board
+					*IN*const int& cols,				// Number of columns in the board
+					*IN*unsigned long long wallHash,	// Hash of the board's walls
+					*IN/OUT*ofstream& fout,				// The output file writer
+					*OUT*CheckpointRec& ck)				// The saved state
+		- Read a checkpoint for a board and cut the output file back to it
+	void SaveSearch(*IN*const string& fileName,		// The checkpoint file
+					*IN*const LayoutRec& layout,		// The entrance and exits
+					*IN*const OptionsRec& opts,		// The options the search runs with
+					*IN*const StackClass& pathStack,	// The current path
+					*IN*const BoardT& board,			// The board being searched
+					*IN*const DirectionEnum& dir,		// The current direction
+					*IN*const long long& pathCt,	// The number of paths found
+					*IN/OUT*ofstream& fout)			// The output file writer
+		- Save the state of the search to a checkpoint file
+	void ResumeSearch(*IN*const CheckpointRec& ck,	// The state the search starts from
+					  *OUT*StackClass& pathStack,	// The path being rebuilt
+					  *IN/OUT*BoardT& board,		// The board being searched
+					  *OUT*DirectionEnum& dir,		// The current direction
+					  *OUT*long long& pathCt,		// The number of paths found
+					  *OUT*int& pathLen)			// The number of moves in the path
+		- Restore the state of a search from a checkpoint record
+*/
+
+#include "stack.h"			// Allows access to the stack ADT
+#include "gameboard.h"		// Allows access to the gameboard ADT
+#include "fixedboard.h"		// Allows access to the fixed size board
+#include "checkpoint.h"		// Allows the search to be saved and resumed
+#include "optionsrec.h"		// The command line options record
+#include "layoutrec.h"		// The entrance and exits record
+#include "navigation.h"		// For stepping around the gameboard
+#include "distancemap.h"	// For cutting off paths that are too long
+#include "dirorder.h"		// For the order each cell's neighbours are tried in
+#include "mazegraph.h"		// Allows access to the compiled maze graph
+#include "corridorgraph.h"	// Allows access to the contracted maze graph
+#include "searchview.h"		// For handing the path to the live view
+#include "searchtrace.h"		// For tracing the search
+#include "pathstats.h"		// For counting the paths' lengths and cells
+#include "pathwriter.h"		// For printing the paths off the search's thread
+#include "pathrank.h"		// For starting the search at a path deep in its order
+#include <iostream>			// For the checkpoint warning
+#include <fstream>			// For output file access
+#include <chrono>			// For the time budget and checkpoint timing
+#include <filesystem>		// For trimming the output file on resume
+
+using namespace std;	// Standard Namespace
+
+
+// Enumerated type for how a search ended
+enum SearchResultEnum { SEARCH_DONE, SEARCH_OUT_OF_TIME, SEARCH_BAD_CHECKPOINT };
+
+
+// An exit the board engine looks up by its cell
+struct ExitCellRec
+{
+	size_t cell;	// The exit's cell in row major order
+	int exit;		// The exit's index in the layout
+};
+
+
+
+// O(2^N)
+// Purpose: Find every path, on a FixedBoard if the board's size has one
+// Pre: The board with its walls set, its layout, the options, the distance map if a maximum length
+//		is set, the live view, the trace, the statistics, and the started path writer
+// Post: The paths are printed to the output file and pathCt holds how many were printed.
+//		 The board is left as the search left it, the graph engine does not change it.
+//		 A resumed search goes on from its checkpoint, and with a first path wanted the search starts
+//		 just before it; if there are not that many paths none are printed and pathCt holds how many there are.
+//		 SEARCH_BAD_CHECKPOINT is returned if the checkpoint cannot be resumed on the board
+SearchResultEnum SearchBoard(/*IN/OUT*/GameBoard& board,			// The board being searched
+							 /*IN*/const LayoutRec& layout,			// The entrance and exits
+							 /*IN*/const OptionsRec& opts,			// The options the search runs with
+							 /*IN*/const DistanceMap& distMap,		// Each cell's distance from the exit
+							 /*IN/OUT*/SearchView& view,			// The live view of the search
+							 /*IN/OUT*/TraceWriter& trace,			// The trace of the search
+							 /*IN/OUT*/PathStats& stats,			// The statistics kept on the paths
+							 /*IN/OUT*/PathWriter& writer,				// The writer printing the paths
+							 /*OUT*/long long& pathCt);				// The number of paths found
+
+
+
+// O(N)
+// Purpose: Copy a path stack into an array, the entrance first
+// Pre: The stack containing the path
+// Post: path holds the stack's entries from the bottom up
+void PathItems(/*IN*/const StackClass& pathStack,		// The stack containing the path
+			   /*OUT*/vector<StackRec>& path);			// The path, the entrance first
+
+
+
+// O(1)
+// Purpose: Check if the shortest way out from a cell keeps a path within the maximum length
+// Pre: The distance map built from the exits, the cell being moved into,
+//		the number of moves made including the move into the cell, and the maximum length
+// Post: true is returned if the path can still reach an exit in at most maxLen moves,
+//		 counting the final exit move. false is returned if it cannot reach an exit at all
+bool FitsMaxLen(/*IN*/const DistanceMap& distMap,	// Each cell's distance from the exit
+				/*IN*/const Location2DRec& loc,		// The cell being moved into
+				/*IN*/const int& pathLen,			// The number of moves made including this one
+				/*IN*/const int& maxLen);			// The maximum number of moves allowed
+
+
+
+// O(1)
+// Purpose: Check if a finished path's length is within the minimum and maximum lengths
+// Pre: The number of moves in the path including the final exit move
+// Post: true is returned if the path is long enough and not too long,
+//		 a limit of zero is not checked
+bool WithinLenLimits(/*IN*/const int& pathLen,		// The number of moves in a finished path
+					 /*IN*/const OptionsRec& opts);	// The options holding the limits
+
+
+
+// O(1)
+// Purpose: Get the checkpoint file written when the time budget runs out
+// Pre: The options the search runs with
+// Post: The checkpoint file if one was given, otherwise the file the search was resumed from,
+//		 otherwise CHECKPOINT_FILE is returned
+string BudgetFile(/*IN*/const OptionsRec& opts);	// The options the search runs with
+
+
+
+// O(E log E) for E exits
+// Purpose: List the exits' cells in order so the search can look them up
+// Pre: The layout and the number of columns in the board
+// Post: exitCells holds each exit's cell in row major order and its index, sorted by cell
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+void SortExitCells(/*IN*/const LayoutRec& layout,				// The entrance and exits
+				   /*IN*/const int& cols,						// Number of columns in the board
+				   /*OUT*/vector<ExitCellRec>& exitCells);		// Each exit's cell and index, sorted by cell
+
+
+
+// O(log E) for E exits
+// Purpose: Get the index of the exit on a cell
+// Pre: The exits' cells sorted by SortExitCells, and a cell in row major order
+// Post: The index of the exit on the cell is returned, or NO_EXIT if it is not an exit.
+//		 It is defined inline since it is called on every move of the search
+inline int FindExit(/*IN*/const vector<ExitCellRec>& exitCells,	// Each exit's cell and index, sorted by cell
+					/*IN*/const size_t& cell)						// The cell in row major order
+{
+	size_t low = ZERO;					// The first entry the cell may be at
+	size_t high = exitCells.size();		// One past the last entry the cell may be at
+	size_t mid;							// The entry being checked
+
+	// Halve the entries the cell may be at until one is left
+	while (low < high)
+	{
+		mid = (low + high) / 2;
+		if (exitCells[mid].cell < cell)
+			low = mid + OFFSET;
+		else
+			high = mid;
+	}
+
+	return (low < exitCells.size() && exitCells[low].cell == cell) ? exitCells[low].exit : NO_EXIT;
+
+}// end FindExit
+
+
+
+// O(N)
+// Purpose: Start the trace and the statistics from the path the search starts from
+// Pre: The path a new or resumed search starts from, and the paths found before it started
+// Post: The trace, if it is open, has begun with the path, and every cell of the path
+//		 has been entered in the statistics if they are being kept
+void StartRecording(/*IN*/const vector<StackRec>& path,	// The path the search starts from, the entrance first
+					/*IN*/const long long& pathCt,			// The number of paths found before the search started
+					/*IN/OUT*/TraceWriter& trace,			// The trace of the search
+					/*IN/OUT*/PathStats& stats);			// The statistics kept on the paths
+
+
+
+// O(N)
+// Purpose: Mix the entrance and exits into a board's wall hash
+// Pre: The layout, the size of the board and its wall hash
+// Post: The hash of the walls and the layout together is returned. The default layout
+//		 (START_POS and one EXIT_DIR exit in the bottom right corner) leaves the hash as it is,
+//		 so checkpoints saved before a layout could be given still resume
+unsigned long long LayoutHash(/*IN*/const LayoutRec& layout,		// The entrance and exits
+							  /*IN*/const int& rows,				// Number of rows in the board
+							  /*IN*/const int& cols,				// Number of columns in the board
+							  /*IN*/unsigned long long wallHash);	// Hash of the board's walls
+
+
+
+// O(N^2)
+// Purpose: Save a captured search state along with the output file's position
+// Pre: ck holds the state of a search at the top of its loop
+// Post: The output file is flushed and the checkpoint file holds the search state,
+//		 its wall hash taking in the layout.
+//		 A warning is displayed if the file could not be written, the search goes on either way
+void WriteSearch(/*IN*/const string& fileName,		// The checkpoint file
+				 /*IN*/const LayoutRec& layout,		// The entrance and exits
+				 /*IN*/const OptionsRec& opts,		// The options the search runs with
+				 /*IN/OUT*/CheckpointRec& ck,		// The captured search state
+				 /*IN/OUT*/ofstream& fout);		// The output file writer
+
+
+
+// O(N^2)
+// Purpose: Read a checkpoint for a board and cut the output file back to it
+// Pre: The size and wall hash of the board being searched, and the output file
+//		opened for reading and writing
+// Post: ck holds the saved state and the output file is cut back to the paths found up until then.
+//		 false is returned if the checkpoint is unreadable, belongs to a different board or layout,
+//		 or was taken with different length limits
+bool ReadSearch(/*IN*/const string& fileName,			// The checkpoint file
+				/*IN*/const LayoutRec& layout,			// The entrance and exits
+				/*IN*/const OptionsRec& opts,			// The options the search runs with
+				/*IN*/const int& rows,					// Number of rows in the board
+				/*IN*/const int& cols,					// Number of columns in the board
+				/*IN*/unsigned long long wallHash,		// Hash of the board's walls
+				/*IN/OUT*/ofstream& fout,				// The output file writer
+				/*OUT*/CheckpointRec& ck);				// The saved state
+
+
+
+// ============================ TEMPLATE FUNCTIONS =================================
+
+
+
+// O(N^2)
+// Purpose: Copy every cell's status from one board to another of the same size
+// Pre: Two boards of the same size
+// Post: Every cell of dst has the status of the same cell in src
+template <class SrcT, class DstT>
+void CopyBoard(/*IN*/const SrcT& src,		// The board being copied
+			   /*OUT*/DstT& dst)			// The board receiving the statuses
+{
+	Location2DRec loc;	// The cell being copied
+	int rows;			// Number of rows in the boards
+	int cols;			// Number of columns in the boards
+
+	// Copy each cells status
+	src.GetSize(rows, cols);
+	for (loc.x = ZERO; loc.x < rows; loc.x++)
+		for (loc.y = ZERO; loc.y < cols; loc.y++)
+			dst.SetStatus(loc, src.GetStatus(loc));
+
+}// end CopyBoard
+
+
+
+// O(N^2)
+// Purpose: Save the state of the search to a checkpoint file
+// Pre: The search is at the top of its loop
+// Post: The output file is flushed and the checkpoint file holds the search state.
+//		 A warning is displayed if the file could not be written, the search goes on either way
+template <class BoardT>
+void SaveSearch(/*IN*/const string& fileName,		// The checkpoint file
+				/*IN*/const LayoutRec& layout,		// The entrance and exits
+				/*IN*/const OptionsRec& opts,		// The options the search runs with
+				/*IN*/const StackClass& pathStack,	// The current path
+				/*IN*/const BoardT& board,			// The board being searched
+				/*IN*/const DirectionEnum& dir,		// The current direction
+				/*IN*/const long long& pathCt,		// The number of paths found
+				/*IN/OUT*/ofstream& fout)			// The output file writer
+{
+	CheckpointRec ck;	// The saved state
+
+	// Store the state, then save it along with the output file's position
+	CaptureCheckpoint(pathStack, board, dir, pathCt, ZERO, ck);
+	WriteSearch(fileName, layout, opts, ck, fout);
+
+}// end SaveSearch
+
+
+
+// O(N^2)
+// Purpose: Restore the state of a search from a checkpoint record
+// Pre: The state read from a checkpoint or found by the path ranker, and a board with only its walls set
+// Post: The path, board, direction and path count are back to where the state was taken
+template <class BoardT>
+void ResumeSearch(/*IN*/const CheckpointRec& ck,		// The state the search starts from
+				  /*OUT*/StackClass& pathStack,		// The path being rebuilt
+				  /*IN/OUT*/BoardT& board,			// The board being searched
+				  /*OUT*/DirectionEnum& dir,		// The current direction
+				  /*OUT*/long long& pathCt,			// The number of paths found
+				  /*OUT*/int& pathLen)				// The number of moves in the path
+{
+	// Put the search back the way it was
+	RestoreCheckpoint(ck, pathStack, board);
+	dir = ck.dir;
+	pathCt = ck.pathCt;
+	pathLen = (int)ck.path.size() - OFFSET;	// The entrance was not reached by a move
+
+}// end ResumeSearch
+
+
+
+// O(2^N)
+// Purpose: Find every path from the entrance to the exits and print them to the output file
+// Pre: The board with its walls set, its layout, the options, the distance map if a maximum
+//		length is set, the state to start from if the search does not start at the entrance,
+//		the live view, the trace, the statistics, and the started path writer
+// Post: Every path within the length limits is numbered and printed to the output file,
+//		 and pathCt holds how many were printed. The search stops after the options' last path if one is set.
+//		 SEARCH_DONE is returned if every path was found, and SEARCH_OUT_OF_TIME if the time budget
+//		 ran out and the search was saved
+template <class BoardT>
+SearchResultEnum FindPaths(/*IN/OUT*/BoardT& board,				// The board being searched
+						   /*IN*/const LayoutRec& layout,			// The entrance and exits
+						   /*IN*/const OptionsRec& opts,			// The options the search runs with
+						   /*IN*/const DistanceMap& distMap,		// Each cell's distance from the exit
+						   /*IN*/const CheckpointRec* start,		// The state the search starts from, NULL for the entrance
+						   /*IN/OUT*/SearchView& view,				// The live view of the search
+						   /*IN/OUT*/TraceWriter& trace,			// The trace of the search
+						   /*IN/OUT*/PathStats& stats,				// The statistics kept on the paths
+						   /*IN/OUT*/PathWriter& writer,				// The writer printing the paths
+						   /*OUT*/long long& pathCt)				// The number of paths found
+{
+	StackClass pathStack;		// The current maze path
+	vector<StackRec> viewPath;	// The path handed to the live view
+	vector<StackRec> startPath;	// The path the search starts from, for the trace and statistics
+	string pathText;			// The printed directions of the path, "D-" for each move
+	Location2DRec currLoc;		// The current position on the gameboard
+	StackRec currItem;			// The item to store within the pathStack
+	Location2DRec newLoc;		// The location being analyzed
+	DirectionEnum dir = NA;		// The current direction being analyzed
+	int rows;					// Number of rows in the gameboard
+	int cols;					// Number of columns in the gameboard
+	int pathLen = ZERO;			// The number of moves made in the current path
+	vector<ExitCellRec> exitCells;	// Each exit's cell in row major order and its index, sorted by cell
+	int exit;					// The exit index of the cell moved into
+	bool manyExits = layout.exits.size() > OFFSET;	// Holds if paths go on past an exit
+	bool tracing = trace.IsOpen();	// Holds if the search is being traced
+	bool counting = stats.IsStarted();	// Holds if statistics are being kept
+	bool printing = !opts.noPaths;	// Holds if the paths are printed
+	bool ordered = opts.dirOrder != DIR_ORDER_FIXED;	// Holds if each cell's neighbours are tried in an order of its own
+	DirOrder order;				// The order each cell's neighbours are tried in, only built if ordered
+	string budgetFile = BudgetFile(opts);	// The checkpoint file written when the time budget runs out
+	long long stepCt = ZERO;	// The number of search steps taken since the clock was checked
+	chrono::steady_clock::time_point startTime;		// When the search began
+	chrono::steady_clock::time_point lastCkTime;	// When the last checkpoint was saved
+	chrono::steady_clock::time_point now;			// The current time
+
+	// Get the size of the board and list where its exits are
+	board.GetSize(rows, cols);
+	SortExitCells(layout, cols, exitCells);
+	pathCt = ZERO;
+
+	// Order each cell's neighbours if they are not tried N, E, S, W
+	if (ordered)
+		order.Build(rows, cols, layout, distMap, opts.dirOrder);
+
+	// Pick up where a saved search left off, or just before the first path wanted
+	if (start != NULL)
+	{
+		// Restore the search
+		ResumeSearch(*start, pathStack, board, dir, pathCt, pathLen);
+
+		// The search continues from the top of the path
+		currLoc = pathStack.Retrieve().loc;
+
+		// The trace, statistics and printed directions start from the restored path
+		if (tracing || counting || printing)
+		{
+			PathItems(pathStack, startPath);
+			StartRecording(startPath, pathCt, trace, stats);
+		}
+		if (printing)
+			for (size_t i = OFFSET; i < startPath.size(); i++)
+				pathText.append(DirText(startPath[i].dir), DIR_TEXT_LEN);
+	}
+
+	// Start a new search
+	else
+	{
+		// Start at the entrance
+		currLoc = layout.start;
+
+		// Store the initial location and direction
+		currItem.loc = currLoc;
+		currItem.dir = dir;
+
+		// Push the first item onto the stack
+		pathStack.Push(currItem);
+
+		// The trace and statistics start from the entrance
+		if (tracing || counting)
+		{
+			PathItems(pathStack, startPath);
+			StartRecording(startPath, pathCt, trace, stats);
+		}
+
+		// An entrance that is an exit is a path of only the exit move
+		exit = FindExit(exitCells, (size_t)currLoc.x * cols + currLoc.y);
+		if (exit != NO_EXIT && WithinLenLimits(OFFSET, opts))
+		{
+			pathCt++;
+			if (printing)
+			{
+				writer.BeginPath(pathCt, exit);
+				writer.EndPath();
+			}
+			if (tracing)
+				trace.Found();
+			if (counting)
+				stats.Found(OFFSET);
+
+			// Stop once the last path wanted is found
+			if (pathCt == opts.lastPath)
+				return SEARCH_DONE;
+		}
+	}
+
+	// Start the clock
+	startTime = chrono::steady_clock::now();
+	lastCkTime = startTime;
+
+	// Repeat until the stack is empty
+	while (!pathStack.IsEmpty())
+	{
+		// Every so often check the clock, the state here is always safe to save
+		if (++stepCt % CLOCK_CHECK_STEPS == ZERO)
+		{
+			now = chrono::steady_clock::now();
+
+			// Save and stop if the time budget has run out
+			if (opts.timeBudgetSecs > ZERO && now - startTime >= chrono::seconds(opts.timeBudgetSecs))
+			{
+				SaveSearch(budgetFile, layout, opts, pathStack, board, dir, pathCt, writer.Drain());
+				return SEARCH_OUT_OF_TIME;
+			}
+
+			// Save if a checkpoint is due
+			if (!opts.checkpointFile.empty() && now - lastCkTime >= chrono::seconds(opts.checkpointSecs))
+			{
+				SaveSearch(opts.checkpointFile, layout, opts, pathStack, board, dir, pathCt, writer.Drain());
+				lastCkTime = now;
+			}
+
+			// Hand the live view the path if it is waiting on one
+			if (view.FrameWanted())
+			{
+				PathItems(pathStack, viewPath);
+				view.Publish(viewPath, pathCt);
+			}
+		}
+
+		// Get the next direction to search
+		dir = ordered ? order.Next((size_t)currLoc.x * cols + currLoc.y, dir) : NextDir(dir);
+
+		// Get the next coordinate being analyzed
+		newLoc = Move(dir, currLoc);
+
+		// See if the space is available to travel into, and if a maximum length is set
+		// that the shortest way out from it still fits
+		if (board.GetStatus(newLoc) == OPEN &&
+			(opts.maxLen == ZERO || FitsMaxLen(distMap, newLoc, pathLen + OFFSET, opts.maxLen)))
+		{
+			// Store the new items information
+			currItem.loc = newLoc;
+			currItem.dir = dir;
+
+			// Add the new item to the stack
+			pathStack.Push(currItem);
+			pathLen++;
+			if (tracing)
+				trace.Push(dir);
+			if (counting)
+				stats.Enter(newLoc);
+			if (printing)
+				pathText.append(DirText(dir), DIR_TEXT_LEN);
+
+			// Set the cell that was just entered to visited
+			board.SetStatus(currLoc, VISITED);
+
+			// Reset the direction to N/A
+			dir = NA;
+
+			// Check if the cell is an exit cell, only print paths within the length limits
+			// - the exit move counts as a move
+			exit = FindExit(exitCells, (size_t)newLoc.x * cols + newLoc.y);
+			if (exit != NO_EXIT && WithinLenLimits(pathLen + OFFSET, opts))
+			{
+				pathCt++;
+				if (printing)
+				{
+					// Hand the path to the writer - it tacks on the exit direction as the final movement
+					writer.BeginPath(pathCt, exit);
+					writer.AddText(pathText.data(), pathText.length());
+					writer.EndPath();
+				}
+				if (tracing)
+					trace.Found();
+				if (counting)
+					stats.Found(pathLen + OFFSET);
+
+				// Stop once the last path wanted is found
+				if (pathCt == opts.lastPath)
+					return SEARCH_DONE;
+			}
+
+			// A lone exit is as far as a path goes, with several exits the path goes on to the others
+			if (exit != NO_EXIT && !manyExits)
+			{
+				// Get the direction of the most recent added item
+				dir = pathStack.Retrieve().dir;		// The search will continue from this direction
+
+				// Get rid of the item
+				pathStack.Pop();
+				pathLen--;
+				if (tracing)
+					trace.Pop();
+				if (counting)
+					stats.Leave();
+				if (printing)
+					pathText.resize(pathText.length() - DIR_TEXT_LEN);
+
+				// Set the status of the removed cell to open, its no longer appart of the path
+				board.SetStatus(currLoc, OPEN);
+			}
+
+			else
+				currLoc = newLoc;	// Go to the next location
+
+		}// end if space is open
+
+		// West (or the last direction of the cell's order) indicates that a cells direction search has
+		// been exhausted so the path must back track until a new direction can be explored
+		while (ordered ? order.IsLast((size_t)currLoc.x * cols + currLoc.y, dir) : dir == WEST)
+		{
+			// Get the direction of the most recent added item
+			dir = pathStack.Retrieve().dir;		// The search will continue from this direction
+
+			// Get rid of the item, back track the path
+			pathStack.Pop();
+			pathLen--;
+			if (counting)
+				stats.Leave();
+
+			// Check to see if the search is over
+			if (!pathStack.IsEmpty())
+			{
+				// Go to the prior location
+				currLoc = pathStack.Retrieve().loc;
+				if (tracing)
+					trace.Pop();
+				if (printing)
+					pathText.resize(pathText.length() - DIR_TEXT_LEN);
+
+				// Treat the current location as open until a forward progressing movement is made
+				board.SetStatus(currLoc, OPEN);
+			}
+
+		}// end while
+
+	}// end while
+
+	return SEARCH_DONE;
+
+}// end FindPaths
+
+
+
+// O(1)
+// Purpose: Find the first edge out of a node that comes after a direction
+// Pre: A node and the last direction already tried from it
+// Post: The index of the first edge in a later direction is returned,
+//		 or the end of the node's edges if there is none
+template <class GraphT>
+int EdgeAfter(/*IN*/const GraphT& graph,			// The graph being searched
+			  /*IN*/const int& node,				// The node whose edges are searched
+			  /*IN*/const DirectionEnum& dir)		// The last direction tried
+{
+	int edge = graph.GetEdgeBegin(node);	// The edge being checked
+
+	// Skip the directions already tried, NA skips nothing
+	while (edge < graph.GetEdgeEnd(node) && graph.GetEdgeDir(edge) <= dir)
+		edge++;
+
+	return edge;
+
+}// end EdgeAfter
+
+
+
+// O(N)
+// Purpose: Expand a graph search's path into one entry per cell, the entrance first
+// Pre: The nodes on the path and the next edge to try from each of them
+// Post: path holds the entrance and then every cell moved into along the path's edges,
+//		 each with the direction it was entered by
+template <class GraphT>
+void GraphPathItems(/*IN*/const GraphT& graph,				// The graph being searched
+					/*IN*/const vector<int>& nodeStack,		// The nodes on the current path
+					/*IN*/const vector<int>& edgeStack,		// The next edge to try from each node
+					/*OUT*/vector<StackRec>& path)			// The path, one entry per cell
+{
+	StackRec item;		// A path entry
+	int edge;			// The edge a node was entered by
+
+	// The entrance was not reached by a move
+	path.clear();
+	item.loc = graph.GetLocation(nodeStack[ZERO]);
+	item.dir = NA;
+	path.push_back(item);
+
+	// Each node was entered by the edge before its parent's next edge, walk its moves
+	for (size_t i = OFFSET; i < nodeStack.size(); i++)
+	{
+		edge = edgeStack[i - OFFSET] - OFFSET;
+		for (int step = ZERO; step < graph.GetEdgeLength(edge); step++)
+		{
+			item.dir = graph.GetEdgeStep(edge, step);
+			item.loc = Move(item.dir, item.loc);
+			path.push_back(item);
+		}
+	}
+
+}// end GraphPathItems
+
+
+
+// O(N^2)
+// Purpose: Save the state of a graph search to a checkpoint file, one path entry per cell
+// Pre: The search is at the top of its loop with edges left to try from the top node
+// Post: The checkpoint file holds the same state FindPaths would save at this point
+template <class GraphT>
+void SaveGraphSearch(/*IN*/const string& fileName,			// The checkpoint file
+					 /*IN*/const LayoutRec& layout,			// The entrance and exits
+					 /*IN*/const OptionsRec& opts,			// The options the search runs with
+					 /*IN*/const GraphT& graph,				// The graph being searched
+					 /*IN*/unsigned long long wallHash,		// Hash of the board's walls
+					 /*IN*/const vector<int>& nodeStack,	// The nodes on the current path
+					 /*IN*/const vector<int>& edgeStack,	// The next edge to try from each node
+					 /*IN*/const long long& pathCt,			// The number of paths found
+					 /*IN/OUT*/ofstream& fout)				// The output file writer
+{
+	CheckpointRec ck;	// The saved state
+	int cell;			// A cell's row major index
+	int top = (int)nodeStack.size() - OFFSET;	// The index of the top node
+
+	// Store the size and state of the search
+	graph.GetSize(ck.rows, ck.cols);
+	ck.wallHash = wallHash;
+	ck.pathCt = pathCt;
+
+	// The last direction tried is the one of the edge just before the next edge
+	if (edgeStack[top] == graph.GetEdgeBegin(nodeStack[top]))
+		ck.dir = NA;
+	else
+		ck.dir = graph.GetEdgeDir(edgeStack[top] - OFFSET);
+
+	// Store the path one cell at a time
+	GraphPathItems(graph, nodeStack, edgeStack, ck.path);
+
+	// Every cell on the path but the top one has been moved out of
+	ck.visited.assign(((long long)ck.rows * ck.cols + BITS_PER_BYTE - OFFSET) / BITS_PER_BYTE, ZERO);
+	for (size_t i = ZERO; i + OFFSET < ck.path.size(); i++)
+	{
+		cell = ck.path[i].loc.x * ck.cols + ck.path[i].loc.y;
+		ck.visited[cell / BITS_PER_BYTE] |= (unsigned char)(OFFSET << (cell % BITS_PER_BYTE));
+	}
+
+	// Save the state
+	WriteSearch(fileName, layout, opts, ck, fout);
+
+}// end SaveGraphSearch
+
+
+
+// O(N^2)
+// Purpose: Rebuild a graph search's path from a checkpoint taken by any engine
+// Pre: A checkpoint read for the board the graph was built from, empty stacks and text,
+//		and no nodes on the path
+// Post: The path is rebuilt node by node. A checkpoint taken part way along an edge goes back
+//		 to the edge's start node, which is set to redo the edge unless the cell the path stopped on
+//		 had already tried the way on. Nothing past that point prints a path, so the output is the same.
+//		 false is returned if the path does not follow the graph
+template <class GraphT>
+bool RestoreGraphSearch(/*IN*/const GraphT& graph,				// The graph being searched
+						/*IN*/const CheckpointRec& ck,			// The saved state
+						/*OUT*/vector<int>& nodeStack,			// The nodes on the path
+						/*OUT*/vector<int>& edgeStack,			// The next edge to try from each node
+						/*IN/OUT*/vector<unsigned char>& onPath,	// Holds which nodes are on the path
+						/*OUT*/string& pathText,				// The directions travelled
+						/*OUT*/int& pathLen)					// The number of moves in the path
+{
+	size_t i = ZERO;	// The path entry of the current node
+	int node;			// The current node
+	int edge;			// The edge the path leaves the node by
+	int len;			// The number of moves the edge makes
+	size_t last;		// The path entry on top of the checkpoint's path
+
+	// The path has to start on a node
+	if (ck.path.empty())
+		return false;
+
+	node = graph.GetNodeId(ck.path[ZERO].loc);
+	last = ck.path.size() - OFFSET;
+	if (node == NO_NODE)
+		return false;
+
+	pathLen = ZERO;
+
+	// Follow the path one edge at a time
+	while (true)
+	{
+		nodeStack.push_back(node);
+		onPath[node] = true;
+
+		// The top of the path goes on with the directions after the last one tried
+		if (i == last)
+		{
+			edgeStack.push_back(EdgeAfter(graph, node, ck.dir));
+			return true;
+		}
+
+		// Find the edge the path leaves the node by
+		edge = graph.GetEdgeBegin(node);
+		while (edge < graph.GetEdgeEnd(node) && graph.GetEdgeDir(edge) != ck.path[i + OFFSET].dir)
+			edge++;
+
+		// The path went into a trimmed dead end, which has no paths left in it
+		if (edge == graph.GetEdgeEnd(node))
+		{
+			edgeStack.push_back(EdgeAfter(graph, node, ck.path[i + OFFSET].dir));
+			return true;
+		}
+
+		// Make sure the path follows the edge as far as it goes
+		len = graph.GetEdgeLength(edge);
+		for (int step = ZERO; step < len && i + step < last; step++)
+			if (ck.path[i + step + OFFSET].dir != graph.GetEdgeStep(edge, step))
+				return false;
+
+		// The path stops part way along the edge, redo the edge if the way on was not yet tried
+		if (i + len > last)
+		{
+			edgeStack.push_back(ck.dir < graph.GetEdgeStep(edge, (int)(last - i)) ? edge : edge + OFFSET);
+			return true;
+		}
+
+		// Make sure the edge ends where the path says it does
+		if (graph.GetEdgeTarget(edge) != graph.GetNodeId(ck.path[i + len].loc))
+			return false;
+
+		// Move along the edge
+		edgeStack.push_back(edge + OFFSET);
+		pathText.append(graph.GetEdgeText(edge), (size_t)len * DIR_TEXT_LEN);
+		pathLen += len;
+		i += len;
+		node = graph.GetEdgeTarget(edge);
+	}
+
+}// end RestoreGraphSearch
+
+
+
+// O(2^N)
+// Purpose: Find every path from the entrance to the exits by walking a graph's edge arrays
+// Pre: The graph built from the board, the board's layout, the options, the distance map
+//		if a maximum length is set, the state to start from if the search does not start at the entrance,
+//		the live view, the trace, the statistics, and the started path writer
+// Post: Every path within the length limits is numbered and printed to the output file,
+//		 and pathCt holds how many were printed. Returns the same results as FindPaths, or
+//		 SEARCH_BAD_CHECKPOINT if the state to start from does not follow the graph
+template <class GraphT>
+SearchResultEnum FindGraphPaths(/*IN*/const GraphT& graph,			// The compiled board being searched
+								/*IN*/const LayoutRec& layout,		// The entrance and exits
+								/*IN*/const OptionsRec& opts,		// The options the search runs with
+								/*IN*/const DistanceMap& distMap,	// Each cell's distance from the exit
+								/*IN*/const CheckpointRec* start,	// The state the search starts from, NULL for the entrance
+								/*IN/OUT*/SearchView& view,			// The live view of the search
+								/*IN/OUT*/TraceWriter& trace,		// The trace of the search
+								/*IN/OUT*/PathStats& stats,			// The statistics kept on the paths
+								/*IN/OUT*/PathWriter& writer,			// The writer printing the paths
+								/*OUT*/long long& pathCt)			// The number of paths found
+{
+	vector<int> nodeStack;			// The nodes on the current path, the entrance first
+	vector<StackRec> viewPath;		// The path handed to the live view
+	vector<StackRec> startPath;		// The path the search starts from, for the trace and statistics
+	vector<int> edgeStack;			// The next edge to try from each node on the path
+	vector<unsigned char> onPath;	// Holds which nodes are on the current path
+	string pathText;				// The directions travelled so far, each followed by a "-"
+	vector<int> exitArr;			// Each node's exit index, or NO_EXIT
+	int exit;						// The exit index of the node an edge leads to
+	bool manyExits = layout.exits.size() > OFFSET;	// Holds if paths go on past an exit
+	bool tracing = trace.IsOpen();	// Holds if the search is being traced
+	bool counting = stats.IsStarted();	// Holds if statistics are being kept
+	bool printing = !opts.noPaths;	// Holds if the paths are printed
+	int node;						// The node on top of the path
+	int edge;						// The edge being tried
+	int target;						// The node the edge leads to
+	int len;						// The number of moves the edge makes
+	DirectionEnum stepDir;			// The direction of one of the edge's moves
+	Location2DRec stepLoc;			// The cell one of the edge's moves goes into
+	int pathLen = ZERO;				// The number of moves made in the current path
+	unsigned long long wallHash;	// Hash of the board's walls, kept for checkpoints
+	string budgetFile = BudgetFile(opts);	// The checkpoint file written when the time budget runs out
+	long long stepCt = ZERO;		// The number of search steps taken since the clock was checked
+	chrono::steady_clock::time_point startTime;		// When the search began
+	chrono::steady_clock::time_point lastCkTime;	// When the last checkpoint was saved
+	chrono::steady_clock::time_point now;			// The current time
+
+	// Mark which nodes are exits, walled exits have no node
+	exitArr.assign(graph.GetNodeCount(), NO_EXIT);
+	for (int i = ZERO; i < (int)layout.exits.size(); i++)
+	{
+		node = graph.GetNodeId(layout.exits[i].loc);
+		if (node != NO_NODE)
+			exitArr[node] = i;
+	}
+	wallHash = WallHash(graph);
+	onPath.assign(graph.GetNodeCount(), false);
+	pathCt = ZERO;
+
+	// Pick up where a saved search left off, or just before the first path wanted
+	if (start != NULL)
+	{
+		// Rebuild the path, give up if it does not follow the graph
+		if (!RestoreGraphSearch(graph, *start, nodeStack, edgeStack, onPath, pathText, pathLen))
+			return SEARCH_BAD_CHECKPOINT;
+
+		pathCt = start->pathCt;
+
+		// The trace and statistics start from the restored path
+		if (tracing || counting)
+		{
+			GraphPathItems(graph, nodeStack, edgeStack, startPath);
+			StartRecording(startPath, pathCt, trace, stats);
+		}
+	}
+
+	// Start a new search at the entrance
+	else
+	{
+		node = graph.GetNodeId(layout.start);
+		nodeStack.push_back(node);
+		edgeStack.push_back(graph.GetEdgeBegin(node));
+		onPath[node] = true;
+
+		// The trace and statistics start from the entrance
+		if (tracing || counting)
+		{
+			GraphPathItems(graph, nodeStack, edgeStack, startPath);
+			StartRecording(startPath, pathCt, trace, stats);
+		}
+
+		// An entrance that is an exit is a path of only the exit move
+		exit = exitArr[node];
+		if (exit != NO_EXIT && WithinLenLimits(OFFSET, opts))
+		{
+			pathCt++;
+			if (printing)
+			{
+				writer.BeginPath(pathCt, exit);
+				writer.EndPath();
+			}
+			if (tracing)
+				trace.Found();
+			if (counting)
+				stats.Found(OFFSET);
+
+			// Stop once the last path wanted is found
+			if (pathCt == opts.lastPath)
+				return SEARCH_DONE;
+		}
+	}
+
+	// Start the clock
+	startTime = chrono::steady_clock::now();
+	lastCkTime = startTime;
+
+	// Repeat until the path is empty
+	while (!nodeStack.empty())
+	{
+		node = nodeStack.back();
+		edge = edgeStack.back();
+
+		// Back track once every edge out of the node has been tried
+		if (edge == graph.GetEdgeEnd(node))
+		{
+			onPath[node] = false;
+			nodeStack.pop_back();
+			edgeStack.pop_back();
+
+			// Take the moves that led into the node off the path
+			if (!nodeStack.empty())
+			{
+				len = graph.GetEdgeLength(edgeStack.back() - OFFSET);
+				pathLen -= len;
+				pathText.erase(pathText.length() - (size_t)len * DIR_TEXT_LEN);
+				if (tracing || counting)
+					for (int step = ZERO; step < len; step++)
+					{
+						if (tracing)
+							trace.Pop();
+						if (counting)
+							stats.Leave();
+					}
+			}
+
+			// The entrance is left once the search is over
+			else if (counting)
+				stats.Leave();
+
+			continue;
+		}
+
+		// Every so often check the clock, the state here is always safe to save
+		if (++stepCt % CLOCK_CHECK_STEPS == ZERO)
+		{
+			now = chrono::steady_clock::now();
+
+			// Save and stop if the time budget has run out
+			if (opts.timeBudgetSecs > ZERO && now - startTime >= chrono::seconds(opts.timeBudgetSecs))
+			{
+				SaveGraphSearch(budgetFile, layout, opts, graph, wallHash, nodeStack, edgeStack, pathCt, writer.Drain());
+				return SEARCH_OUT_OF_TIME;
+			}
+
+			// Save if a checkpoint is due
+			if (!opts.checkpointFile.empty() && now - lastCkTime >= chrono::seconds(opts.checkpointSecs))
+			{
+				SaveGraphSearch(opts.checkpointFile, layout, opts, graph, wallHash, nodeStack, edgeStack, pathCt, writer.Drain());
+				lastCkTime = now;
+			}
+
+			// Hand the live view the path if it is waiting on one
+			if (view.FrameWanted())
+			{
+				GraphPathItems(graph, nodeStack, edgeStack, viewPath);
+				view.Publish(viewPath, pathCt);
+			}
+		}
+
+		// Try the edge, the next one is tried when the search comes back to this node
+		edgeStack.back()++;
+		target = graph.GetEdgeTarget(edge);
+		len = graph.GetEdgeLength(edge);
+
+		// Skip nodes already on the path, and if a maximum length is set
+		// nodes whose shortest way out no longer fits
+		if (onPath[target] ||
+			(opts.maxLen != ZERO && !FitsMaxLen(distMap, graph.GetLocation(target), pathLen + len, opts.maxLen)))
+			continue;
+
+		// Trace and count the edge's moves, the way the board search makes them
+		if (tracing || counting)
+		{
+			stepLoc = graph.GetLocation(node);
+			for (int step = ZERO; step < len; step++)
+			{
+				stepDir = graph.GetEdgeStep(edge, step);
+				stepLoc = Move(stepDir, stepLoc);
+				if (tracing)
+					trace.Push(stepDir);
+				if (counting)
+					stats.Enter(stepLoc);
+			}
+		}
+
+		// Print the path if the edge leads to an exit, the exit move counts as a move
+		exit = exitArr[target];
+		if (exit != NO_EXIT && WithinLenLimits(pathLen + len + OFFSET, opts))
+		{
+			pathCt++;
+			if (printing)
+			{
+				writer.BeginPath(pathCt, exit);
+				writer.AddText(pathText.data(), pathText.length());
+				writer.AddText(graph.GetEdgeText(edge), (size_t)len * DIR_TEXT_LEN);
+				writer.EndPath();
+			}
+			if (tracing)
+				trace.Found();
+			if (counting)
+				stats.Found(pathLen + len + OFFSET);
+
+			// Stop once the last path wanted is found
+			if (pathCt == opts.lastPath)
+				return SEARCH_DONE;
+		}
+
+		// Move along the edge, unless it led to a lone exit which is as far as a path goes
+		if (exit == NO_EXIT || manyExits)
+		{
+			nodeStack.push_back(target);
+			edgeStack.push_back(graph.GetEdgeBegin(target));
+			onPath[target] = true;
+			pathLen += len;
+			pathText.append(graph.GetEdgeText(edge), (size_t)len * DIR_TEXT_LEN);
+		}
+
+		// Otherwise take the edge's moves back off the trace and statistics
+		else if (tracing || counting)
+			for (int step = ZERO; step < len; step++)
+			{
+				if (tracing)
+					trace.Pop();
+				if (counting)
+					stats.Leave();
+			}
+
+	}// end while
+
+	return SEARCH_DONE;
+
+}// end FindGraphPaths
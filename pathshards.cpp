@@ -0,0 +1,254 @@
+// Project Maze
+// FileName : pathshards.cpp
+// Author: Christian Siletti
+// Purpose : This file contains the implementation for all of the methods
+//			 defined in pathshards.h
+
+#include "pathshards.h"		// The header file
+#include "gbExceptions.h"	// Holds the out of memory exception
+#include <algorithm>		// For comparing the file mark and finding an index entry
+#include <sstream>			// For padding the shard number
+#include <iomanip>			// For padding the shard number
+#include <cstdlib>			// For reading a path's number
+#include <new>				// Contains the bad_alloc exception
+
+const char SHARD_INDEX_MAGIC[] = { 'M', 'Z', 'I', 'X' };	// Marks the start of an index file
+const int SHARD_INDEX_MAGIC_LEN = 4;						// The number of characters in the mark
+const int SHARD_INDEX_VERSION = 1;							// The index file layout version
+const string PATH_LABEL = "Path #";							// Starts the line of each path
+
+
+
+// O(1)
+// Purpose: Order a path number against an index entry, for finding the entry a path comes after
+// Pre: A path number and an index entry
+// Post: true is returned if the path comes before the entry's path
+static bool PathBefore(/*IN*/const long long& pathNum,		// The path being looked for
+					   /*IN*/const ShardIndexRec& entry)	// The index entry it is compared with
+{
+	return pathNum < entry.pathNum;
+
+}// end PathBefore
+
+
+
+// O(1) - Default Constructor
+// Pre: N/A
+// Post: A writer that is not sharding is created
+ShardWriter::ShardWriter()
+{
+	shardBytes = ZERO;
+	shard = ZERO;
+	nextIndexPath = ZERO;
+
+}// end DC
+
+
+
+
+// O(1) - Destructor
+// Pre: N/A
+// Post: The files are closed
+ShardWriter::~ShardWriter()
+{
+	Close();
+
+}// end Destructor
+
+
+
+
+// O(1) - Mutator
+// Pre: The start of the file names and a shard size above zero
+// Post: The index and shard 0 are open and true is returned, false if either could not be created
+bool ShardWriter::Open(/*IN*/const string& baseName,			// The start of the shard and index file names
+					   /*IN*/const long long& shardBytes)		// The size a shard is closed at
+{
+	this->baseName = baseName;
+	this->shardBytes = shardBytes;
+	shard = ZERO;
+	nextIndexPath = ZERO;		// The first path is always indexed
+
+	// Create the index and mark it as one
+	indexOut.open(baseName + SHARD_INDEX_EXT, ios::binary | ios::trunc);
+	indexOut.write(SHARD_INDEX_MAGIC, SHARD_INDEX_MAGIC_LEN);
+	indexOut.write(reinterpret_cast<const char*>(&SHARD_INDEX_VERSION), sizeof(SHARD_INDEX_VERSION));
+
+	// Create the first shard
+	shardOut.open(ShardFile(baseName, shard), ios::binary | ios::trunc);
+
+	return indexOut && shardOut;
+
+}// end Open
+
+
+
+
+// O(1) - Mutator
+// Pre: N/A
+// Post: Everything printed is in the files and they are closed, nothing happens if they were not open
+void ShardWriter::Close()
+{
+	if (shardOut.is_open())
+		shardOut.close();
+	if (indexOut.is_open())
+		indexOut.close();
+
+}// end Close
+
+
+
+
+// O(1) - Mutator Helper
+// Pre: The path is due to be indexed
+// Post: The path's number, shard and offset are in the index
+void ShardWriter::IndexPath(/*IN*/const long long& pathNum)		// The number of the path being printed
+{
+	long long offset = (long long)shardOut.tellp();		// Where the path starts in the shard
+
+	// Start the next shard once this one is full, never on an empty one
+	if (offset >= shardBytes)
+	{
+		shardOut.close();
+		shardOut.clear();
+		shardOut.open(ShardFile(baseName, ++shard), ios::binary | ios::trunc);
+		offset = ZERO;
+	}
+
+	indexOut.write(reinterpret_cast<const char*>(&pathNum), sizeof(pathNum));
+	indexOut.write(reinterpret_cast<const char*>(&shard), sizeof(shard));
+	indexOut.write(reinterpret_cast<const char*>(&offset), sizeof(offset));
+	nextIndexPath = pathNum + SHARD_INDEX_PATHS;
+
+}// end IndexPath
+
+
+
+
+// O(1) - Default Constructor
+// Pre: N/A
+// Post: A reader with no index entries is created
+ShardReader::ShardReader()
+{
+}// end DC
+
+
+
+
+// O(N) - Mutator
+// Pre: N/A
+// Post: The index entries are loaded and true is returned,
+//		 false is returned if the index is missing or is not an index
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+bool ShardReader::Open(/*IN*/const string& baseName)	// The start of the shard and index file names
+{
+	ifstream fin;					// The index file reader
+	char magic[SHARD_INDEX_MAGIC_LEN];	// The mark at the start of the file
+	int version = ZERO;				// The file layout version
+	ShardIndexRec entry;			// The index entry being read
+
+	this->baseName = baseName;
+	indexArr.clear();
+
+	// Check that it is an index
+	fin.open(baseName + SHARD_INDEX_EXT, ios::binary);
+	fin.read(magic, SHARD_INDEX_MAGIC_LEN);
+	fin.read(reinterpret_cast<char*>(&version), sizeof(version));
+	if (!fin || !equal(magic, magic + SHARD_INDEX_MAGIC_LEN, SHARD_INDEX_MAGIC) || version != SHARD_INDEX_VERSION)
+		return false;
+
+	try
+	{
+		// Read entries until the file runs out, a partly written entry is left off
+		while (fin.read(reinterpret_cast<char*>(&entry.pathNum), sizeof(entry.pathNum)) &&
+			   fin.read(reinterpret_cast<char*>(&entry.shard), sizeof(entry.shard)) &&
+			   fin.read(reinterpret_cast<char*>(&entry.offset), sizeof(entry.offset)))
+			indexArr.push_back(entry);
+	}
+	catch (std::bad_alloc)	// The heap space memory has run out
+	{
+		// Throw the exception
+		throw GBOutOfMemoryException();
+	}
+
+	return true;
+
+}// end Open
+
+
+
+
+// O(log N + M) for M paths read
+// Pre: The index is loaded and first <= last
+// Post: Every path numbered first to last that was printed is printed to out, as it is in its shard.
+//		 The number of paths printed is returned
+long long ShardReader::ReadPaths(/*IN*/const long long& first,	// The number of the first path wanted
+								 /*IN*/const long long& last,	// The number of the last path wanted
+								 /*IN/OUT*/ostream& out)		// Where the paths are printed
+{
+	vector<ShardIndexRec>::const_iterator entry;	// The last index entry at or before the first path
+	ifstream fin;						// The shard file reader
+	string line;						// A line of the shard
+	long long pathNum;					// The number of the path the line belongs to
+	long long printedCt = ZERO;			// The number of paths printed
+	int shard;							// The number of the shard being read
+	bool inRange = false;				// Holds if the lines read belong to a wanted path
+
+	// Find the last entry at or before the first path, there is nothing before the first entry
+	entry = upper_bound(indexArr.begin(), indexArr.end(), first, PathBefore);
+	if (entry == indexArr.begin())
+		return ZERO;
+	--entry;
+
+	// Seek straight to it
+	shard = entry->shard;
+	fin.open(ShardFile(baseName, shard), ios::binary);
+	fin.seekg(entry->offset);
+
+	// Read forward until the last path wanted is passed, going on to the next shard at the end of one
+	while (fin)
+	{
+		if (!getline(fin, line))
+		{
+			fin.close();
+			fin.clear();
+			fin.open(ShardFile(baseName, ++shard), ios::binary);
+			continue;
+		}
+
+		// A path's line starts with its number, the lines after it belong to it
+		if (line.compare(ZERO, PATH_LABEL.length(), PATH_LABEL) == ZERO)
+		{
+			pathNum = atoll(line.c_str() + PATH_LABEL.length());
+			if (pathNum > last)
+				break;
+
+			inRange = (pathNum >= first);
+			if (inRange)
+				printedCt++;
+		}
+
+		if (inRange)
+			out << line << "\n";
+	}
+
+	return printedCt;
+
+}// end ReadPaths
+
+
+
+
+// O(1)
+// Pre: The start of the shard file names and a shard number
+// Post: baseName followed by "_", the shard number padded to SHARD_NUM_DIGITS, and SHARD_EXT is returned
+string ShardFile(/*IN*/const string& baseName,	// The start of the shard file names
+				 /*IN*/const int& shard)		// The number of the shard
+{
+	ostringstream name;		// The file name being built
+
+	name << baseName << "_" << setw(SHARD_NUM_DIGITS) << setfill('0') << shard << SHARD_EXT;
+
+	return name.str();
+
+}// end ShardFile
@@ -0,0 +1,255 @@
+#pragma once
+/*
+	FileName : pathshards.h
+	Author: Christian Siletti
+	Date: 5/1/24
+	Project Maze
+
+	PURPOSE:
+		Contains the specifications for the ShardWriter and ShardReader Classes. Sharded output
+		splits the printed paths over numbered shard files of a bounded size, with an index file
+		that maps path numbers to where they are, so any path can be read back without scanning
+		every path before it.
+
+		For the first path and every SHARD_INDEX_PATHS paths after it the writer notes the path's
+		number, the shard it is in and its byte offset there in the index. A shard is only ever
+		started on one of those paths, once the shard before it has reached its size, so a shard
+		holds a contiguous run of path numbers and may run over its size by at most
+		SHARD_INDEX_PATHS - 1 paths. Paths are never split across shards.
+
+		The reader loads the index, finds the last entry at or before the path wanted with a
+		binary search, seeks straight to it in its shard and reads forward, going on to the next
+		shards for a range that runs past the end of one. Index entries hold their shard number,
+		so shards written by separate workers over separate path ranges are indexed together by
+		concatenating their entries in path order.
+
+
+	ASSUMPTIONS:
+		1) Paths are started in increasing number, one at a time, starting at any number
+		2) Each path is printed as in OUTPUT_FILE: a "Path #N" line followed by a blank line
+		3) The index entries are in increasing path number
+
+
+	EXCEPTION HANDLING/ERROR CHECKING:
+		1) Open returns false if a shard or the index cannot be created or read, or is not an index.
+		2) ReadPaths stops at a shard that cannot be opened, or at the last path there is.
+		3) GBOutOfMemoryException thrown when memory from the heap has run out
+
+
+	FILE LAYOUT:
+		BASE_0000.out, BASE_0001.out, ... hold the paths as text.
+		BASE.idx (binary) is "MZIX", version, then an entry for each indexed path:
+		its number, its shard number and its byte offset in the shard
+
+
+						   SUMMARY OF METHODS:
+	SHARDWRITER PUBLIC METHODS
+		ShardWriter() - Instantiate a writer with no shards
+		~ShardWriter() - Close the shard and index if they are still open
+		bool Open(*IN*const string& baseName,		// The start of the shard and index file names
+				  *IN*const long long& shardBytes)	// The size a shard is closed at
+					- Create the index and the first shard
+		bool IsOpen() const - Check if paths are being sharded
+		ofstream& StartPath(*IN*const long long& pathNum)	// The number of the path being printed
+					- Get the shard a path is printed to, indexing it if it is due
+		void Close() - Close the shard and the index
+
+	SHARDWRITER PRIVATE MEMBERS:
+		string baseName;			// The start of the shard and index file names
+		long long shardBytes;		// The size a shard is closed at
+		int shard;					// The number of the shard being written
+		long long nextIndexPath;	// The number of the next path that is indexed
+		ofstream shardOut;			// The shard file writer
+		ofstream indexOut;			// The index file writer
+
+	SHARDWRITER PRIVATE METHODS:
+		void IndexPath(*IN*const long long& pathNum)	// The number of the path being printed
+					- Start a new shard if this one is full, and index the path
+
+	SHARDREADER PUBLIC METHODS
+		ShardReader() - Instantiate a reader with no index
+		bool Open(*IN*const string& baseName)	// The start of the shard and index file names
+					- Load the index
+		long long ReadPaths(*IN*const long long& first,	// The number of the first path wanted
+							*IN*const long long& last,	// The number of the last path wanted
+							*IN/OUT*ostream& out)		// Where the paths are printed
+					- Print a range of paths from the shards
+
+	SHARDREADER PRIVATE MEMBERS:
+		string baseName;					// The start of the shard and index file names
+		vector<ShardIndexRec> indexArr;		// The index entries, in path order
+
+
+						   SUMMARY OF FUNCTIONS:
+	string ShardFile(*IN*const string& baseName,	// The start of the shard file names
+					 *IN*const int& shard)			// The number of the shard
+		- Get the name of a shard file
+*/
+
+#include "Constants.h"		// File containing appropriate constants
+#include <fstream>			// For the shard and index files
+#include <vector>			// For the index entries
+
+using namespace std;    // Standard namespace
+
+
+const int SHARD_INDEX_PATHS = 256;			// The number of paths between index entries
+const string SHARD_INDEX_EXT = ".idx";		// Ends the name of the index file
+const string SHARD_EXT = ".out";			// Ends the name of a shard file
+const int SHARD_NUM_DIGITS = 4;				// The number of digits a shard number is padded to
+
+
+// Where an indexed path was printed
+struct ShardIndexRec
+{
+	long long pathNum;		// The number of the path
+	int shard;				// The number of the shard it is in
+	long long offset;		// Its byte offset in the shard
+};
+
+
+
+class ShardWriter
+{
+public:
+
+	// O(1) - Default Constructor
+	// Purpose: Instantiate a writer with no shards
+	// Pre: N/A
+	// Post: A writer that is not sharding is created
+	ShardWriter();
+
+
+
+	// O(1) - Destructor
+	// Purpose: Close the shard and index if they are still open
+	// Pre: N/A
+	// Post: The files are closed
+	~ShardWriter();
+
+
+
+	// O(1) - Mutator
+	// Purpose: Create the index and the first shard
+	// Pre: The start of the file names and a shard size above zero
+	// Post: The index and shard 0 are open and true is returned, false if either could not be created
+	bool Open(/*IN*/const string& baseName,			// The start of the shard and index file names
+			  /*IN*/const long long& shardBytes);	// The size a shard is closed at
+
+
+
+	// O(1) - Observer Predicate
+	// Purpose: Check if paths are being sharded
+	// Pre: N/A
+	// Post: true is returned if the shards are open
+	bool IsOpen() const;
+
+
+
+	// O(1) - Mutator
+	// Purpose: Get the shard a path is printed to, indexing it if it is due
+	// Pre: The shards are open and the path comes after every path started before it
+	// Post: The shard the path is to be printed to is returned. The first path and every
+	//		 SHARD_INDEX_PATHS paths after it are indexed, on a new shard if the one before has reached its size
+	ofstream& StartPath(/*IN*/const long long& pathNum);	// The number of the path being printed
+
+
+
+	// O(1) - Mutator
+	// Purpose: Close the shard and the index
+	// Pre: N/A
+	// Post: Everything printed is in the files and they are closed, nothing happens if they were not open
+	void Close();
+
+
+
+private:
+	string baseName;			// The start of the shard and index file names
+	long long shardBytes;		// The size a shard is closed at
+	int shard;					// The number of the shard being written
+	long long nextIndexPath;	// The number of the next path that is indexed
+	ofstream shardOut;			// The shard file writer
+	ofstream indexOut;			// The index file writer
+
+
+
+	// O(1) - Mutator Helper
+	// Purpose: Start a new shard if this one is full, and index the path
+	// Pre: The path is due to be indexed
+	// Post: The path's number, shard and offset are in the index
+	void IndexPath(/*IN*/const long long& pathNum);		// The number of the path being printed
+
+};
+
+
+
+class ShardReader
+{
+public:
+
+	// O(1) - Default Constructor
+	// Purpose: Instantiate a reader with no index
+	// Pre: N/A
+	// Post: A reader with no index entries is created
+	ShardReader();
+
+
+
+	// O(N) - Mutator
+	// Purpose: Load the index
+	// Pre: N/A
+	// Post: The index entries are loaded and true is returned,
+	//		 false is returned if the index is missing or is not an index
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	bool Open(/*IN*/const string& baseName);	// The start of the shard and index file names
+
+
+
+	// O(log N + M) for M paths read
+	// Purpose: Print a range of paths from the shards
+	// Pre: The index is loaded and first <= last
+	// Post: Every path numbered first to last that was printed is printed to out, as it is in its shard.
+	//		 The number of paths printed is returned
+	long long ReadPaths(/*IN*/const long long& first,	// The number of the first path wanted
+						/*IN*/const long long& last,	// The number of the last path wanted
+						/*IN/OUT*/ostream& out);		// Where the paths are printed
+
+
+
+private:
+	string baseName;					// The start of the shard and index file names
+	vector<ShardIndexRec> indexArr;		// The index entries, in path order
+
+};
+
+
+
+// O(1)
+// Purpose: Get the name of a shard file
+// Pre: The start of the shard file names and a shard number
+// Post: baseName followed by "_", the shard number padded to SHARD_NUM_DIGITS, and SHARD_EXT is returned
+string ShardFile(/*IN*/const string& baseName,	// The start of the shard file names
+				 /*IN*/const int& shard);		// The number of the shard
+
+
+
+// O(1) - Observer Predicate
+// Defined here as the path writer checks it for every path
+inline bool ShardWriter::IsOpen() const
+{
+	return shardOut.is_open();
+
+}// end IsOpen
+
+
+
+// O(1) - Mutator
+// Defined here as it runs for every path printed
+inline ofstream& ShardWriter::StartPath(/*IN*/const long long& pathNum)	// The number of the path being printed
+{
+	if (pathNum >= nextIndexPath)
+		IndexPath(pathNum);
+
+	return shardOut;
+
+}// end StartPath
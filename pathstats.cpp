@@ -0,0 +1,162 @@
+// Project Maze
+// FileName : pathstats.cpp
+// Author: Christian Siletti
+// Purpose : This file contains the implementation for all of the methods
+//			 defined in pathstats.h
+
+#include "pathstats.h"		// The header file
+#include "boardimage.h"		// For saving the heatmap
+#include "memaccount.h"		// For counting the counts and the path
+#include <fstream>			// For CSV file access
+#include <new>				// Contains the bad_alloc exception
+
+
+
+// O(1) - Default Constructor
+// Pre: N/A
+// Post: Statistics with no board are created
+PathStats::PathStats()
+{
+	maxRows = ZERO;		// Nothing is being counted yet
+	maxCols = ZERO;
+	pathCt = ZERO;
+	memBytes = ZERO;
+
+}// end DC
+
+
+
+
+// O(1) - Destructor
+// Pre: N/A
+// Post: The class object is destroyed
+PathStats::~PathStats()
+{
+	// The counts and the path free themselves, they are no longer counted
+	MemRelease(MEM_MAPS, memBytes);
+
+}// end Destructor
+
+
+
+
+// O(N^2) - Mutator
+// Pre: The size of the board
+// Post: Every length and cell count is zero and the path is empty
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+void PathStats::Start(/*IN*/const int& rows,		// Number of rows in the board
+					  /*IN*/const int& cols)		// Number of columns in the board
+{
+	size_t cellCt = (size_t)rows * cols;	// The number of cells in the board
+
+	maxRows = rows;
+	maxCols = cols;
+	pathCt = ZERO;
+
+	try
+	{
+		// A path through every cell is as long as a path can be, the exit move included
+		lengthArr.assign(cellCt + OFFSET, ZERO);
+		cellArr.assign(cellCt, ZERO);
+
+		// Make room for the longest path up front so a move never has to grow the stacks
+		pathCellArr.clear();
+		enteredAtArr.clear();
+		pathCellArr.reserve(cellCt);
+		enteredAtArr.reserve(cellCt);
+	}
+	catch (std::bad_alloc)	// The heap space memory has run out
+	{
+		// Throw the exception
+		throw GBOutOfMemoryException();
+	}
+
+	// Count the counts and the path in place of any kept before
+	MemRelease(MEM_MAPS, memBytes);
+	memBytes = (long long)lengthArr.capacity() * sizeof(long long) + (long long)cellArr.capacity() * sizeof(long long) +
+			   (long long)pathCellArr.capacity() * sizeof(int) + (long long)enteredAtArr.capacity() * sizeof(long long);
+	MemAdd(MEM_MAPS, memBytes);
+
+}// end Start
+
+
+
+
+// O(N) - Mutator
+// Pre: N/A
+// Post: The path is empty and every cell's count is up to date
+void PathStats::Finish()
+{
+	while (!pathCellArr.empty())
+		Leave();
+
+}// end Finish
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: N/A
+// Post: The number of paths counted is returned
+long long PathStats::GetPathCount() const
+{
+	return pathCt;
+
+}// end GetPathCount
+
+
+
+
+// O(N^2) - Observer
+// Pre: The path is empty (see Finish) and the board the statistics were kept for
+// Post: baseName + STATS_LENGTHS_EXT holds a "Length,Paths" line for each length found,
+//		 baseName + STATS_CELLS_EXT a "Row,Column,Paths" line for each cell that is not a wall,
+//		 and baseName + STATS_HEATMAP_EXT the heatmap. false is returned if a file could not be written
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+bool PathStats::Save(/*IN*/const string& baseName,			// The start of the file names
+					 /*IN*/const GameBoard& board) const		// The board that was searched
+{
+	ofstream fout;			// The CSV file writer
+	Location2DRec loc;		// The cell being written
+	bool saved;				// Holds if every file was written
+
+	// Write the number of paths of each length that has any
+	fout.open(baseName + STATS_LENGTHS_EXT, ios::trunc);
+	fout << "Length,Paths\n";
+	for (size_t len = ZERO; len < lengthArr.size(); len++)
+		if (lengthArr[len] > ZERO)
+			fout << len << "," << lengthArr[len] << "\n";
+	fout.close();
+	saved = (bool)fout;
+
+	// Write the number of paths through each cell that is not a wall
+	fout.clear();
+	fout.open(baseName + STATS_CELLS_EXT, ios::trunc);
+	fout << "Row,Column,Paths\n";
+	for (loc.x = ZERO; loc.x < maxRows; loc.x++)
+		for (loc.y = ZERO; loc.y < maxCols; loc.y++)
+			if (board.GetStatus(loc) != WALL)
+				fout << loc.x << "," << loc.y << "," << cellArr[(size_t)loc.x * maxCols + loc.y] << "\n";
+	fout.close();
+	saved = saved && fout;
+
+	// Draw the cell counts over the board
+	return SaveHeatmapImage(baseName + STATS_HEATMAP_EXT, board, cellArr) && saved;
+
+}// end Save
+
+
+
+
+// O(1)
+// Pre: The number of rows and columns
+// Post: The bytes of the length and cell counts and of the path, which can hold every cell,
+//		 are returned, as counted in memaccount.h
+long long PathStats::StatsBytes(/*IN*/const int& rows,		// The number of rows
+								/*IN*/const int& cols)		// The number of columns
+{
+	long long cellCt = (long long)rows * cols;	// The number of cells in the board
+
+	return (cellCt + OFFSET) * sizeof(long long) + cellCt * (sizeof(long long) + sizeof(int) + sizeof(long long));
+
+}// end StatsBytes
@@ -0,0 +1,237 @@
+#pragma once
+/*
+	FileName : pathstats.h
+	Author: Christian Siletti
+	Date: 4/29/24
+	Project Maze
+
+	PURPOSE:
+		Contains the specifications for a PathStats Class. Path statistics are counted while the
+		search runs, without printing or keeping a single path: how many paths there are of each
+		length, and how many paths go through each cell.
+
+		The length of each path found is counted in a histogram as it is found. The cells are
+		counted without going over the path: every cell on the path is kept on a stack along with
+		how many paths had been found when it was moved into. When the search moves back out of it,
+		every path found in between went through it, so the cell's count goes up by the difference.
+		Moving in, moving out and finding a path are each O(1), however long the path is.
+
+		The counts are saved as two CSV files, one for the lengths and one for the cells,
+		and as a heatmap image of the board (see boardimage.h).
+
+
+	ASSUMPTIONS:
+		1) Every cell on the path is entered once before it is left, in stack order, the entrance included
+		2) A path's length is its number of moves, including the final exit move
+		3) Only the paths found while the statistics are kept are counted, a resumed search
+		   counts the paths found after it was resumed
+
+
+	EXCEPTION HANDLING/ERROR CHECKING:
+		1) Save returns false if any of the files could not be written.
+		2) GBOutOfMemoryException thrown when memory from the heap has run out
+
+
+						   SUMMARY OF METHODS:
+	PUBLIC METHODS
+		PathStats() - Instantiate statistics that are not being kept
+		virtual ~PathStats() - Destroy the class object
+		void Start(*IN*const int& rows,		// Number of rows in the board
+				   *IN*const int& cols)		// Number of columns in the board
+					- Start keeping statistics for a board, every count at zero
+		bool IsStarted() const - Check if statistics are being kept
+		void Enter(*IN*const Location2DRec& loc)		// The cell moved into
+					- Put a cell on top of the path
+		void Leave() - Take the top cell off the path and count the paths found while it was on it
+		void Found(*IN*const int& pathLen)		// The number of moves in the path
+					- Count a path found along the current path
+		void Finish() - Take every cell left on the path off it
+		long long GetPathCount() const - Return the number of paths counted
+		bool Save(*IN*const string& baseName,		// The start of the file names
+				  *IN*const GameBoard& board) const	// The board that was searched
+					- Save the length and cell counts to CSV files and the cell counts as a heatmap
+		static long long StatsBytes(*IN*const int& rows,		// The number of rows
+									*IN*const int& cols)		// The number of columns
+					- Return the bytes the statistics of a board's size take from the heap
+
+
+	PRIVATE MEMBERS:
+		int maxRows;						// The number of rows in the board
+		int maxCols;						// The number of columns in the board
+		long long pathCt;					// The number of paths counted
+		vector<long long> lengthArr;		// The number of paths of each length
+		vector<long long> cellArr;			// The number of paths through each cell, row major
+		vector<int> pathCellArr;			// The cells on the path, the top last
+		vector<long long> enteredAtArr;		// The path count when each cell on the path was entered
+		long long memBytes;					// The bytes of the counts and the path counted in memaccount.h
+*/
+
+#include "gameboard.h"		// Allows access to the gameboard ADT
+#include <vector>			// For the counts and the path
+
+using namespace std;    // Standard namespace
+
+
+
+class PathStats
+{
+public:
+
+	// O(1) - Default Constructor
+	// Purpose: Instantiate statistics that are not being kept
+	// Pre: N/A
+	// Post: Statistics with no board are created
+	PathStats();
+
+
+
+	// O(1) - Destructor
+	// Purpose: Destroy the class object
+	// Pre: N/A
+	// Post: The class object is destroyed
+	virtual ~PathStats();
+
+
+
+	// O(N^2) - Mutator
+	// Purpose: Start keeping statistics for a board, every count at zero
+	// Pre: The size of the board
+	// Post: Every length and cell count is zero and the path is empty
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	void Start(/*IN*/const int& rows,		// Number of rows in the board
+			   /*IN*/const int& cols);		// Number of columns in the board
+
+
+
+	// O(1) - Observer Predicate
+	// Purpose: Check if statistics are being kept
+	// Pre: N/A
+	// Post: true is returned if Start has been called
+	bool IsStarted() const;
+
+
+
+	// O(1) - Mutator
+	// Purpose: Put a cell on top of the path
+	// Pre: Statistics are being kept, the cell is on the board and not already on the path
+	// Post: The cell is on top of the path
+	void Enter(/*IN*/const Location2DRec& loc);		// The cell moved into
+
+
+
+	// O(1) - Mutator
+	// Purpose: Take the top cell off the path and count the paths found while it was on it
+	// Pre: The path is not empty
+	// Post: The cell's count has gone up by the paths found since it was entered
+	void Leave();
+
+
+
+	// O(1) - Mutator
+	// Purpose: Count a path found along the current path
+	// Pre: Statistics are being kept and 0 < pathLen <= rows * cols
+	// Post: The path and its length are counted, the cells on the path are counted when they are left
+	void Found(/*IN*/const int& pathLen);		// The number of moves in the path
+
+
+
+	// O(N) - Mutator
+	// Purpose: Take every cell left on the path off it
+	// Pre: N/A
+	// Post: The path is empty and every cell's count is up to date
+	void Finish();
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return the number of paths counted
+	// Pre: N/A
+	// Post: The number of paths counted is returned
+	long long GetPathCount() const;
+
+
+
+	// O(N^2) - Observer
+	// Purpose: Save the length and cell counts to CSV files and the cell counts as a heatmap
+	// Pre: The path is empty (see Finish) and the board the statistics were kept for
+	// Post: baseName + STATS_LENGTHS_EXT holds a "Length,Paths" line for each length found,
+	//		 baseName + STATS_CELLS_EXT a "Row,Column,Paths" line for each cell that is not a wall,
+	//		 and baseName + STATS_HEATMAP_EXT the heatmap. false is returned if a file could not be written
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	bool Save(/*IN*/const string& baseName,			// The start of the file names
+			  /*IN*/const GameBoard& board) const;	// The board that was searched
+
+
+
+	// O(1)
+	// Purpose: Return the bytes the statistics of a board's size take from the heap
+	// Pre: The number of rows and columns
+	// Post: The bytes of the length and cell counts and of the path, which can hold every cell,
+	//		 are returned, as counted in memaccount.h
+	static long long StatsBytes(/*IN*/const int& rows,		// The number of rows
+								/*IN*/const int& cols);		// The number of columns
+
+
+
+private:
+	int maxRows;						// The number of rows in the board
+	int maxCols;						// The number of columns in the board
+	long long pathCt;					// The number of paths counted
+
+	vector<long long> lengthArr;		// The number of paths of each length
+	vector<long long> cellArr;			// The number of paths through each cell, row major
+	vector<int> pathCellArr;			// The cells on the path, the top last
+	vector<long long> enteredAtArr;		// The path count when each cell on the path was entered
+	long long memBytes;					// The bytes of the counts and the path counted in memaccount.h
+
+};
+
+
+
+const string STATS_LENGTHS_EXT = "_lengths.csv";	// Ends the name of the length counts file
+const string STATS_CELLS_EXT = "_cells.csv";		// Ends the name of the cell counts file
+const string STATS_HEATMAP_EXT = "_heatmap.ppm";	// Ends the name of the heatmap image
+
+
+
+// O(1) - Observer Predicate
+// Defined here as the search checks it before every move
+inline bool PathStats::IsStarted() const
+{
+	return !cellArr.empty();
+
+}// end IsStarted
+
+
+
+// O(1) - Mutator
+// Defined here as it runs for every move the search makes
+inline void PathStats::Enter(/*IN*/const Location2DRec& loc)		// The cell moved into
+{
+	pathCellArr.push_back(loc.x * maxCols + loc.y);
+	enteredAtArr.push_back(pathCt);
+
+}// end Enter
+
+
+
+// O(1) - Mutator
+// Defined here as it runs for every move the search takes back
+inline void PathStats::Leave()
+{
+	cellArr[pathCellArr.back()] += pathCt - enteredAtArr.back();
+	pathCellArr.pop_back();
+	enteredAtArr.pop_back();
+
+}// end Leave
+
+
+
+// O(1) - Mutator
+// Defined here as it runs for every path the search finds
+inline void PathStats::Found(/*IN*/const int& pathLen)		// The number of moves in the path
+{
+	pathCt++;
+	lengthArr[pathLen]++;
+
+}// end Found
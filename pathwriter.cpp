@@ -0,0 +1,312 @@
+// Project Maze
+// FileName : pathwriter.cpp
+// Author: Christian Siletti
+// Purpose : This file contains the implementation for all of the methods
+//			 defined in pathwriter.h
+
+#include "pathwriter.h"		// The header file
+#include "memaccount.h"		// For counting the ring's memory
+#include <chrono>			// For the writer's idle wait
+
+const int WRITER_YIELD_TRIES = 64;								// Times an idle writer gives up its turn before sleeping
+const chrono::microseconds WRITER_IDLE_WAIT = chrono::microseconds(200);	// How long an idle writer sleeps
+
+
+
+// O(1) - Default Constructor
+// Pre: N/A
+// Post: A writer with no output file is created
+PathWriter::PathWriter()
+{
+	foutPtr = NULL;		// Nothing is being written yet
+	outPtr = NULL;
+	threaded = false;
+	ringBytes = ZERO;
+	record = &localRecord;
+	searchStalls = ZERO;
+	writerStalls = ZERO;
+	running = false;
+
+}// end DC
+
+
+
+
+// O(N) - Destructor
+// Pre: N/A
+// Post: The writer thread has finished and the ring's memory is counted as given back
+PathWriter::~PathWriter()
+{
+	Stop();
+	MemRelease(MEM_OUTPUT, ringBytes);
+
+}// end Destructor
+
+
+
+
+// O(1) - Mutator
+// Pre: The writer has not been started, and a shard size above zero
+// Post: The first shard and the index are created and true is returned, false if they could not be.
+//		 The paths handed over once the writer starts are printed to the shards
+bool PathWriter::ShardTo(/*IN*/const string& baseName,			// The start of the shard and index file names
+						 /*IN*/const long long& shardBytes)		// The size a shard is closed at
+{
+	return shards.Open(baseName, shardBytes);
+
+}// end ShardTo
+
+
+
+
+// O(1) - Mutator
+// Pre: The open output file, the layout being searched, and if a writer thread should be used
+// Post: Paths handed over are written to the output file, by the writer thread if threaded
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+void PathWriter::Start(/*IN/OUT*/ofstream& fout,			// The output file writer
+					   /*IN*/const LayoutRec& layout,		// The entrance and exits
+					   /*IN*/bool threaded)					// Holds if the paths are written on a thread of their own
+{
+	// Start as on any stream, and keep the file for draining
+	Start((ostream&)fout, layout, threaded);
+	foutPtr = &fout;
+
+}// end Start
+
+
+
+
+// O(1) - Mutator
+// Pre: The stream, the layout being searched, and if a writer thread should be used
+// Post: Paths handed over are written to the stream, by the writer thread if threaded.
+//		 The writer has no output file, so it cannot be drained for a checkpoint
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+void PathWriter::Start(/*IN/OUT*/ostream& out,				// The stream the paths are written to
+					   /*IN*/const LayoutRec& layout,		// The entrance and exits
+					   /*IN*/bool threaded)					// Holds if the paths are written on a thread of their own
+{
+	foutPtr = NULL;
+	outPtr = &out;
+	this->layout = layout;
+	this->threaded = threaded;
+	record = &localRecord;
+	searchStalls = ZERO;
+	writerStalls = ZERO;
+
+	// Make the ring and start emptying it
+	if (threaded)
+	{
+		ring.Allocate(PATH_RING_RECORDS);
+		if (ringBytes == ZERO)
+		{
+			ringBytes = RingBytes();
+			MemAdd(MEM_OUTPUT, ringBytes);
+		}
+		running = true;
+		writeThread = thread(&PathWriter::WriteLoop, this);
+	}
+
+}// end Start
+
+
+
+
+// O(N) - Mutator
+// Pre: The writer has been started on the output file and no path is being handed over
+// Post: Every path handed over is in the output file writer, which can be used until the next path
+ofstream& PathWriter::Drain()
+{
+	// The writer thread is done with the file once it has released every record
+	if (threaded)
+		while (!ring.IsEmpty())
+			this_thread::yield();
+
+	return *foutPtr;
+
+}// end Drain
+
+
+
+
+// O(N) - Mutator
+// Pre: No path is being handed over
+// Post: Every path handed over is in the output file writer or the shards and the writer thread
+//		 has finished, the shards are closed. Nothing happens if the writer was not started
+void PathWriter::Stop()
+{
+	// Let the writer thread empty the ring and finish
+	if (writeThread.joinable())
+	{
+		running = false;
+		writeThread.join();
+	}
+
+	shards.Close();
+
+}// end Stop
+
+
+
+
+// O(1) - Observer Predicate
+// Pre: N/A
+// Post: true is returned if the writer was started with a writer thread
+bool PathWriter::IsThreaded() const
+{
+	return threaded;
+
+}// end IsThreaded
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: N/A
+// Post: The number of times a record could not be claimed straight away is returned
+long long PathWriter::GetSearchStalls() const
+{
+	return searchStalls;
+
+}// end GetSearchStalls
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: The writer has been stopped
+// Post: The number of times the writer thread found nothing to write is returned
+long long PathWriter::GetWriterStalls() const
+{
+	return writerStalls;
+
+}// end GetWriterStalls
+
+
+
+
+// O(1)
+// Pre: N/A
+// Post: The bytes of PATH_RING_RECORDS records are returned, as counted in memaccount.h.
+//		 Only a writer started with a thread of its own makes the ring
+long long PathWriter::RingBytes()
+{
+	return (long long)PATH_RING_RECORDS * sizeof(PathRecordRec);
+
+}// end RingBytes
+
+
+
+
+// O(1) - Mutator Helper
+// Pre: The record before it, if any, has been handed over
+// Post: record points to an empty record
+void PathWriter::NextRecord()
+{
+	// Wait for the writer to free a slot if the ring is full
+	if (threaded && (record = ring.Claim()) == NULL)
+	{
+		searchStalls++;
+		while ((record = ring.Claim()) == NULL)
+			this_thread::yield();
+	}
+
+	record->textLen = ZERO;
+	record->last = false;
+
+}// end NextRecord
+
+
+
+
+// O(1) - Mutator Helper
+// Pre: The record is filled in
+// Post: The record belongs to the writer
+void PathWriter::HandOver()
+{
+	if (threaded)
+		ring.Publish();
+	else
+		WriteRecord(localRecord);
+
+}// end HandOver
+
+
+
+
+// O(N) - Mutator Helper
+// Pre: Run on the writer thread
+// Post: Every record handed over has been written
+void PathWriter::WriteLoop()
+{
+	PathRecordRec* rec;		// The oldest record handed over
+
+	while (true)
+	{
+		// Write the records as they come in
+		rec = ring.Peek();
+		if (rec != NULL)
+		{
+			WriteRecord(*rec);
+			ring.Release();
+			continue;
+		}
+
+		// Every record is handed over before the writer is stopped, so one last look finds the rest
+		if (!running.load(memory_order_acquire))
+		{
+			if (ring.Peek() == NULL)
+				break;
+			continue;
+		}
+
+		// Nothing to write, give the search a chance before sleeping on it
+		writerStalls++;
+		for (int i = ZERO; i < WRITER_YIELD_TRIES && ring.Peek() == NULL; i++)
+			this_thread::yield();
+		if (ring.Peek() == NULL)
+			this_thread::sleep_for(WRITER_IDLE_WAIT);
+	}
+
+}// end WriteLoop
+
+
+
+
+// O(N) - Mutator Helper
+// Pre: The record comes after the records of the path before it
+// Post: The path's label is printed if the record starts it, then its text,
+//		 then the exit move and a blank line if the record finishes it
+void PathWriter::WriteRecord(/*IN*/const PathRecordRec& rec)		// The record being written
+{
+	// Label the path, in the shard it belongs in if the paths are sharded
+	if (rec.pathNum != ZERO)
+	{
+		if (shards.IsOpen())
+			outPtr = &shards.StartPath(rec.pathNum);
+		*outPtr << "Path #" << rec.pathNum << ExitLabel(layout, rec.exit) << ":\t";
+	}
+
+	// Print the path - Exit direction is tacked on as it is the final movement
+	outPtr->write(rec.text, rec.textLen);
+	if (rec.last)
+		*outPtr << layout.exits[rec.exit].dir << "\n\n";
+
+}// end WriteRecord
+
+
+
+
+// O(1)
+// Pre: The layout and the index of the exit reached
+// Post: An empty string is returned if the board has one exit, so its paths print as they
+//		 always have, otherwise " (Exit k)" with the exits numbered from 1 in the order read in
+string ExitLabel(/*IN*/const LayoutRec& layout,		// The entrance and exits
+				 /*IN*/const int& exit)				// The exit the path finished on
+{
+	// A lone exit needs no label
+	if (layout.exits.size() <= OFFSET)
+		return "";
+
+	return " (Exit " + to_string(exit + OFFSET) + ")";
+
+}// end ExitLabel
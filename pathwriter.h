@@ -0,0 +1,369 @@
+#pragma once
+/*
+	FileName : pathwriter.h
+	Author: Christian Siletti
+	Date: 4/30/24
+	Project Maze
+
+	PURPOSE:
+		Contains the specifications for a PathWriter Class. A path writer prints the paths the
+		search finds to the output file, on a thread of its own so the search never waits on the file.
+
+		The search hands each path over as fixed size records in a lock free ring (see spscring.h).
+		A record holds the path's number, the exit it finished on and a piece of its direction text;
+		a path too long for one record carries on in the records after it. The writer thread turns
+		each record into the "Path #N (Exit k):" line and writes it. When the ring is full the search
+		waits for the writer to free a slot, and when it is empty the writer waits for the search,
+		and each side counts how often it had to wait.
+
+		Without a thread the records are written as soon as they are handed over, on the search's
+		own thread, so the file is the same either way.
+
+		The paths can be printed to size bounded shard files with an index instead of the output
+		file (see pathshards.h), so a path can be read back by its number without a scan.
+
+
+	ASSUMPTIONS:
+		1) Only the search hands over paths, one at a time, BeginPath then AddText then EndPath
+		2) Nothing else writes to the output file between Start and Stop except through Drain
+		3) A path's text is its moves as "D-" pairs, the exit move is added from the layout
+
+
+	EXCEPTION HANDLING/ERROR CHECKING:
+		1) A search that is not printing paths never hands any over, so its writer is started without a thread.
+		2) GBOutOfMemoryException thrown when memory from the heap has run out
+
+
+						   SUMMARY OF METHODS:
+	PUBLIC METHODS
+		PathWriter() - Instantiate a writer that is not writing
+		~PathWriter() - Stop the writer thread if it is still running
+		bool ShardTo(*IN*const string& baseName,		// The start of the shard and index file names
+					 *IN*const long long& shardBytes)	// The size a shard is closed at
+					- Print the paths to shard files and an index instead of the output file
+		void Start(*IN/OUT*ofstream& fout,			// The output file writer
+				   *IN*const LayoutRec& layout,		// The entrance and exits
+				   *IN*bool threaded)				// Holds if the paths are written on a thread of their own
+					- Start writing paths to the output file
+		void Start(*IN/OUT*ostream& out,			// The stream the paths are written to
+				   *IN*const LayoutRec& layout,		// The entrance and exits
+				   *IN*bool threaded)				// Holds if the paths are written on a thread of their own
+					- Start writing paths to a stream that is not a file, such as a string
+		void BeginPath(*IN*const long long& pathNum,	// The number of the path
+					   *IN*const int& exit)			// The exit the path finished on
+					- Start handing over a path
+		void AddText(*IN*const char* text,		// The path's direction text
+					 *IN*size_t len)			// The number of characters of text
+					- Hand over the next piece of the path's direction text
+		void EndPath() - Finish handing over the path
+		ofstream& Drain() - Wait for every path handed over to be written and return the output file writer
+		void Stop() - Write every path handed over and stop the writer thread
+		bool IsThreaded() const - Check if the paths are written on a thread of their own
+		long long GetSearchStalls() const - Return how often the search waited on a full ring
+		long long GetWriterStalls() const - Return how often the writer waited on an empty ring
+		static long long RingBytes() - Return the bytes the ring takes from the heap
+
+
+	PRIVATE MEMBERS:
+		ofstream* foutPtr;					// The output file writer, NULL if started on another stream
+		ostream* outPtr;					// Where the path being written is printed
+		ShardWriter shards;					// The shard files and index, when the paths are sharded
+		LayoutRec layout;					// The entrance and exits, for the exit labels and moves
+		bool threaded;						// Holds if the paths are written on a thread of their own
+		SpscRing<PathRecordRec> ring;		// The records handed from the search to the writer thread
+		long long ringBytes;				// The bytes the ring has taken, zero until a writer thread is started
+		PathRecordRec* record;				// The record the search is filling
+		PathRecordRec localRecord;			// The record filled when there is no writer thread
+		long long searchStalls;				// The number of times the search waited on a full ring
+		long long writerStalls;				// The number of times the writer waited on an empty ring
+		atomic<bool> running;				// Holds if the writer thread should keep going
+		thread writeThread;					// The thread writing the records
+
+	PRIVATE METHODS:
+		void NextRecord() - Claim the next record for the search to fill, waiting for a free slot
+		void HandOver() - Hand the record being filled to the writer, or write it if there is no thread
+		void WriteLoop() - Write the records handed over until the writer is stopped and the ring is empty
+		void WriteRecord(*IN*const PathRecordRec& rec)		// The record being written
+					- Print a record to the output file
+
+
+						   SUMMARY OF FUNCTIONS:
+	string ExitLabel(*IN*const LayoutRec& layout,	// The entrance and exits
+					 *IN*const int& exit)			// The exit the path finished on
+		- Get the text that follows a path's number to say which exit it finished on
+*/
+
+#include "layoutrec.h"		// The entrance and exits
+#include "spscring.h"		// The ring the records are handed over in
+#include "pathshards.h"		// For printing the paths to shard files
+#include <fstream>			// For the output file
+#include <atomic>			// For stopping the writer thread
+#include <thread>			// For the writer thread
+#include <cstring>			// For copying text into a record
+#include <algorithm>		// For the room left in a record
+
+using namespace std;    // Standard namespace
+
+
+const int PATH_RECORD_TEXT = 236;			// The characters of text in a record, filling it out to 256 bytes
+const size_t PATH_RING_RECORDS = 8192;		// The number of records the ring holds, a power of two
+
+
+// A fixed size piece of a path handed from the search to the writer
+struct PathRecordRec
+{
+	long long pathNum;				// The number of the path, zero if it carries on the path before
+	int exit;						// The exit the path finished on
+	int textLen;					// The number of characters of text held
+	bool last;						// Holds if the path's text finishes in this record
+	char text[PATH_RECORD_TEXT];	// The next piece of the path's direction text
+};
+
+
+
+class PathWriter
+{
+public:
+
+	// O(1) - Default Constructor
+	// Purpose: Instantiate a writer that is not writing
+	// Pre: N/A
+	// Post: A writer with no output file is created
+	PathWriter();
+
+
+
+	// O(N) - Destructor
+	// Purpose: Stop the writer thread if it is still running
+	// Pre: N/A
+	// Post: The writer thread has finished
+	~PathWriter();
+
+
+
+	// O(1) - Mutator
+	// Purpose: Print the paths to shard files and an index instead of the output file
+	// Pre: The writer has not been started, and a shard size above zero
+	// Post: The first shard and the index are created and true is returned, false if they could not be.
+	//		 The paths handed over once the writer starts are printed to the shards
+	bool ShardTo(/*IN*/const string& baseName,			// The start of the shard and index file names
+				 /*IN*/const long long& shardBytes);	// The size a shard is closed at
+
+
+
+	// O(1) - Mutator
+	// Purpose: Start writing paths to the output file
+	// Pre: The open output file, the layout being searched, and if a writer thread should be used
+	// Post: Paths handed over are written to the output file, by the writer thread if threaded
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	void Start(/*IN/OUT*/ofstream& fout,			// The output file writer
+			   /*IN*/const LayoutRec& layout,		// The entrance and exits
+			   /*IN*/bool threaded);				// Holds if the paths are written on a thread of their own
+
+
+
+	// O(1) - Mutator
+	// Purpose: Start writing paths to a stream that is not a file, such as a string
+	// Pre: The stream, the layout being searched, and if a writer thread should be used
+	// Post: Paths handed over are written to the stream, by the writer thread if threaded.
+	//		 The writer has no output file, so it cannot be drained for a checkpoint
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	void Start(/*IN/OUT*/ostream& out,				// The stream the paths are written to
+			   /*IN*/const LayoutRec& layout,		// The entrance and exits
+			   /*IN*/bool threaded);				// Holds if the paths are written on a thread of their own
+
+
+
+	// O(1) - Mutator
+	// Purpose: Start handing over a path
+	// Pre: The writer has been started and no path is being handed over
+	// Post: A record for the path is being filled, with no text yet
+	void BeginPath(/*IN*/const long long& pathNum,		// The number of the path
+				   /*IN*/const int& exit);				// The exit the path finished on
+
+
+
+	// O(N) - Mutator
+	// Purpose: Hand over the next piece of the path's direction text
+	// Pre: A path is being handed over
+	// Post: The text follows the text handed over before it, full records are handed to the writer
+	void AddText(/*IN*/const char* text,		// The path's direction text
+				 /*IN*/size_t len);				// The number of characters of text
+
+
+
+	// O(1) - Mutator
+	// Purpose: Finish handing over the path
+	// Pre: A path is being handed over
+	// Post: The path's last record is handed to the writer, followed by the exit move when written
+	void EndPath();
+
+
+
+	// O(N) - Mutator
+	// Purpose: Wait for every path handed over to be written and return the output file writer
+	// Pre: The writer has been started on the output file and no path is being handed over
+	// Post: Every path handed over is in the output file writer, which can be used until the next path
+	ofstream& Drain();
+
+
+
+	// O(N) - Mutator
+	// Purpose: Write every path handed over and stop the writer thread
+	// Pre: No path is being handed over
+	// Post: Every path handed over is in the output file writer or the shards and the writer thread
+	//		 has finished, the shards are closed. Nothing happens if the writer was not started
+	void Stop();
+
+
+
+	// O(1) - Observer Predicate
+	// Purpose: Check if the paths are written on a thread of their own
+	// Pre: N/A
+	// Post: true is returned if the writer was started with a writer thread
+	bool IsThreaded() const;
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return how often the search waited on a full ring
+	// Pre: N/A
+	// Post: The number of times a record could not be claimed straight away is returned
+	long long GetSearchStalls() const;
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return how often the writer waited on an empty ring
+	// Pre: The writer has been stopped
+	// Post: The number of times the writer thread found nothing to write is returned
+	long long GetWriterStalls() const;
+
+
+
+	// O(1)
+	// Purpose: Return the bytes the ring takes from the heap
+	// Pre: N/A
+	// Post: The bytes of PATH_RING_RECORDS records are returned, as counted in memaccount.h.
+	//		 Only a writer started with a thread of its own makes the ring
+	static long long RingBytes();
+
+
+
+private:
+	ofstream* foutPtr;					// The output file writer, NULL if started on another stream
+	ostream* outPtr;					// Where the path being written is printed
+	ShardWriter shards;					// The shard files and index, when the paths are sharded
+	LayoutRec layout;					// The entrance and exits, for the exit labels and moves
+	bool threaded;						// Holds if the paths are written on a thread of their own
+
+	SpscRing<PathRecordRec> ring;		// The records handed from the search to the writer thread
+	long long ringBytes;				// The bytes the ring has taken, zero until a writer thread is started
+	PathRecordRec* record;				// The record the search is filling
+	PathRecordRec localRecord;			// The record filled when there is no writer thread
+
+	long long searchStalls;				// The number of times the search waited on a full ring
+	long long writerStalls;				// The number of times the writer waited on an empty ring
+	atomic<bool> running;				// Holds if the writer thread should keep going
+	thread writeThread;					// The thread writing the records
+
+
+
+	// O(1) - Mutator Helper
+	// Purpose: Claim the next record for the search to fill, waiting for a free slot
+	// Pre: The record before it, if any, has been handed over
+	// Post: record points to an empty record
+	void NextRecord();
+
+
+
+	// O(1) - Mutator Helper
+	// Purpose: Hand the record being filled to the writer, or write it if there is no thread
+	// Pre: The record is filled in
+	// Post: The record belongs to the writer
+	void HandOver();
+
+
+
+	// O(N) - Mutator Helper
+	// Purpose: Write the records handed over until the writer is stopped and the ring is empty
+	// Pre: Run on the writer thread
+	// Post: Every record handed over has been written
+	void WriteLoop();
+
+
+
+	// O(N) - Mutator Helper
+	// Purpose: Print a record to the output file
+	// Pre: The record comes after the records of the path before it
+	// Post: The path's label is printed if the record starts it, then its text,
+	//		 then the exit move and a blank line if the record finishes it
+	void WriteRecord(/*IN*/const PathRecordRec& rec);		// The record being written
+
+};
+
+
+
+// O(1)
+// Purpose: Get the text that follows a path's number to say which exit it finished on
+// Pre: The layout and the index of the exit reached
+// Post: An empty string is returned if the board has one exit, so its paths print as they
+//		 always have, otherwise " (Exit k)" with the exits numbered from 1 in the order read in
+string ExitLabel(/*IN*/const LayoutRec& layout,		// The entrance and exits
+				 /*IN*/const int& exit);			// The exit the path finished on
+
+
+
+// O(1) - Mutator
+// Defined here as it runs for every path the search finds
+inline void PathWriter::BeginPath(/*IN*/const long long& pathNum,		// The number of the path
+								  /*IN*/const int& exit)				// The exit the path finished on
+{
+	NextRecord();
+	record->pathNum = pathNum;
+	record->exit = exit;
+
+}// end BeginPath
+
+
+
+// O(N) - Mutator
+// Defined here as it runs for every path the search finds
+inline void PathWriter::AddText(/*IN*/const char* text,		// The path's direction text
+								/*IN*/size_t len)			// The number of characters of text
+{
+	size_t room;	// The characters left in the record being filled
+	int exit;		// The exit the path finished on
+
+	while (len > ZERO)
+	{
+		// Carry the path on in a new record once this one is full
+		if (record->textLen == PATH_RECORD_TEXT)
+		{
+			exit = record->exit;
+			HandOver();
+			NextRecord();
+			record->pathNum = ZERO;
+			record->exit = exit;
+		}
+
+		// Fill as much of the record as the text allows
+		room = min((size_t)(PATH_RECORD_TEXT - record->textLen), len);
+		memcpy(record->text + record->textLen, text, room);
+		record->textLen += (int)room;
+		text += room;
+		len -= room;
+	}
+
+}// end AddText
+
+
+
+// O(1) - Mutator
+// Defined here as it runs for every path the search finds
+inline void PathWriter::EndPath()
+{
+	record->last = true;
+	HandOver();
+
+}// end EndPath
@@ -0,0 +1,478 @@
+// Project Maze
+// FileName : resultcache.cpp
+// Author: Christian Siletti
+// Purpose : This file contains the implementation for all of the methods
+//			 and functions defined in resultcache.h
+
+#include "resultcache.h"	// The header file
+#include "checkpoint.h"		// For the FNV-1a hash and the bitmap layout
+#include <fstream>			// For the entry files
+#include <filesystem>		// For listing, sizing and removing the entries
+#include <sstream>			// For the entry file names
+#include <iomanip>			// For printing the hash in hex digits
+#include <algorithm>		// For sorting the entries by when they were used
+#include <cstring>			// For reading the key a word at a time
+#include <new>				// Contains the bad_alloc exception
+
+using namespace std;	// Standard Namespace
+
+
+const char CACHE_MAGIC[] = { 'M', 'Z', 'R', 'C' };	// Marks the start of an entry file
+const int CACHE_MAGIC_LEN = 4;						// The number of characters in the mark
+const int CACHE_VERSION = 1;						// The entry file layout version
+const string CACHE_TEMP_EXT = ".tmp";				// Extension of an entry written before the rename
+const int HASH_HEX_DIGITS = 16;						// The number of hex digits in an entry's name
+
+
+// An entry file found in the cache directory
+struct CacheFileRec
+{
+	filesystem::file_time_type usedAt;	// When the entry was last stored or read back
+	long long bytes;					// The size of the entry file
+	filesystem::path name;				// The entry file
+};
+
+
+
+// O(1)
+// Purpose: Add a value to the end of a key
+// Pre: The key so far and the value
+// Post: The value's eight bytes are added to the key
+static void AppendValue(/*IN/OUT*/string& key,			// The key being built
+						/*IN*/const long long& value)	// The value added
+{
+	key.append(reinterpret_cast<const char*>(&value), sizeof(value));
+
+}// end AppendValue
+
+
+
+// O(B) for a string of B bytes
+// Purpose: Write a string to an entry file
+// Pre: The open entry file and the string
+// Post: The string's length and then its bytes are written
+static void WriteText(/*IN/OUT*/ofstream& fout,			// The entry file
+					  /*IN*/const string& text)			// The string written
+{
+	long long len = (long long)text.size();		// The number of bytes in the string
+
+	fout.write(reinterpret_cast<const char*>(&len), sizeof(len));
+	fout.write(text.data(), len);
+
+}// end WriteText
+
+
+
+// O(B) for a string of B bytes
+// Purpose: Read a string from an entry file
+// Pre: The open entry file and the most bytes the string may have
+// Post: text holds the string and true is returned, false is returned if the file ran out
+//		 or the string is longer than the most it may have
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+static bool ReadText(/*IN/OUT*/ifstream& fin,			// The entry file
+					 /*IN*/const long long& maxLen,		// The most bytes the string may have
+					 /*OUT*/string& text)				// The string read
+{
+	long long len = -OFFSET;		// The number of bytes in the string
+
+	fin.read(reinterpret_cast<char*>(&len), sizeof(len));
+	if (!fin || len < ZERO || len > maxLen)
+		return false;
+
+	try
+	{
+		text.resize((size_t)len);
+	}
+	catch (std::bad_alloc)	// The heap space memory has run out
+	{
+		// Throw the exception
+		throw GBOutOfMemoryException();
+	}
+	fin.read(&text[ZERO], len);
+
+	return (bool)fin;
+
+}// end ReadText
+
+
+
+// O(1)
+// Purpose: Order entries by when they were last used
+// Pre: Two entries found in the cache directory
+// Post: true is returned if the first was used before the second
+static bool UsedBefore(/*IN*/const CacheFileRec& first,		// The first entry
+					   /*IN*/const CacheFileRec& second)	// The second entry
+{
+	return first.usedAt < second.usedAt;
+
+}// end UsedBefore
+
+
+
+// O(1) - Default Constructor
+// Pre: N/A
+// Post: A cache that is not open is created
+ResultCache::ResultCache()
+{
+	dirName = "";		// No directory is used yet
+	maxBytes = ZERO;
+	evictCt = ZERO;
+
+}// end DC
+
+
+
+
+// O(1)
+// Pre: The cache directory and the most its entries may take up
+// Post: The cache is open on the directory and true is returned,
+//		 false is returned if it cannot be created
+bool ResultCache::Open(/*IN*/const string& dirName,			// The cache directory
+					   /*IN*/const long long& maxBytes)		// The most the entries may take up
+{
+	error_code err;		// Holds any error from creating the directory
+
+	// Create the directory unless it is already there
+	filesystem::create_directories(dirName, err);
+	if (!filesystem::is_directory(dirName, err))
+		return false;
+
+	this->dirName = dirName;
+	this->maxBytes = maxBytes;
+
+	return true;
+
+}// end Open
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: N/A
+// Post: true is returned if the cache is open
+bool ResultCache::IsOpen() const
+{
+	return !dirName.empty();
+
+}// end IsOpen
+
+
+
+
+// O(K + B) for a key of K bytes and parts of B bytes
+// Pre: The cache is open and the key of the run
+// Post: partArr holds the entry's parts, and the entry is marked used, and true is returned.
+//		 false is returned, with partArr empty, if there is no entry with the same key
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+bool ResultCache::Fetch(/*IN*/const string& key,						// What the run was asked
+						/*OUT*/vector<CachePartRec>& partArr)			// The files the run printed
+{
+	string fileName = EntryFile(key);	// The entry file the key would be in
+	ifstream fin;						// The entry file reader
+	char magic[CACHE_MAGIC_LEN];		// The mark at the start of the file
+	int version = ZERO;					// The file layout version
+	string storedKey;					// The key the entry was stored under
+	long long partCt = -OFFSET;			// The number of parts in the entry
+	long long fileBytes;				// The size of the entry file, no string in it can be longer
+	error_code err;						// Holds any error from sizing or touching the file
+
+	partArr.clear();
+
+	// Check that it is an entry
+	fileBytes = (long long)filesystem::file_size(fileName, err);
+	fin.open(fileName, ios::binary);
+	fin.read(magic, CACHE_MAGIC_LEN);
+	fin.read(reinterpret_cast<char*>(&version), sizeof(version));
+	if (err || !fin || !equal(magic, magic + CACHE_MAGIC_LEN, CACHE_MAGIC) || version != CACHE_VERSION)
+		return false;
+
+	// Only an entry stored under the same key is used, not just the same hash
+	if (!ReadText(fin, fileBytes, storedKey) || storedKey != key)
+		return false;
+
+	// Read every part, a damaged entry is not used at all
+	fin.read(reinterpret_cast<char*>(&partCt), sizeof(partCt));
+	if (!fin || partCt < ZERO || partCt > fileBytes)
+		return false;
+
+	try
+	{
+		partArr.resize((size_t)partCt);
+	}
+	catch (std::bad_alloc)	// The heap space memory has run out
+	{
+		// Throw the exception
+		throw GBOutOfMemoryException();
+	}
+
+	for (size_t i = ZERO; i < partArr.size(); i++)
+		if (!ReadText(fin, fileBytes, partArr[i].name) || !ReadText(fin, fileBytes, partArr[i].content))
+		{
+			partArr.clear();
+			return false;
+		}
+
+	// Mark it used so it is the last to be removed
+	fin.close();
+	filesystem::last_write_time(fileName, filesystem::file_time_type::clock::now(), err);
+
+	return true;
+
+}// end Fetch
+
+
+
+
+// O(K + B + E log E) for a key of K bytes, parts of B bytes and E entries in the cache
+// Pre: The cache is open, the key of the run and the files it printed
+// Post: The entry replaces any entry with the same hash, and the entries used least recently
+//		 are removed until the cache fits, and true is returned. false is returned if the
+//		 entry could not be written or is bigger than the cache
+bool ResultCache::Store(/*IN*/const string& key,							// What the run was asked
+						/*IN*/const vector<CachePartRec>& partArr)		// The files the run printed
+{
+	string fileName = EntryFile(key);				// The entry file the key goes in
+	string tempName = fileName + CACHE_TEMP_EXT;	// The file written before it replaces the old one
+	ofstream fout;									// The entry file writer
+	long long partCt = (long long)partArr.size();	// The number of parts in the entry
+	long long entryBytes;							// The size of the entry file
+	error_code err;									// Holds any error from the rename
+
+	// An entry bigger than the whole cache is not stored, it would only remove every other entry
+	entryBytes = CACHE_MAGIC_LEN + sizeof(CACHE_VERSION) + sizeof(long long) * (OFFSET + OFFSET) + key.size();
+	for (size_t i = ZERO; i < partArr.size(); i++)
+		entryBytes += sizeof(long long) * (OFFSET + OFFSET) + partArr[i].name.size() + partArr[i].content.size();
+	if (entryBytes > maxBytes)
+		return false;
+
+	// Write the entry
+	fout.open(tempName, ios::binary | ios::trunc);
+	if (!fout)
+		return false;
+
+	fout.write(CACHE_MAGIC, CACHE_MAGIC_LEN);
+	fout.write(reinterpret_cast<const char*>(&CACHE_VERSION), sizeof(CACHE_VERSION));
+	WriteText(fout, key);
+	fout.write(reinterpret_cast<const char*>(&partCt), sizeof(partCt));
+	for (size_t i = ZERO; i < partArr.size(); i++)
+	{
+		WriteText(fout, partArr[i].name);
+		WriteText(fout, partArr[i].content);
+	}
+
+	// Make sure everything made it to the disk before it replaces the old entry
+	fout.close();
+	if (!fout)
+	{
+		filesystem::remove(tempName, err);
+		return false;
+	}
+
+	filesystem::rename(tempName, fileName, err);
+	if (err)
+	{
+		filesystem::remove(tempName, err);
+		return false;
+	}
+
+	// Make room for it
+	Evict(fileName);
+
+	return true;
+
+}// end Store
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: N/A
+// Post: The number of entries Store has removed is returned
+int ResultCache::GetEvictCt() const
+{
+	return evictCt;
+
+}// end GetEvictCt
+
+
+
+
+// O(K) for a key of K bytes
+// Pre: The cache is open
+// Post: The directory, the key's hash in hex digits and CACHE_ENTRY_EXT are returned
+string ResultCache::EntryFile(/*IN*/const string& key) const	// What the run was asked
+{
+	unsigned long long hash = FNV_BASIS;	// The running hash of the key
+	long long word;							// Eight bytes of the key
+	size_t i;								// The byte of the key being hashed
+	ostringstream name;						// The hash in hex digits
+
+	// Hash the key eight bytes at a time, then whatever is left a byte at a time
+	for (i = ZERO; i + sizeof(word) <= key.size(); i += sizeof(word))
+	{
+		memcpy(&word, key.data() + i, sizeof(word));
+		hash = HashMix(hash, word);
+	}
+	for (; i < key.size(); i++)
+		hash = HashMix(hash, (unsigned char)key[i]);
+
+	name << hex << setw(HASH_HEX_DIGITS) << setfill('0') << hash << CACHE_ENTRY_EXT;
+
+	return (filesystem::path(dirName) / name.str()).string();
+
+}// end EntryFile
+
+
+
+
+// O(E log E) for E entries in the cache
+// Pre: The cache is open and an entry has just been stored
+// Post: The entries left, always including the one just stored, take up no more than maxBytes
+void ResultCache::Evict(/*IN*/const string& keepFile)		// The entry just stored
+{
+	vector<CacheFileRec> fileArr;	// The entries in the directory
+	CacheFileRec file;				// The entry being looked at
+	long long totalBytes = ZERO;	// The size of every entry together
+	error_code err;					// Holds any error from listing, sizing or removing the entries
+
+	// Find every entry and how big it is
+	for (filesystem::directory_iterator it(dirName, err), end; !err && it != end; it.increment(err))
+	{
+		if (!it->is_regular_file(err) || it->path().extension() != CACHE_ENTRY_EXT)
+			continue;
+
+		file.name = it->path();
+		file.bytes = (long long)it->file_size(err);
+		file.usedAt = it->last_write_time(err);
+		if (err)
+		{
+			err.clear();
+			continue;
+		}
+
+		totalBytes += file.bytes;
+		if (!filesystem::equivalent(file.name, keepFile, err))
+			fileArr.push_back(file);
+		err.clear();
+	}
+
+	// Remove the entries used least recently until the rest fit
+	sort(fileArr.begin(), fileArr.end(), UsedBefore);
+	for (size_t i = ZERO; i < fileArr.size() && totalBytes > maxBytes; i++)
+		if (filesystem::remove(fileArr[i].name, err))
+		{
+			totalBytes -= fileArr[i].bytes;
+			evictCt++;
+		}
+
+}// end Evict
+
+
+
+
+// O(N^2)
+// Pre: The board with its walls and costs set, its entrance and exits, and the run's options
+// Post: The key is returned, the same for any two runs that print the same files
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+string CacheKey(/*IN*/const GameBoard& board,		// The board being solved
+				/*IN*/const LayoutRec& layout,		// The entrance and exits
+				/*IN*/const OptionsRec& opts)		// The options it is solved with
+{
+	string key;						// The key being built
+	vector<unsigned char> wallArr;	// The walls, a bit per cell in row major order
+	Location2DRec loc;				// The cell being read
+	long long cell;					// Its index in row major order
+	int rows;						// Number of rows in the gameboard
+	int cols;						// Number of columns in the gameboard
+
+	board.GetSize(rows, cols);
+
+	try
+	{
+		// The size, entrance and exits
+		AppendValue(key, rows);
+		AppendValue(key, cols);
+		AppendValue(key, layout.start.x);
+		AppendValue(key, layout.start.y);
+		AppendValue(key, (long long)layout.exits.size());
+		for (size_t i = ZERO; i < layout.exits.size(); i++)
+		{
+			AppendValue(key, layout.exits[i].loc.x);
+			AppendValue(key, layout.exits[i].loc.y);
+			AppendValue(key, (long long)layout.exits[i].dir.size());
+			key.append(layout.exits[i].dir);
+		}
+
+		// The options that change what is printed
+		AppendValue(key, opts.maxLen);
+		AppendValue(key, opts.minLen);
+		AppendValue(key, opts.noPaths);
+		AppendValue(key, opts.firstPath);
+		AppendValue(key, opts.lastPath);
+		AppendValue(key, opts.cheapest);
+		AppendValue(key, opts.shortest);
+		AppendValue(key, !opts.statsBase.empty());
+		AppendValue(key, opts.dirOrder);
+
+		// The walls
+		wallArr.assign(((long long)rows * cols + BITS_PER_BYTE - OFFSET) / BITS_PER_BYTE, ZERO);
+		for (loc.x = ZERO; loc.x < rows; loc.x++)
+			for (loc.y = ZERO; loc.y < cols; loc.y++)
+				if (board.GetStatus(loc) == WALL)
+				{
+					cell = (long long)loc.x * cols + loc.y;
+					wallArr[cell / BITS_PER_BYTE] |= (unsigned char)(OFFSET << (cell % BITS_PER_BYTE));
+				}
+		key.append(wallArr.begin(), wallArr.end());
+
+		// The costs are only read for the cheapest paths
+		if (opts.cheapest)
+			for (loc.x = ZERO; loc.x < rows; loc.x++)
+				for (loc.y = ZERO; loc.y < cols; loc.y++)
+					key.push_back((char)board.GetCost(loc));
+	}
+	catch (std::bad_alloc)	// The heap space memory has run out
+	{
+		// Throw the exception
+		throw GBOutOfMemoryException();
+	}
+
+	return key;
+
+}// end CacheKey
+
+
+
+
+// O(B) for a file of B bytes
+// Pre: The name of the file
+// Post: content holds the file's bytes and true is returned, false is returned if it cannot be read
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+bool ReadWholeFile(/*IN*/const string& fileName,	// The file being read
+				   /*OUT*/string& content)			// Its bytes
+{
+	ifstream fin;				// The file reader
+	error_code err;				// Holds any error from sizing the file
+	long long fileBytes;		// The size of the file
+
+	content.clear();
+
+	fileBytes = (long long)filesystem::file_size(fileName, err);
+	fin.open(fileName, ios::binary);
+	if (err || !fin)
+		return false;
+
+	try
+	{
+		content.resize((size_t)fileBytes);
+	}
+	catch (std::bad_alloc)	// The heap space memory has run out
+	{
+		// Throw the exception
+		throw GBOutOfMemoryException();
+	}
+	fin.read(&content[ZERO], fileBytes);
+
+	return fin.gcount() == fileBytes;
+
+}// end ReadWholeFile
@@ -0,0 +1,210 @@
+#pragma once
+/*
+	FileName : resultcache.h
+	Author: Christian Siletti
+	Date: 5/8/24
+	Project Maze
+
+	PURPOSE:
+		Contains the specifications for a ResultCache Class. A result cache keeps the files a
+		run printed in a directory on disk, filed under what the run was asked, so a later run
+		asked the same thing about the same board reads them back instead of searching again.
+
+		What a run was asked is its key: the board's size, entrance, exits (with their directions),
+		a bitmap of its walls, its cell costs when they matter, and every option that changes what
+		is printed. Two input files that only differ in the order or spacing of their lines have
+		the same key. An entry is named by the FNV-1a hash of its key, and holds the key itself,
+		so an entry whose hash matches but whose key does not (a collision, or a damaged file)
+		is never used.
+
+		Each entry holds any number of parts, a name and the bytes of the file saved under it.
+		The cache is bounded by the size of its directory: once storing an entry takes it over
+		its size, the entries used least recently are removed until it fits. An entry is used
+		when it is stored or read back, which moves its file's modified time up to now.
+
+
+	ASSUMPTIONS:
+		1) Only one run writes to a cache directory at a time, a run reading it while another
+		   stores into it can only miss, as entries are written to a temporary file first
+		2) The engines print the same paths in the same order, so the engine is not in the key.
+		   The neighbour order (see dirorder.h) changes the order the paths are numbered in, so it is
+		   in the key
+		3) Every file in the directory ending in CACHE_ENTRY_EXT is an entry
+
+
+	EXCEPTION HANDLING/ERROR CHECKING:
+		1) Open returns false if the directory cannot be created.
+		2) Fetch returns false for an entry that is missing, is not an entry, or has another key.
+		3) Store returns false, and leaves the cache as it was, for an entry that cannot be
+		   written or is bigger than the whole cache.
+		4) GBOutOfMemoryException thrown when memory from the heap has run out
+
+
+	FILE LAYOUT:
+		DIR/<16 hex digits>.mzc (binary) is "MZRC", version, the key's length and bytes, the
+		number of parts, then each part's name length and name, and its length and bytes
+
+
+						   SUMMARY OF METHODS:
+	PUBLIC METHODS
+		ResultCache() - Instantiate a cache with no directory
+		bool Open(*IN*const string& dirName,			// The cache directory
+				  *IN*const long long& maxBytes)		// The most the entries may take up
+					- Use a directory as the cache, creating it if needed
+		bool IsOpen() const - Check if a directory is being used
+		bool Fetch(*IN*const string& key,					// What the run was asked
+				   *OUT*vector<CachePartRec>& partArr)		// The files the run printed
+					- Read back the entry for a key
+		bool Store(*IN*const string& key,						// What the run was asked
+				   *IN*const vector<CachePartRec>& partArr)		// The files the run printed
+					- Save the entry for a key and make room for it
+		int GetEvictCt() const - Return the number of entries removed to make room
+
+
+	PRIVATE MEMBERS:
+		string dirName;			// The cache directory, empty if not open
+		long long maxBytes;		// The most the entries may take up
+		int evictCt;			// The number of entries removed to make room
+
+	PRIVATE METHODS:
+		string EntryFile(*IN*const string& key) const	// What the run was asked
+					- Get the name of a key's entry file
+		void Evict(*IN*const string& keepFile)			// The entry just stored
+					- Remove the entries used least recently until the cache fits
+
+
+						   SUMMARY OF FUNCTIONS:
+	string CacheKey(*IN*const GameBoard& board,		// The board being solved
+					*IN*const LayoutRec& layout,	// The entrance and exits
+					*IN*const OptionsRec& opts)		// The options it is solved with
+		- Describe what a run is asked, in a normal form
+	bool ReadWholeFile(*IN*const string& fileName,		// The file being read
+					   *OUT*string& content)			// Its bytes
+		- Read a whole file into a string
+*/
+
+#include "gameboard.h"		// Allows access to the gameboard ADT
+#include "layoutrec.h"		// The entrance and exits record
+#include "optionsrec.h"		// The command line options record
+#include <string>			// For the keys and the parts' bytes
+#include <vector>			// For the parts of an entry
+
+using namespace std;    // Standard namespace
+
+
+const int DEFAULT_CACHE_MB = 256;			// The default size of a cache directory, in megabytes
+const string CACHE_ENTRY_EXT = ".mzc";		// Ends the name of an entry file
+
+
+// A file saved in a cache entry
+struct CachePartRec
+{
+	string name;		// What the file is saved under
+	string content;		// The file's bytes
+};
+
+
+
+class ResultCache
+{
+public:
+
+	// O(1) - Default Constructor
+	// Purpose: Instantiate a cache with no directory
+	// Pre: N/A
+	// Post: A cache that is not open is created
+	ResultCache();
+
+
+
+	// O(1)
+	// Purpose: Use a directory as the cache, creating it if needed
+	// Pre: The cache directory and the most its entries may take up
+	// Post: The cache is open on the directory and true is returned,
+	//		 false is returned if it cannot be created
+	bool Open(/*IN*/const string& dirName,			// The cache directory
+			  /*IN*/const long long& maxBytes);		// The most the entries may take up
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Check if a directory is being used
+	// Pre: N/A
+	// Post: true is returned if the cache is open
+	bool IsOpen() const;
+
+
+
+	// O(K + B) for a key of K bytes and parts of B bytes
+	// Purpose: Read back the entry for a key
+	// Pre: The cache is open and the key of the run
+	// Post: partArr holds the entry's parts, and the entry is marked used, and true is returned.
+	//		 false is returned, with partArr empty, if there is no entry with the same key
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	bool Fetch(/*IN*/const string& key,						// What the run was asked
+			   /*OUT*/vector<CachePartRec>& partArr);		// The files the run printed
+
+
+
+	// O(K + B + E log E) for a key of K bytes, parts of B bytes and E entries in the cache
+	// Purpose: Save the entry for a key and make room for it
+	// Pre: The cache is open, the key of the run and the files it printed
+	// Post: The entry replaces any entry with the same hash, and the entries used least recently
+	//		 are removed until the cache fits, and true is returned. false is returned if the
+	//		 entry could not be written or is bigger than the cache
+	bool Store(/*IN*/const string& key,							// What the run was asked
+			   /*IN*/const vector<CachePartRec>& partArr);		// The files the run printed
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return the number of entries removed to make room
+	// Pre: N/A
+	// Post: The number of entries Store has removed is returned
+	int GetEvictCt() const;
+
+
+
+private:
+	string dirName;			// The cache directory, empty if not open
+	long long maxBytes;		// The most the entries may take up
+	int evictCt;			// The number of entries removed to make room
+
+
+
+	// O(K) for a key of K bytes
+	// Purpose: Get the name of a key's entry file
+	// Pre: The cache is open
+	// Post: The directory, the key's hash in hex digits and CACHE_ENTRY_EXT are returned
+	string EntryFile(/*IN*/const string& key) const;	// What the run was asked
+
+
+
+	// O(E log E) for E entries in the cache
+	// Purpose: Remove the entries used least recently until the cache fits
+	// Pre: The cache is open and an entry has just been stored
+	// Post: The entries left, always including the one just stored, take up no more than maxBytes
+	void Evict(/*IN*/const string& keepFile);		// The entry just stored
+
+};
+
+
+
+// O(N^2)
+// Purpose: Describe what a run is asked, in a normal form
+// Pre: The board with its walls and costs set, its entrance and exits, and the run's options
+// Post: The key is returned, the same for any two runs that print the same files
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+string CacheKey(/*IN*/const GameBoard& board,		// The board being solved
+				/*IN*/const LayoutRec& layout,		// The entrance and exits
+				/*IN*/const OptionsRec& opts);		// The options it is solved with
+
+
+
+// O(B) for a file of B bytes
+// Purpose: Read a whole file into a string
+// Pre: The name of the file
+// Post: content holds the file's bytes and true is returned, false is returned if it cannot be read
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+bool ReadWholeFile(/*IN*/const string& fileName,	// The file being read
+				   /*OUT*/string& content);			// Its bytes
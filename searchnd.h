@@ -0,0 +1,331 @@
+#pragma once
+/*
+	FileName : searchnd.h
+	Author: Christian Siletti
+	Date: 5/4/24
+	Project Maze
+
+	PURPOSE:
+		Contains the search that finds every path from the entrance to the exits of a board with
+		any number of dimensions (see boardnd.h), and the breadth first distances it cuts paths
+		that are too long short with. Both are templates on the number of dimensions, so for a
+		layered board the compiler sees its six moves as six fixed offsets into the cell array.
+
+		The search walks the board the way FindPaths walks a GameBoard (see pathsearch.h): each
+		cell's directions are tried in the board's order, a lone exit is as far as a path goes,
+		and with several exits a path is printed at each exit it reaches and goes on to the others.
+		It keeps the cells on the path and the next direction to try from each on two arrays,
+		and hands each path found to the PathWriter.
+
+		GetShortestPathND walks the same distances down from the entrance, a move closer to an exit
+		each step, so one shortest path is found without searching.
+
+
+	ASSUMPTIONS:
+		1) An exit's own direction movement is made on its tile to exit the board
+		2) The layout's entrance and exits are on the board, and the entrance is open
+		3) With one exit the entrance is not the exit, with several exits an entrance that is an exit
+		   is printed as a path of only the exit movement
+		4) The length limits and --no-paths work as they do in FindPaths, and with --to M the search
+		   stops once path M is found. A layered search is not checkpointed, traced, viewed or ranked
+
+
+	EXCEPTION HANDLING/ERROR CHECKING:
+		1) Cells that cannot reach an exit are given NO_DISTANCE.
+		2) GBOutOfMemoryException thrown when memory from the heap has run out
+
+
+						   SUMMARY OF FUNCTIONS:
+	void MeasureDistancesND(*IN*const BoardND<DIMS>& board,		// The board being measured
+							*IN*const LayoutNDRec<DIMS>& layout,	// The entrance and exits
+							*OUT*vector<int>& distArr)				// Each cell's distance, by cell index
+		- Measure every cell's fewest moves to the nearest exit that is not a wall
+	bool GetShortestPathND(*IN*const BoardND<DIMS>& board,		// The board measured
+						   *IN*const vector<int>& distArr,		// Each cell's distance from the exit
+						   *IN*const int& from,					// The cell the path starts on
+						   *OUT*string& pathText,				// The directions travelled
+						   *OUT*int& end)						// The exit cell the path finishes on
+		- Walk a shortest path from a cell to the nearest exit
+	void FindPathsND(*IN/OUT*BoardND<DIMS>& board,			// The board being searched
+					 *IN*const LayoutNDRec<DIMS>& layout,	// The entrance and exits
+					 *IN*const OptionsRec& opts,			// The options the search runs with
+					 *IN*const vector<int>& distArr,		// Each cell's distance from the exit
+					 *IN/OUT*PathWriter& writer,			// The writer printing the paths
+					 *OUT*long long& pathCt)				// The number of paths found
+		- Find every path from the entrance to the exits and print them to the output file
+	void FlattenLayout(*IN*const LayoutNDRec<DIMS>& layout,	// The entrance and exits
+					   *OUT*LayoutRec& flat)				// The layout the path writer is started with
+		- Copy the exits' directions into a LayoutRec for the path writer
+*/
+
+#include "boardnd.h"		// The board, location and directions searched
+#include "layoutrec.h"		// The layout the path writer labels paths with
+#include "optionsrec.h"		// The command line options record
+#include "distancemap.h"	// For NO_DISTANCE
+#include "pathwriter.h"		// For printing the paths off the search's thread
+#include "pathsearch.h"		// For WithinLenLimits
+#include <vector>			// For the path and the distances
+#include <string>			// For the printed directions
+
+using namespace std;    // Standard namespace
+
+
+
+// O(N)
+// Purpose: Measure every cell's fewest moves to the nearest exit that is not a wall
+// Pre: The board with only its walls set, and its layout
+// Post: distArr holds each cell's distance by its index on the board,
+//		 NO_DISTANCE for walls and cells that cannot reach an exit
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+template <int DIMS>
+void MeasureDistancesND(/*IN*/const BoardND<DIMS>& board,			// The board being measured
+						/*IN*/const LayoutNDRec<DIMS>& layout,		// The entrance and exits
+						/*OUT*/vector<int>& distArr)				// Each cell's distance, by cell index
+{
+	vector<int> queue;		// The cells waiting to have their neighbours measured
+	size_t front = ZERO;	// The position of the next cell in the queue
+	int cell;				// The cell being measured from
+	int next;				// Its neighbour
+
+	try
+	{
+		distArr.assign(board.GetCellCount(), NO_DISTANCE);
+		queue.reserve(board.GetCellCount());
+	}
+	catch (std::bad_alloc)	// The heap space memory has run out
+	{
+		// Throw the exception
+		throw GBOutOfMemoryException();
+	}
+
+	// Every exit that is not a wall is zero moves away
+	for (size_t i = ZERO; i < layout.exits.size(); i++)
+	{
+		cell = board.GetCell(layout.exits[i].loc);
+		if (board.GetCellStatus(cell) != WALL && distArr[cell] == NO_DISTANCE)
+		{
+			distArr[cell] = ZERO;
+			queue.push_back(cell);
+		}
+	}
+
+	// Spread out one move at a time, the border is all walls so no move leaves the board
+	while (front < queue.size())
+	{
+		cell = queue[front++];
+		for (int d = ZERO; d < DirCountND(DIMS); d++)
+		{
+			next = cell + board.GetStep(d);
+			if (board.GetCellStatus(next) != WALL && distArr[next] == NO_DISTANCE)
+			{
+				distArr[next] = distArr[cell] + OFFSET;
+				queue.push_back(next);
+			}
+		}
+	}
+
+}// end MeasureDistancesND
+
+
+
+// O(N) for a path of N moves
+// Purpose: Walk a shortest path from a cell to the nearest exit
+// Pre: The board and the distances MeasureDistancesND measured on it
+// Post: pathText holds the path's directions, "D-" for each move, trying each cell's directions
+//		 in the board's order, and end holds the exit cell it finishes on. false is returned,
+//		 with pathText empty, if no exit can be reached from the cell
+template <int DIMS>
+bool GetShortestPathND(/*IN*/const BoardND<DIMS>& board,		// The board measured
+					   /*IN*/const vector<int>& distArr,		// Each cell's distance from the exit
+					   /*IN*/const int& from,					// The cell the path starts on
+					   /*OUT*/string& pathText,				// The directions travelled
+					   /*OUT*/int& end)						// The exit cell the path finishes on
+{
+	int dir;	// The direction being tried
+	int next;	// The neighbour being tried
+
+	pathText.clear();
+	end = from;
+	if (distArr[from] == NO_DISTANCE)
+		return false;
+
+	// Step to a neighbour one move closer until an exit is reached, the border walls keep every
+	// move on the board
+	while (distArr[end] != ZERO)
+	{
+		for (dir = ZERO; dir < DirCountND(DIMS); dir++)
+		{
+			next = end + board.GetStep(dir);
+			if (board.GetCellStatus(next) != WALL && distArr[next] == distArr[end] - OFFSET)
+				break;
+		}
+
+		pathText.append(DirTextND(dir), DIR_TEXT_LEN);
+		end = next;
+	}
+
+	return true;
+
+}// end GetShortestPathND
+
+
+
+// O(2^N)
+// Purpose: Find every path from the entrance to the exits and print them to the output file
+// Pre: The board with only its walls set, its layout, the options, the distances if a maximum
+//		length is set, and the started path writer
+// Post: Every path within the length limits is numbered and handed to the writer, and pathCt
+//		 holds how many were found. The search stops after the options' last path if one is set,
+//		 otherwise the board is left with only its walls set
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+template <int DIMS>
+void FindPathsND(/*IN/OUT*/BoardND<DIMS>& board,			// The board being searched
+				 /*IN*/const LayoutNDRec<DIMS>& layout,		// The entrance and exits
+				 /*IN*/const OptionsRec& opts,				// The options the search runs with
+				 /*IN*/const vector<int>& distArr,			// Each cell's distance from the exit
+				 /*IN/OUT*/PathWriter& writer,				// The writer printing the paths
+				 /*OUT*/long long& pathCt)					// The number of paths found
+{
+	int stepArr[DirCountND(DIMS)];	// How far each direction's move is in the cell array
+	vector<int> exitArr;			// Each cell's exit index, or NO_EXIT
+	vector<int> cellStack;			// The cells on the path, the entrance first
+	vector<int> dirStack;			// The next direction to try from each cell on the path
+	string pathText;				// The printed directions of the path, "D-" for each move
+	int dir;						// The direction being tried
+	int next;						// The cell being moved into
+	int exit;						// The exit index of the cell moved into
+	int pathLen = ZERO;				// The number of moves made in the current path
+	bool manyExits = layout.exits.size() > OFFSET;	// Holds if paths go on past an exit
+	bool printing = !opts.noPaths;	// Holds if the paths are printed
+
+	// Look the moves up once, and mark where the exits are
+	for (int d = ZERO; d < DirCountND(DIMS); d++)
+		stepArr[d] = board.GetStep(d);
+	try
+	{
+		exitArr.assign(board.GetCellCount(), NO_EXIT);
+		for (int i = ZERO; i < (int)layout.exits.size(); i++)
+			exitArr[board.GetCell(layout.exits[i].loc)] = i;
+	}
+	catch (std::bad_alloc)	// The heap space memory has run out
+	{
+		// Throw the exception
+		throw GBOutOfMemoryException();
+	}
+	pathCt = ZERO;
+
+	// Start at the entrance
+	next = board.GetCell(layout.start);
+	board.SetCellStatus(next, VISITED);
+	cellStack.push_back(next);
+	dirStack.push_back(ZERO);
+
+	// An entrance that is an exit is a path of only the exit move
+	exit = exitArr[next];
+	if (exit != NO_EXIT && WithinLenLimits(OFFSET, opts))
+	{
+		pathCt++;
+		if (printing)
+		{
+			writer.BeginPath(pathCt, exit);
+			writer.EndPath();
+		}
+
+		// Stop once the last path wanted is found
+		if (pathCt == opts.lastPath)
+			return;
+	}
+
+	// Repeat until the entrance has been backed out of
+	while (!cellStack.empty())
+	{
+		// Every direction from the top of the path has been tried, so back track
+		dir = dirStack.back();
+		if (dir == DirCountND(DIMS))
+		{
+			board.SetCellStatus(cellStack.back(), OPEN);
+			cellStack.pop_back();
+			dirStack.pop_back();
+			if (!cellStack.empty())
+			{
+				pathLen--;
+				if (printing)
+					pathText.resize(pathText.length() - DIR_TEXT_LEN);
+			}
+			continue;
+		}
+
+		// Try the next direction, the border walls keep every move on the board
+		dirStack.back()++;
+		next = cellStack.back() + stepArr[dir];
+		if (board.GetCellStatus(next) != OPEN ||
+			(opts.maxLen > ZERO && (distArr[next] == NO_DISTANCE ||
+									pathLen + OFFSET + distArr[next] + OFFSET > opts.maxLen)))
+			continue;
+
+		// Make the move
+		pathLen++;
+		if (printing)
+			pathText.append(DirTextND(dir), DIR_TEXT_LEN);
+
+		// Check if the cell is an exit cell, the exit move counts as a move
+		exit = exitArr[next];
+		if (exit != NO_EXIT && WithinLenLimits(pathLen + OFFSET, opts))
+		{
+			pathCt++;
+			if (printing)
+			{
+				// Hand the path to the writer - it tacks on the exit direction as the final movement
+				writer.BeginPath(pathCt, exit);
+				writer.AddText(pathText.data(), pathText.length());
+				writer.EndPath();
+			}
+
+			// Stop once the last path wanted is found
+			if (pathCt == opts.lastPath)
+				return;
+		}
+
+		// A lone exit is as far as a path goes, with several exits the path goes on to the others
+		if (exit != NO_EXIT && !manyExits)
+		{
+			pathLen--;
+			if (printing)
+				pathText.resize(pathText.length() - DIR_TEXT_LEN);
+			continue;
+		}
+
+		// Go on from the new cell
+		board.SetCellStatus(next, VISITED);
+		cellStack.push_back(next);
+		dirStack.push_back(ZERO);
+
+	}// end while
+
+}// end FindPathsND
+
+
+
+// O(N)
+// Purpose: Copy the exits' directions into a LayoutRec for the path writer
+// Pre: The layout of a board with any number of dimensions
+// Post: flat holds the entrance and exits on their rows and columns, with each exit's direction,
+//		 which is all the path writer reads from them
+template <int DIMS>
+void FlattenLayout(/*IN*/const LayoutNDRec<DIMS>& layout,		// The entrance and exits
+				   /*OUT*/LayoutRec& flat)						// The layout the path writer is started with
+{
+	ExitRec exitItem;	// The exit being copied
+
+	flat.start.x = layout.start.pos[ZERO];
+	flat.start.y = layout.start.pos[OFFSET];
+	flat.exits.clear();
+	for (size_t i = ZERO; i < layout.exits.size(); i++)
+	{
+		exitItem.loc.x = layout.exits[i].loc.pos[ZERO];
+		exitItem.loc.y = layout.exits[i].loc.pos[OFFSET];
+		exitItem.dir = layout.exits[i].dir;
+		flat.exits.push_back(exitItem);
+	}
+
+}// end FlattenLayout
@@ -0,0 +1,351 @@
+// Project Maze
+// FileName : searchtrace.cpp
+// Author: Christian Siletti
+// Purpose : This file contains the implementation for all of the methods
+//			 defined in searchtrace.h
+
+#include "searchtrace.h"	// The header file
+#include <algorithm>		// For comparing the file mark
+#include <new>				// Contains the bad_alloc exception
+
+const char TRACE_MAGIC[] = { 'M', 'Z', 'T', 'R' };	// Marks the start of a trace file
+const int TRACE_MAGIC_LEN = 4;						// The number of characters in the mark
+const int TRACE_VERSION = 1;						// The trace file layout version
+const size_t TRACE_BUFFER_SIZE = 1 << 16;			// The number of bytes written or read at once
+const unsigned int TRACE_DIR_MASK = 3;				// Picks a push's direction out of its bits
+
+
+
+// O(1) - Default Constructor
+// Pre: N/A
+// Post: A writer that is not tracing is created
+TraceWriter::TraceWriter()
+{
+	bufferLen = ZERO;
+	bits = ZERO;
+	bitCt = ZERO;
+
+}// end DC
+
+
+
+
+// O(1) - Destructor
+// Pre: N/A
+// Post: The trace file is closed
+TraceWriter::~TraceWriter()
+{
+	Close();
+
+}// end Destructor
+
+
+
+
+// O(N^2) - Mutator
+// Pre: The board with its walls set and its entrance
+// Post: The trace file holds the board and true is returned, false is returned if it could not be created
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+bool TraceWriter::Open(/*IN*/const string& fileName,			// The trace file
+					   /*IN*/const GameBoard& board,			// The board being searched
+					   /*IN*/const Location2DRec& start)		// The entrance of the board
+{
+	vector<unsigned char> wallArr;	// The wall bitmap, one bit per cell, row major
+	Location2DRec loc;				// The cell being read
+	int rows;						// Number of rows in the gameboard
+	int cols;						// Number of columns in the gameboard
+	int cell;						// A cell's row major index
+
+	// Open the trace file
+	fout.open(fileName, ios::binary | ios::trunc);
+	if (!fout)
+		return false;
+
+	board.GetSize(rows, cols);
+
+	try
+	{
+		// Pack the walls
+		wallArr.assign(((long long)rows * cols + BITS_PER_BYTE - OFFSET) / BITS_PER_BYTE, ZERO);
+		for (loc.x = ZERO; loc.x < rows; loc.x++)
+			for (loc.y = ZERO; loc.y < cols; loc.y++)
+				if (board.GetStatus(loc) == WALL)
+				{
+					cell = loc.x * cols + loc.y;
+					wallArr[cell / BITS_PER_BYTE] |= (unsigned char)(OFFSET << (cell % BITS_PER_BYTE));
+				}
+
+		buffer.assign(TRACE_BUFFER_SIZE, ZERO);
+	}
+	catch (std::bad_alloc)	// The heap space memory has run out
+	{
+		// Throw the exception
+		throw GBOutOfMemoryException();
+	}
+
+	// Write the board
+	fout.write(TRACE_MAGIC, TRACE_MAGIC_LEN);
+	fout.write(reinterpret_cast<const char*>(&TRACE_VERSION), sizeof(TRACE_VERSION));
+	fout.write(reinterpret_cast<const char*>(&rows), sizeof(rows));
+	fout.write(reinterpret_cast<const char*>(&cols), sizeof(cols));
+	fout.write(reinterpret_cast<const char*>(&start.x), sizeof(start.x));
+	fout.write(reinterpret_cast<const char*>(&start.y), sizeof(start.y));
+	fout.write(reinterpret_cast<const char*>(wallArr.data()), wallArr.size());
+
+	bufferLen = ZERO;
+	bits = ZERO;
+	bitCt = ZERO;
+
+	return (bool)fout;
+
+}// end Open
+
+
+
+
+// O(N) - Mutator
+// Pre: The trace is open and nothing has been traced, the path starts at the entrance
+// Post: The path count is written and every move of the path is traced as a push
+void TraceWriter::Begin(/*IN*/const vector<StackRec>& path,	// The path the search starts from, the entrance first
+						/*IN*/const long long& pathCt)			// The number of paths found before the search started
+{
+	long long firstPathCt = pathCt;		// The path count as it is stored
+
+	fout.write(reinterpret_cast<const char*>(&firstPathCt), sizeof(firstPathCt));
+
+	// The entrance was not reached by a move
+	for (size_t i = OFFSET; i < path.size(); i++)
+		Push(path[i].dir);
+
+}// end Begin
+
+
+
+
+// O(1) - Mutator
+// Pre: N/A
+// Post: Everything traced is in the trace file and it is closed, nothing happens if it was not open
+void TraceWriter::Close()
+{
+	// Nothing to close if no trace was opened
+	if (!fout.is_open())
+		return;
+
+	// Mark the end, then move the bits left over into the buffer a byte at a time
+	PutBits(TRACE_END, TRACE_CODE_BITS);
+	if (bufferLen + sizeof(unsigned int) > buffer.size())
+		FlushBuffer();
+	for (int i = ZERO; i < bitCt; i += BITS_PER_BYTE)
+		buffer[bufferLen++] = (char)((bits >> i) & 0xFF);
+	bits = ZERO;
+	bitCt = ZERO;
+
+	// Write what is left and close the file
+	FlushBuffer();
+	fout.close();
+
+}// end Close
+
+
+
+
+// O(N) - Mutator Helper
+// Pre: N/A
+// Post: The buffer is empty
+void TraceWriter::FlushBuffer()
+{
+	fout.write(buffer.data(), bufferLen);
+	bufferLen = ZERO;
+
+}// end FlushBuffer
+
+
+
+
+// O(1) - Default Constructor
+// Pre: N/A
+// Post: A reader with no board is created
+TraceReader::TraceReader()
+{
+	maxRows = ZERO;
+	maxCols = ZERO;
+	start = START_POS;
+	firstPathCt = ZERO;
+	bufferPos = ZERO;
+	bufferLen = ZERO;
+	bits = ZERO;
+	bitCt = ZERO;
+
+}// end DC
+
+
+
+
+// O(N^2) - Mutator
+// Pre: N/A
+// Post: The board is read in and true is returned,
+//		 false is returned if the file is missing or is not a trace
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+bool TraceReader::Open(/*IN*/const string& fileName)	// The trace file
+{
+	char magic[TRACE_MAGIC_LEN];	// The mark at the start of the file
+	int version = ZERO;				// The file layout version
+
+	// Open the file
+	fin.open(fileName, ios::binary);
+	if (!fin)
+		return false;
+
+	// Check that it is a trace file
+	fin.read(magic, TRACE_MAGIC_LEN);
+	fin.read(reinterpret_cast<char*>(&version), sizeof(version));
+	if (!fin || !equal(magic, magic + TRACE_MAGIC_LEN, TRACE_MAGIC) || version != TRACE_VERSION)
+		return false;
+
+	// Read the size and entrance, make sure they make sense before sizing anything off of them
+	fin.read(reinterpret_cast<char*>(&maxRows), sizeof(maxRows));
+	fin.read(reinterpret_cast<char*>(&maxCols), sizeof(maxCols));
+	fin.read(reinterpret_cast<char*>(&start.x), sizeof(start.x));
+	fin.read(reinterpret_cast<char*>(&start.y), sizeof(start.y));
+	if (!fin || maxRows <= ZERO || maxCols <= ZERO || start.x < ZERO || start.x >= maxRows ||
+		start.y < ZERO || start.y >= maxCols)
+		return false;
+
+	try
+	{
+		wallArr.resize(((long long)maxRows * maxCols + BITS_PER_BYTE - OFFSET) / BITS_PER_BYTE);
+		buffer.assign(TRACE_BUFFER_SIZE, ZERO);
+	}
+	catch (std::bad_alloc)	// The heap space memory has run out
+	{
+		// Throw the exception
+		throw GBOutOfMemoryException();
+	}
+
+	// Read the walls and the path count the trace began with
+	fin.read(reinterpret_cast<char*>(wallArr.data()), wallArr.size());
+	fin.read(reinterpret_cast<char*>(&firstPathCt), sizeof(firstPathCt));
+
+	bufferPos = ZERO;
+	bufferLen = ZERO;
+	bits = ZERO;
+	bitCt = ZERO;
+
+	return (bool)fin;
+
+}// end Open
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: The trace is open
+// Post: rows and cols hold the board's size
+void TraceReader::GetSize(/*OUT*/int& rows,				// The number of rows in the board
+						  /*OUT*/int& cols) const		// The number of columns in the board
+{
+	rows = maxRows;
+	cols = maxCols;
+
+}// end GetSize
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: The trace is open
+// Post: The entrance is returned
+Location2DRec TraceReader::GetStart() const
+{
+	return start;
+
+}// end GetStart
+
+
+
+
+// O(1) - Observer Predicate
+// Pre: The trace is open and the cell is on the board
+// Post: true is returned if the cell is a wall
+bool TraceReader::IsWall(/*IN*/const Location2DRec& loc) const	// The cell being checked
+{
+	int cell = loc.x * maxCols + loc.y;		// The cell's row major index
+
+	return (wallArr[cell / BITS_PER_BYTE] >> (cell % BITS_PER_BYTE)) & OFFSET;
+
+}// end IsWall
+
+
+
+
+// O(1) - Observer Accessor
+// Pre: The trace is open
+// Post: The path count the trace began with is returned
+long long TraceReader::GetFirstPathCt() const
+{
+	return firstPathCt;
+
+}// end GetFirstPathCt
+
+
+
+
+// O(1) - Mutator
+// Pre: The trace is open
+// Post: The next event is returned and dir holds its direction if it is a push.
+//		 TRACE_END is returned once the trace has ended
+TraceEventEnum TraceReader::Next(/*OUT*/DirectionEnum& dir)		// The direction of a push
+{
+	unsigned int code;		// The event's code
+	unsigned int dirBits;	// The bits of a push's direction
+
+	// A trace that ran out ended there
+	if (!GetBits(TRACE_CODE_BITS, code))
+		return TRACE_END;
+
+	// A push is followed by its direction
+	if (code == TRACE_PUSH)
+	{
+		if (!GetBits(TRACE_DIR_BITS, dirBits))
+			return TRACE_END;
+		dir = (DirectionEnum)(NORTH + (dirBits & TRACE_DIR_MASK));
+	}
+
+	return (TraceEventEnum)code;
+
+}// end Next
+
+
+
+
+// O(1) - Mutator Helper
+// Pre: 0 < ct < TRACE_WORD_BITS
+// Post: value holds the bits and true is returned, false is returned if the trace ran out
+bool TraceReader::GetBits(/*IN*/int ct,					// The number of bits wanted
+						  /*OUT*/unsigned int& value)	// The bits read
+{
+	// Read in bytes until there are enough bits
+	while (bitCt < ct)
+	{
+		// Refill the buffer once it is used up
+		if (bufferPos == bufferLen)
+		{
+			fin.read(buffer.data(), buffer.size());
+			bufferLen = (size_t)fin.gcount();
+			bufferPos = ZERO;
+			if (bufferLen == ZERO)
+				return false;
+		}
+
+		bits |= (unsigned long long)(unsigned char)buffer[bufferPos++] << bitCt;
+		bitCt += BITS_PER_BYTE;
+	}
+
+	// Take the lowest bits
+	value = (unsigned int)(bits & ((OFFSET << ct) - OFFSET));
+	bits >>= ct;
+	bitCt -= ct;
+
+	return true;
+
+}// end GetBits
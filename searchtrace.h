@@ -0,0 +1,386 @@
+#pragma once
+/*
+	FileName : searchtrace.h
+	Author: Christian Siletti
+	Date: 4/28/24
+	Project Maze
+
+	PURPOSE:
+		Contains the specifications for the TraceWriter and TraceReader Classes. A trace is a
+		record of every step a search takes, so a search can be watched afterwards at any speed,
+		or stopped on any path it found, without running it again.
+
+		A search is made of three events: a move into a cell (a push), a move back out of it
+		(a pop), and a path being found at the cell the path is on. Every event starts with a
+		2 bit code and a push adds the 2 bit direction it moved in, so a push takes 4 bits and the
+		others take 2. The cell of a push is the cell before it moved in the push's direction,
+		so no cells are stored. The events are packed into 32 bit words and written through
+		a buffer, a large block at a time.
+
+		Every engine traces one move at a time, a graph edge many moves long is traced as that
+		many pushes, so a trace reads the same whichever engine ran it. The board and graph engines
+		trace the same events, the corridor engine leaves out the dead ends it trimmed.
+
+
+	ASSUMPTIONS:
+		1) The trace begins with the path the search starts from, a resumed search pushes
+		   the path it was resumed with before anything else
+		2) A pop is never traced for the entrance, the path always holds it
+		3) A path found is counted against the path count written when the trace began
+
+
+	EXCEPTION HANDLING/ERROR CHECKING:
+		1) Open returns false if the trace file cannot be written or read, or is not a trace.
+		2) A trace that ends early (a search stopped without Close) reads as if it ended there.
+		3) GBOutOfMemoryException thrown when memory from the heap has run out
+
+
+	FILE LAYOUT (binary):
+		"MZTR", version, rows, cols, entrance x and y, wall bitmap (one bit per cell, row major),
+		the path count the trace began with, then the event bits, lowest bit first
+
+
+						   SUMMARY OF METHODS:
+	TRACEWRITER PUBLIC METHODS
+		TraceWriter() - Instantiate a writer with no trace file
+		~TraceWriter() - Close the trace file if it is still open
+		bool Open(*IN*const string& fileName,		// The trace file
+				  *IN*const GameBoard& board,		// The board being searched
+				  *IN*const Location2DRec& start)	// The entrance of the board
+					- Create a trace file and write the board to it
+		bool IsOpen() const - Check if a trace is being written
+		void Begin(*IN*const vector<StackRec>& path,	// The path the search starts from, the entrance first
+				   *IN*const long long& pathCt)			// The number of paths found before the search started
+					- Write the path count and the path the search starts from
+		void Push(*IN*const DirectionEnum& dir)	// The direction moved in
+					- Trace a move into a cell
+		void Pop() - Trace a move back out of the top cell of the path
+		void Found() - Trace a path found at the top cell of the path
+		void Close() - Trace the end of the search and close the trace file
+
+	TRACEWRITER PRIVATE MEMBERS:
+		ofstream fout;				// The trace file writer
+		vector<char> buffer;		// The bytes waiting to be written
+		size_t bufferLen;			// The number of bytes in the buffer
+		unsigned long long bits;	// The event bits not yet in the buffer, lowest first
+		int bitCt;					// The number of event bits not yet in the buffer
+
+	TRACEWRITER PRIVATE METHODS:
+		void PutBits(*IN*unsigned int value,	// The bits being added
+					 *IN*int ct)				// The number of bits being added
+					- Add an event's bits to the trace
+		void FlushBuffer() - Write the buffer out to the trace file
+
+	TRACEREADER PUBLIC METHODS
+		TraceReader() - Instantiate a reader with no trace file
+		bool Open(*IN*const string& fileName)	// The trace file
+					- Open a trace file and read the board from it
+		void GetSize(*OUT*int& rows,			// The number of rows in the board
+					 *OUT*int& cols) const		// The number of columns in the board
+					- Get the size of the traced board
+		Location2DRec GetStart() const - Get the entrance of the traced board
+		bool IsWall(*IN*const Location2DRec& loc) const	// The cell being checked
+					- Check if a cell of the traced board is a wall
+		long long GetFirstPathCt() const - Get the number of paths found before the trace began
+		TraceEventEnum Next(*OUT*DirectionEnum& dir)		// The direction of a push
+					- Read the next event of the trace
+
+	TRACEREADER PRIVATE MEMBERS:
+		ifstream fin;					// The trace file reader
+		int maxRows;					// The number of rows in the board
+		int maxCols;					// The number of columns in the board
+		Location2DRec start;			// The entrance of the board
+		vector<unsigned char> wallArr;	// The wall bitmap, one bit per cell, row major
+		long long firstPathCt;			// The number of paths found before the trace began
+		vector<char> buffer;			// The bytes read in and not yet used
+		size_t bufferPos;				// The next byte of the buffer to use
+		size_t bufferLen;				// The number of bytes in the buffer
+		unsigned long long bits;		// The event bits read in and not yet used, lowest first
+		int bitCt;						// The number of event bits read in and not yet used
+
+	TRACEREADER PRIVATE METHODS:
+		bool GetBits(*IN*int ct,				// The number of bits wanted
+					 *OUT*unsigned int& value)	// The bits read
+					- Take the next bits of the trace
+*/
+
+#include "gameboard.h"		// Allows access to the gameboard ADT
+#include "stackrec.h"		// The path entries a trace begins with
+#include "checkpoint.h"		// For the bitmap byte size
+#include <fstream>			// For trace file access
+#include <vector>			// For the buffers and the wall bitmap
+
+using namespace std;    // Standard namespace
+
+
+// Enumerated type for the events in a trace, the order is the code written for each
+enum TraceEventEnum { TRACE_PUSH, TRACE_POP, TRACE_FOUND, TRACE_END };
+
+const int TRACE_CODE_BITS = 2;		// The number of bits in an event's code
+const int TRACE_DIR_BITS = 2;		// The number of bits in a push's direction
+const int TRACE_WORD_BITS = 32;		// The number of bits moved into the buffer at once
+
+
+
+class TraceWriter
+{
+public:
+
+	// O(1) - Default Constructor
+	// Purpose: Instantiate a writer with no trace file
+	// Pre: N/A
+	// Post: A writer that is not tracing is created
+	TraceWriter();
+
+
+
+	// O(1) - Destructor
+	// Purpose: Close the trace file if it is still open
+	// Pre: N/A
+	// Post: The trace file is closed
+	~TraceWriter();
+
+
+
+	// O(N^2) - Mutator
+	// Purpose: Create a trace file and write the board to it
+	// Pre: The board with its walls set and its entrance
+	// Post: The trace file holds the board and true is returned, false is returned if it could not be created
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	bool Open(/*IN*/const string& fileName,			// The trace file
+			  /*IN*/const GameBoard& board,			// The board being searched
+			  /*IN*/const Location2DRec& start);	// The entrance of the board
+
+
+
+	// O(1) - Observer Predicate
+	// Purpose: Check if a trace is being written
+	// Pre: N/A
+	// Post: true is returned if the trace file is open
+	bool IsOpen() const;
+
+
+
+	// O(N) - Mutator
+	// Purpose: Write the path count and the path the search starts from
+	// Pre: The trace is open and nothing has been traced, the path starts at the entrance
+	// Post: The path count is written and every move of the path is traced as a push
+	void Begin(/*IN*/const vector<StackRec>& path,	// The path the search starts from, the entrance first
+			   /*IN*/const long long& pathCt);			// The number of paths found before the search started
+
+
+
+	// O(1) - Mutator
+	// Purpose: Trace a move into a cell
+	// Pre: The trace has begun, NORTH <= dir <= WEST
+	// Post: A push in the direction is traced
+	void Push(/*IN*/const DirectionEnum& dir);	// The direction moved in
+
+
+
+	// O(1) - Mutator
+	// Purpose: Trace a move back out of the top cell of the path
+	// Pre: The trace has begun and the path has a cell other than the entrance
+	// Post: A pop is traced
+	void Pop();
+
+
+
+	// O(1) - Mutator
+	// Purpose: Trace a path found at the top cell of the path
+	// Pre: The trace has begun
+	// Post: A path found is traced
+	void Found();
+
+
+
+	// O(1) - Mutator
+	// Purpose: Trace the end of the search and close the trace file
+	// Pre: N/A
+	// Post: Everything traced is in the trace file and it is closed, nothing happens if it was not open
+	void Close();
+
+
+
+private:
+	ofstream fout;				// The trace file writer
+	vector<char> buffer;		// The bytes waiting to be written
+	size_t bufferLen;			// The number of bytes in the buffer
+	unsigned long long bits;	// The event bits not yet in the buffer, lowest first
+	int bitCt;					// The number of event bits not yet in the buffer
+
+
+
+	// O(1) - Mutator Helper
+	// Purpose: Add an event's bits to the trace
+	// Pre: ct <= TRACE_WORD_BITS
+	// Post: The bits follow every bit added before them
+	void PutBits(/*IN*/unsigned int value,	// The bits being added
+				 /*IN*/int ct);				// The number of bits being added
+
+
+
+	// O(N) - Mutator Helper
+	// Purpose: Write the buffer out to the trace file
+	// Pre: N/A
+	// Post: The buffer is empty
+	void FlushBuffer();
+
+};
+
+
+
+class TraceReader
+{
+public:
+
+	// O(1) - Default Constructor
+	// Purpose: Instantiate a reader with no trace file
+	// Pre: N/A
+	// Post: A reader with no board is created
+	TraceReader();
+
+
+
+	// O(N^2) - Mutator
+	// Purpose: Open a trace file and read the board from it
+	// Pre: N/A
+	// Post: The board is read in and true is returned,
+	//		 false is returned if the file is missing or is not a trace
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	bool Open(/*IN*/const string& fileName);	// The trace file
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Get the size of the traced board
+	// Pre: The trace is open
+	// Post: rows and cols hold the board's size
+	void GetSize(/*OUT*/int& rows,				// The number of rows in the board
+				 /*OUT*/int& cols) const;		// The number of columns in the board
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Get the entrance of the traced board
+	// Pre: The trace is open
+	// Post: The entrance is returned
+	Location2DRec GetStart() const;
+
+
+
+	// O(1) - Observer Predicate
+	// Purpose: Check if a cell of the traced board is a wall
+	// Pre: The trace is open and the cell is on the board
+	// Post: true is returned if the cell is a wall
+	bool IsWall(/*IN*/const Location2DRec& loc) const;	// The cell being checked
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Get the number of paths found before the trace began
+	// Pre: The trace is open
+	// Post: The path count the trace began with is returned
+	long long GetFirstPathCt() const;
+
+
+
+	// O(1) - Mutator
+	// Purpose: Read the next event of the trace
+	// Pre: The trace is open
+	// Post: The next event is returned and dir holds its direction if it is a push.
+	//		 TRACE_END is returned once the trace has ended
+	TraceEventEnum Next(/*OUT*/DirectionEnum& dir);		// The direction of a push
+
+
+
+private:
+	ifstream fin;					// The trace file reader
+	int maxRows;					// The number of rows in the board
+	int maxCols;					// The number of columns in the board
+	Location2DRec start;			// The entrance of the board
+	vector<unsigned char> wallArr;	// The wall bitmap, one bit per cell, row major
+	long long firstPathCt;			// The number of paths found before the trace began
+
+	vector<char> buffer;			// The bytes read in and not yet used
+	size_t bufferPos;				// The next byte of the buffer to use
+	size_t bufferLen;				// The number of bytes in the buffer
+	unsigned long long bits;		// The event bits read in and not yet used, lowest first
+	int bitCt;						// The number of event bits read in and not yet used
+
+
+
+	// O(1) - Mutator Helper
+	// Purpose: Take the next bits of the trace
+	// Pre: 0 < ct < TRACE_WORD_BITS
+	// Post: value holds the bits and true is returned, false is returned if the trace ran out
+	bool GetBits(/*IN*/int ct,					// The number of bits wanted
+				 /*OUT*/unsigned int& value);	// The bits read
+
+};
+
+
+
+// O(1) - Observer Predicate
+// Defined here as the search checks it before every event
+inline bool TraceWriter::IsOpen() const
+{
+	return fout.is_open();
+
+}// end IsOpen
+
+
+
+// O(1) - Mutator Helper
+// Defined here as it runs for every event the search traces
+inline void TraceWriter::PutBits(/*IN*/unsigned int value,	// The bits being added
+								 /*IN*/int ct)				// The number of bits being added
+{
+	// Add the bits above the ones waiting
+	bits |= (unsigned long long)value << bitCt;
+	bitCt += ct;
+
+	// Move a full word into the buffer, lowest byte first
+	if (bitCt >= TRACE_WORD_BITS)
+	{
+		if (bufferLen + sizeof(unsigned int) > buffer.size())
+			FlushBuffer();
+
+		for (int i = ZERO; i < TRACE_WORD_BITS; i += BITS_PER_BYTE)
+			buffer[bufferLen++] = (char)((bits >> i) & 0xFF);
+
+		bits >>= TRACE_WORD_BITS;
+		bitCt -= TRACE_WORD_BITS;
+	}
+
+}// end PutBits
+
+
+
+// O(1) - Mutator
+// Defined here as it runs for every move the search makes
+inline void TraceWriter::Push(/*IN*/const DirectionEnum& dir)	// The direction moved in
+{
+	PutBits(TRACE_PUSH | ((unsigned int)(dir - NORTH) << TRACE_CODE_BITS), TRACE_CODE_BITS + TRACE_DIR_BITS);
+
+}// end Push
+
+
+
+// O(1) - Mutator
+// Defined here as it runs for every move the search takes back
+inline void TraceWriter::Pop()
+{
+	PutBits(TRACE_POP, TRACE_CODE_BITS);
+
+}// end Pop
+
+
+
+// O(1) - Mutator
+// Defined here as it runs for every path the search finds
+inline void TraceWriter::Found()
+{
+	PutBits(TRACE_FOUND, TRACE_CODE_BITS);
+
+}// end Found
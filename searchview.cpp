@@ -0,0 +1,284 @@
+// Project Maze
+// FileName : searchview.cpp
+// Author: Christian Siletti
+// Purpose : This file contains the implementation for all of the methods
+//			 defined in searchview.h
+
+#include "searchview.h"		// The header file
+#include <iostream>			// For console output
+#include <new>				// Contains the bad_alloc exception
+
+const int SCREEN_ROWS_PER_CELL = 2;		// A row of cells and the border under it
+const int SCREEN_COLS_PER_CELL = 4;		// A border and the three characters of a cell
+const int CELL_TEXT_OFFSET = 2;			// How far into its row a cell's text is, "| X " puts it two over
+const long long NO_PATHS_SHOWN = -1;	// The path count shown before anything is drawn
+
+
+
+// O(1) - Default Constructor
+// Pre: N/A
+// Post: A view with no board is created, it never wants a frame
+SearchView::SearchView()
+{
+	maxRows = ZERO;		// Nothing has been drawn yet
+	maxCols = ZERO;
+	framePeriod = chrono::nanoseconds(ZERO);
+	sharedPathCt = ZERO;
+	hasPath = false;
+	drawPathCt = ZERO;
+	shownPathCt = ZERO;
+	frameWanted = false;
+	running = false;
+
+}// end DC
+
+
+
+
+// O(N^2) - Destructor
+// Pre: N/A
+// Post: The drawing thread has finished
+SearchView::~SearchView()
+{
+	Stop();
+
+}// end Destructor
+
+
+
+
+// O(N^2) - Mutator
+// Pre: The board with its walls set, and a frame rate above zero
+// Post: The empty board is on the console and a frame is wanted fps times a second
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+void SearchView::Start(/*IN*/const GameBoard& board,	// The board being searched
+					   /*IN*/int fps)					// The number of frames drawn a second
+{
+	Location2DRec loc;	// The cell being read
+
+	// Get the size of the board and the time between frames
+	board.GetSize(maxRows, maxCols);
+	framePeriod = chrono::nanoseconds(NANOS_PER_SEC / fps);
+
+	try
+	{
+		// Remember the walls, the console starts out showing only them
+		wallArr.assign((size_t)maxRows * maxCols, false);
+		for (loc.x = ZERO; loc.x < maxRows; loc.x++)
+			for (loc.y = ZERO; loc.y < maxCols; loc.y++)
+				wallArr[(size_t)loc.x * maxCols + loc.y] = (board.GetStatus(loc) == WALL);
+
+		frameArr.assign(wallArr.size(), VIEW_OPEN);
+		shownArr.assign(wallArr.size(), VIEW_OPEN);
+	}
+	catch (std::bad_alloc)	// The heap space memory has run out
+	{
+		// Throw the exception
+		throw GBOutOfMemoryException();
+	}
+
+	// Clear the console and draw the table borders, every cell drawn as open
+	frameText = "\033[2J\033[H";
+	for (int i = ZERO; i < maxRows; i++)
+	{
+		for (int j = ZERO; j < maxCols; j++)
+			frameText += "+---";
+		frameText += "+\n";
+
+		for (int j = ZERO; j < maxCols; j++)
+			frameText += "|   ";
+		frameText += "|\n";
+	}
+	for (int j = ZERO; j < maxCols; j++)
+		frameText += "+---";
+	frameText += "+\n";
+
+	// Draw the walls and the path count over the empty table
+	cout.write(frameText.data(), frameText.length());
+	drawPath.clear();
+	drawPathCt = ZERO;
+	shownPathCt = NO_PATHS_SHOWN;
+	DrawFrame();
+
+	// Start drawing
+	hasPath = false;
+	frameWanted = false;
+	running = true;
+	drawThread = thread(&SearchView::DrawLoop, this);
+
+}// end Start
+
+
+
+
+// O(N) - Mutator
+// Pre: The cells of the path from the entrance to the head, and the number of paths found
+// Post: The path is copied for the drawing thread and the frame is no longer wanted
+void SearchView::Publish(/*IN*/const vector<StackRec>& path,	// The cells of the path, the head last
+						 /*IN*/long long pathCt)				// The number of paths found
+{
+	// Hand the path over
+	{
+		lock_guard<mutex> lock(pathLock);
+		sharedPath = path;
+		sharedPathCt = pathCt;
+		hasPath = true;
+		frameWanted.store(false, memory_order_relaxed);
+	}
+
+	// Wake the drawing thread
+	pathReady.notify_one();
+
+}// end Publish
+
+
+
+
+// O(N^2) - Mutator
+// Pre: N/A
+// Post: The drawing thread has finished, nothing happens if the view was not started
+void SearchView::Stop()
+{
+	// Nothing to stop if the view never started
+	if (!drawThread.joinable())
+		return;
+
+	// Tell the drawing thread to finish, then wait for it
+	{
+		lock_guard<mutex> lock(pathLock);
+		running = false;
+	}
+	pathReady.notify_one();
+	drawThread.join();
+	frameWanted = false;
+
+	// Draw the last path handed over
+	if (hasPath)
+	{
+		drawPath.swap(sharedPath);
+		drawPathCt = sharedPathCt;
+		hasPath = false;
+	}
+	DrawFrame();
+
+	// Leave the cursor below the path count
+	cout << "\033[" << maxRows * SCREEN_ROWS_PER_CELL + SCREEN_ROWS_PER_CELL + OFFSET << ";1H" << flush;
+
+}// end Stop
+
+
+
+
+// O(N^2) - Mutator Helper
+// Pre: The view has been started
+// Post: Frames were drawn until running was cleared
+void SearchView::DrawLoop()
+{
+	chrono::steady_clock::time_point nextFrame = chrono::steady_clock::now();	// When the next frame is due
+	chrono::steady_clock::time_point now;		// The current time
+	bool hasFrame;								// Holds if a path was handed over for the frame
+
+	// Repeat until the view is stopped
+	while (running)
+	{
+		// Wait for the frame to be due, a console that fell behind skips the frames it missed
+		nextFrame += framePeriod;
+		now = chrono::steady_clock::now();
+		if (nextFrame < now)
+			nextFrame = now;
+		this_thread::sleep_until(nextFrame);
+
+		// Ask the search for its path and wait up to a frame for it
+		frameWanted = true;
+		{
+			unique_lock<mutex> lock(pathLock);
+			pathReady.wait_until(lock, nextFrame + framePeriod, [this] { return hasPath || !running; });
+
+			// Take the path, the search can hand over the next one while this one is drawn
+			hasFrame = hasPath;
+			if (hasFrame)
+			{
+				drawPath.swap(sharedPath);
+				drawPathCt = sharedPathCt;
+				hasPath = false;
+			}
+		}
+
+		// Draw the frame
+		if (hasFrame)
+			DrawFrame();
+	}
+
+}// end DrawLoop
+
+
+
+
+// O(N^2) - Mutator Helper
+// Pre: The board is on the console
+// Post: The console shows the path being drawn and the number of paths found
+void SearchView::DrawFrame()
+{
+	int cell;	// A cell's row major index
+
+	// Start from the walls
+	for (size_t i = ZERO; i < frameArr.size(); i++)
+		frameArr[i] = wallArr[i] ? VIEW_WALL : VIEW_OPEN;
+
+	// Lay the path over them, the last cell is the head
+	for (size_t i = ZERO; i < drawPath.size(); i++)
+		if (drawPath[i].loc.x >= ZERO && drawPath[i].loc.x < maxRows &&
+			drawPath[i].loc.y >= ZERO && drawPath[i].loc.y < maxCols)
+		{
+			cell = drawPath[i].loc.x * maxCols + drawPath[i].loc.y;
+			frameArr[cell] = (i + OFFSET == drawPath.size()) ? VIEW_HEAD : VIEW_PATH;
+		}
+
+	// Draw only the cells that changed
+	frameText.clear();
+	for (cell = ZERO; cell < (int)frameArr.size(); cell++)
+		if (frameArr[cell] != shownArr[cell])
+		{
+			DrawCell(cell);
+			shownArr[cell] = frameArr[cell];
+		}
+
+	// Draw the path count below the board if it changed
+	if (drawPathCt != shownPathCt)
+	{
+		frameText += "\033[" + to_string(maxRows * SCREEN_ROWS_PER_CELL + SCREEN_ROWS_PER_CELL) + ";1H\033[K";
+		frameText += "Paths found: " + to_string(drawPathCt);
+		shownPathCt = drawPathCt;
+	}
+
+	// Send the whole frame in one write
+	if (!frameText.empty())
+	{
+		cout.write(frameText.data(), frameText.length());
+		cout.flush();
+	}
+
+}// end DrawFrame
+
+
+
+
+// O(1) - Mutator Helper
+// Pre: 0 <= cell < rows * cols
+// Post: The frame text moves the cursor to the cell and draws what it should show
+void SearchView::DrawCell(/*IN*/int cell)		// The cell's row major index
+{
+	// Move the cursor to the cell, the console counts rows and columns from one
+	frameText += "\033[" + to_string((cell / maxCols) * SCREEN_ROWS_PER_CELL + SCREEN_ROWS_PER_CELL) + ";" +
+				 to_string((cell % maxCols) * SCREEN_COLS_PER_CELL + CELL_TEXT_OFFSET + OFFSET) + "H";
+
+	// Draw what the cell shows
+	switch (frameArr[cell])
+	{
+	case VIEW_WALL: frameText += "\033[1;31mX\033[0m"; break;	// A red X
+	case VIEW_PATH: frameText += "\033[1;32m0\033[0m"; break;	// A green 0
+	case VIEW_HEAD: frameText += "\033[1;32mO\033[0m"; break;	// A green O
+	default: frameText += " "; break;							// A blank cell
+	};
+
+}// end DrawCell
@@ -0,0 +1,207 @@
+#pragma once
+/*
+	FileName : searchview.h
+	Author: Christian Siletti
+	Date: 4/27/24
+	Project Maze
+
+	PURPOSE:
+		Contains the specifications for a SearchView Class. A search view draws the board and the
+		path being searched to the console while the search runs, without slowing the search down.
+
+		Drawing happens on its own thread, a set number of frames a second. When a frame is due the
+		view raises a flag, the search sees it the next time it checks the clock and hands over a
+		copy of its path, and goes straight back to searching. The search never waits on the console.
+
+		The view keeps a frame buffer of what each cell should show and a copy of what the console
+		already shows. Only the cells that changed are drawn, each one by moving the cursor straight
+		to it, and the whole frame goes to the console in one write. The table looks the same as
+		the one PrintCurrentPath prints: red X's for walls, green 0's for the path and a green O
+		for its head, with the number of paths found below it.
+
+
+	ASSUMPTIONS:
+		1) The console understands ANSI cursor movement and colour escape codes, like PrintCurrentPath
+		2) Nothing else writes to the console between Start and Stop
+		3) The board's walls do not change after Start
+
+
+	EXCEPTION HANDLING/ERROR CHECKING:
+		1) A view that was never started never wants a frame, so Publish is never called on it.
+		2) Path cells off the board are not drawn.
+		3) GBOutOfMemoryException thrown when memory from the heap has run out
+
+
+						   SUMMARY OF METHODS:
+	PUBLIC METHODS
+		SearchView() - Instantiate a view that is not drawing
+		~SearchView() - Stop drawing if the view is still running
+		void Start(*IN*const GameBoard& board,	// The board being searched
+				   *IN*int fps)					// The number of frames drawn a second
+					- Clear the console, draw the board and start the drawing thread
+		bool FrameWanted() const - Check if the drawing thread is waiting on a path
+		void Publish(*IN*const vector<StackRec>& path,	// The cells of the path, the head last
+					 *IN*long long pathCt)				// The number of paths found
+					- Hand the drawing thread the path to draw next
+		void Stop() - Draw the last path handed over, stop the drawing thread and
+					  leave the cursor below the board
+
+
+	PRIVATE MEMBERS:
+		int maxRows;						// The number of rows in the board
+		int maxCols;						// The number of columns in the board
+		chrono::nanoseconds framePeriod;	// The time between frames
+		vector<unsigned char> wallArr;		// Holds which cells are walls, row major
+		vector<unsigned char> frameArr;		// What each cell should show, row major
+		vector<unsigned char> shownArr;		// What each cell shows on the console, row major
+		vector<StackRec> sharedPath;		// The path handed over by the search
+		long long sharedPathCt;				// The number of paths found when it was handed over
+		bool hasPath;						// Holds if a path was handed over since the last frame
+		vector<StackRec> drawPath;			// The path being drawn
+		long long drawPathCt;				// The number of paths found when it was handed over
+		long long shownPathCt;				// The number of paths found shown below the board
+		string frameText;					// The escape codes and cells of the frame being drawn
+		atomic<bool> frameWanted;			// Set by the drawing thread when a frame is due
+		atomic<bool> running;				// Holds if the drawing thread should keep going
+		mutex pathLock;						// Guards the path handed over
+		condition_variable pathReady;		// Wakes the drawing thread when a path is handed over
+		thread drawThread;					// The thread drawing the frames
+
+	PRIVATE METHODS:
+		void DrawLoop() - Draw a frame each frame period until the view is stopped
+		void DrawFrame() - Draw the cells of the path being drawn that changed since the last frame
+		void DrawCell(*IN*int cell)		// The cell's row major index
+					- Add the escape codes that draw one cell to the frame text
+*/
+
+#include "gameboard.h"		// Allows access to the gameboard ADT
+#include "stackrec.h"		// The path entries handed over by the search
+#include <vector>			// For the frame buffers
+#include <atomic>			// For the flags shared with the search
+#include <mutex>			// For guarding the path handed over
+#include <condition_variable>	// For waking the drawing thread
+#include <thread>			// For the drawing thread
+#include <chrono>			// For the frame timing
+
+using namespace std;    // Standard namespace
+
+
+// Enumerated type for what a cell of the view shows
+enum ViewCellEnum { VIEW_OPEN, VIEW_WALL, VIEW_PATH, VIEW_HEAD };
+
+
+
+class SearchView
+{
+public:
+
+	// O(1) - Default Constructor
+	// Purpose: Instantiate a view that is not drawing
+	// Pre: N/A
+	// Post: A view with no board is created, it never wants a frame
+	SearchView();
+
+
+
+	// O(N^2) - Destructor
+	// Purpose: Stop drawing if the view is still running
+	// Pre: N/A
+	// Post: The drawing thread has finished
+	~SearchView();
+
+
+
+	// O(N^2) - Mutator
+	// Purpose: Clear the console, draw the board and start the drawing thread
+	// Pre: The board with its walls set, and a frame rate above zero
+	// Post: The empty board is on the console and a frame is wanted fps times a second
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	void Start(/*IN*/const GameBoard& board,	// The board being searched
+			   /*IN*/int fps);					// The number of frames drawn a second
+
+
+
+	// O(1) - Observer Predicate
+	// Purpose: Check if the drawing thread is waiting on a path
+	// Pre: N/A
+	// Post: true is returned if a frame is due and no path has been handed over for it
+	bool FrameWanted() const;
+
+
+
+	// O(N) - Mutator
+	// Purpose: Hand the drawing thread the path to draw next
+	// Pre: The cells of the path from the entrance to the head, and the number of paths found
+	// Post: The path is copied for the drawing thread and the frame is no longer wanted
+	void Publish(/*IN*/const vector<StackRec>& path,	// The cells of the path, the head last
+				 /*IN*/long long pathCt);			// The number of paths found
+
+
+
+	// O(N^2) - Mutator
+	// Purpose: Draw the last path handed over, stop the drawing thread and leave the cursor below the board
+	// Pre: N/A
+	// Post: The drawing thread has finished, nothing happens if the view was not started
+	void Stop();
+
+
+
+private:
+	int maxRows;						// The number of rows in the board
+	int maxCols;						// The number of columns in the board
+	chrono::nanoseconds framePeriod;	// The time between frames
+
+	vector<unsigned char> wallArr;		// Holds which cells are walls, row major
+	vector<unsigned char> frameArr;		// What each cell should show, row major
+	vector<unsigned char> shownArr;		// What each cell shows on the console, row major
+
+	vector<StackRec> sharedPath;		// The path handed over by the search
+	long long sharedPathCt;				// The number of paths found when it was handed over
+	bool hasPath;						// Holds if a path was handed over since the last frame
+
+	vector<StackRec> drawPath;			// The path being drawn
+	long long drawPathCt;				// The number of paths found when it was handed over
+	long long shownPathCt;				// The number of paths found shown below the board
+	string frameText;					// The escape codes and cells of the frame being drawn
+
+	atomic<bool> frameWanted;			// Set by the drawing thread when a frame is due
+	atomic<bool> running;				// Holds if the drawing thread should keep going
+	mutex pathLock;						// Guards the path handed over
+	condition_variable pathReady;		// Wakes the drawing thread when a path is handed over
+	thread drawThread;					// The thread drawing the frames
+
+
+
+	// O(N^2) - Mutator Helper
+	// Purpose: Draw a frame each frame period until the view is stopped
+	// Pre: The view has been started
+	// Post: Frames were drawn until running was cleared
+	void DrawLoop();
+
+
+
+	// O(N^2) - Mutator Helper
+	// Purpose: Draw the cells of the path being drawn that changed since the last frame
+	// Pre: The board is on the console
+	// Post: The console shows the path being drawn and the number of paths found
+	void DrawFrame();
+
+
+
+	// O(1) - Mutator Helper
+	// Purpose: Add the escape codes that draw one cell to the frame text
+	// Pre: 0 <= cell < rows * cols
+	// Post: The frame text moves the cursor to the cell and draws what it should show
+	void DrawCell(/*IN*/int cell);		// The cell's row major index
+
+};
+
+
+
+// O(1) - Observer Predicate
+// Defined here as the search checks it every time it checks the clock
+inline bool SearchView::FrameWanted() const
+{
+	return frameWanted.load(memory_order_relaxed);
+
+}// end FrameWanted
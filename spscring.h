@@ -0,0 +1,206 @@
+#pragma once
+/*
+	FileName : spscring.h
+	Author: Christian Siletti
+	Date: 4/30/24
+	Project Maze
+
+	PURPOSE:
+		Contains the specifications for a SpscRing Class template. A SpscRing is a fixed size ring
+		of items handed from one thread to another without a lock: one producer thread fills slots
+		at the write end and one consumer thread empties them at the read end.
+
+		Each side owns its own index and only reads the other's. The producer claims the next slot,
+		fills it in place and publishes it by moving the write index on. The consumer peeks at the
+		oldest published slot, uses it in place and releases it by moving the read index on. The
+		two indices sit on cache lines of their own, and each side keeps a copy of the other's index
+		so it only has to look at the shared one when its copy says the ring is full or empty.
+
+
+	ASSUMPTIONS:
+		1) Exactly one thread claims and publishes, and exactly one thread peeks and releases
+		2) The capacity is a power of two so an index is turned into a slot with a mask
+		3) The indices only ever count up, a size_t does not wrap in the life of a search
+
+
+	EXCEPTION HANDLING/ERROR CHECKING:
+		1) Claim returns NULL when the ring is full and Peek returns NULL when it is empty,
+		   it is up to the caller to wait.
+		2) GBOutOfMemoryException thrown when memory from the heap has run out
+
+
+						   SUMMARY OF METHODS:
+	PUBLIC METHODS
+		SpscRing() - Instantiate a ring with no slots
+		void Allocate(*IN*const size_t& capacity)		// The number of slots, a power of two
+					- Make room for the slots, the ring starts out empty
+		ItemType* Claim() - Get the next free slot for the producer to fill, NULL if the ring is full
+		void Publish() - Hand the slot claimed over to the consumer
+		ItemType* Peek() - Get the oldest slot published for the consumer, NULL if the ring is empty
+		void Release() - Give the slot peeked at back to the producer
+		bool IsEmpty() const - Check if every slot published has been released
+
+
+	PRIVATE MEMBERS:
+		vector<ItemType> slotArr;		// The slots of the ring
+		size_t mask;					// Turns an index into a slot, the capacity less one
+		atomic<size_t> writeIdx;		// The number of slots published, owned by the producer
+		size_t cachedReadIdx;			// The producer's copy of the read index
+		atomic<size_t> readIdx;			// The number of slots released, owned by the consumer
+		size_t cachedWriteIdx;			// The consumer's copy of the write index
+*/
+
+#include "Constants.h"		// File containing appropriate constants
+#include "gbExceptions.h"	// Holds the out of memory exception
+#include <vector>			// For the slots
+#include <atomic>			// For the indices shared between the threads
+#include <new>				// Contains the bad_alloc exception
+
+using namespace std;    // Standard namespace
+
+
+const size_t CACHE_LINE_BYTES = 64;		// Keeps the producer's and consumer's indices apart
+
+
+
+template <class ItemType>
+class SpscRing
+{
+public:
+
+	// O(1) - Default Constructor
+	// Purpose: Instantiate a ring with no slots
+	// Pre: N/A
+	// Post: An empty ring is created, Allocate must be called before it is used
+	SpscRing()
+	{
+		mask = ZERO;
+		writeIdx = ZERO;
+		cachedReadIdx = ZERO;
+		readIdx = ZERO;
+		cachedWriteIdx = ZERO;
+
+	}// end DC
+
+
+
+	// O(N) - Mutator
+	// Purpose: Make room for the slots, the ring starts out empty
+	// Pre: A capacity that is a power of two, and neither thread is using the ring
+	// Post: The ring has capacity slots and is empty
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	void Allocate(/*IN*/const size_t& capacity)		// The number of slots, a power of two
+	{
+		try
+		{
+			slotArr.resize(capacity);
+		}
+		catch (std::bad_alloc)	// The heap space memory has run out
+		{
+			// Throw the exception
+			throw GBOutOfMemoryException();
+		}
+
+		mask = capacity - OFFSET;
+		writeIdx = ZERO;
+		cachedReadIdx = ZERO;
+		readIdx = ZERO;
+		cachedWriteIdx = ZERO;
+
+	}// end Allocate
+
+
+
+	// O(1) - Mutator
+	// Purpose: Get the next free slot for the producer to fill
+	// Pre: Called only from the producer thread
+	// Post: The slot after the last one published is returned, NULL if every slot is in use.
+	//		 The slot is not seen by the consumer until it is published
+	ItemType* Claim()
+	{
+		size_t write = writeIdx.load(memory_order_relaxed);	// The slot being claimed
+
+		// Only look at the consumer's index when the copy of it says the ring is full
+		if (write - cachedReadIdx > mask)
+		{
+			cachedReadIdx = readIdx.load(memory_order_acquire);
+			if (write - cachedReadIdx > mask)
+				return NULL;
+		}
+
+		return &slotArr[write & mask];
+
+	}// end Claim
+
+
+
+	// O(1) - Mutator
+	// Purpose: Hand the slot claimed over to the consumer
+	// Pre: Called only from the producer thread, after a successful Claim
+	// Post: The slot and everything written into it can be seen by the consumer
+	void Publish()
+	{
+		writeIdx.store(writeIdx.load(memory_order_relaxed) + OFFSET, memory_order_release);
+
+	}// end Publish
+
+
+
+	// O(1) - Mutator
+	// Purpose: Get the oldest slot published for the consumer
+	// Pre: Called only from the consumer thread
+	// Post: The oldest slot not yet released is returned, NULL if none has been published
+	ItemType* Peek()
+	{
+		size_t read = readIdx.load(memory_order_relaxed);	// The slot being looked at
+
+		// Only look at the producer's index when the copy of it says the ring is empty
+		if (read == cachedWriteIdx)
+		{
+			cachedWriteIdx = writeIdx.load(memory_order_acquire);
+			if (read == cachedWriteIdx)
+				return NULL;
+		}
+
+		return &slotArr[read & mask];
+
+	}// end Peek
+
+
+
+	// O(1) - Mutator
+	// Purpose: Give the slot peeked at back to the producer
+	// Pre: Called only from the consumer thread, after a successful Peek
+	// Post: The slot can be claimed again, and everything the consumer did before releasing it
+	//		 can be seen by the producer
+	void Release()
+	{
+		readIdx.store(readIdx.load(memory_order_relaxed) + OFFSET, memory_order_release);
+
+	}// end Release
+
+
+
+	// O(1) - Observer Predicate
+	// Purpose: Check if every slot published has been released
+	// Pre: Called from the producer thread
+	// Post: true is returned if the consumer has released every slot published
+	bool IsEmpty() const
+	{
+		return readIdx.load(memory_order_acquire) == writeIdx.load(memory_order_relaxed);
+
+	}// end IsEmpty
+
+
+
+private:
+	vector<ItemType> slotArr;		// The slots of the ring
+	size_t mask;					// Turns an index into a slot, the capacity less one
+
+	alignas(CACHE_LINE_BYTES) atomic<size_t> writeIdx;	// The number of slots published, owned by the producer
+	size_t cachedReadIdx;								// The producer's copy of the read index
+
+	alignas(CACHE_LINE_BYTES) atomic<size_t> readIdx;	// The number of slots released, owned by the consumer
+	size_t cachedWriteIdx;								// The consumer's copy of the write index
+
+};
@@ -1,6 +1,7 @@
 //IMPLEMENTATION FILE : stack.cpp
 // This file contains the implementation of a dynamically allocated stack.
 #include "stack.h"
+#include "memaccount.h"		//for counting the nodes' memory
 
 //***************************************************************************
 //*																			*
@@ -31,6 +32,7 @@ StackClass::StackClass()
 {
 
 	head = nullptr;  //initialize stack
+	spare = nullptr;  //no nodes kept yet
 
 }  // end default constructor
 
@@ -42,6 +44,7 @@ StackClass::StackClass()
 StackClass::StackClass(const StackClass& orig)
 {
 	head = nullptr;		//initialize stack	
+	spare = nullptr;	//no nodes kept yet
 
 	operator=(orig);	//perform deep copy
 
@@ -54,7 +57,15 @@ StackClass::StackClass(const StackClass& orig)
 //Post: Memory has been returned to the system
 StackClass::~StackClass()
 {
-	Clear();		//return memory to heap
+	Clear();		//keep every node
+
+	while (spare != nullptr)	//return the kept nodes to heap
+	{
+		node* temp = spare->next;	//set temp
+		delete spare;				//delete node
+		spare = temp;				//reconnect
+		MemRelease(MEM_STACK, sizeof(node));	//count the memory given back
+	}
 
 }//end destructor
 
@@ -138,7 +149,8 @@ void StackClass::Pop()
 	if (!IsEmpty())				//if not empty
 	{
 		node* temp = head->next;	//set temp
-		delete head;				//delete node
+		head->next = spare;			//keep node for the next push
+		spare = head;
 		head = temp;				//reconnect
 	}
 
@@ -226,7 +238,16 @@ node* StackClass::Allocate()
 {
 	try
 	{
-		node* tbr = new node;	//get a node
+		node* tbr = spare;		//reuse a popped node if there is one
+
+		if (tbr != nullptr)
+			spare = tbr->next;
+		else
+		{
+			tbr = new node;		//get a node
+			MemAdd(MEM_STACK, sizeof(node));	//count the memory taken
+		}
+
 		tbr->next = nullptr;	//set internal to null
 		return tbr;				//return it
 
@@ -240,3 +261,14 @@ node* StackClass::Allocate()
 }	//end Allocate
 
 
+
+//Pre: N/A
+//Post: The bytes of one node are returned, as counted in memaccount.h
+long long StackClass::ItemBytes()
+{
+
+	return sizeof(node);	//every item gets a node of its own
+
+}	//end ItemBytes
+
+
@@ -1,3 +1,4 @@
+#pragma once
 ///Filename : stack.h
 //Specification File : StackClass
 //Purpose: This file contains the definition of a dynamic array based StackClass.
@@ -6,6 +7,9 @@
 // 
 // Assumptions: 
 //			(1) ADT will be accessible in LIFO method of access only.
+//			(2) Popped nodes are kept and reused by the next pushes, so a search
+//				pushing and popping the same cells does not go to the heap each time.
+//				They are returned to the heap when the stack is destroyed.
 // 
 // Exceptions Thrown:
 //		(1)	Method Retrieve throws a  RetrieveOnEmptyException when retrieve is  
@@ -34,6 +38,8 @@
 //
 //	  virtual void operator=(const StackClass& orig); Overloads = operator for class object
 //
+//	  static long long ItemBytes();	returns the bytes each item pushed takes from the heap
+//
 //	  protected methods:
 //
 //	  node* Allocate();   Allocates a stack object, if memory unavailable, throws out 
@@ -126,10 +132,17 @@ public:
 															//mutator        O(N)
 
 
+	//Pre: N/A
+	//Post: The bytes of one node are returned, as counted in memaccount.h
+	//Purpose: Return the bytes each item pushed takes from the heap
+	static long long ItemBytes();	//observer accessor   O(1)
+
+
 
 private:  //pdms
 	
 	node* head;		//top of stack
+	node* spare;	//popped nodes kept for the next pushes
 
 
 protected:
@@ -0,0 +1,536 @@
+// Project Maze
+// FileName : tiledboard.cpp
+// Author: Christian Siletti
+// Purpose : This file contains the implementation for all of the methods
+//			 defined in tiledboard.h
+
+#include "tiledboard.h"		// The header file
+#include "memaccount.h"		// For counting the tiles' memory
+#include "zorderboard.h"	// For the boards laid out in z-order
+#include <new>				// Contains the bad_alloc exception
+
+using namespace std;	// Standard Namespace
+
+
+const int TILE_MASK = TILE_SIDE - 1;	// Keeps a coordinate's place within its tile
+
+
+
+// O(TILE_CELLS)
+// Purpose: Fill the shared tiles
+// Pre: The shared OPEN and WALL tiles
+// Post: Every cell of each is its status with the default cost, true is returned
+static bool FillSharedTiles(/*OUT*/CellRec openTile[],		// The shared OPEN tile
+							/*OUT*/CellRec wallTile[])		// The shared WALL tile
+{
+	for (int i = ZERO; i < TILE_CELLS; i++)
+	{
+		openTile[i].status = OPEN;
+		openTile[i].cost = (unsigned char)DEFAULT_CELL_COST;
+		wallTile[i].status = WALL;
+		wallTile[i].cost = (unsigned char)DEFAULT_CELL_COST;
+	}
+
+	return true;
+
+}// end FillSharedTiles
+
+
+
+// O(1), O(TILE_CELLS) the first time
+// Purpose: Return the tile every tiled board shares for a status
+// Pre: OPEN or WALL
+// Post: The shared tile of the status is returned, filled the first time it is asked for
+static CellRec* SharedTile(/*IN*/const StateEnum& fill)		// The status of every cell of the tile
+{
+	static CellRec openTile[TILE_CELLS];		// Every cell OPEN, never written once filled
+	static CellRec wallTile[TILE_CELLS];		// Every cell WALL, never written once filled
+	static const bool filled = FillSharedTiles(openTile, wallTile);	// Filled once, on whichever thread gets here first
+
+	(void)filled;
+	return fill == WALL ? wallTile : openTile;
+
+}// end SharedTile
+
+
+
+// O(1)
+// Purpose: Check if a tile is one of the shared tiles
+// Pre: A tile of a tiled board
+// Post: true is returned if the tile has no cells of its own
+static bool IsShared(/*IN*/const CellRec* tile)		// The tile's cells
+{
+	return tile == SharedTile(OPEN) || tile == SharedTile(WALL);
+
+}// end IsShared
+
+
+
+// O(1)
+// Purpose: Return where a cell is within its tile
+// Pre: A cell on the board
+// Post: The cell's index in its tile's cells is returned
+static int CellIndex(/*IN*/const Location2DRec& loc)		// The cell's coordinate
+{
+	return ((loc.x & TILE_MASK) << TILE_SHIFT) | (loc.y & TILE_MASK);
+
+}// end CellIndex
+
+
+
+// O(N^2 / TILE_CELLS) - Non Default Constructor
+// Pre: The desired maximum row and column count
+// Post: A tiled board of the size is created, every tile pointing at the shared OPEN tile
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+TiledBoard::TiledBoard(/*IN*/int rows,			// The desired number of rows
+					   /*IN*/int cols)			// The desired number of columns
+	: GameBoard(ZERO, ZERO, false)
+{
+	maxRows = rows;
+	maxCols = cols;
+
+	// Create the tile table
+	AllocateTiles();
+
+}// end NDC
+
+
+
+// O(N^2 / TILE_CELLS + T * TILE_CELLS) for T tiles of orig's own - Copy Constructor
+// Pre: The tiled board to be copied exists
+// Post: A tiled board with the same cells, and its own copy of each tile orig has its own, is created
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+TiledBoard::TiledBoard(/*IN*/const TiledBoard& orig)		// The tiled board to be copied
+	: GameBoard(ZERO, ZERO, false)
+{
+	// Start with no cells so there is nothing for the copy to free
+	maxRows = ZERO;
+	maxCols = ZERO;
+	tileRows = ZERO;
+	tileCols = ZERO;
+	tileArr = nullptr;
+	ownTileCt = ZERO;
+
+	// Copy the board
+	operator=(orig);
+
+}// end CC
+
+
+
+// O(1) - Move Constructor
+// Pre: The tiled board to be moved exists
+// Post: This board holds orig's size and tiles, and orig is left with no cells
+TiledBoard::TiledBoard(/*IN/OUT*/TiledBoard&& orig) noexcept		// The tiled board being moved
+	: GameBoard(ZERO, ZERO, false)
+{
+	// Take the tiles
+	maxRows = orig.maxRows;
+	maxCols = orig.maxCols;
+	tileRows = orig.tileRows;
+	tileCols = orig.tileCols;
+	tileArr = orig.tileArr;
+	ownTileCt = orig.ownTileCt;
+
+	// Leave nothing behind to be freed twice
+	orig.maxRows = ZERO;
+	orig.maxCols = ZERO;
+	orig.tileRows = ZERO;
+	orig.tileCols = ZERO;
+	orig.tileArr = nullptr;
+	orig.ownTileCt = ZERO;
+
+}// end MC
+
+
+
+// O(N^2 / TILE_CELLS) - Destructor
+// Pre: N/A
+// Post: The tiles of the board's own and the tile table are returned to the heap
+TiledBoard::~TiledBoard()
+{
+	DeAllocateTiles();
+
+}// end Destructor
+
+
+
+// O(1) - Observer Accessor
+// Pre: The coordinate of the desired cell
+// Post: The status of the desired cell is returned.
+//       If loc is outside the bounds of the board the status OUT_OF_BOUNDS will be returned
+StateEnum TiledBoard::GetStatus(/*IN*/const Location2DRec& loc) const		// The desired cell's coordinate
+{
+	if (loc.x < ZERO || loc.x >= maxRows || loc.y < ZERO || loc.y >= maxCols)
+		return OUT_OF_BOUNDS;
+
+	return tileArr[(loc.x >> TILE_SHIFT) * tileCols + (loc.y >> TILE_SHIFT)][CellIndex(loc)].status;
+
+}// end GetStatus
+
+
+
+// O(1), O(TILE_CELLS) the first time a tile's cell is changed - Mutator
+// Pre: The coordinate of the desired cell and its new status
+// Post: If loc is within the board the status of the cell is changed, its tile given cells of
+//		 its own first if its shared tile does not hold the status
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+void TiledBoard::SetStatus(/*IN*/const Location2DRec& loc,			// The desired cell's coordinate
+						   /*IN*/const StateEnum& newStatus)		// The cells new status
+{
+	if (loc.x < ZERO || loc.x >= maxRows || loc.y < ZERO || loc.y >= maxCols)
+		return;
+
+	// A shared tile already holding the status is left shared
+	if (GetStatus(loc) == newStatus)
+		return;
+
+	OwnTile(loc)[CellIndex(loc)].status = newStatus;
+
+}// end SetStatus
+
+
+
+// O(1) - Observer Accessor
+// Pre: N/A
+// Post: The size of the board will be stored into the incoming rows and columns variables
+void TiledBoard::GetSize(/*OUT*/int& rows,				// The location to store the row size
+						 /*OUT*/int& cols) const		// The location to store the column size
+{
+	rows = maxRows;
+	cols = maxCols;
+
+}// end GetSize
+
+
+
+// O(1) - Observer Accessor
+// Pre: The coordinate of the desired cell
+// Post: The cost of the cell is returned, DEFAULT_CELL_COST unless it was changed.
+//		 Zero is returned if loc is outside the board
+int TiledBoard::GetCost(/*IN*/const Location2DRec& loc) const		// The desired cell's coordinate
+{
+	if (loc.x < ZERO || loc.x >= maxRows || loc.y < ZERO || loc.y >= maxCols)
+		return ZERO;
+
+	return tileArr[(loc.x >> TILE_SHIFT) * tileCols + (loc.y >> TILE_SHIFT)][CellIndex(loc)].cost;
+
+}// end GetCost
+
+
+
+// O(1), O(TILE_CELLS) the first time a tile's cell is changed - Mutator
+// Pre: The coordinate of the desired cell and its new cost
+// Post: If loc is within the board and the cost is between DEFAULT_CELL_COST and MAX_CELL_COST
+//		 the cost of the cell is changed, its tile given cells of its own first if it needs them
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+void TiledBoard::SetCost(/*IN*/const Location2DRec& loc,		// The desired cell's coordinate
+						 /*IN*/const int& newCost)			// The cells new cost
+{
+	if (loc.x < ZERO || loc.x >= maxRows || loc.y < ZERO || loc.y >= maxCols ||
+		newCost < DEFAULT_CELL_COST || newCost > MAX_CELL_COST)
+		return;
+
+	// A shared tile already holding the cost is left shared
+	if (GetCost(loc) == newCost)
+		return;
+
+	OwnTile(loc)[CellIndex(loc)].cost = (unsigned char)newCost;
+
+}// end SetCost
+
+
+
+// O(N^2) - Overloaded Operator
+// Pre: The gameboard to be copied
+// Post: This board has orig's size and cells, with its own cells only for the tiles
+//		 that are not all OPEN with the default cost
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+void TiledBoard::operator =(/*IN*/const GameBoard& orig)		// The gameboard to be copied
+{
+	Location2DRec loc;	// The cell being copied
+
+	// A board copied onto itself is already a copy
+	if (this == &orig)
+		return;
+
+	// Start over at orig's size with every cell OPEN, and only write the cells that are not
+	DeAllocateTiles();
+	orig.GetSize(maxRows, maxCols);
+	AllocateTiles();
+
+	for (loc.x = ZERO; loc.x < maxRows; loc.x++)
+		for (loc.y = ZERO; loc.y < maxCols; loc.y++)
+		{
+			SetStatus(loc, orig.GetStatus(loc));
+			SetCost(loc, orig.GetCost(loc));
+		}
+
+}// end operator =
+
+
+
+// O(N^2) - Overloaded Operator
+// Pre: The gameboard to be copied
+// Post: This board has orig's size and cells, and orig is left as it was
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+void TiledBoard::operator =(/*IN/OUT*/GameBoard&& orig)		// The gameboard to be copied
+{
+	// The cells are kept in tiles, so they are copied into them
+	operator=((const GameBoard&)orig);
+
+}// end operator =
+
+
+
+// O(N^2 / TILE_CELLS + T * TILE_CELLS) for T tiles of orig's own - Overloaded Operator
+// Pre: The tiled board to be copied
+// Post: This board has orig's size and cells, and its own copy of each tile orig has its own
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+void TiledBoard::operator =(/*IN*/const TiledBoard& orig)		// The tiled board to be copied
+{
+	// A board copied onto itself is already a copy
+	if (this == &orig)
+		return;
+
+	DeAllocateTiles();
+	maxRows = orig.maxRows;
+	maxCols = orig.maxCols;
+	AllocateTiles();
+
+	// Share what orig shares, copy what it has of its own
+	for (int t = ZERO; t < tileRows * tileCols; t++)
+	{
+		if (IsShared(orig.tileArr[t]))
+			tileArr[t] = orig.tileArr[t];
+		else
+		{
+			try
+			{
+				tileArr[t] = new CellRec[TILE_CELLS];
+			}
+			catch (std::bad_alloc)	// The heap space memory has run out
+			{
+				// Throw the exception
+				tileArr[t] = SharedTile(OPEN);
+				throw GBOutOfMemoryException();
+			}
+
+			for (int i = ZERO; i < TILE_CELLS; i++)
+				tileArr[t][i] = orig.tileArr[t][i];
+
+			ownTileCt++;
+			MemAdd(MEM_BOARD, (long long)TILE_CELLS * sizeof(CellRec));
+		}
+	}
+
+}// end operator =
+
+
+
+// O(T * TILE_CELLS) for T tiles of the board's own - Mutator
+// Pre: N/A
+// Post: Every tile whose cells are all OPEN, or all WALL, with the default cost points at the
+//		 shared tile again and its cells are returned to the heap
+void TiledBoard::Compact()
+{
+	bool uniform;		// Holds if every cell of the tile is the same as its first
+
+	for (int t = ZERO; t < tileRows * tileCols; t++)
+	{
+		if (IsShared(tileArr[t]))
+			continue;
+
+		uniform = (tileArr[t][ZERO].status == OPEN || tileArr[t][ZERO].status == WALL) &&
+				  tileArr[t][ZERO].cost == DEFAULT_CELL_COST;
+		for (int i = OFFSET; i < TILE_CELLS && uniform; i++)
+			uniform = tileArr[t][i].status == tileArr[t][ZERO].status && tileArr[t][i].cost == tileArr[t][ZERO].cost;
+
+		// Give the cells back and share the tile again
+		if (uniform)
+		{
+			CellRec* shared = SharedTile(tileArr[t][ZERO].status);	// The shared tile the same as this one
+
+			delete[] tileArr[t];
+			tileArr[t] = shared;
+			ownTileCt--;
+			MemRelease(MEM_BOARD, (long long)TILE_CELLS * sizeof(CellRec));
+		}
+	}
+
+}// end Compact
+
+
+
+// O(1) - Observer Accessor
+// Pre: N/A
+// Post: The number of tiles not pointing at a shared tile is returned
+int TiledBoard::GetOwnTileCt() const
+{
+	return ownTileCt;
+
+}// end GetOwnTileCt
+
+
+
+// O(1)
+// Pre: The number of rows and columns
+// Post: The bytes of the tile table are returned, as counted in memaccount.h
+long long TiledBoard::TableBytes(/*IN*/const int& rows,		// The number of rows
+								 /*IN*/const int& cols)		// The number of columns
+{
+	return (long long)((rows + TILE_MASK) >> TILE_SHIFT) * ((cols + TILE_MASK) >> TILE_SHIFT) * sizeof(CellRec*);
+
+}// end TableBytes
+
+
+
+// ============================ PRIVATE METHODS =================================
+
+
+
+// O(N^2 / TILE_CELLS)
+// Pre: maxRows and maxCols hold the size of the board
+// Post: The tile table is allocated with every tile shared and OPEN
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+void TiledBoard::AllocateTiles()
+{
+	CellRec* openTile = SharedTile(OPEN);	// Where every tile starts
+
+	tileRows = (maxRows + TILE_MASK) >> TILE_SHIFT;
+	tileCols = (maxCols + TILE_MASK) >> TILE_SHIFT;
+	ownTileCt = ZERO;
+
+	try
+	{
+		tileArr = new CellRec * [(size_t)tileRows * tileCols];
+	}
+	catch (std::bad_alloc)	// The heap space memory has run out
+	{
+		// Throw the exception
+		tileArr = nullptr;
+		tileRows = ZERO;
+		tileCols = ZERO;
+		maxRows = ZERO;
+		maxCols = ZERO;
+		throw GBOutOfMemoryException();
+	}
+
+	for (int t = ZERO; t < tileRows * tileCols; t++)
+		tileArr[t] = openTile;
+
+	// Count the memory taken
+	MemAdd(MEM_BOARD, TableBytes(maxRows, maxCols));
+
+}// end AllocateTiles
+
+
+
+// O(N^2 / TILE_CELLS)
+// Pre: N/A
+// Post: The memory the board is using is returned to the heap and it has no cells
+void TiledBoard::DeAllocateTiles()
+{
+	// A board moved from has nothing to free
+	if (tileArr == nullptr)
+		return;
+
+	for (int t = ZERO; t < tileRows * tileCols; t++)
+		if (!IsShared(tileArr[t]))
+			delete[] tileArr[t];
+
+	delete[] tileArr;
+	MemRelease(MEM_BOARD, TableBytes(maxRows, maxCols) + (long long)ownTileCt * TILE_CELLS * sizeof(CellRec));
+
+	tileArr = nullptr;
+	tileRows = ZERO;
+	tileCols = ZERO;
+	ownTileCt = ZERO;
+
+}// end DeAllocateTiles
+
+
+
+// O(1), O(TILE_CELLS) if the tile is shared
+// Pre: A cell on the board
+// Post: The cell's tile has cells of its own, a copy of its shared tile if it had none, and they are returned
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+CellRec* TiledBoard::OwnTile(/*IN*/const Location2DRec& loc)		// A cell of the tile
+{
+	CellRec*& tile = tileArr[(loc.x >> TILE_SHIFT) * tileCols + (loc.y >> TILE_SHIFT)];	// The tile of the cell
+	CellRec* shared = tile;		// The shared tile being copied
+
+	if (!IsShared(tile))
+		return tile;
+
+	// Copy the shared tile before writing to it
+	try
+	{
+		tile = new CellRec[TILE_CELLS];
+	}
+	catch (std::bad_alloc)	// The heap space memory has run out
+	{
+		// Throw the exception
+		throw GBOutOfMemoryException();
+	}
+
+	for (int i = ZERO; i < TILE_CELLS; i++)
+		tile[i] = shared[i];
+
+	ownTileCt++;
+	MemAdd(MEM_BOARD, (long long)TILE_CELLS * sizeof(CellRec));
+
+	return tile;
+
+}// end OwnTile
+
+
+
+// ============================ FUNCTIONS =================================
+
+
+
+// O(N^2 / TILE_CELLS) for a tiled board, O(N^2) otherwise
+// Pre: The number of rows and columns, how the cells are laid out and if they are put on huge pages
+// Post: A new tiled board is returned if a board of the size has TILED_BOARD_CELLS or more,
+//		 otherwise a new z-order board for ORDER_ZORDER or a new gameboard, every cell OPEN
+//		 either way. A tiled board keeps its cells in rows whatever the order, the caller checks
+//		 UsesTiles before asking for ORDER_ZORDER. The caller deletes it
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+GameBoard* NewBoard(/*IN*/const int& rows,						// The number of rows
+					/*IN*/const int& cols,						// The number of columns
+					/*IN*/const CellOrderEnum& cellOrder,		// How the cells are laid out
+					/*IN*/const bool& hugePages)				// Holds if the cells are put on huge pages
+{
+	GameBoard* board;	// The board made
+
+	try
+	{
+		if (UsesTiles(rows, cols))
+			board = new TiledBoard(rows, cols);
+		else if (cellOrder == ORDER_ZORDER)
+			board = new ZOrderBoard(rows, cols, hugePages);
+		else
+			board = new GameBoard(rows, cols);
+	}
+	catch (std::bad_alloc)	// The heap space memory has run out
+	{
+		// Throw the exception
+		throw GBOutOfMemoryException();
+	}
+
+	return board;
+
+}// end NewBoard
+
+
+
+// O(1)
+// Pre: The number of rows and columns
+// Post: true is returned if NewBoard makes a tiled board for the size
+bool UsesTiles(/*IN*/const int& rows,		// The number of rows
+			   /*IN*/const int& cols)		// The number of columns
+{
+	return (long long)rows * cols >= TILED_BOARD_CELLS;
+
+}// end UsesTiles
@@ -0,0 +1,316 @@
+#pragma once
+/*
+	FileName : tiledboard.h
+	Author: Christian Siletti
+	Date: 5/11/24
+	Project Maze
+
+	PURPOSE:
+		Contains the specifications for a TiledBoard Class. A tiled board is a gameboard whose
+		cells are kept in square tiles of TILE_SIDE by TILE_SIDE cells, for boards too big to
+		allocate and fill every cell of up front.
+
+		A tile that has never been written points at one of two tiles shared by every tiled
+		board, one all OPEN and one all WALL, each with the default cost. Only writing a cell
+		a value its shared tile does not already hold gives the tile cells of its own, a copy
+		of the shared tile, so a board is made in O(N^2 / TILE_CELLS) and reading in its walls
+		costs a tile for each part of the board that has any. Compact gives the cells of any
+		tile that is all OPEN or all WALL again back, so a board that is mostly solid rock
+		keeps only the tiles holding its passages.
+
+		Reading a cell is an index into the tile table and one into the tile, so the searches
+		run on a tiled board as they are, if a little slower than on a plain gameboard.
+		NewBoard makes a tiled board for any board of TILED_BOARD_CELLS or more, and for the rest
+		a plain gameboard, or a z-order board (see zorderboard.h) if its cells are to be laid
+		out in z-order. A tiled board is never laid out in z-order.
+
+
+	ASSUMPTIONS:
+		1) The shared tiles are never written, a tile is copied before any of its cells change
+		2) The tiles' memory is counted as the board's (see memaccount.h)
+
+
+	EXCEPTION HANDLING/ERROR CHECKING:
+		1) If an invalid location is sent into GetStatus a OUT_OF_BOUNDS status will be returned.
+		2) If an invalid location is sent into SetStatus the status of the location will not change,
+		   the program will move on.
+		3) GetCost returns zero for a location outside the board, and SetCost ignores a cost
+		   outside DEFAULT_CELL_COST to MAX_CELL_COST
+		4) GBOutOfMemoryException thrown when memory from the heap has run out
+
+
+						   SUMMARY OF METHODS:
+	PUBLIC METHODS
+		TiledBoard(*IN*int rows,		// The desired number of rows
+				   *IN*int cols)		// The desired number of columns
+					- Instantiate a tiled board with every cell OPEN and no tile of its own
+		TiledBoard(*IN*const TiledBoard& orig)		// The tiled board to be copied
+					- Share the shared tiles and copy the tiles of another tiled board's own
+		TiledBoard(*IN/OUT*TiledBoard&& orig)		// The tiled board being moved
+					- Take over another tiled board's tiles
+		~TiledBoard() - Free the tiles of the board's own
+		virtual StateEnum GetStatus(*IN*const Location2DRec& loc) const	// The desired cell's coordinate
+					- To return the status of a specified cell
+		virtual void SetStatus(*IN*const Location2DRec& loc,		// The desired cell's coordinate
+							   *IN*const StateEnum& newStatus)		// The cells new status
+					- To change the status of a desired location
+		virtual void GetSize(*OUT*int& rows,			// The location to store the row size
+							 *OUT*int& cols) const		// The location to store the column size
+					- To return the size of the board
+		virtual int GetCost(*IN*const Location2DRec& loc) const	// The desired cell's coordinate
+					- To return the cost of moving into a specified cell
+		virtual void SetCost(*IN*const Location2DRec& loc,		// The desired cell's coordinate
+							 *IN*const int& newCost)			// The cells new cost
+					- To change the cost of moving into a desired location
+		virtual void operator =(*IN*const GameBoard& orig)		// The gameboard to be copied
+					- To copy any gameboard, keeping only the tiles it needs
+		virtual void operator =(*IN/OUT*GameBoard&& orig)		// The gameboard to be copied
+					- To copy any gameboard, keeping only the tiles it needs
+		void operator =(*IN*const TiledBoard& orig)			// The tiled board to be copied
+					- To share the shared tiles and copy the tiles of another tiled board's own
+		virtual void Compact() - Give back the cells of every tile that is all OPEN or all WALL
+		int GetOwnTileCt() const - Return the number of tiles with cells of their own
+		static long long TableBytes(*IN*const int& rows,	// The number of rows
+									*IN*const int& cols)	// The number of columns
+					- To return the bytes a tiled board of a size takes before any tile is written
+
+	PRIVATE MEMBERS:
+		int maxRows;			// The maximum number of rows
+		int maxCols;			// The maximum number of cols
+		int tileRows;			// The number of rows of tiles
+		int tileCols;			// The number of columns of tiles
+		CellRec** tileArr;		// Each tile's cells, row major, the shared tiles' if it has none of its own
+		int ownTileCt;			// The number of tiles with cells of their own
+
+	PRIVATE METHODS:
+		void AllocateTiles() - Point every tile at the shared OPEN tile
+		void DeAllocateTiles() - Free the tiles of the board's own and the tile table
+		CellRec* OwnTile(*IN*const Location2DRec& loc)		// A cell of the tile
+					- Give a cell's tile cells of its own if it has none
+
+
+						   SUMMARY OF FUNCTIONS:
+	GameBoard* NewBoard(*IN*const int& rows,					// The number of rows
+						*IN*const int& cols,					// The number of columns
+						*IN*const CellOrderEnum& cellOrder,		// How the cells are laid out
+						*IN*const bool& hugePages)				// Holds if the cells are put on huge pages
+		- Make a gameboard, tiled if it is big
+	bool UsesTiles(*IN*const int& rows,		// The number of rows
+				   *IN*const int& cols)		// The number of columns
+		- Check if a board of a size is made tiled
+*/
+
+#include "gameboard.h"		// Allows access to the gameboard ADT
+#include "optionsrec.h"		// For how the cells are laid out
+
+using namespace std;    // Standard namespace
+
+
+const int TILE_SHIFT = 6;									// A tile is 2^TILE_SHIFT cells on a side
+const int TILE_SIDE = 1 << TILE_SHIFT;						// The number of cells on a side of a tile
+const int TILE_CELLS = TILE_SIDE * TILE_SIDE;				// The number of cells in a tile
+const long long TILED_BOARD_CELLS = 16LL * 1024 * 1024;		// The fewest cells a board is made tiled for
+
+
+
+class TiledBoard : public GameBoard
+{
+public:
+
+	// O(N^2 / TILE_CELLS) - Non Default Constructor
+	// Purpose: Instantiate a tiled board with every cell OPEN and no tile of its own
+	// Pre: The desired maximum row and column count
+	// Post: A tiled board of the size is created, every tile pointing at the shared OPEN tile
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	TiledBoard(/*IN*/int rows,			// The desired number of rows
+			   /*IN*/int cols);			// The desired number of columns
+
+
+
+	// O(N^2 / TILE_CELLS + T * TILE_CELLS) for T tiles of orig's own - Copy Constructor
+	// Purpose: Share the shared tiles and copy the tiles of another tiled board's own
+	// Pre: The tiled board to be copied exists
+	// Post: A tiled board with the same cells, and its own copy of each tile orig has its own, is created
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	TiledBoard(/*IN*/const TiledBoard& orig);		// The tiled board to be copied
+
+
+
+	// O(1) - Move Constructor
+	// Purpose: Take over another tiled board's tiles
+	// Pre: The tiled board to be moved exists
+	// Post: This board holds orig's size and tiles, and orig is left with no cells
+	TiledBoard(/*IN/OUT*/TiledBoard&& orig) noexcept;		// The tiled board being moved
+
+
+
+	// O(N^2 / TILE_CELLS) - Destructor
+	// Purpose: Free the tiles of the board's own
+	// Pre: N/A
+	// Post: The tiles of the board's own and the tile table are returned to the heap
+	~TiledBoard();
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: To return the status of a specified cell
+	// Pre: The coordinate of the desired cell
+	// Post: The status of the desired cell is returned.
+	//       If loc is outside the bounds of the board the status OUT_OF_BOUNDS will be returned
+	virtual StateEnum GetStatus(/*IN*/const Location2DRec& loc) const;		// The desired cell's coordinate
+
+
+
+	// O(1), O(TILE_CELLS) the first time a tile's cell is changed - Mutator
+	// Purpose: To change the status of a desired location
+	// Pre: The coordinate of the desired cell and its new status
+	// Post: If loc is within the board the status of the cell is changed, its tile given cells of
+	//		 its own first if its shared tile does not hold the status
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	virtual void SetStatus(/*IN*/const Location2DRec& loc,			// The desired cell's coordinate
+						   /*IN*/const StateEnum& newStatus);		// The cells new status
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: To return the size of the board
+	// Pre: N/A
+	// Post: The size of the board will be stored into the incoming rows and columns variables
+	virtual void GetSize(/*OUT*/int& rows,				// The location to store the row size
+						 /*OUT*/int& cols) const;		// The location to store the column size
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: To return the cost of moving into a specified cell
+	// Pre: The coordinate of the desired cell
+	// Post: The cost of the cell is returned, DEFAULT_CELL_COST unless it was changed.
+	//		 Zero is returned if loc is outside the board
+	virtual int GetCost(/*IN*/const Location2DRec& loc) const;		// The desired cell's coordinate
+
+
+
+	// O(1), O(TILE_CELLS) the first time a tile's cell is changed - Mutator
+	// Purpose: To change the cost of moving into a desired location
+	// Pre: The coordinate of the desired cell and its new cost
+	// Post: If loc is within the board and the cost is between DEFAULT_CELL_COST and MAX_CELL_COST
+	//		 the cost of the cell is changed, its tile given cells of its own first if it needs them
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	virtual void SetCost(/*IN*/const Location2DRec& loc,		// The desired cell's coordinate
+						 /*IN*/const int& newCost);			// The cells new cost
+
+
+
+	// O(N^2) - Overloaded Operator
+	// Purpose: To copy any gameboard, keeping only the tiles it needs
+	// Pre: The gameboard to be copied
+	// Post: This board has orig's size and cells, with its own cells only for the tiles
+	//		 that are not all OPEN with the default cost
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	virtual void operator =(/*IN*/const GameBoard& orig);		// The gameboard to be copied
+
+
+
+	// O(N^2) - Overloaded Operator
+	// Purpose: To copy any gameboard, keeping only the tiles it needs
+	// Pre: The gameboard to be copied
+	// Post: This board has orig's size and cells, and orig is left as it was
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	virtual void operator =(/*IN/OUT*/GameBoard&& orig);		// The gameboard to be copied
+
+
+
+	// O(N^2 / TILE_CELLS + T * TILE_CELLS) for T tiles of orig's own - Overloaded Operator
+	// Purpose: To share the shared tiles and copy the tiles of another tiled board's own
+	// Pre: The tiled board to be copied
+	// Post: This board has orig's size and cells, and its own copy of each tile orig has its own
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	void operator =(/*IN*/const TiledBoard& orig);		// The tiled board to be copied
+
+
+
+	// O(T * TILE_CELLS) for T tiles of the board's own - Mutator
+	// Purpose: Give back the cells of every tile that is all OPEN or all WALL
+	// Pre: N/A
+	// Post: Every tile whose cells are all OPEN, or all WALL, with the default cost points at the
+	//		 shared tile again and its cells are returned to the heap
+	virtual void Compact();
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: Return the number of tiles with cells of their own
+	// Pre: N/A
+	// Post: The number of tiles not pointing at a shared tile is returned
+	int GetOwnTileCt() const;
+
+
+
+	// O(1)
+	// Purpose: To return the bytes a tiled board of a size takes before any tile is written
+	// Pre: The number of rows and columns
+	// Post: The bytes of the tile table are returned, as counted in memaccount.h
+	static long long TableBytes(/*IN*/const int& rows,		// The number of rows
+								/*IN*/const int& cols);		// The number of columns
+
+
+
+private:
+	int maxRows;			// The maximum number of rows
+	int maxCols;			// The maximum number of cols
+	int tileRows;			// The number of rows of tiles
+	int tileCols;			// The number of columns of tiles
+	CellRec** tileArr;		// Each tile's cells, row major, the shared tiles' if it has none of its own
+	int ownTileCt;			// The number of tiles with cells of their own
+
+
+
+	// O(N^2 / TILE_CELLS)
+	// Purpose: Point every tile at the shared OPEN tile
+	// Pre: maxRows and maxCols hold the size of the board
+	// Post: The tile table is allocated with every tile shared and OPEN
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	void AllocateTiles();
+
+
+
+	// O(N^2 / TILE_CELLS)
+	// Purpose: Free the tiles of the board's own and the tile table
+	// Pre: N/A
+	// Post: The memory the board is using is returned to the heap and it has no cells
+	void DeAllocateTiles();
+
+
+
+	// O(1), O(TILE_CELLS) if the tile is shared
+	// Purpose: Give a cell's tile cells of its own if it has none
+	// Pre: A cell on the board
+	// Post: The cell's tile has cells of its own, a copy of its shared tile if it had none, and they are returned
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	CellRec* OwnTile(/*IN*/const Location2DRec& loc);		// A cell of the tile
+
+};
+
+
+
+// O(N^2 / TILE_CELLS) for a tiled board, O(N^2) otherwise
+// Purpose: Make a gameboard, tiled if it is big
+// Pre: The number of rows and columns, how the cells are laid out and if they are put on huge pages
+// Post: A new tiled board is returned if a board of the size has TILED_BOARD_CELLS or more,
+//		 otherwise a new z-order board for ORDER_ZORDER or a new gameboard, every cell OPEN
+//		 either way. A tiled board keeps its cells in rows whatever the order, the caller checks
+//		 UsesTiles before asking for ORDER_ZORDER. The caller deletes it
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+GameBoard* NewBoard(/*IN*/const int& rows,						// The number of rows
+					/*IN*/const int& cols,						// The number of columns
+					/*IN*/const CellOrderEnum& cellOrder,		// How the cells are laid out
+					/*IN*/const bool& hugePages);				// Holds if the cells are put on huge pages
+
+
+
+// O(1)
+// Purpose: Check if a board of a size is made tiled
+// Pre: The number of rows and columns
+// Post: true is returned if NewBoard makes a tiled board for the size
+bool UsesTiles(/*IN*/const int& rows,		// The number of rows
+			   /*IN*/const int& cols);		// The number of columns
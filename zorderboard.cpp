@@ -0,0 +1,354 @@
+// Project Maze
+// FileName : zorderboard.cpp
+// Author: Christian Siletti
+// Purpose : This file contains the implementation for all of the methods
+//			 defined in zorderboard.h
+
+#include "zorderboard.h"	// The header file
+#include "memaccount.h"		// For counting the cells' memory
+#include <new>				// Contains the bad_alloc exception and the aligned allocations
+#ifdef __linux__
+#include <sys/mman.h>		// For asking for transparent huge pages
+#endif
+
+using namespace std;	// Standard Namespace
+
+
+const int ZORDER_MASK = ZORDER_SIDE - 1;	// Keeps a coordinate's place within its tile
+
+// A coordinate's bits within its tile spread out to every other bit, so a row's and a column's
+// can be interleaved into the cell's z-order index
+const size_t ZORDER_SPREAD[ZORDER_SIDE] = { 0, 1, 4, 5, 16, 17, 20, 21 };
+
+
+
+// O(1)
+// Purpose: Return the alignment of a board's cells
+// Pre: If huge pages are wanted
+// Post: HUGE_PAGE_BYTES is returned with huge pages, CACHE_LINE_BYTES without
+static size_t CellAlignment(/*IN*/const bool& hugePages)		// Holds if the cells are put on huge pages
+{
+	return hugePages ? (size_t)HUGE_PAGE_BYTES : (size_t)CACHE_LINE_BYTES;
+
+}// end CellAlignment
+
+
+
+// O(N^2) - Non Default Constructor
+// Pre: The desired maximum row and column count, and if huge pages are wanted
+// Post: A z-order board of the size is created, every cell OPEN with the default cost
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+ZOrderBoard::ZOrderBoard(/*IN*/int rows,				// The desired number of rows
+						 /*IN*/int cols,				// The desired number of columns
+						 /*IN*/bool hugePages)			// Holds if the cells are put on huge pages
+	: GameBoard(ZERO, ZERO, false)
+{
+	maxRows = rows;
+	maxCols = cols;
+	this->hugePages = hugePages;
+
+	// Create the cells
+	AllocateCells();
+
+}// end NDC
+
+
+
+// O(N^2) - Copy Constructor
+// Pre: The z-order board to be copied exists
+// Post: A z-order board with the same size, cells and huge pages is created
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+ZOrderBoard::ZOrderBoard(/*IN*/const ZOrderBoard& orig)		// The z-order board to be copied
+	: GameBoard(ZERO, ZERO, false)
+{
+	// Start with no cells so there is nothing for the copy to free
+	maxRows = ZERO;
+	maxCols = ZERO;
+	tileCols = ZERO;
+	hugePages = orig.hugePages;
+	cellArr = nullptr;
+
+	// Copy the board
+	operator=(orig);
+
+}// end CC
+
+
+
+// O(1) - Move Constructor
+// Pre: The z-order board to be moved exists
+// Post: This board holds orig's size and cells, and orig is left with no cells
+ZOrderBoard::ZOrderBoard(/*IN/OUT*/ZOrderBoard&& orig) noexcept		// The z-order board being moved
+	: GameBoard(ZERO, ZERO, false)
+{
+	// Take the cells
+	maxRows = orig.maxRows;
+	maxCols = orig.maxCols;
+	tileCols = orig.tileCols;
+	hugePages = orig.hugePages;
+	cellArr = orig.cellArr;
+
+	// Leave nothing behind to be freed twice
+	orig.maxRows = ZERO;
+	orig.maxCols = ZERO;
+	orig.tileCols = ZERO;
+	orig.cellArr = nullptr;
+
+}// end MC
+
+
+
+// O(1) - Destructor
+// Pre: N/A
+// Post: The board's cells are returned to the heap
+ZOrderBoard::~ZOrderBoard()
+{
+	DeAllocateCells();
+
+}// end Destructor
+
+
+
+// O(1) - Observer Accessor
+// Pre: The coordinate of the desired cell
+// Post: The status of the desired cell is returned.
+//       If loc is outside the bounds of the board the status OUT_OF_BOUNDS will be returned
+StateEnum ZOrderBoard::GetStatus(/*IN*/const Location2DRec& loc) const		// The desired cell's coordinate
+{
+	// Check if the cooridnate is within the bounds of the board
+	if (loc.x >= ZERO && loc.x < maxRows && loc.y >= ZERO && loc.y < maxCols)
+		return cellArr[CellIndex(loc)].status;
+
+	// Otherwise treat the coordinate as a OUT_OF_BOUNDS
+	return OUT_OF_BOUNDS;
+
+}// end GetStatus
+
+
+
+// O(1) - Mutator
+// Pre: The coordinate of the desired cell and its new status
+// Post: If loc is within the board the status of the cell is changed, otherwise nothing occurs
+void ZOrderBoard::SetStatus(/*IN*/const Location2DRec& loc,			// The desired cell's coordinate
+							/*IN*/const StateEnum& newStatus)		// The cells new status
+{
+	// Check if the cooridnate is within the bounds of the board
+	if (loc.x >= ZERO && loc.x < maxRows && loc.y >= ZERO && loc.y < maxCols)
+		cellArr[CellIndex(loc)].status = newStatus;
+
+}// end SetStatus
+
+
+
+// O(1) - Observer Accessor
+// Pre: N/A
+// Post: The size of the board will be stored into the incoming rows and columns variables
+void ZOrderBoard::GetSize(/*OUT*/int& rows,				// The location to store the row size
+						  /*OUT*/int& cols) const		// The location to store the column size
+{
+	rows = maxRows;
+	cols = maxCols;
+
+}// end GetSize
+
+
+
+// O(1) - Observer Accessor
+// Pre: The coordinate of the desired cell
+// Post: The cost of the cell is returned, DEFAULT_CELL_COST unless it was changed.
+//		 Zero is returned if loc is outside the board
+int ZOrderBoard::GetCost(/*IN*/const Location2DRec& loc) const		// The desired cell's coordinate
+{
+	// Check if the cooridnate is within the bounds of the board
+	if (loc.x >= ZERO && loc.x < maxRows && loc.y >= ZERO && loc.y < maxCols)
+		return cellArr[CellIndex(loc)].cost;
+
+	// Otherwise there is no cell to move into
+	return ZERO;
+
+}// end GetCost
+
+
+
+// O(1) - Mutator
+// Pre: The coordinate of the desired cell and its new cost
+// Post: If loc is within the board and the cost is between DEFAULT_CELL_COST and MAX_CELL_COST
+//		 the cost of the cell is changed, otherwise nothing occurs
+void ZOrderBoard::SetCost(/*IN*/const Location2DRec& loc,		// The desired cell's coordinate
+						  /*IN*/const int& newCost)			// The cells new cost
+{
+	// Check if the cooridnate is within the bounds of the board and the cost can be held
+	if (loc.x >= ZERO && loc.x < maxRows && loc.y >= ZERO && loc.y < maxCols &&
+		newCost >= DEFAULT_CELL_COST && newCost <= MAX_CELL_COST)
+		cellArr[CellIndex(loc)].cost = (unsigned char)newCost;
+
+}// end SetCost
+
+
+
+// O(N^2) - Overloaded Operator
+// Pre: The gameboard to be copied
+// Post: This board has orig's size and cells, and keeps its own huge pages setting
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+void ZOrderBoard::operator =(/*IN*/const GameBoard& orig)		// The gameboard to be copied
+{
+	Location2DRec loc;	// The cell being copied
+
+	// A board copied onto itself is already a copy
+	if (this == &orig)
+		return;
+
+	// Delete the current cells and make them again at orig's size
+	DeAllocateCells();
+	orig.GetSize(maxRows, maxCols);
+	AllocateCells();
+
+	// Copy each cells status and cost
+	for (loc.x = ZERO; loc.x < maxRows; loc.x++)
+		for (loc.y = ZERO; loc.y < maxCols; loc.y++)
+		{
+			cellArr[CellIndex(loc)].status = orig.GetStatus(loc);
+			cellArr[CellIndex(loc)].cost = (unsigned char)orig.GetCost(loc);
+		}
+
+}// end operator =
+
+
+
+// O(N^2) - Overloaded Operator
+// Pre: The gameboard to be copied
+// Post: This board has orig's size and cells, and orig is left as it was
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+void ZOrderBoard::operator =(/*IN/OUT*/GameBoard&& orig)		// The gameboard to be copied
+{
+	// The cells are laid out differently, so they are copied into this board's layout
+	operator=((const GameBoard&)orig);
+
+}// end operator =
+
+
+
+// O(N^2) - Overloaded Operator
+// Pre: The z-order board to be copied
+// Post: This board has orig's size, cells and huge pages setting
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+void ZOrderBoard::operator =(/*IN*/const ZOrderBoard& orig)		// The z-order board to be copied
+{
+	size_t cellCt;	// The number of cells kept, whole tiles
+
+	// A board copied onto itself is already a copy
+	if (this == &orig)
+		return;
+
+	DeAllocateCells();
+	maxRows = orig.maxRows;
+	maxCols = orig.maxCols;
+	hugePages = orig.hugePages;
+	AllocateCells();
+
+	// The layouts are the same, so the cells are copied as they are
+	cellCt = (size_t)((maxRows + ZORDER_MASK) >> ZORDER_SHIFT) * tileCols * ZORDER_CELLS;
+	for (size_t i = ZERO; i < cellCt; i++)
+		cellArr[i] = orig.cellArr[i];
+
+}// end operator =
+
+
+
+// O(1)
+// Pre: The number of rows and columns, and if huge pages are wanted
+// Post: The bytes of the cells, rounded up to whole tiles and to whole huge pages
+//		 if they are wanted, are returned, as counted in memaccount.h
+long long ZOrderBoard::BoardBytes(/*IN*/const int& rows,				// The number of rows
+								  /*IN*/const int& cols,				// The number of columns
+								  /*IN*/const bool& hugePages)			// Holds if the cells are put on huge pages
+{
+	long long bytes = (long long)((rows + ZORDER_MASK) >> ZORDER_SHIFT) * ((cols + ZORDER_MASK) >> ZORDER_SHIFT) *
+					  ZORDER_CELLS * sizeof(CellRec);		// The bytes of the whole tiles
+
+	// Huge pages are handed out whole
+	if (hugePages)
+		bytes = (bytes + HUGE_PAGE_BYTES - OFFSET) / HUGE_PAGE_BYTES * HUGE_PAGE_BYTES;
+
+	return bytes;
+
+}// end BoardBytes
+
+
+
+// ============================ PRIVATE METHODS =================================
+
+
+
+// O(N^2)
+// Pre: maxRows, maxCols and hugePages are set
+// Post: cellArr points at the board's cells, every one OPEN with the default cost
+// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+void ZOrderBoard::AllocateCells()
+{
+	long long bytes = BoardBytes(maxRows, maxCols, hugePages);		// The bytes taken from the heap
+	size_t cellCt = (size_t)bytes / sizeof(CellRec);				// The number of cells kept, padding included
+
+	tileCols = (maxCols + ZORDER_MASK) >> ZORDER_SHIFT;
+
+	try
+	{
+		cellArr = (CellRec*)::operator new((size_t)bytes, align_val_t(CellAlignment(hugePages)));
+	}
+	catch (std::bad_alloc)	// The heap space memory has run out
+	{
+		// Throw the exception
+		cellArr = nullptr;
+		maxRows = ZERO;
+		maxCols = ZERO;
+		tileCols = ZERO;
+		throw GBOutOfMemoryException();
+	}
+
+#ifdef __linux__
+	// Ask for huge pages before the cells are first touched, the kernel may say no
+	if (hugePages)
+		madvise(cellArr, (size_t)bytes, MADV_HUGEPAGE);
+#endif
+
+	// Set each cell to OPEN with the default cost
+	for (size_t i = ZERO; i < cellCt; i++)
+	{
+		cellArr[i].status = OPEN;
+		cellArr[i].cost = (unsigned char)DEFAULT_CELL_COST;
+	}
+
+	// Count the memory taken
+	MemAdd(MEM_BOARD, bytes);
+
+}// end AllocateCells
+
+
+
+// O(1)
+// Pre: N/A
+// Post: The cells are freed and the board has none, nothing happens if it had none
+void ZOrderBoard::DeAllocateCells()
+{
+	// A board moved from has nothing to free
+	if (cellArr == nullptr)
+		return;
+
+	::operator delete(cellArr, align_val_t(CellAlignment(hugePages)));
+	MemRelease(MEM_BOARD, BoardBytes(maxRows, maxCols, hugePages));
+	cellArr = nullptr;
+
+}// end DeAllocateCells
+
+
+
+// O(1)
+// Pre: A cell on the board
+// Post: The index of the cell in cellArr is returned
+size_t ZOrderBoard::CellIndex(/*IN*/const Location2DRec& loc) const		// The cell's coordinate
+{
+	size_t tile = (size_t)(loc.x >> ZORDER_SHIFT) * tileCols + (loc.y >> ZORDER_SHIFT);	// The cell's tile
+
+	return (tile << (ZORDER_SHIFT * 2)) | (ZORDER_SPREAD[loc.x & ZORDER_MASK] << OFFSET) | ZORDER_SPREAD[loc.y & ZORDER_MASK];
+
+}// end CellIndex
@@ -0,0 +1,258 @@
+#pragma once
+/*
+	FileName : zorderboard.h
+	Author: Christian Siletti
+	Date: 5/12/24
+	Project Maze
+
+	PURPOSE:
+		Contains the specifications for a ZOrderBoard Class. A z-order board is a gameboard whose
+		cells are laid out for the search instead of a row at a time. On a gameboard a cell's
+		neighbours to the north and south are a whole row away, so on a wide board every
+		NORTH/SOUTH step of the search reads another cache line, and often another page.
+
+		A z-order board keeps its cells in one block of memory, in square tiles of ZORDER_SIDE by
+		ZORDER_SIDE cells laid out a row of tiles at a time. Within a tile the cells are in
+		z-order (Morton order), a cell's index being its row and column bits interleaved, so
+		a tile's 64 cells take two cache lines and the four neighbours of most cells are in
+		the same line or the next one.
+
+		With huge pages the block is aligned to and rounded up to HUGE_PAGE_BYTES, and on Linux
+		the kernel is asked to back it with transparent huge pages, so a search of a big board
+		misses the TLB less often. Elsewhere the block is only aligned.
+
+
+	ASSUMPTIONS:
+		1) Huge pages are a hint, a board the kernel backs with small pages works the same
+		2) The board's memory is counted as the board's (see memaccount.h), huge page padding included
+
+
+	EXCEPTION HANDLING/ERROR CHECKING:
+		1) If an invalid location is sent into GetStatus a OUT_OF_BOUNDS status will be returned.
+		2) If an invalid location is sent into SetStatus the status of the location will not change,
+		   the program will move on.
+		3) GetCost returns zero for a location outside the board, and SetCost ignores a cost
+		   outside DEFAULT_CELL_COST to MAX_CELL_COST
+		4) GBOutOfMemoryException thrown when memory from the heap has run out
+
+
+						   SUMMARY OF METHODS:
+	PUBLIC METHODS
+		ZOrderBoard(*IN*int rows,				// The desired number of rows
+					*IN*int cols,				// The desired number of columns
+					*IN*bool hugePages)			// Holds if the cells are put on huge pages
+					- Instantiate a z-order board with every cell OPEN
+		ZOrderBoard(*IN*const ZOrderBoard& orig)		// The z-order board to be copied
+					- Performs a deep copy of another z-order board
+		ZOrderBoard(*IN/OUT*ZOrderBoard&& orig)		// The z-order board being moved
+					- Take over another z-order board's cells
+		~ZOrderBoard() - Free the board's cells
+		virtual StateEnum GetStatus(*IN*const Location2DRec& loc) const	// The desired cell's coordinate
+					- To return the status of a specified cell
+		virtual void SetStatus(*IN*const Location2DRec& loc,		// The desired cell's coordinate
+							   *IN*const StateEnum& newStatus)		// The cells new status
+					- To change the status of a desired location
+		virtual void GetSize(*OUT*int& rows,			// The location to store the row size
+							 *OUT*int& cols) const		// The location to store the column size
+					- To return the size of the board
+		virtual int GetCost(*IN*const Location2DRec& loc) const	// The desired cell's coordinate
+					- To return the cost of moving into a specified cell
+		virtual void SetCost(*IN*const Location2DRec& loc,		// The desired cell's coordinate
+							 *IN*const int& newCost)			// The cells new cost
+					- To change the cost of moving into a desired location
+		virtual void operator =(*IN*const GameBoard& orig)		// The gameboard to be copied
+					- To copy any gameboard into the z-order layout
+		virtual void operator =(*IN/OUT*GameBoard&& orig)		// The gameboard to be copied
+					- To copy any gameboard into the z-order layout
+		void operator =(*IN*const ZOrderBoard& orig)			// The z-order board to be copied
+					- To create a deep copy of another z-order board
+		static long long BoardBytes(*IN*const int& rows,			// The number of rows
+									*IN*const int& cols,			// The number of columns
+									*IN*const bool& hugePages)		// Holds if the cells are put on huge pages
+					- To return the bytes a z-order board of a size takes from the heap
+
+	PRIVATE MEMBERS:
+		int maxRows;			// The maximum number of rows
+		int maxCols;			// The maximum number of cols
+		int tileCols;			// The number of columns of tiles
+		bool hugePages;			// Holds if the cells are put on huge pages
+		CellRec* cellArr;		// Every cell, a tile at a time, in z-order within each tile
+
+	PRIVATE METHODS:
+		void AllocateCells() - Allocate and open every cell of the board
+		void DeAllocateCells() - Return the board's cells to the heap
+		size_t CellIndex(*IN*const Location2DRec& loc) const		// The cell's coordinate
+					- Return where a cell is kept
+*/
+
+#include "gameboard.h"		// Allows access to the gameboard ADT
+#include "spscring.h"		// For the size of a cache line, which the cells are aligned to
+#include <cstddef>			// For the cells' indexes
+
+using namespace std;    // Standard namespace
+
+
+const int ZORDER_SHIFT = 3;									// A tile is 2^ZORDER_SHIFT cells on a side
+const int ZORDER_SIDE = 1 << ZORDER_SHIFT;					// The number of cells on a side of a tile
+const int ZORDER_CELLS = ZORDER_SIDE * ZORDER_SIDE;			// The number of cells in a tile
+const long long HUGE_PAGE_BYTES = 2LL * 1024 * 1024;		// The size of a huge page
+
+
+
+class ZOrderBoard : public GameBoard
+{
+public:
+
+	// O(N^2) - Non Default Constructor
+	// Purpose: Instantiate a z-order board with every cell OPEN
+	// Pre: The desired maximum row and column count, and if huge pages are wanted
+	// Post: A z-order board of the size is created, every cell OPEN with the default cost
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	ZOrderBoard(/*IN*/int rows,					// The desired number of rows
+				/*IN*/int cols,					// The desired number of columns
+				/*IN*/bool hugePages);			// Holds if the cells are put on huge pages
+
+
+
+	// O(N^2) - Copy Constructor
+	// Purpose: Performs a deep copy of another z-order board
+	// Pre: The z-order board to be copied exists
+	// Post: A z-order board with the same size, cells and huge pages is created
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	ZOrderBoard(/*IN*/const ZOrderBoard& orig);		// The z-order board to be copied
+
+
+
+	// O(1) - Move Constructor
+	// Purpose: Take over another z-order board's cells
+	// Pre: The z-order board to be moved exists
+	// Post: This board holds orig's size and cells, and orig is left with no cells
+	ZOrderBoard(/*IN/OUT*/ZOrderBoard&& orig) noexcept;		// The z-order board being moved
+
+
+
+	// O(1) - Destructor
+	// Purpose: Free the board's cells
+	// Pre: N/A
+	// Post: The board's cells are returned to the heap
+	~ZOrderBoard();
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: To return the status of a specified cell
+	// Pre: The coordinate of the desired cell
+	// Post: The status of the desired cell is returned.
+	//       If loc is outside the bounds of the board the status OUT_OF_BOUNDS will be returned
+	virtual StateEnum GetStatus(/*IN*/const Location2DRec& loc) const;		// The desired cell's coordinate
+
+
+
+	// O(1) - Mutator
+	// Purpose: To change the status of a desired location
+	// Pre: The coordinate of the desired cell and its new status
+	// Post: If loc is within the board the status of the cell is changed, otherwise nothing occurs
+	virtual void SetStatus(/*IN*/const Location2DRec& loc,			// The desired cell's coordinate
+						   /*IN*/const StateEnum& newStatus);		// The cells new status
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: To return the size of the board
+	// Pre: N/A
+	// Post: The size of the board will be stored into the incoming rows and columns variables
+	virtual void GetSize(/*OUT*/int& rows,				// The location to store the row size
+						 /*OUT*/int& cols) const;		// The location to store the column size
+
+
+
+	// O(1) - Observer Accessor
+	// Purpose: To return the cost of moving into a specified cell
+	// Pre: The coordinate of the desired cell
+	// Post: The cost of the cell is returned, DEFAULT_CELL_COST unless it was changed.
+	//		 Zero is returned if loc is outside the board
+	virtual int GetCost(/*IN*/const Location2DRec& loc) const;		// The desired cell's coordinate
+
+
+
+	// O(1) - Mutator
+	// Purpose: To change the cost of moving into a desired location
+	// Pre: The coordinate of the desired cell and its new cost
+	// Post: If loc is within the board and the cost is between DEFAULT_CELL_COST and MAX_CELL_COST
+	//		 the cost of the cell is changed, otherwise nothing occurs
+	virtual void SetCost(/*IN*/const Location2DRec& loc,		// The desired cell's coordinate
+						 /*IN*/const int& newCost);			// The cells new cost
+
+
+
+	// O(N^2) - Overloaded Operator
+	// Purpose: To copy any gameboard into the z-order layout
+	// Pre: The gameboard to be copied
+	// Post: This board has orig's size and cells, and keeps its own huge pages setting
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	virtual void operator =(/*IN*/const GameBoard& orig);		// The gameboard to be copied
+
+
+
+	// O(N^2) - Overloaded Operator
+	// Purpose: To copy any gameboard into the z-order layout
+	// Pre: The gameboard to be copied
+	// Post: This board has orig's size and cells, and orig is left as it was
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	virtual void operator =(/*IN/OUT*/GameBoard&& orig);		// The gameboard to be copied
+
+
+
+	// O(N^2) - Overloaded Operator
+	// Purpose: To create a deep copy of another z-order board
+	// Pre: The z-order board to be copied
+	// Post: This board has orig's size, cells and huge pages setting
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	void operator =(/*IN*/const ZOrderBoard& orig);		// The z-order board to be copied
+
+
+
+	// O(1)
+	// Purpose: To return the bytes a z-order board of a size takes from the heap
+	// Pre: The number of rows and columns, and if huge pages are wanted
+	// Post: The bytes of the cells, rounded up to whole tiles and to whole huge pages
+	//		 if they are wanted, are returned, as counted in memaccount.h
+	static long long BoardBytes(/*IN*/const int& rows,				// The number of rows
+								/*IN*/const int& cols,				// The number of columns
+								/*IN*/const bool& hugePages);		// Holds if the cells are put on huge pages
+
+
+
+private:
+	int maxRows;			// The maximum number of rows
+	int maxCols;			// The maximum number of cols
+	int tileCols;			// The number of columns of tiles
+	bool hugePages;			// Holds if the cells are put on huge pages
+	CellRec* cellArr;		// Every cell, a tile at a time, in z-order within each tile
+
+
+
+	// O(N^2)
+	// Purpose: Allocate and open every cell of the board
+	// Pre: maxRows, maxCols and hugePages are set
+	// Post: cellArr points at the board's cells, every one OPEN with the default cost
+	// Exceptions: GBOutOfMemoryException will be thrown if the heap runs out of memory
+	void AllocateCells();
+
+
+
+	// O(1)
+	// Purpose: Return the board's cells to the heap
+	// Pre: N/A
+	// Post: The cells are freed and the board has none, nothing happens if it had none
+	void DeAllocateCells();
+
+
+
+	// O(1)
+	// Purpose: Return where a cell is kept
+	// Pre: A cell on the board
+	// Post: The index of the cell in cellArr is returned
+	size_t CellIndex(/*IN*/const Location2DRec& loc) const;		// The cell's coordinate
+
+};